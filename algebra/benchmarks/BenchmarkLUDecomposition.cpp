@@ -0,0 +1,136 @@
+#include "algebra/LUDecomposition.hpp"
+#include "algebra/MultiplicationLarge.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+using LCNS::Algebra::lu_factorize;
+using LCNS::Algebra::lu_solve;
+using LCNS::Algebra::multiply_blocked;
+
+using namespace std;
+
+namespace
+{
+    constexpr int repetition_count = 3;
+
+    /*
+     * Best time in seconds of repetition_count runs of function, setup being called before each run and not timed
+     */
+    template <typename Setup, typename Function>
+    double best_time(const Setup& setup, const Function& function)
+    {
+        double result = numeric_limits<double>::max();
+
+        for (int i = 0; i < repetition_count; ++i)
+        {
+            setup();
+
+            const auto start = chrono::steady_clock::now();
+            function();
+            const auto stop = chrono::steady_clock::now();
+
+            result = min(result, chrono::duration<double>(stop - start).count());
+        }
+
+        return result;
+    }
+
+    void report(const string& name, double flop_count, double seconds, double peak_gflops)
+    {
+        const double gflops = flop_count / seconds * 1e-9;
+
+        cout << "    " << left << setw(34) << name << right << fixed << setprecision(3) << setw(10) << seconds * 1e3 << " ms"
+             << setprecision(1) << setw(10) << gflops << " GFLOPS" << setw(8) << 100.0 * gflops / peak_gflops << " % of the multiply\n";
+    }
+
+    /*
+     * GFLOPS of the decomposition and of the solves of a random n x n system, compared with the multiplication of two
+     * n x n matrices by the same blocked kernel
+     */
+    template <typename T>
+    void benchmark_lu(size_t n)
+    {
+        cout << "CTEST_FULL_OUTPUT\n";
+        cout << "LU decomposition of " << n << " x " << n << (is_same_v<T, float> ? " floats" : " doubles") << '\n';
+
+        mt19937                      gen(static_cast<unsigned int>(n));
+        uniform_real_distribution<T> dis(-1, 1);
+
+        vector<T> mat(n * n);
+        vector<T> rhs(n * n);
+        generate(mat.begin(), mat.end(), [&]() { return dis(gen); });
+        generate(rhs.begin(), rhs.end(), [&]() { return dis(gen); });
+
+        const double cube = static_cast<double>(n) * static_cast<double>(n) * static_cast<double>(n);
+
+        // Multiplication peak
+        vector<T> product(n * n);
+
+        const double multiply_time = best_time([]() {}, [&]() { multiply_blocked<T>(n, n, n, mat, rhs, product); });
+        const double peak_gflops   = 2.0 * cube / multiply_time * 1e-9;
+
+        report("Blocked multiplication", 2.0 * cube, multiply_time, peak_gflops);
+
+        // Decomposition
+        vector<T>            lu(n * n);
+        vector<unsigned int> pivots(n);
+        bool                 regular = false;
+
+        const double lu_time = best_time([&]() { lu = mat; }, [&]() { regular = lu_factorize<T>(lu, pivots); });
+
+        REQUIRE(regular);
+        report("Decomposition", 2.0 * cube / 3.0, lu_time, peak_gflops);
+
+        // Solves
+        for (const size_t rhs_cols : { size_t{1}, size_t{64}, n })
+        {
+            vector<T> x(n * rhs_cols);
+
+            const double solve_time = best_time([&]() { copy(rhs.begin(), rhs.begin() + static_cast<ptrdiff_t>(n * rhs_cols), x.begin()); },
+                                                [&]() { lu_solve<T>(lu, pivots, x, rhs_cols); });
+
+            report("Solve with " + to_string(rhs_cols) + " right hand sides", 2.0 * static_cast<double>(n) * static_cast<double>(n) * static_cast<double>(rhs_cols), solve_time, peak_gflops);
+
+            // Relative residual of the first system
+            double residual = 0.0;
+            double norm     = 0.0;
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                double value = 0.0;
+
+                for (size_t k = 0; k < n; ++k)
+                {
+                    value += static_cast<double>(mat[i * n + k]) * static_cast<double>(x[k * rhs_cols]);
+                }
+
+                residual = max(residual, abs(value - static_cast<double>(rhs[i * rhs_cols])));
+                norm     = max(norm, abs(static_cast<double>(rhs[i * rhs_cols])));
+            }
+
+            CHECK(residual / norm < static_cast<double>(n) * 1e3 * numeric_limits<T>::epsilon());
+        }
+    }
+}  // namespace
+
+
+TEMPLATE_TEST_CASE("LU decomposition 2048", "[benchmark][lu][2048]", float, double)
+{
+    benchmark_lu<TestType>(2048);
+}
+
+TEMPLATE_TEST_CASE("LU decomposition 4096", "[benchmark][lu][4096]", float, double)
+{
+    benchmark_lu<TestType>(4096);
+}
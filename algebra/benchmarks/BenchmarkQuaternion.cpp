@@ -0,0 +1,364 @@
+#include "algebra/MappingFunctions.hpp"
+#include "algebra/Quaternion.hpp"
+#include "algebra/QuaternionArray.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <iostream>
+#include <random>
+#include <span>
+#include <vector>
+
+using LCNS::Algebra::EulerAnglesAsQuaternion;
+using LCNS::Algebra::Quaternion;
+using LCNS::Algebra::QuaternionArray;
+
+using Catch::Matchers::WithinAbs;
+
+using namespace std;
+
+class BenchmarkFixture
+{
+public:
+    BenchmarkFixture()
+    : _gen(_rd())
+    {
+        cout << "CTEST_FULL_OUTPUT\n";
+    }
+
+    vector<Quaternion<float>> get_randomly_initialized(size_t count)
+    {
+        uniform_real_distribution<float> dis(-1.0f, 1.0f);
+        vector<Quaternion<float>>        result(count);
+
+        for (auto& quat : result)
+        {
+            quat = Quaternion<float>(dis(_gen), dis(_gen), dis(_gen), dis(_gen)).normalized();
+        }
+
+        return result;
+    }
+
+    void perform_random_checks(const vector<Quaternion<float>>& lhs, const vector<Quaternion<float>>& rhs, size_t test_count = 100)
+    {
+        uniform_int_distribution<size_t> dis(0, lhs.size() - 1);
+
+        for (size_t i = 0; i < test_count; ++i)
+        {
+            const auto index = dis(_gen);
+
+            for (unsigned int k = 0; k < 4; ++k)
+            {
+                CHECK_THAT(lhs[index][k], WithinAbs(rhs[index][k], 1e-5));
+            }
+        }
+    }
+
+private:
+    random_device _rd;
+    mt19937       _gen;
+};
+
+namespace
+{
+    // The scalar implementation of Quaternion::operator*, as a reference
+    Quaternion<float> scalar_hamilton_product(const Quaternion<float>& lhs, const Quaternion<float>& rhs)
+    {
+        const float x = lhs.w() * rhs.x() + lhs.x() * rhs.w() + lhs.y() * rhs.z() - lhs.z() * rhs.y();
+        const float y = lhs.w() * rhs.y() - lhs.x() * rhs.z() + lhs.y() * rhs.w() + lhs.z() * rhs.x();
+        const float z = lhs.w() * rhs.z() + lhs.x() * rhs.y() - lhs.y() * rhs.x() + lhs.z() * rhs.w();
+        const float w = lhs.w() * rhs.w() - lhs.x() * rhs.x() - lhs.y() * rhs.y() - lhs.z() * rhs.z();
+
+        return { x, y, z, w };
+    }
+}  // namespace
+
+
+TEST_CASE_METHOD(BenchmarkFixture, "Hamilton product of 10M quaternions", "[benchmark][quaternion][multiplication]")
+{
+    constexpr size_t quaternion_count = 10'000'000;
+
+    const auto lhs = get_randomly_initialized(quaternion_count);
+    const auto rhs = get_randomly_initialized(quaternion_count);
+
+    vector<Quaternion<float>> res1(quaternion_count);
+    BENCHMARK("Scalar Hamilton product")
+    {
+        for (size_t i = 0; i < quaternion_count; ++i)
+        {
+            res1[i] = scalar_hamilton_product(lhs[i], rhs[i]);
+        }
+
+        return 0;
+    };
+
+    vector<Quaternion<float>> res2(quaternion_count);
+    BENCHMARK("Quaternion::operator*")
+    {
+        for (size_t i = 0; i < quaternion_count; ++i)
+        {
+            res2[i] = lhs[i] * rhs[i];
+        }
+
+        return 0;
+    };
+    perform_random_checks(res1, res2);
+
+    const QuaternionArray<float> lhs_array(lhs);
+    const QuaternionArray<float> rhs_array(rhs);
+    QuaternionArray<float>       res3(quaternion_count);
+    BENCHMARK("Batched Hamilton product of quaternion arrays")
+    {
+        multiply(lhs_array, rhs_array, res3);
+
+        return 0;
+    };
+    perform_random_checks(res1, res3.toQuaternions());
+}
+
+
+TEST_CASE_METHOD(BenchmarkFixture, "Hamilton product of 4096 quaternions", "[benchmark][quaternion][multiplication]")
+{
+    // Small enough to stay in the L1/L2 caches: measures the computation rather than the memory bandwidth
+    constexpr size_t quaternion_count = 4096;
+
+    const auto lhs = get_randomly_initialized(quaternion_count);
+    const auto rhs = get_randomly_initialized(quaternion_count);
+
+    vector<Quaternion<float>> res1(quaternion_count);
+    BENCHMARK("Scalar Hamilton product")
+    {
+        for (size_t i = 0; i < quaternion_count; ++i)
+        {
+            res1[i] = scalar_hamilton_product(lhs[i], rhs[i]);
+        }
+
+        return res1.back().w();
+    };
+
+    vector<Quaternion<float>> res2(quaternion_count);
+    BENCHMARK("Quaternion::operator*")
+    {
+        for (size_t i = 0; i < quaternion_count; ++i)
+        {
+            res2[i] = lhs[i] * rhs[i];
+        }
+
+        return res2.back().w();
+    };
+    perform_random_checks(res1, res2);
+
+    const QuaternionArray<float> lhs_array(lhs);
+    const QuaternionArray<float> rhs_array(rhs);
+    QuaternionArray<float>       res3(quaternion_count);
+    BENCHMARK("Batched Hamilton product of quaternion arrays")
+    {
+        multiply(lhs_array, rhs_array, res3);
+
+        return res3.lane(3)[0];
+    };
+    perform_random_checks(res1, res3.toQuaternions());
+}
+
+
+TEST_CASE_METHOD(BenchmarkFixture, "Slerp of 4096 pairs of quaternions", "[benchmark][quaternion][interpolation]")
+{
+    constexpr size_t quaternion_count = 4096;
+
+    const auto from = get_randomly_initialized(quaternion_count);
+    const auto to   = get_randomly_initialized(quaternion_count);
+
+    vector<float> weights(quaternion_count);
+    for (size_t i = 0; i < quaternion_count; ++i)
+    {
+        weights[i] = static_cast<float>(i) / static_cast<float>(quaternion_count);
+    }
+
+    vector<Quaternion<float>> res1(quaternion_count);
+    BENCHMARK("Scalar slerp")
+    {
+        for (size_t i = 0; i < quaternion_count; ++i)
+        {
+            res1[i] = slerp(from[i], to[i], weights[i]);
+        }
+
+        return res1.back().w();
+    };
+
+    const QuaternionArray<float> from_array(from);
+    const QuaternionArray<float> to_array(to);
+    QuaternionArray<float>       res2(quaternion_count);
+    BENCHMARK("Batched slerp, polynomial approximations")
+    {
+        slerp(from_array, to_array, weights, res2);
+
+        return res2.lane(3)[0];
+    };
+    perform_random_checks(res1, res2.toQuaternions());
+
+    QuaternionArray<float> res3(quaternion_count);
+    BENCHMARK("Batched nlerp")
+    {
+        nlerp(from_array, to_array, weights, res3);
+
+        return res3.lane(3)[0];
+    };
+}
+
+
+TEST_CASE_METHOD(BenchmarkFixture, "Normalization of 4096 quaternions", "[benchmark][quaternion][normalization]")
+{
+    constexpr size_t quaternion_count = 4096;
+
+    auto quaternions = get_randomly_initialized(quaternion_count);
+    for (auto& quat : quaternions)
+    {
+        quat *= 3.0f;
+    }
+
+    // Normalizing again the normalized quaternions costs the same, the benchmarks work in place
+    vector<Quaternion<float>> res1(quaternions);
+    BENCHMARK("Scalar normalize")
+    {
+        for (auto& quat : res1)
+        {
+            quat.normalize();
+        }
+
+        return res1.back().w();
+    };
+
+    vector<Quaternion<float>> res2(quaternions);
+    BENCHMARK("Scalar normalize, rsqrt estimate and one Newton step")
+    {
+        for (auto& quat : res2)
+        {
+            quat.normalize(LCNS::Algebra::Precision::Fast);
+        }
+
+        return res2.back().w();
+    };
+    perform_random_checks(res1, res2);
+
+    QuaternionArray<float> res3(quaternions);
+    BENCHMARK("Batched normalize")
+    {
+        normalize(res3);
+
+        return res3.lane(3)[0];
+    };
+    perform_random_checks(res1, res3.toQuaternions());
+
+    QuaternionArray<float> res4(quaternions);
+    BENCHMARK("Batched normalize, rsqrt estimate and one Newton step")
+    {
+        normalize(res4, LCNS::Algebra::Precision::Fast);
+
+        return res4.lane(3)[0];
+    };
+    perform_random_checks(res1, res4.toQuaternions());
+}
+
+TEST_CASE_METHOD(BenchmarkFixture, "Conversion of 4096 rotation matrices to quaternions", "[benchmark][quaternion][conversion]")
+{
+    using LCNS::Algebra::Matrix;
+
+    constexpr size_t quaternion_count = 4096;
+
+    const auto rotations = get_randomly_initialized(quaternion_count);
+
+    vector<Matrix<float, 3, 3>> matrices(quaternion_count);
+    for (size_t i = 0; i < quaternion_count; ++i)
+    {
+        matrices[i] = QuaternionAsRotationMatrix(rotations[i]);
+    }
+
+    vector<Quaternion<float>> res1(quaternion_count);
+    BENCHMARK("Through the Euler angles")
+    {
+        for (size_t i = 0; i < quaternion_count; ++i)
+        {
+            const auto [psi, theta, phi] = EulerAnglesFromRotationMatrix(matrices[i]);
+
+            res1[i] = EulerAnglesAsQuaternion(static_cast<float>(psi), static_cast<float>(theta), static_cast<float>(phi));
+            if (res1[i].w() < 0)
+            {
+                res1[i] = res1[i] * -1.0f;
+            }
+        }
+
+        return res1.back().w();
+    };
+
+    vector<Quaternion<float>> res2(quaternion_count);
+    BENCHMARK("Shepperd's method")
+    {
+        for (size_t i = 0; i < quaternion_count; ++i)
+        {
+            res2[i] = RotationMatrixAsQuaternion(matrices[i]);
+        }
+
+        return res2.back().w();
+    };
+    perform_random_checks(res1, res2);
+
+    QuaternionArray<float> res3(quaternion_count);
+    BENCHMARK("Batched Shepperd's method")
+    {
+        RotationMatricesAsQuaternions(span<const Matrix<float, 3, 3>>(matrices), res3);
+
+        return res3.lane(3)[0];
+    };
+    perform_random_checks(res1, res3.toQuaternions());
+
+    vector<Matrix<float, 3, 3>> res4(quaternion_count);
+    BENCHMARK("Batched quaternions to matrices")
+    {
+        QuaternionsAsRotationMatrices(res3, span(res4));
+
+        return res4.back()(0, 0);
+    };
+}
+
+
+TEST_CASE_METHOD(BenchmarkFixture, "Conversion of 4096 rotation matrices to Euler angles and back", "[benchmark][quaternion][conversion]")
+{
+    using LCNS::Algebra::Matrix;
+    using LCNS::Algebra::VectorArray;
+
+    constexpr size_t quaternion_count = 4096;
+
+    const auto rotations = get_randomly_initialized(quaternion_count);
+
+    vector<Matrix<float, 3, 3>> matrices(quaternion_count);
+    for (size_t i = 0; i < quaternion_count; ++i)
+    {
+        matrices[i] = QuaternionAsRotationMatrix(rotations[i]);
+    }
+
+    vector<Quaternion<float>> res1(quaternion_count);
+    BENCHMARK("Standard library, one matrix at a time")
+    {
+        for (size_t i = 0; i < quaternion_count; ++i)
+        {
+            const auto [psi, theta, phi] = EulerAnglesFromRotationMatrix(matrices[i]);
+
+            res1[i] = EulerAnglesAsQuaternion(static_cast<float>(psi), static_cast<float>(theta), static_cast<float>(phi));
+        }
+
+        return res1.back().w();
+    };
+
+    VectorArray<float, 3>  angles(quaternion_count);
+    QuaternionArray<float> res2(quaternion_count);
+    BENCHMARK("Batched with the vectorized math functions")
+    {
+        EulerAnglesFromRotationMatrices(span<const Matrix<float, 3, 3>>(matrices), angles);
+        EulerAnglesAsQuaternions(angles, res2);
+
+        return res2.lane(3)[0];
+    };
+    perform_random_checks(res1, res2.toQuaternions());
+}
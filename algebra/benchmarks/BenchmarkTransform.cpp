@@ -0,0 +1,116 @@
+#include "algebra/Matrix.hpp"
+#include "algebra/Transform.hpp"
+#include "algebra/VectorArray.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+using LCNS::Algebra::Matrix;
+using LCNS::Algebra::Vector;
+using LCNS::Algebra::VectorArray;
+using LCNS::Algebra::transform_directions;
+using LCNS::Algebra::transform_points;
+
+using Catch::Matchers::WithinAbs;
+
+using namespace std;
+
+class BenchmarkFixture
+{
+public:
+    BenchmarkFixture()
+    : _gen(_rd())
+    {
+        cout << "CTEST_FULL_OUTPUT\n";
+    }
+
+    vector<Vector<float, 3>> get_randomly_initialized(size_t count)
+    {
+        uniform_real_distribution<float> dis(-100.0f, 100.0f);
+        vector<Vector<float, 3>>         result(count);
+
+        for (auto& point : result)
+        {
+            point = Vector<float, 3>(dis(_gen), dis(_gen), dis(_gen));
+        }
+
+        return result;
+    }
+
+    void perform_random_checks(const vector<Vector<float, 3>>& lhs, const vector<Vector<float, 3>>& rhs, size_t test_count = 100)
+    {
+        uniform_int_distribution<size_t> dis(0, lhs.size() - 1);
+
+        for (size_t i = 0; i < test_count; ++i)
+        {
+            const auto index = dis(_gen);
+
+            for (unsigned int k = 0; k < 3; ++k)
+            {
+                CHECK_THAT(lhs[index][k], WithinAbs(rhs[index][k], 1e-2));
+            }
+        }
+    }
+
+private:
+    random_device _rd;
+    mt19937       _gen;
+};
+
+
+TEST_CASE_METHOD(BenchmarkFixture, "Transform 10M points", "[benchmark][transform]")
+{
+    constexpr size_t point_count = 10'000'000;
+
+    // clang-format off
+    const Matrix<float, 4, 4> matrix({ 0.5f, -1.0f,  2.0f,  3.0f,
+                                       1.5f,  0.2f, -0.7f, -4.0f,
+                                      -0.3f,  0.8f,  1.1f, 10.0f,
+                                       0.0f,  0.0f,  0.0f,  1.0f});
+    // clang-format on
+
+    const auto points = get_randomly_initialized(point_count);
+
+    vector<Vector<float, 3>> res1(point_count);
+    BENCHMARK("One matrix vector product per point")
+    {
+        for (size_t i = 0; i < point_count; ++i)
+        {
+            const auto transformed = matrix * Vector<float, 4>(points[i].x(), points[i].y(), points[i].z(), 1.0f);
+            res1[i]                = Vector<float, 3>(transformed.x(), transformed.y(), transformed.z());
+        }
+
+        return 0;
+    };
+
+    vector<Vector<float, 3>> res2(point_count);
+    BENCHMARK("Batched transform of an array of structures")
+    {
+        transform_points(matrix, points, res2);
+
+        return 0;
+    };
+    perform_random_checks(res1, res2);
+
+    const VectorArray<float, 3> array(points);
+    VectorArray<float, 3>       res3(point_count);
+    BENCHMARK("Batched transform of a structure of arrays")
+    {
+        transform_points(matrix, array, res3);
+
+        return 0;
+    };
+    perform_random_checks(res1, res3.toVectors());
+
+    BENCHMARK("Batched transform of a structure of arrays in place")
+    {
+        transform_directions(matrix, res3);
+
+        return 0;
+    };
+}
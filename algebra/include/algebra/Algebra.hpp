@@ -1,9 +1,19 @@
 #pragma once
 
 #include "algebra/Vector.hpp"
+#include "algebra/VectorArray.hpp"
+#include "algebra/VectorKernels.hpp"
 #include "algebra/Matrix.hpp"
 #include "algebra/Quaternion.hpp"
+#include "algebra/QuaternionArray.hpp"
 #include "algebra/MappingFunctions.hpp"
+#include "algebra/EigenDecomposition.hpp"
+#include "algebra/SingularValueDecomposition.hpp"
+#include "algebra/IterativeSolvers.hpp"
+#include "algebra/MatrixFile.hpp"
+#include "algebra/MatrixFunctions.hpp"
+#include "algebra/MatrixView.hpp"
+#include "algebra/Transform.hpp"
 
 using vec1i = LCNS::Algebra::Vector<int, 1>;
 using vec1u = LCNS::Algebra::Vector<unsigned int, 1>;
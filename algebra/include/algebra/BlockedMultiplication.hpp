@@ -0,0 +1,378 @@
+#pragma once
+
+#include "algebra/Concurrency.hpp"
+#include "algebra/Internal.hpp"
+#include "algebra/Simd.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+/*
+ * Blocked product of sub-matrices stored row by row with a leading dimension (the distance between two rows), so that
+ * the blocks of a larger matrix can be updated in place: C += alpha * A * B.
+ *
+ * C is split in tiles of multiply_tile_height rows and multiply_block_width columns, the tiles being distributed
+ * between threads. Each thread walks B by blocks of multiply_block_depth rows, small enough to stay in the L2 cache
+ * while the rows of A stream through it, and accumulates 6 rows by 2 SIMD registers of C at a time so that each load
+ * of B feeds 6 fused multiply-adds and each broadcast of A feeds 2.
+ */
+
+namespace LCNS::Algebra
+{
+    namespace ImplementationDetails
+    {
+        // NOLINTBEGIN(readability-identifier-length)
+
+        /*!
+         * @brief Depth (along the common dimension) and width (along the columns of B) of the blocks of B
+         */
+        constexpr size_t multiply_block_depth = 128;
+        constexpr size_t multiply_block_width = 512;
+
+        /*!
+         * @brief Number of rows of the tiles of C distributed between threads
+         */
+        constexpr size_t multiply_tile_height = 64;
+
+        /*!
+         * @brief Number of rows of C updated at once by the micro kernel: with 2 registers per row, 12 accumulators
+         *        plus 2 registers of B and a broadcast of A fit in the 16 registers of AVX2
+         */
+        constexpr size_t multiply_micro_kernel_rows = 6;
+
+        /*!
+         * @brief Number of multiply-adds under which the blocked kernels stay on the calling thread
+         */
+        constexpr size_t multiply_concurrency_work = size_t{1} << 21;
+
+        /*!
+         * @brief Threshold argument of for_each_chunk_concurrently for a task of count elements doing work multiply-adds
+         *        in total: the task is split between threads only when it is worth it
+         */
+        constexpr size_t concurrency_threshold_for_work(size_t count, size_t work)
+        {
+            return work >= multiply_concurrency_work ? 0 : count + 1;
+        }
+
+        /*!
+         * @brief C[0..row_count[ [0..pack_count * simd::width[ += alpha * A * B[..][0..pack_count * simd::width[, A being
+         *        read transposed, A(i, k) = a[k * lda + i], if transpose_a is true
+         */
+        template <size_t row_count, size_t pack_count, Coordinate coordinate, typename simd, bool transpose_a>
+        void multiply_add_micro_kernel(size_t            depth,
+                                       coordinate        alpha,
+                                       const coordinate* a,
+                                       size_t            lda,
+                                       const coordinate* b,
+                                       size_t            ldb,
+                                       coordinate*       c,
+                                       size_t            ldc)
+        {
+            static_assert(0 < row_count && row_count <= multiply_micro_kernel_rows && 0 < pack_count && pack_count <= 2);
+
+            using type = typename simd::type;
+
+            // Plain arrays: the alignment of the SIMD types would be dropped as template arguments of std::array
+            type acc[row_count][pack_count];
+
+            for (size_t r = 0; r < row_count; ++r)
+            {
+                for (size_t p = 0; p < pack_count; ++p)
+                {
+                    acc[r][p] = simd::broadcast(coordinate{0});
+                }
+            }
+
+            for (size_t k = 0; k < depth; ++k)
+            {
+                type row[pack_count];
+
+                for (size_t p = 0; p < pack_count; ++p)
+                {
+                    row[p] = simd::load(b + k * ldb + p * simd::width);
+                }
+
+                for (size_t r = 0; r < row_count; ++r)
+                {
+                    const auto factor = simd::broadcast(transpose_a ? a[k * lda + r] : a[r * lda + k]);
+
+                    for (size_t p = 0; p < pack_count; ++p)
+                    {
+                        acc[r][p] = simd::fmadd(factor, row[p], acc[r][p]);
+                    }
+                }
+            }
+
+            const auto factor = simd::broadcast(alpha);
+
+            for (size_t r = 0; r < row_count; ++r)
+            {
+                for (size_t p = 0; p < pack_count; ++p)
+                {
+                    coordinate* dst = c + r * ldc + p * simd::width;
+                    simd::store(dst, simd::fmadd(factor, acc[r][p], simd::load(dst)));
+                }
+            }
+        }
+
+        /*!
+         * @brief Call the micro kernel for row_count rows of C, row_count being known at run time only
+         */
+        template <size_t pack_count, Coordinate coordinate, typename simd, bool transpose_a>
+        void multiply_add_micro_kernel(size_t            row_count,
+                                       size_t            depth,
+                                       coordinate        alpha,
+                                       const coordinate* a,
+                                       size_t            lda,
+                                       const coordinate* b,
+                                       size_t            ldb,
+                                       coordinate*       c,
+                                       size_t            ldc)
+        {
+            switch (row_count)
+            {
+                case 6:
+                    multiply_add_micro_kernel<6, pack_count, coordinate, simd, transpose_a>(depth, alpha, a, lda, b, ldb, c, ldc);
+                    break;
+                case 5:
+                    multiply_add_micro_kernel<5, pack_count, coordinate, simd, transpose_a>(depth, alpha, a, lda, b, ldb, c, ldc);
+                    break;
+                case 4:
+                    multiply_add_micro_kernel<4, pack_count, coordinate, simd, transpose_a>(depth, alpha, a, lda, b, ldb, c, ldc);
+                    break;
+                case 3:
+                    multiply_add_micro_kernel<3, pack_count, coordinate, simd, transpose_a>(depth, alpha, a, lda, b, ldb, c, ldc);
+                    break;
+                case 2:
+                    multiply_add_micro_kernel<2, pack_count, coordinate, simd, transpose_a>(depth, alpha, a, lda, b, ldb, c, ldc);
+                    break;
+                default:
+                    multiply_add_micro_kernel<1, pack_count, coordinate, simd, transpose_a>(depth, alpha, a, lda, b, ldb, c, ldc);
+                    break;
+            }
+        }
+
+        /*!
+         * @brief Tile [row_begin, row_end[ x [col_begin, col_end[ of C += alpha * A * B, see multiply_add_blocked
+         */
+        template <Coordinate coordinate, bool transpose_a>
+        void multiply_add_tile(size_t            row_begin,
+                               size_t            row_end,
+                               size_t            col_begin,
+                               size_t            col_end,
+                               size_t            depth,
+                               coordinate        alpha,
+                               const coordinate* a,
+                               size_t            lda,
+                               const coordinate* b,
+                               size_t            ldb,
+                               coordinate*       c,
+                               size_t            ldc)
+        {
+            const size_t width = col_end - col_begin;
+
+            // Columns processed by strips of 2 SIMD registers, the remaining ones by for_each_pack
+            size_t strip_width = 1;
+            size_t strip_cols  = 0;
+
+#ifdef AVX_ENABLED_ON_CPU
+            if constexpr (has_simd_pack<coordinate>)
+            {
+                strip_width = 2 * SimdPack<coordinate>::width;
+                strip_cols  = width / strip_width * strip_width;
+            }
+#endif
+
+            const size_t tail_width = width - strip_cols;
+
+            // Copy of a block of B where each strip is contiguous: read directly, the rows of a strip are ldb apart and
+            // map to the same few sets of the L1 cache when ldb is a large power of 2
+            std::vector<coordinate> packed(std::min(multiply_block_depth, depth) * width);
+
+            for (size_t k0 = 0; k0 < depth; k0 += multiply_block_depth)
+            {
+                const size_t      block_depth = std::min(multiply_block_depth, depth - k0);
+                const coordinate* b_rows      = b + k0 * ldb + col_begin;
+                coordinate*       tail        = packed.data() + block_depth * strip_cols;
+
+                for (size_t k = 0; k < block_depth; ++k)
+                {
+                    const coordinate* b_row = b_rows + k * ldb;
+
+                    for (size_t s = 0; s < strip_cols; s += strip_width)
+                    {
+                        std::copy(b_row + s, b_row + s + strip_width, packed.data() + s * block_depth + k * strip_width);
+                    }
+
+                    std::copy(b_row + strip_cols, b_row + width, tail + k * tail_width);
+                }
+
+                // The strip of B stays in the L1 cache while the rows of the tile go through it
+                const auto strip = [=]<size_t pack_count, typename simd>(const coordinate* b_strip, size_t ld_strip, size_t j)
+                {
+                    for (size_t i = row_begin; i < row_end; i += multiply_micro_kernel_rows)
+                    {
+                        multiply_add_micro_kernel<pack_count, coordinate, simd, transpose_a>(std::min(multiply_micro_kernel_rows, row_end - i),
+                                                                                             block_depth,
+                                                                                             alpha,
+                                                                                             transpose_a ? a + k0 * lda + i : a + i * lda + k0,
+                                                                                             lda,
+                                                                                             b_strip,
+                                                                                             ld_strip,
+                                                                                             c + i * ldc + j,
+                                                                                             ldc);
+                    }
+                };
+
+#ifdef AVX_ENABLED_ON_CPU
+                if constexpr (has_simd_pack<coordinate>)
+                {
+                    for (size_t s = 0; s < strip_cols; s += strip_width)
+                    {
+                        strip.template operator()<2, SimdPack<coordinate>>(packed.data() + s * block_depth, strip_width, col_begin + s);
+                    }
+                }
+#endif
+
+                for_each_pack<coordinate>(0,
+                                          tail_width,
+                                          [=](auto pack, size_t j)
+                                          {
+                                              strip.template operator()<1, decltype(pack)>(tail + j, tail_width, col_begin + strip_cols + j);
+                                          });
+            }
+        }
+
+        /*!
+         * @brief C += alpha * A * B, all the matrices being stored row by row
+         * @param rows is the number of rows of A and C
+         * @param cols is the number of columns of B and C
+         * @param depth is the number of columns of A and rows of B
+         * @param lda, ldb and ldc are the leading dimensions: A(i, k) = a[i * lda + k], or a[k * lda + i] if transpose_a
+         *        is true, A being then read as the transpose of a depth x rows matrix
+         */
+        template <Coordinate coordinate, bool transpose_a = false>
+        void multiply_add_blocked(size_t            rows,
+                                  size_t            cols,
+                                  size_t            depth,
+                                  coordinate        alpha,
+                                  const coordinate* a,
+                                  size_t            lda,
+                                  const coordinate* b,
+                                  size_t            ldb,
+                                  coordinate*       c,
+                                  size_t            ldc)
+        {
+            if (rows == 0 || cols == 0 || depth == 0)
+            {
+                return;
+            }
+
+            // Tiles numbered column block by column block, so that the contiguous tiles of a thread share their blocks of B
+            const size_t row_tiles  = (rows + multiply_tile_height - 1) / multiply_tile_height;
+            const size_t col_tiles  = (cols + multiply_block_width - 1) / multiply_block_width;
+            const size_t tile_count = row_tiles * col_tiles;
+
+            for_each_chunk_concurrently(
+            tile_count,
+            1,
+            [=](size_t begin, size_t end)
+            {
+                for (size_t tile = begin; tile < end; ++tile)
+                {
+                    const size_t row_begin = (tile % row_tiles) * multiply_tile_height;
+                    const size_t col_begin = (tile / row_tiles) * multiply_block_width;
+
+                    multiply_add_tile<coordinate, transpose_a>(row_begin,
+                                                               std::min(row_begin + multiply_tile_height, rows),
+                                                               col_begin,
+                                                               std::min(col_begin + multiply_block_width, cols),
+                                                               depth,
+                                                               alpha,
+                                                               a,
+                                                               lda,
+                                                               b,
+                                                               ldb,
+                                                               c,
+                                                               ldc);
+                }
+            },
+            concurrency_threshold_for_work(tile_count, rows * cols * depth));
+        }
+
+        /*!
+         * @brief Lower triangle of C += alpha * A * B, C being a rows x rows matrix, see multiply_add_blocked. Only the
+         *        tiles crossing the lower triangle are computed, the coefficients of these tiles above the diagonal being
+         *        updated too.
+         */
+        template <Coordinate coordinate, bool transpose_a = false>
+        void multiply_add_blocked_lower(size_t            rows,
+                                        size_t            depth,
+                                        coordinate        alpha,
+                                        const coordinate* a,
+                                        size_t            lda,
+                                        const coordinate* b,
+                                        size_t            ldb,
+                                        coordinate*       c,
+                                        size_t            ldc)
+        {
+            if (rows == 0 || depth == 0)
+            {
+                return;
+            }
+
+            static_assert(multiply_block_width % multiply_tile_height == 0);
+
+            // The column block j crosses the lower triangle from the row tile first_row_tile(j)
+            const size_t row_tiles      = (rows + multiply_tile_height - 1) / multiply_tile_height;
+            const size_t col_tiles      = (rows + multiply_block_width - 1) / multiply_block_width;
+            const auto   first_row_tile = [](size_t col_tile) { return col_tile * (multiply_block_width / multiply_tile_height); };
+
+            size_t tile_count = 0;
+
+            for (size_t j = 0; j < col_tiles; ++j)
+            {
+                tile_count += row_tiles - first_row_tile(j);
+            }
+
+            for_each_chunk_concurrently(
+            tile_count,
+            1,
+            [=](size_t begin, size_t end)
+            {
+                for (size_t tile = begin; tile < end; ++tile)
+                {
+                    size_t col_tile = 0;
+                    size_t row_tile = tile;
+
+                    while (row_tile >= row_tiles - first_row_tile(col_tile))
+                    {
+                        row_tile -= row_tiles - first_row_tile(col_tile);
+                        ++col_tile;
+                    }
+
+                    const size_t row_begin = (first_row_tile(col_tile) + row_tile) * multiply_tile_height;
+                    const size_t row_end   = std::min(row_begin + multiply_tile_height, rows);
+                    const size_t col_begin = col_tile * multiply_block_width;
+
+                    multiply_add_tile<coordinate, transpose_a>(row_begin,
+                                                               row_end,
+                                                               col_begin,
+                                                               std::min(col_begin + multiply_block_width, row_end),
+                                                               depth,
+                                                               alpha,
+                                                               a,
+                                                               lda,
+                                                               b,
+                                                               ldb,
+                                                               c,
+                                                               ldc);
+                }
+            },
+            concurrency_threshold_for_work(tile_count, rows * rows * depth / 2));
+        }
+
+        // NOLINTEND(readability-identifier-length)
+    }  // namespace ImplementationDetails
+}  // namespace LCNS::Algebra
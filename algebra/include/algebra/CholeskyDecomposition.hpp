@@ -0,0 +1,605 @@
+#pragma once
+
+#include "algebra/BlockedMultiplication.hpp"
+#include "algebra/Internal.hpp"
+#include "algebra/LUDecomposition.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+/*
+ * Cholesky decomposition A = L * L^T of symmetric positive definite matrices stored row by row. Only the lower triangle
+ * of A is read. L overwrites it, and its transpose L^T overwrites the upper triangle: both substitutions of a solve then
+ * read their triangle row by row, and the decomposition is symmetric like A, the same for both storage orders of Matrix.
+ *
+ * As for the LU decomposition, the loops are unrolled at compile time up to lu_unrolled_size. Above, the right-looking
+ * blocked algorithm decomposes a diagonal block, obtains the panel below it with a triangular solve, and updates the
+ * lower triangle of the trailing matrix with multiply_add_blocked_lower, where almost all the work is done. The inverse
+ * is computed in place from the decomposition: L is inverted, then A^-1 = L^-T * L^-1, both steps being blocked the
+ * same way.
+ */
+
+namespace LCNS::Algebra
+{
+    /*!
+     * \brief Cholesky decomposition A = L * L^T of a large symmetric positive definite matrix whose size is known at run
+     *        time. The trailing matrix updates, where almost all the work is done, are blocked matrix multiplications
+     *        split between threads.
+     * @param matrix holds the n x n matrix A row by row on input, only its lower triangle being read, and L on and below
+     *        the diagonal, L^T above, on output
+     * @return false if A is not positive definite, one of its pivots being not larger than n * epsilon * max|diagonal|.
+     *         The decomposition is then incomplete.
+     * @throw std::invalid_argument if the size of matrix is not a square
+     */
+    template <Coordinate coordinate>
+    bool cholesky_factorize(std::span<coordinate> matrix) requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief Solve A * X = B from the decomposition of A by cholesky_factorize
+     * @param factor is the result of cholesky_factorize
+     * @param rhs holds B row by row on input, and X on output
+     * @param rhs_cols is the number of columns of B, one per system
+     * @throw std::invalid_argument if the size of factor does not match the number of rows of rhs
+     */
+    template <Coordinate coordinate>
+    void cholesky_solve(std::span<const coordinate> factor, std::span<coordinate> rhs, size_t rhs_cols = 1)
+    requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief Inverse a large symmetric positive definite matrix in place with its Cholesky decomposition, about half the
+     *        work of an inverse through the LU decomposition. No second matrix is allocated, the blocked products only
+     *        need two buffers of lu_block_size rows.
+     * @param matrix holds the n x n matrix A row by row on input, only its lower triangle being read, and A^-1 on output
+     * @return false if A is not positive definite, see cholesky_factorize. matrix is then left partially decomposed.
+     * @throw std::invalid_argument if the size of matrix is not a square
+     */
+    template <Coordinate coordinate>
+    bool cholesky_inverse(std::span<coordinate> matrix) requires(std::is_floating_point_v<coordinate>);
+
+    namespace ImplementationDetails
+    {
+        // NOLINTBEGIN(readability-identifier-length)
+
+        /*!
+         * @brief Number of rows of a square matrix of size coefficients
+         * @throw std::invalid_argument if size is not a square
+         */
+        inline size_t cholesky_matrix_size(size_t size)
+        {
+            const auto n = static_cast<size_t>(std::llround(std::sqrt(static_cast<double>(size))));
+
+            if (n * n != size)
+            {
+                throw std::invalid_argument("The matrix to decompose must have as many rows as columns");
+            }
+
+            return n;
+        }
+
+        /*!
+         * @brief Pivots not larger than n * epsilon * max|diagonal| are considered null. The coefficients of a symmetric
+         *        positive definite matrix are bounded by its diagonal, which is all that is read.
+         */
+        template <Coordinate coordinate>
+        coordinate cholesky_tolerance(const coordinate* a, size_t lda, size_t n)
+        {
+            coordinate largest = 0;
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                largest = std::max(largest, a[i * lda + i]);
+            }
+
+            return static_cast<coordinate>(n) * std::numeric_limits<coordinate>::epsilon() * largest;
+        }
+
+        /*!
+         * @brief Copy the m x cols block src to the cols x m block dst, transposed
+         */
+        template <Coordinate coordinate>
+        void cholesky_transpose(size_t m, size_t cols, const coordinate* src, size_t lds, coordinate* dst, size_t ldd)
+        {
+            for (size_t i = 0; i < m; ++i)
+            {
+                for (size_t j = 0; j < cols; ++j)
+                {
+                    dst[j * ldd + i] = src[i * lds + j];
+                }
+            }
+        }
+
+        /*!
+         * @brief Decomposition unrolled at compile time, a pointing to n x n coefficients
+         * @return false if a pivot is not larger than tolerance (or is not a number)
+         */
+        template <Coordinate coordinate, unsigned int n>
+        bool cholesky_unrolled(coordinate* a, coordinate tolerance)
+        {
+            bool positive = true;
+
+            unroll<n>(
+            [&](auto j_)
+            {
+                constexpr size_t j = decltype(j_)::value;
+
+                if (!positive)
+                {
+                    return;
+                }
+
+                coordinate pivot = a[j * n + j];
+
+                unroll<j>([&](auto k_) { pivot -= a[j * n + decltype(k_)::value] * a[j * n + decltype(k_)::value]; });
+
+                if (!(pivot > tolerance))
+                {
+                    positive = false;
+                    return;
+                }
+
+                const coordinate diagonal = std::sqrt(pivot);
+                a[j * n + j]              = diagonal;
+
+                unroll<n>(
+                [&](auto i_)
+                {
+                    constexpr size_t i = decltype(i_)::value;
+
+                    if constexpr (i > j)
+                    {
+                        coordinate value = a[i * n + j];
+
+                        unroll<j>([&](auto k_) { value -= a[i * n + decltype(k_)::value] * a[j * n + decltype(k_)::value]; });
+
+                        a[i * n + j] = value / diagonal;
+                        a[j * n + i] = a[i * n + j];
+                    }
+                });
+            });
+
+            return positive;
+        }
+
+        /*!
+         * @brief Decomposition of a m x m block, row by row, used for the diagonal blocks of cholesky_blocked
+         * @return false if a pivot is not larger than tolerance (or is not a number)
+         */
+        template <Coordinate coordinate>
+        bool cholesky_unblocked(coordinate* a, size_t lda, size_t m, coordinate tolerance)
+        {
+            for (size_t j = 0; j < m; ++j)
+            {
+                const coordinate* row_j = a + j * lda;
+                coordinate        pivot = row_j[j];
+
+                for (size_t k = 0; k < j; ++k)
+                {
+                    pivot -= row_j[k] * row_j[k];
+                }
+
+                if (!(pivot > tolerance))
+                {
+                    return false;
+                }
+
+                const coordinate diagonal = std::sqrt(pivot);
+                a[j * lda + j]            = diagonal;
+
+                for (size_t i = j + 1; i < m; ++i)
+                {
+                    const coordinate* row_i = a + i * lda;
+                    coordinate        value = row_i[j];
+
+                    for (size_t k = 0; k < j; ++k)
+                    {
+                        value -= row_i[k] * row_j[k];
+                    }
+
+                    a[i * lda + j] = value / diagonal;
+                    a[j * lda + i] = a[i * lda + j];
+                }
+            }
+
+            return true;
+        }
+
+        /*!
+         * @brief Right-looking blocked decomposition of a n x n matrix, a[i * lda + j] being A(i, j)
+         * @return false if a pivot is not larger than tolerance (or is not a number)
+         */
+        template <Coordinate coordinate>
+        bool cholesky_blocked(coordinate* a, size_t lda, size_t n, coordinate tolerance)
+        {
+            for (size_t k0 = 0; k0 < n; k0 += lu_block_size)
+            {
+                const size_t k1 = std::min(k0 + lu_block_size, n);
+
+                if (!cholesky_unblocked(a + k0 * lda + k0, lda, k1 - k0, tolerance))
+                {
+                    return false;
+                }
+
+                if (k1 == n)
+                {
+                    return true;
+                }
+
+                // L21^T = L11^-1 * A21^T, solved above the diagonal where the rows are contiguous, then L21
+                const size_t trailing = n - k1;
+
+                cholesky_transpose(trailing, k1 - k0, a + k1 * lda + k0, lda, a + k0 * lda + k1, lda);
+                solve_triangular_blocked<true, false>(k1 - k0, trailing, a + k0 * lda + k0, lda, a + k0 * lda + k1, lda);
+                cholesky_transpose(k1 - k0, trailing, a + k0 * lda + k1, lda, a + k1 * lda + k0, lda);
+
+                // A22 -= L21 * L21^T, on the lower triangle only
+                multiply_add_blocked_lower(trailing, k1 - k0, coordinate{-1}, a + k1 * lda + k0, lda, a + k0 * lda + k1, lda, a + k1 * lda + k1, lda);
+            }
+
+            return true;
+        }
+
+        /*!
+         * @brief Solve A * X = B from the decomposition of A, unrolled at compile time
+         * @param x holds B on input and X on output, n rows of cols coefficients
+         */
+        template <Coordinate coordinate, unsigned int n>
+        void cholesky_solve_unrolled(const coordinate* a, coordinate* x, size_t cols)
+        {
+            // Forward substitution with L
+            unroll<n>(
+            [&](auto i_)
+            {
+                constexpr size_t i = decltype(i_)::value;
+
+                unroll<i>(
+                [&](auto k_)
+                {
+                    constexpr size_t k = decltype(k_)::value;
+
+                    for (size_t j = 0; j < cols; ++j)
+                    {
+                        x[i * cols + j] -= a[i * n + k] * x[k * cols + j];
+                    }
+                });
+
+                for (size_t j = 0; j < cols; ++j)
+                {
+                    x[i * cols + j] /= a[i * n + i];
+                }
+            });
+
+            // Backward substitution with L^T, above the diagonal
+            unroll<n>(
+            [&](auto r_)
+            {
+                constexpr size_t i = n - 1 - decltype(r_)::value;
+
+                unroll<n>(
+                [&](auto k_)
+                {
+                    constexpr size_t k = decltype(k_)::value;
+
+                    if constexpr (k > i)
+                    {
+                        for (size_t j = 0; j < cols; ++j)
+                        {
+                            x[i * cols + j] -= a[i * n + k] * x[k * cols + j];
+                        }
+                    }
+                });
+
+                for (size_t j = 0; j < cols; ++j)
+                {
+                    x[i * cols + j] /= a[i * n + i];
+                }
+            });
+        }
+
+        /*!
+         * @brief Inverse in place from the decomposition, unrolled at compile time: L^-1 replaces L row by row, then
+         *        A^-1 = L^-T * L^-1 replaces L^-1 row by row too, each row of the product only depending on the rows below
+         */
+        template <Coordinate coordinate, unsigned int n>
+        void cholesky_inverse_unrolled(coordinate* a)
+        {
+            // Row i of L^-1 is -L(i, :i) * L^-1(:i, :i) / L(i, i), accumulated in place from the left
+            unroll<n>(
+            [&](auto i_)
+            {
+                constexpr size_t i = decltype(i_)::value;
+
+                unroll<i>(
+                [&](auto k_)
+                {
+                    constexpr size_t k = decltype(k_)::value;
+                    const coordinate l = a[i * n + k];
+
+                    unroll<k>([&](auto j_) { a[i * n + decltype(j_)::value] += l * a[k * n + decltype(j_)::value]; });
+
+                    a[i * n + k] = l * a[k * n + k];
+                });
+
+                const coordinate reciprocal = coordinate{1} / a[i * n + i];
+
+                unroll<i>([&](auto j_) { a[i * n + decltype(j_)::value] *= -reciprocal; });
+
+                a[i * n + i] = reciprocal;
+            });
+
+            // Row i of L^-T * L^-1 is the sum of L^-1(k, i) * L^-1(k, :i] for k >= i
+            unroll<n>(
+            [&](auto i_)
+            {
+                constexpr size_t i        = decltype(i_)::value;
+                const coordinate diagonal = a[i * n + i];
+
+                unroll<i + 1>([&](auto j_) { a[i * n + decltype(j_)::value] *= diagonal; });
+
+                unroll<n>(
+                [&](auto k_)
+                {
+                    constexpr size_t k = decltype(k_)::value;
+
+                    if constexpr (k > i)
+                    {
+                        const coordinate factor = a[k * n + i];
+
+                        unroll<i + 1>([&](auto j_) { a[i * n + decltype(j_)::value] += factor * a[k * n + decltype(j_)::value]; });
+                    }
+                });
+            });
+
+            unroll<n>(
+            [&](auto i_)
+            {
+                constexpr size_t i = decltype(i_)::value;
+
+                unroll<i>([&](auto j_) { a[decltype(j_)::value * n + i] = a[i * n + decltype(j_)::value]; });
+            });
+        }
+
+        /*!
+         * @brief Inverse in place of the lower triangle of a m x m block, row by row, see cholesky_inverse_unrolled. The
+         *        coefficients above the diagonal are not read.
+         */
+        template <Coordinate coordinate>
+        void cholesky_triangular_inverse(coordinate* a, size_t lda, size_t m)
+        {
+            for (size_t i = 0; i < m; ++i)
+            {
+                coordinate* row_i = a + i * lda;
+
+                for (size_t k = 0; k < i; ++k)
+                {
+                    const coordinate  l     = row_i[k];
+                    const coordinate* row_k = a + k * lda;
+
+                    for (size_t j = 0; j < k; ++j)
+                    {
+                        row_i[j] += l * row_k[j];
+                    }
+
+                    row_i[k] = l * row_k[k];
+                }
+
+                const coordinate reciprocal = coordinate{1} / row_i[i];
+
+                for (size_t j = 0; j < i; ++j)
+                {
+                    row_i[j] *= -reciprocal;
+                }
+
+                row_i[i] = reciprocal;
+            }
+        }
+
+        /*!
+         * @brief A^-1 = L^-T * L^-1 in place, from L^-1 in the lower triangle of a n x n matrix of leading dimension lda, see
+         *        cholesky_inverse_unrolled. The result is written on both sides of the diagonal.
+         */
+        template <Coordinate coordinate>
+        void cholesky_inverse_product(coordinate* a, size_t lda, size_t n)
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                coordinate*      row_i    = a + i * lda;
+                const coordinate diagonal = row_i[i];
+
+                for (size_t j = 0; j <= i; ++j)
+                {
+                    row_i[j] *= diagonal;
+                }
+
+                for (size_t k = i + 1; k < n; ++k)
+                {
+                    const coordinate* row_k  = a + k * lda;
+                    const coordinate  factor = row_k[i];
+
+                    for (size_t j = 0; j <= i; ++j)
+                    {
+                        row_i[j] += factor * row_k[j];
+                    }
+                }
+            }
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                for (size_t j = 0; j < i; ++j)
+                {
+                    a[j * lda + i] = a[i * lda + j];
+                }
+            }
+        }
+
+        /*!
+         * @brief Blocked inverse in place from the decomposition of a n x n matrix. Both steps go block row by block row,
+         *        the work being done by multiply_add_blocked:
+         *          - L^-1(I, :I) = -L(I, I)^-1 * L(I, :I) * L^-1(:I, :I), the diagonal block being inverted afterwards
+         *          - A^-1(I, :I] = L^-1(I:, I)^T * L^-1(I:, :I]
+         */
+        template <Coordinate coordinate>
+        void cholesky_inverse_blocked(coordinate* a, size_t lda, size_t n)
+        {
+            if (n <= lu_block_size)
+            {
+                cholesky_triangular_inverse(a, lda, n);
+                cholesky_inverse_product(a, lda, n);
+                return;
+            }
+
+            // L^T is cleared so that the triangular blocks of L^-1 can be multiplied as full blocks
+            for (size_t i = 0; i < n; ++i)
+            {
+                std::fill(a + i * lda + i + 1, a + i * lda + n, coordinate{0});
+            }
+
+            std::vector<coordinate> block_row(lu_block_size * n);
+            std::vector<coordinate> block_col(lu_block_size * n);
+
+            for (size_t i0 = 0; i0 < n; i0 += lu_block_size)
+            {
+                const size_t m   = std::min(lu_block_size, n - i0);
+                coordinate*  row = a + i0 * lda;
+
+                if (i0 > 0)
+                {
+                    for (size_t i = 0; i < m; ++i)
+                    {
+                        std::copy(row + i * lda, row + i * lda + i0, block_row.data() + i * i0);
+                        std::fill(row + i * lda, row + i * lda + i0, coordinate{0});
+                    }
+
+                    multiply_add_blocked(m, i0, i0, coordinate{-1}, block_row.data(), i0, a, lda, row, lda);
+                    solve_triangular_blocked<true, false>(m, i0, row + i0, lda, row, lda);
+                }
+
+                cholesky_triangular_inverse(row + i0, lda, m);
+            }
+
+            for (size_t i0 = 0; i0 < n; i0 += lu_block_size)
+            {
+                const size_t m     = std::min(lu_block_size, n - i0);
+                const size_t i1    = i0 + m;
+                const size_t depth = n - i0;
+                coordinate*  row   = a + i0 * lda;
+
+                cholesky_transpose(depth, m, row + i0, lda, block_col.data(), depth);
+                std::fill(block_row.begin(), block_row.begin() + static_cast<std::ptrdiff_t>(m * i1), coordinate{0});
+
+                multiply_add_blocked(m, i1, depth, coordinate{1}, block_col.data(), depth, row, lda, block_row.data(), i1);
+
+                for (size_t i = 0; i < m; ++i)
+                {
+                    std::copy(block_row.data() + i * i1, block_row.data() + (i + 1) * i1, row + i * lda);
+                }
+            }
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                for (size_t j = 0; j < i; ++j)
+                {
+                    a[j * lda + i] = a[i * lda + j];
+                }
+            }
+        }
+
+        /*!
+         * @brief Decompose the n x n matrix a in place
+         * @return false if the matrix is not positive definite
+         */
+        template <Coordinate coordinate, unsigned int n>
+        bool cholesky_factorize(coordinate* a)
+        {
+            const coordinate tolerance = cholesky_tolerance(a, n, n);
+
+            if constexpr (n <= lu_unrolled_size)
+            {
+                return cholesky_unrolled<coordinate, n>(a, tolerance);
+            }
+            else
+            {
+                return cholesky_blocked(a, n, n, tolerance);
+            }
+        }
+
+        /*!
+         * @brief Solve A * X = B from the decomposition of A
+         * @param x holds B on input and X on output, n rows of cols coefficients
+         */
+        template <Coordinate coordinate, unsigned int n>
+        void cholesky_solve(const coordinate* a, coordinate* x, size_t cols)
+        {
+            if constexpr (n <= lu_unrolled_size)
+            {
+                cholesky_solve_unrolled<coordinate, n>(a, x, cols);
+            }
+            else
+            {
+                solve_triangular_blocked<true, false>(n, cols, a, n, x, cols);
+                solve_triangular_blocked<false, false>(n, cols, a, n, x, cols);
+            }
+        }
+
+        /*!
+         * @brief Replace the decomposition of A by A^-1, in place
+         */
+        template <Coordinate coordinate, unsigned int n>
+        void cholesky_inverse(coordinate* a)
+        {
+            if constexpr (n <= lu_unrolled_size)
+            {
+                cholesky_inverse_unrolled<coordinate, n>(a);
+            }
+            else
+            {
+                cholesky_inverse_blocked(a, n, n);
+            }
+        }
+
+        // NOLINTEND(readability-identifier-length)
+    }  // namespace ImplementationDetails
+
+    template <Coordinate coordinate>
+    bool cholesky_factorize(std::span<coordinate> matrix) requires(std::is_floating_point_v<coordinate>)
+    {
+        const size_t n = ImplementationDetails::cholesky_matrix_size(matrix.size());
+
+        return ImplementationDetails::cholesky_blocked(matrix.data(), n, n, ImplementationDetails::cholesky_tolerance(matrix.data(), n, n));
+    }
+
+    template <Coordinate coordinate>
+    void cholesky_solve(std::span<const coordinate> factor, std::span<coordinate> rhs, size_t rhs_cols)
+    requires(std::is_floating_point_v<coordinate>)
+    {
+        const size_t n = rhs_cols == 0 ? 0 : rhs.size() / rhs_cols;
+
+        if (rhs.size() != n * rhs_cols || factor.size() != n * n)
+        {
+            throw std::invalid_argument("The decomposition must have as many rows and columns as the right hand sides have rows");
+        }
+
+        ImplementationDetails::solve_triangular_blocked<true, false>(n, rhs_cols, factor.data(), n, rhs.data(), rhs_cols);
+        ImplementationDetails::solve_triangular_blocked<false, false>(n, rhs_cols, factor.data(), n, rhs.data(), rhs_cols);
+    }
+
+    template <Coordinate coordinate>
+    bool cholesky_inverse(std::span<coordinate> matrix) requires(std::is_floating_point_v<coordinate>)
+    {
+        if (!cholesky_factorize(matrix))
+        {
+            return false;
+        }
+
+        const size_t n = ImplementationDetails::cholesky_matrix_size(matrix.size());
+
+        ImplementationDetails::cholesky_inverse_blocked(matrix.data(), n, n);
+
+        return true;
+    }
+}  // namespace LCNS::Algebra
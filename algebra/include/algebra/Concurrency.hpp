@@ -0,0 +1,64 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace LCNS::Algebra
+{
+    namespace ImplementationDetails
+    {
+        /*!
+         * @brief Number of elements under which the batched kernels stay on the calling thread. Below this size,
+         *        creating the threads costs more than the work they would do.
+         */
+        constexpr size_t concurrency_threshold = 1 << 16;
+
+        /*!
+         * @brief Call task(begin, end) on contiguous chunks covering [0, count[, one chunk per hardware thread
+         *        when count is at least threshold, a single chunk on the calling thread otherwise.
+         * @param count is the number of elements to process
+         * @param granularity is a number of elements the chunk sizes are a multiple of (for instance a SIMD width)
+         * @param task is a callable taking the first and one past the last index of its chunk
+         * @param threshold is the minimal number of elements required to use more than one thread
+         */
+        template <typename Task>
+        void for_each_chunk_concurrently(size_t count, size_t granularity, Task&& task, size_t threshold = concurrency_threshold)
+        {
+            // Tested first: std::thread::hardware_concurrency is not free, it can read a system file
+            if (count < threshold)
+            {
+                task(size_t{0}, count);
+                return;
+            }
+
+            const size_t hardware_thread_count = std::max(std::thread::hardware_concurrency(), 1u);
+
+            if (hardware_thread_count == 1)
+            {
+                task(size_t{0}, count);
+                return;
+            }
+
+            size_t chunk_size = (count + hardware_thread_count - 1) / hardware_thread_count;
+            chunk_size        = (chunk_size + granularity - 1) / granularity * granularity;
+
+            std::vector<std::thread> threads;
+            threads.reserve(hardware_thread_count);
+
+            for (size_t begin = chunk_size; begin < count; begin += chunk_size)
+            {
+                threads.emplace_back(task, begin, std::min(begin + chunk_size, count));
+            }
+
+            // The calling thread processes the first chunk instead of waiting
+            task(size_t{0}, std::min(chunk_size, count));
+
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+        }
+    }  // namespace ImplementationDetails
+}  // namespace LCNS::Algebra
@@ -0,0 +1,1679 @@
+#pragma once
+
+#include "algebra/BlockedMultiplication.hpp"
+#include "algebra/Concurrency.hpp"
+#include "algebra/Internal.hpp"
+#include "algebra/MappingFunctions.hpp"
+#include "algebra/Matrix.hpp"
+#include "algebra/Simd.hpp"
+#include "algebra/Vector.hpp"
+#include "algebra/VectorArray.hpp"
+#include "algebra/VectorKernels.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+/*
+ * Eigen decomposition A = V * D * V^T of small symmetric matrices by the cyclic Jacobi method. Each rotation cancels
+ * one off-diagonal coefficient, a sweep rotating every pair (p, q) of rows and columns once. The convergence is
+ * quadratic, also for repeated eigenvalues, and the eigenvectors are orthonormal to the working precision, which the
+ * trigonometric closed form of the 3x3 eigenvalues followed by cross products does not give for close eigenvalues.
+ *
+ * The rotation angles are computed without branches, so that the same kernel processes one matrix with ScalarPack or
+ * one matrix per SIMD lane with SimdPack. The sweeps stop once the off-diagonal coefficients of all the lanes are below
+ * epsilon * max|A|, at most jacobi_sweeps being done. For 2x2 matrices, the single rotation is the closed form solution.
+ *
+ * Large symmetric matrices, whose size is known at run time, are decomposed in three steps as by LAPACK:
+ * - Householder tridiagonalization A = Q * T * Q^T, from the last row up so that each reflector is a row of the lower
+ *   triangle. The reflectors of a panel of tridiagonal_block_size rows are accumulated with W, their products by the
+ *   matrix, and the rest of the matrix is updated once per panel, A -= V * W^T + W * V^T, by two blocked multiplications
+ *   limited to its lower triangle. The products of the matrix by each reflector, half of the work, are split between
+ *   threads.
+ * - Divide and conquer on T (Cuppen): T is split in two halves plus a rank one correction, and the eigen decompositions
+ *   of the halves are merged by solving the secular equation. The eigenvalues of the halves which are also eigenvalues
+ *   of T are deflated. The eigenvectors of the rest are computed from the roots as by Gu and Eisenstat, so that they
+ *   stay orthogonal for close eigenvalues, and multiplied by those of the halves with blocked multiplications.
+ * - The eigenvectors of T are multiplied by Q, its reflectors being applied by panels in the compact WY form.
+ * The eigenvalues alone are obtained from T by implicit QL iterations, in O(n^2). When only a few extreme eigenpairs are
+ * needed, eigen_symmetric_lanczos avoids the O(n^3) decomposition: thick restarted Lanczos with full reorthogonalization
+ * only multiplies the matrix by one vector per iteration, and decomposes small projected matrices.
+ */
+
+namespace LCNS::Algebra
+{
+    /*!
+     * \brief Eigenvalues and eigenvectors of a symmetric matrix, see eigenSymmetric
+     */
+    template <Coordinate coordinate, unsigned int size, StorageOrder order = StorageOrder::RowMajor>
+    struct SymmetricEigenDecomposition
+    {
+        Vector<coordinate, size>              eigenvalues;   // In ascending order
+        Matrix<coordinate, size, size, order> eigenvectors;  // Column i is the eigenvector of eigenvalues[i], of length 1
+    };
+
+    /*!
+     * \brief Eigen decomposition of a 2x2, 3x3 or 4x4 symmetric matrix, such as an inertia tensor, by the cyclic Jacobi
+     *        method: matrix = eigenvectors * diag(eigenvalues) * eigenvectors^T
+     * @param matrix is the symmetric matrix to decompose, only its upper triangle is read
+     * @return the eigenvalues in ascending order and the orthonormal eigenvectors, in the columns of a rotation or
+     *         reflection matrix
+     */
+    template <Coordinate coordinate, unsigned int size, StorageOrder order>
+    SymmetricEigenDecomposition<coordinate, size, order> eigenSymmetric(const Matrix<coordinate, size, size, order>& matrix)
+    requires(2 <= size && size <= 4 && std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief Eigen decomposition of each symmetric matrix, see above. Several matrices are decomposed at once with SIMD
+     *        instructions, one per lane, large arrays are split between threads.
+     * @param matrices are the symmetric matrices to decompose, only their upper triangles are read
+     * @param eigenvalues is the destination of the eigenvalues, in ascending order. Its count must be matrices.size().
+     * @param eigenvectors is the destination of the eigenvectors, in columns. Its size must be matrices.size().
+     */
+    template <Coordinate coordinate, unsigned int size, StorageOrder order = StorageOrder::RowMajor>
+    void eigenSymmetric(std::type_identity_t<std::span<const Matrix<coordinate, size, size, order>>> matrices,
+                        VectorArray<coordinate, size>&                                                 eigenvalues,
+                        std::type_identity_t<std::span<Matrix<coordinate, size, size, order>>>       eigenvectors)
+    requires(2 <= size && size <= 4 && std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief Eigen decomposition A = V * diag(eigenvalues) * V^T of a large symmetric matrix whose size is known at run
+     *        time, by tridiagonalization and divide and conquer, see the introduction of EigenDecomposition.hpp. The
+     *        blocked multiplications, where most of the work is done, are split between threads.
+     * @param matrix holds the n x n symmetric matrix A row by row on input, only its lower triangle being read, and the
+     *        orthonormal eigenvectors V on output, column i being the eigenvector of eigenvalues[i]
+     * @param eigenvalues receives the n eigenvalues in ascending order
+     * @return false if A has coefficients which are not finite, matrix and eigenvalues being then unspecified
+     * @throw std::invalid_argument if the size of matrix is not the square of the size of eigenvalues
+     */
+    template <Coordinate coordinate>
+    bool eigen_symmetric(std::span<coordinate> matrix, std::span<coordinate> eigenvalues) requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief Eigenvalues of a large symmetric matrix without its eigenvectors: after the tridiagonalization, in O(n^3),
+     *        the implicit QL iterations are in O(n^2)
+     * @param matrix holds the n x n symmetric matrix A row by row, only its lower triangle being read. It is overwritten.
+     * @param eigenvalues receives the n eigenvalues in ascending order
+     * @return false if A has coefficients which are not finite
+     * @throw std::invalid_argument if the size of matrix is not the square of the size of eigenvalues
+     */
+    template <Coordinate coordinate>
+    bool eigenvalues_symmetric(std::span<coordinate> matrix, std::span<coordinate> eigenvalues) requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief End of the spectrum computed by eigen_symmetric_lanczos
+     */
+    enum class Spectrum
+    {
+        Smallest,
+        Largest
+    };
+
+    /*!
+     * \brief A few of the largest or smallest eigenvalues of a large symmetric matrix and their eigenvectors, by thick
+     *        restarted Lanczos iterations, each one multiplying A by a vector, see the introduction of
+     *        EigenDecomposition.hpp. Much faster than eigen_symmetric for a few eigenpairs, all the more so when they are
+     *        well separated from the rest of the spectrum.
+     * @param matrix holds the whole n x n symmetric matrix A row by row
+     * @param eigenvalues receives the count eigenvalues in ascending order
+     * @param eigenvectors receives the orthonormal eigenvectors, n rows of count coefficients, column i being the
+     *        eigenvector of eigenvalues[i]
+     * @param spectrum tells whether the largest or the smallest eigenvalues are computed
+     * @return false if the residuals |A * v - lambda * v| did not all fall below lanczos_tolerance * |A| within
+     *         lanczos_max_restarts restarts, the results being then the last approximations
+     * @throw std::invalid_argument if count, the size of eigenvalues, is null or larger than n, or if the sizes of matrix
+     *        and eigenvectors do not match
+     */
+    template <Coordinate coordinate>
+    bool eigen_symmetric_lanczos(std::span<const coordinate> matrix,
+                                 std::span<coordinate>       eigenvalues,
+                                 std::span<coordinate>       eigenvectors,
+                                 Spectrum                    spectrum = Spectrum::Largest) requires(std::is_floating_point_v<coordinate>);
+
+    namespace ImplementationDetails
+    {
+        // NOLINTBEGIN(readability-identifier-length)
+
+        /*!
+         * @brief Number of Jacobi sweeps: the largest number needed to reach the working precision, measured on random
+         *        matrices with close, repeated and tiny eigenvalues, plus one
+         */
+        template <Coordinate coordinate, unsigned int size>
+        constexpr unsigned int jacobi_sweeps = size == 2 ? 1 : (size == 3 ? 5 : (std::is_same_v<coordinate, float> ? 6 : 7));
+
+        /*!
+         * @brief Jacobi rotation of the rows and columns p < q cancelling a[p][q], see jacobi_eigen
+         */
+        template <Coordinate coordinate, unsigned int size, typename simd, size_t p, size_t q>
+        void jacobi_rotate(typename simd::type (&a)[size][size], typename simd::type (&v)[size][size])
+        {
+            const auto zero = simd::broadcast(coordinate{0});
+            const auto one  = simd::broadcast(coordinate{1});
+
+            // Below epsilon^2 * max|A|, a_pq is dropped: the lanes which have already converged would otherwise square
+            // ever smaller coefficients, down to the denormals, much slower on most processors
+            const auto negligible = simd::broadcast(std::numeric_limits<coordinate>::epsilon() * std::numeric_limits<coordinate>::epsilon());
+
+            // tan of the rotation angle t = sign(d) * 2 * a_pq / (|d| + r), r = sqrt(d^2 + 4 * a_pq^2), d = a_qq - a_pp, the
+            // smaller root of t^2 + t * d / a_pq - 1 = 0. 1 + t^2 = 2 * r / (|d| + r) gives the cosine without dividing by
+            // 1 + t^2. The rotation is the identity if a_pq is dropped: d^2 may then underflow, r being null or inaccurate.
+            const auto apq         = simd::select_greater(simd::abs(a[p][q]), negligible, a[p][q], zero);
+            const auto d           = simd::sub(a[q][q], a[p][p]);
+            const auto two_apq     = simd::add(apq, apq);
+            const auto r           = simd::sqrt(simd::fmadd(d, d, simd::mul(two_apq, two_apq)));
+            const auto denominator = simd::add(simd::abs(d), r);
+            const auto non_null    = simd::select_non_zero(denominator, denominator, one);
+
+            const auto t = simd::div(simd::select_greater(zero, d, simd::sub(zero, two_apq), two_apq), non_null);
+            const auto c = simd::select_non_zero(apq, simd::sqrt(simd::div(non_null, simd::select_non_zero(r, simd::add(r, r), one))), one);
+            const auto s = simd::mul(t, c);
+
+            a[p][p] = simd::sub(a[p][p], simd::mul(t, apq));
+            a[q][q] = simd::fmadd(t, apq, a[q][q]);
+            a[p][q] = zero;
+
+            unroll<size>(
+            [&](auto k)
+            {
+                if constexpr (k != p && k != q)
+                {
+                    auto&      akp = a[std::min<size_t>(k, p)][std::max<size_t>(k, p)];
+                    auto&      akq = a[std::min<size_t>(k, q)][std::max<size_t>(k, q)];
+                    const auto kp  = akp;
+
+                    akp = simd::sub(simd::mul(c, kp), simd::mul(s, akq));
+                    akq = simd::fmadd(s, kp, simd::mul(c, akq));
+                }
+
+                const auto vkp = v[k][p];
+
+                v[k][p] = simd::sub(simd::mul(c, vkp), simd::mul(s, v[k][q]));
+                v[k][q] = simd::fmadd(s, vkp, simd::mul(c, v[k][q]));
+            });
+        }
+
+        /*!
+         * @brief Exchange the eigenvalues i < j and their eigenvectors if a[i][i] > a[j][j], without branches
+         */
+        template <Coordinate coordinate, unsigned int size, typename simd, size_t i, size_t j>
+        void jacobi_sort(typename simd::type (&a)[size][size], typename simd::type (&v)[size][size])
+        {
+            const auto ai = a[i][i];
+            const auto aj = a[j][j];
+
+            unroll<size>(
+            [&](auto k)
+            {
+                const auto vki = v[k][i];
+
+                v[k][i] = simd::select_greater(ai, aj, v[k][j], vki);
+                v[k][j] = simd::select_greater(ai, aj, vki, v[k][j]);
+            });
+
+            a[i][i] = simd::min(ai, aj);
+            a[j][j] = simd::max(ai, aj);
+        }
+
+        /*!
+         * @brief Diagonalize a symmetric matrix by Jacobi sweeps, see the introduction of EigenDecomposition.hpp.
+         *        The loops are unrolled at compile time so that the coefficients stay in registers.
+         * @param a holds the upper triangle of the matrix on input, a[p][q] with p <= q, and the eigenvalues in ascending
+         *        order on its diagonal on output. The coefficients below the diagonal are not used.
+         * @param v is the destination of the eigenvectors, v[row][col] being a coefficient of the eigenvector col
+         */
+        template <Coordinate coordinate, unsigned int size, typename simd>
+        void jacobi_eigen(typename simd::type (&a)[size][size], typename simd::type (&v)[size][size])
+        {
+            const auto zero = simd::broadcast(coordinate{0});
+            const auto one  = simd::broadcast(coordinate{1});
+
+            // Scaled to max|a| = 1 so that d^2 + 4 * a_pq^2 cannot overflow
+            auto scale = zero;
+
+            unroll<size>([&](auto p) { unroll<size>([&](auto q) { if constexpr (p <= q) { scale = simd::max(scale, simd::abs(a[p][q])); } }); });
+
+            const auto inverse_scale = simd::div(one, simd::select_non_zero(scale, scale, one));
+
+            unroll<size>(
+            [&](auto p)
+            {
+                unroll<size>(
+                [&](auto q)
+                {
+                    if constexpr (p <= q)
+                    {
+                        a[p][q] = simd::mul(a[p][q], inverse_scale);
+                    }
+
+                    v[p][q] = p == q ? one : zero;
+                });
+            });
+
+            // Stops early once the off-diagonal coefficients of all the lanes are negligible
+            const auto tolerance = simd::broadcast(std::numeric_limits<coordinate>::epsilon());
+
+            for (unsigned int sweep = 0; sweep < jacobi_sweeps<coordinate, size>; ++sweep)
+            {
+                auto off_diagonal = zero;
+
+                unroll<size>(
+                [&](auto p)
+                {
+                    unroll<size>(
+                    [&](auto q)
+                    {
+                        if constexpr (p < q)
+                        {
+                            off_diagonal = simd::max(off_diagonal, simd::abs(a[p][q]));
+                        }
+                    });
+                });
+
+                if (simd::all_less_equal(off_diagonal, tolerance))
+                {
+                    break;
+                }
+
+                unroll<size>([&](auto p) { unroll<size>([&](auto q) { if constexpr (p < q) { jacobi_rotate<coordinate, size, simd, p, q>(a, v); } }); });
+            }
+
+            // Sorting network
+            if constexpr (size == 2)
+            {
+                jacobi_sort<coordinate, size, simd, 0, 1>(a, v);
+            }
+            else if constexpr (size == 3)
+            {
+                jacobi_sort<coordinate, size, simd, 0, 1>(a, v);
+                jacobi_sort<coordinate, size, simd, 1, 2>(a, v);
+                jacobi_sort<coordinate, size, simd, 0, 1>(a, v);
+            }
+            else
+            {
+                jacobi_sort<coordinate, size, simd, 0, 1>(a, v);
+                jacobi_sort<coordinate, size, simd, 2, 3>(a, v);
+                jacobi_sort<coordinate, size, simd, 0, 2>(a, v);
+                jacobi_sort<coordinate, size, simd, 1, 3>(a, v);
+                jacobi_sort<coordinate, size, simd, 1, 2>(a, v);
+            }
+
+            unroll<size>([&](auto p) { a[p][p] = simd::mul(a[p][p], scale); });
+        }
+
+        /*!
+         * @brief Number of rows of the panels of the tridiagonalization, whose reflectors update the rest of the matrix
+         *        at once, and number of rows under which the reflectors are applied one at a time
+         */
+        constexpr size_t tridiagonal_block_size     = 32;
+        constexpr size_t tridiagonal_unblocked_size = 128;
+
+        /*!
+         * @brief Number of reflectors applied at once to the eigenvectors of the tridiagonal matrix
+         */
+        constexpr size_t tridiagonal_apply_block_size = 128;
+
+        /*!
+         * @brief Size of the tridiagonal matrices decomposed by QL iterations instead of being divided
+         */
+        constexpr size_t divide_leaf_size = 32;
+
+        /*!
+         * @brief Largest number of QL iterations per eigenvalue, and of iterations per root of the secular equation, the
+         *        last ones being bisections
+         */
+        constexpr unsigned int ql_iterations      = 30;
+        constexpr unsigned int secular_iterations = 100;
+
+        /*!
+         * @brief Number of Lanczos vectors in addition to the wanted eigenvectors, largest number of restarts, and
+         *        residual under which an eigenpair has converged, relative to epsilon * |A|
+         */
+        constexpr size_t       lanczos_extra_vectors = 32;
+        constexpr unsigned int lanczos_max_restarts  = 1000;
+        constexpr unsigned int lanczos_tolerance     = 64;
+
+        /*!
+         * @brief y = A * v, A being the m x m symmetric matrix whose lower triangle is stored in a. Each row below the
+         *        diagonal is read once, for both its dot product with v and its contribution to the other coefficients
+         *        of y. The rows are split between threads by pairs (i, m - 1 - i) of the same total length, each thread
+         *        accumulating in its own vector.
+         */
+        template <Coordinate coordinate>
+        void symmetric_multiply(size_t m, const coordinate* a, size_t lda, const coordinate* v, coordinate* y)
+        {
+            std::fill(y, y + m, coordinate{0});
+
+            const size_t pairs = (m + 1) / 2;
+            std::mutex   mutex;
+
+            for_each_chunk_concurrently(
+            pairs,
+            1,
+            [&](size_t begin, size_t end)
+            {
+                std::vector<coordinate> local(begin == 0 && end == pairs ? 0 : m);
+                coordinate*             accumulator = local.empty() ? y : local.data();
+
+                for (size_t pair = begin; pair < end; ++pair)
+                {
+                    for (const size_t i : {pair, m - 1 - pair})
+                    {
+                        const coordinate* row = a + i * lda;
+
+                        accumulator[i] += dot_product(row, v, i) + row[i] * v[i];
+                        add_scaled(i, v[i], row, accumulator);
+
+                        if (i == m - 1 - i)
+                        {
+                            break;
+                        }
+                    }
+                }
+
+                if (!local.empty())
+                {
+                    const std::lock_guard lock(mutex);
+                    add_scaled(m, coordinate{1}, accumulator, y);
+                }
+            },
+            concurrency_threshold_for_work(pairs, m * m / 2));
+        }
+
+        /*!
+         * @brief Reflector H = I - tau * v * v^T such that H * x = (0, ..., 0, beta) for the count coefficients of x.
+         *        v overwrites x, except its last coefficient, an implied 1, which receives beta.
+         * @return tau, null if x is already proportional to (0, ..., 0, 1)
+         */
+        template <Coordinate coordinate>
+        coordinate tridiagonal_reflector(coordinate* x, size_t count)
+        {
+            const coordinate alpha = x[count - 1];
+            const coordinate sigma = dot_product(x, x, count - 1);
+
+            if (sigma == 0)
+            {
+                return 0;
+            }
+
+            // beta has the opposite sign of alpha to avoid a cancellation
+            const coordinate beta  = -std::copysign(std::sqrt(alpha * alpha + sigma), alpha);
+            const coordinate scale = coordinate{1} / (alpha - beta);
+
+            for (size_t j = 0; j + 1 < count; ++j)
+            {
+                x[j] *= scale;
+            }
+
+            x[count - 1] = beta;
+
+            return (beta - alpha) / beta;
+        }
+
+        /*!
+         * @brief Tridiagonalization of the leading m x m block of the matrix, one reflector at a time, see
+         *        tridiagonalize
+         * @param w is a buffer of m coefficients
+         */
+        template <Coordinate coordinate>
+        void tridiagonal_unblocked(coordinate* a, size_t lda, size_t m, coordinate* d, coordinate* e, coordinate* tau, coordinate* w)
+        {
+            for (size_t i = m; i-- > 1;)
+            {
+                coordinate* v = a + i * lda;
+
+                tau[i - 1] = tridiagonal_reflector(v, i);
+                e[i - 1]   = v[i - 1];
+
+                if (tau[i - 1] != 0)
+                {
+                    // w = tau * A * v - tau / 2 * (tau * v^T * A * v) * v, then A -= v * w^T + w * v^T
+                    v[i - 1] = 1;
+
+                    symmetric_multiply(i, a, lda, v, w);
+
+                    for (size_t j = 0; j < i; ++j)
+                    {
+                        w[j] *= tau[i - 1];
+                    }
+
+                    add_scaled(i, -tau[i - 1] / 2 * dot_product(w, v, i), v, w);
+
+                    for (size_t r = 0; r < i; ++r)
+                    {
+                        coordinate* row = a + r * lda;
+
+                        add_scaled(r + 1, -v[r], w, row);
+                        add_scaled(r + 1, -w[r], v, row);
+                    }
+
+                    v[i - 1] = e[i - 1];
+                }
+
+                d[i] = v[i];
+            }
+
+            d[0] = a[0];
+        }
+
+        /*!
+         * @brief Reduction of the rows [m - b, m[ of the leading m x m block of the matrix (LAPACK's latrd), the rest of
+         *        the block being left to update: A(:m - b, :m - b) -= V * W^T + W * V^T, V^T being the rows of the panel
+         *        and W^T the b rows of w. The rows of the panel are updated lazily from the reflectors below them, and
+         *        the products w_i = A * v_i corrected by those reflectors. The last coefficients of the reflectors, their
+         *        implied 1, are stored in the matrix until the update.
+         */
+        template <Coordinate coordinate>
+        void tridiagonal_panel(coordinate* a, size_t lda, size_t m, size_t b, coordinate* e, coordinate* tau, coordinate* w, size_t ldw)
+        {
+            const size_t            first = m - b;
+            std::vector<coordinate> products(2 * b);
+
+            for (size_t i = m; i-- > first;)
+            {
+                coordinate* row_i = a + i * lda;
+                coordinate* w_i   = w + (i - first) * ldw;
+
+                for (size_t c = i + 1; c < m; ++c)
+                {
+                    const coordinate* row_c = a + c * lda;
+                    const coordinate* w_c   = w + (c - first) * ldw;
+
+                    add_scaled(i + 1, -w_c[i], row_c, row_i);
+                    add_scaled(i + 1, -row_c[i], w_c, row_i);
+                }
+
+                tau[i - 1]   = tridiagonal_reflector(row_i, i);
+                e[i - 1]     = row_i[i - 1];
+                row_i[i - 1] = 1;
+
+                symmetric_multiply(i, a, lda, row_i, w_i);
+
+                // w_i -= V * (W^T * v_i) + W * (V^T * v_i) over the reflectors of the panel already computed
+                for (size_t c = i + 1; c < m; ++c)
+                {
+                    products[2 * (c - i - 1)]     = dot_product(w + (c - first) * ldw, row_i, i);
+                    products[2 * (c - i - 1) + 1] = dot_product(a + c * lda, row_i, i);
+                }
+
+                for (size_t c = i + 1; c < m; ++c)
+                {
+                    add_scaled(i, -products[2 * (c - i - 1)], a + c * lda, w_i);
+                    add_scaled(i, -products[2 * (c - i - 1) + 1], w + (c - first) * ldw, w_i);
+                }
+
+                for (size_t j = 0; j < i; ++j)
+                {
+                    w_i[j] *= tau[i - 1];
+                }
+
+                add_scaled(i, -tau[i - 1] / 2 * dot_product(w_i, row_i, i), row_i, w_i);
+            }
+        }
+
+        /*!
+         * @brief Householder tridiagonalization A = Q * T * Q^T of a n x n symmetric matrix (LAPACK's sytrd for the upper
+         *        triangle of a matrix stored column by column, the same storage). Q = H_(n-2) * ... * H_0, the reflector
+         *        H_t = I - tau_t * v_t * v_t^T having its coefficients v_t[:t] stored in the row t + 1 of the lower
+         *        triangle and v_t[t] = 1.
+         * @param a holds the lower triangle of the matrix, of leading dimension lda, and the reflectors below the first
+         *        subdiagonal on output. The upper triangle is overwritten.
+         * @param d and e receive the n diagonal and n - 1 subdiagonal coefficients of T, tau the n - 1 factors
+         */
+        template <Coordinate coordinate>
+        void tridiagonalize(coordinate* a, size_t lda, size_t n, coordinate* d, coordinate* e, coordinate* tau)
+        {
+            std::vector<coordinate> w(tridiagonal_block_size * n);
+
+            size_t m = n;
+
+            for (; m > tridiagonal_unblocked_size; m -= tridiagonal_block_size)
+            {
+                const size_t first = m - tridiagonal_block_size;
+                coordinate*  v     = a + first * lda;
+
+                tridiagonal_panel(a, lda, m, tridiagonal_block_size, e, tau, w.data(), n);
+
+                // A(i, j) -= sum of V(i, k) * W(j, k) + W(i, k) * V(j, k), V and W being read transposed
+                multiply_add_blocked_lower<coordinate, true>(first, tridiagonal_block_size, coordinate{-1}, v, lda, w.data(), n, a, lda);
+                multiply_add_blocked_lower<coordinate, true>(first, tridiagonal_block_size, coordinate{-1}, w.data(), n, v, lda, a, lda);
+
+                for (size_t i = first; i < m; ++i)
+                {
+                    a[i * lda + i - 1] = e[i - 1];
+                    d[i]               = a[i * lda + i];
+                }
+            }
+
+            tridiagonal_unblocked(a, lda, m, d, e, tau, w.data());
+        }
+
+        /*!
+         * @brief Z = Q * Z for the cols columns of Z, Q being the result of tridiagonalize. The reflectors are applied by
+         *        panels from H_0, each panel H_(t1-1) * ... * H_t0 = I - V * T^T * V^T being applied with two blocked
+         *        multiplications, as by qr_apply_panel.
+         */
+        template <Coordinate coordinate>
+        void tridiagonal_apply_q(const coordinate* a, size_t lda, size_t n, const coordinate* tau, coordinate* z, size_t ldz, size_t cols)
+        {
+            constexpr size_t block = tridiagonal_apply_block_size;
+
+            std::vector<coordinate> v(block * n);
+            std::vector<coordinate> g(block * block);
+            std::vector<coordinate> t(block * block);
+            std::vector<coordinate> w(block * cols);
+
+            for (size_t t0 = 0; t0 + 1 < n; t0 += block)
+            {
+                const size_t t1 = std::min(t0 + block, n - 1);
+                const size_t b  = t1 - t0;
+                const size_t m  = t1;  // Rows of Z changed by the panel
+
+                // V^T, the reflector t in the row t - t0
+                for (size_t l = 0; l < b; ++l)
+                {
+                    const size_t reflector = t0 + l;
+                    coordinate*  row       = v.data() + l * m;
+
+                    std::copy(a + (reflector + 1) * lda, a + (reflector + 1) * lda + reflector, row);
+                    row[reflector] = 1;
+                    std::fill(row + reflector + 1, row + m, coordinate{0});
+                }
+
+                // T(j, j) = tau_j and T(:j, j) = -tau_j * T(:j, :j) * V(:, :j)^T * v_j
+                for (size_t i = 0; i < b; ++i)
+                {
+                    for (size_t j = i + 1; j < b; ++j)
+                    {
+                        g[i * b + j] = dot_product(v.data() + i * m, v.data() + j * m, t0 + i + 1);
+                    }
+                }
+
+                for (size_t j = 0; j < b; ++j)
+                {
+                    for (size_t i = 0; i < j; ++i)
+                    {
+                        coordinate value = 0;
+
+                        for (size_t l = i; l < j; ++l)
+                        {
+                            value += t[i * b + l] * g[l * b + j];
+                        }
+
+                        t[i * b + j] = -tau[t0 + j] * value;
+                    }
+
+                    t[j * b + j] = tau[t0 + j];
+                }
+
+                // W = T^T * V^T * Z, then Z -= V * W
+                std::fill(w.begin(), w.begin() + static_cast<std::ptrdiff_t>(b * cols), coordinate{0});
+
+                multiply_add_blocked(b, cols, m, coordinate{1}, v.data(), m, z, ldz, w.data(), cols);
+
+                for (size_t i = b; i-- > 0;)
+                {
+                    coordinate* row = w.data() + i * cols;
+
+                    for (size_t j = 0; j < cols; ++j)
+                    {
+                        row[j] *= t[i * b + i];
+                    }
+
+                    for (size_t l = 0; l < i; ++l)
+                    {
+                        add_scaled(cols, t[l * b + i], w.data() + l * cols, row);
+                    }
+                }
+
+                multiply_add_blocked<coordinate, true>(m, cols, b, coordinate{-1}, v.data(), m, w.data(), cols, z, ldz);
+            }
+        }
+
+        /*!
+         * @brief Eigen decomposition of a n x n tridiagonal matrix scaled to max|T| = 1 by implicit QL iterations with
+         *        Wilkinson shifts, the rotations being accumulated in the columns of z if not null. The eigenvalues are
+         *        not sorted.
+         * @param d holds the diagonal on input and the eigenvalues on output
+         * @param e holds the n - 1 subdiagonal coefficients followed by a coefficient used as workspace, overwritten
+         * @return false if an eigenvalue did not converge within ql_iterations iterations
+         */
+        template <Coordinate coordinate>
+        bool tridiagonal_ql(size_t n, coordinate* d, coordinate* e, coordinate* z, size_t ldz)
+        {
+            if (n == 0)
+            {
+                return true;
+            }
+
+            e[n - 1] = 0;
+
+            // Below epsilon * |T|, the subdiagonal coefficients are as negligible as the rounding errors of the
+            // tridiagonalization, even when they are not compared to their diagonal coefficients. Without this absolute
+            // tolerance, tiny blocks would be iterated on until their squares underflow.
+            const coordinate negligible = std::numeric_limits<coordinate>::epsilon();
+
+            for (size_t l = 0; l < n; ++l)
+            {
+                for (unsigned int iteration = 0;; ++iteration)
+                {
+                    // The matrix splits at the first negligible subdiagonal coefficient e[m]
+                    size_t m = l;
+
+                    for (; m + 1 < n; ++m)
+                    {
+                        const coordinate magnitude = std::abs(e[m]);
+
+                        if (magnitude <= negligible || magnitude <= std::numeric_limits<coordinate>::epsilon() * (std::abs(d[m]) + std::abs(d[m + 1])))
+                        {
+                            break;
+                        }
+                    }
+
+                    if (m == l)
+                    {
+                        break;
+                    }
+
+                    if (iteration == ql_iterations)
+                    {
+                        return false;
+                    }
+
+                    // Eigenvalue of the leading 2x2 block closer to d[l]
+                    coordinate g = (d[l + 1] - d[l]) / (2 * e[l]);
+                    coordinate r = std::hypot(g, coordinate{1});
+
+                    g = d[m] - d[l] + e[l] / (g + std::copysign(r, g));
+
+                    coordinate s         = 1;
+                    coordinate c         = 1;
+                    coordinate p         = 0;
+                    bool       underflow = false;
+
+                    for (size_t i = m; i-- > l;)
+                    {
+                        const coordinate f = s * e[i];
+                        const coordinate b = c * e[i];
+
+                        r        = std::hypot(f, g);
+                        e[i + 1] = r;
+
+                        if (r == 0)
+                        {
+                            d[i + 1] -= p;
+                            e[m]      = 0;
+                            underflow = true;
+                            break;
+                        }
+
+                        s = f / r;
+                        c = g / r;
+                        g = d[i + 1] - p;
+                        r = (d[i] - g) * s + 2 * c * b;
+                        p = s * r;
+
+                        d[i + 1] = g + p;
+                        g        = c * r - b;
+
+                        if (z != nullptr)
+                        {
+                            for (size_t k = 0; k < n; ++k)
+                            {
+                                coordinate*      row  = z + k * ldz;
+                                const coordinate next = row[i + 1];
+
+                                row[i + 1] = s * row[i] + c * next;
+                                row[i]     = c * row[i] - s * next;
+                            }
+                        }
+                    }
+
+                    if (!underflow)
+                    {
+                        d[l] -= p;
+                        e[l] = g;
+                        e[m] = 0;
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        /*!
+         * @brief Sort the n eigenvalues in ascending order, with the columns of z if not null
+         */
+        template <Coordinate coordinate>
+        void sort_eigenpairs(size_t n, coordinate* values, coordinate* z, size_t ldz)
+        {
+            std::vector<size_t> order(n);
+            std::iota(order.begin(), order.end(), size_t{0});
+            std::stable_sort(order.begin(), order.end(), [values](size_t i, size_t j) { return values[i] < values[j]; });
+
+            std::vector<coordinate> row(n);
+
+            const auto permute = [&](coordinate* src)
+            {
+                for (size_t i = 0; i < n; ++i)
+                {
+                    row[i] = src[order[i]];
+                }
+
+                std::copy(row.begin(), row.end(), src);
+            };
+
+            permute(values);
+
+            if (z != nullptr)
+            {
+                for (size_t i = 0; i < n; ++i)
+                {
+                    permute(z + i * ldz);
+                }
+            }
+        }
+
+        /*!
+         * @brief Root i of the secular equation f(x) = 1 + rho * sum of w_j^2 / (d_j - x) = 0, d being in ascending
+         *        order and rho positive: the root lies in ]d_i, d_(i+1)[, or in ]d_i, d_i + rho * |w|^2] for the last
+         *        one. It is searched as x = d_o + t from the closer pole d_o, so that d_j - x = (d_j - d_o) - t is
+         *        accurate. Each step solves the approximation of f by its two poles around the root, matching the value
+         *        and derivative of both parts of the sum at t (Bunch, Nielsen and Sorensen), and bisects the bracket of
+         *        the root instead when the step leaves it.
+         * @param delta receives d_j - x for the k coefficients
+         * @return the root x
+         */
+        template <Coordinate coordinate>
+        coordinate secular_root(size_t k, size_t i, const coordinate* d, const coordinate* w, coordinate rho, coordinate* delta)
+        {
+            const bool last = i + 1 == k;
+
+            size_t     origin = i;
+            coordinate lower  = 0;
+            coordinate upper  = 0;
+
+            if (last)
+            {
+                upper = rho * dot_product(w, w, k);
+            }
+            else
+            {
+                const coordinate middle = (d[i + 1] - d[i]) / 2;
+                coordinate       f      = 1;
+
+                for (size_t j = 0; j < k; ++j)
+                {
+                    f += rho * w[j] * w[j] / ((d[j] - d[i]) - middle);
+                }
+
+                if (f >= 0)
+                {
+                    upper = middle;
+                }
+                else
+                {
+                    origin = i + 1;
+                    lower  = -middle;
+                }
+            }
+
+            for (size_t j = 0; j < k; ++j)
+            {
+                delta[j] = d[j] - d[origin];
+            }
+
+            coordinate t = (lower + upper) / 2;
+
+            for (unsigned int iteration = 0; iteration < secular_iterations; ++iteration)
+            {
+                // psi sums the poles up to d_i, phi the poles above
+                coordinate psi  = 0;
+                coordinate dpsi = 0;
+                coordinate phi  = 0;
+                coordinate dphi = 0;
+
+                for (size_t j = 0; j <= i; ++j)
+                {
+                    const coordinate q = w[j] / (delta[j] - t);
+
+                    psi += rho * w[j] * q;
+                    dpsi += rho * q * q;
+                }
+
+                for (size_t j = i + 1; j < k; ++j)
+                {
+                    const coordinate q = w[j] / (delta[j] - t);
+
+                    phi += rho * w[j] * q;
+                    dphi += rho * q * q;
+                }
+
+                const coordinate f = 1 + psi + phi;
+
+                if (std::abs(f) <= std::numeric_limits<coordinate>::epsilon() * (8 * (phi - psi) + 1 + std::abs(t) * (dpsi + dphi)))
+                {
+                    break;
+                }
+
+                if (f < 0)
+                {
+                    lower = t;
+                }
+                else
+                {
+                    upper = t;
+                }
+
+                // Root s of c + b1 / (d1 - s) + b2 / (d2 - s), s being the step from t and d1 < 0 < d2 the poles around t
+                const coordinate d1 = delta[i] - t;
+                const coordinate b1 = dpsi * d1 * d1;
+                coordinate       step;
+
+                if (last)
+                {
+                    const coordinate c = f - dpsi * d1;
+
+                    step = c > 0 ? d1 + b1 / c : upper - t;
+                }
+                else
+                {
+                    const coordinate d2 = delta[i + 1] - t;
+                    const coordinate b2 = dphi * d2 * d2;
+                    const coordinate c  = f - dpsi * d1 - dphi * d2;
+
+                    // c * s^2 - b * s + d1 * d2 * f = 0, the root between d1 and d2 being computed without cancellation
+                    const coordinate b       = c * (d1 + d2) + b1 + b2;
+                    const coordinate product = d1 * d2 * f;
+
+                    if (c == 0)
+                    {
+                        step = product / b;
+                    }
+                    else
+                    {
+                        const coordinate q     = (b + std::copysign(std::sqrt(std::max(b * b - 4 * c * product, coordinate{0})), b)) / 2;
+                        const coordinate first = q / c;
+
+                        step = d1 < first && first < d2 ? first : product / q;
+                    }
+                }
+
+                // The last root may be the upper bound itself, the other bounds are poles
+                coordinate next = t + step;
+
+                if (!(lower < next && (next < upper || (last && next == upper))))
+                {
+                    next = (lower + upper) / 2;
+                }
+
+                if (next == t)
+                {
+                    break;
+                }
+
+                t = next;
+            }
+
+            for (size_t j = 0; j < k; ++j)
+            {
+                delta[j] -= t;
+            }
+
+            return d[origin] + t;
+        }
+
+        /*!
+         * @brief Merge of the eigen decompositions Q1 * D1 * Q1^T and Q2 * D2 * Q2^T of the halves T1 and T2 of a n x n
+         *        tridiagonal matrix T = diag(T1, T2) + rho * u * u^T, u having a 1 at the rows n1 - 1 and n1 (the second
+         *        one being negated if negative), T1 and T2 having rho subtracted from their last and first diagonal
+         *        coefficients. T = Q * (D + rho * z * z^T) * Q^T, Q = diag(Q1, Q2) and z = Q^T * u:
+         *        - the eigenvalues d_j whose coefficient z_j is negligible are eigenvalues of T, as are those rotated
+         *          with a close d_j so that one of their coefficients vanishes. Such eigenvectors are columns of Q.
+         *        - the k others are the roots of the secular equation, see secular_root. Their eigenvectors are the
+         *          products of the columns of Q and of U, U(j, i) = zhat_j / (d_j - lambda_i), zhat being recomputed from
+         *          the roots. The columns of Q being non null in the first half of the rows, in the second, or in both
+         *          after a rotation, the product is done by two blocked multiplications, one per half of the rows.
+         * @param d holds the eigenvalues of the halves, and those of T on output, in no particular order, the k roots
+         *        coming first
+         * @param z holds Q in the n x n block, and the eigenvectors of T on output, in the columns matching d
+         */
+        template <Coordinate coordinate>
+        void divide_merge(size_t n, size_t n1, coordinate* d, coordinate rho, bool negative, coordinate* z, size_t ldz)
+        {
+            // Scaled to |z| = 1, the rows of Q1 and Q2 being of length 1
+            const coordinate        scale = coordinate{1} / std::sqrt(coordinate{2});
+            std::vector<coordinate> w(n);
+
+            for (size_t j = 0; j < n1; ++j)
+            {
+                w[j] = scale * z[(n1 - 1) * ldz + j];
+            }
+
+            for (size_t j = n1; j < n; ++j)
+            {
+                w[j] = (negative ? -scale : scale) * z[n1 * ldz + j];
+            }
+
+            rho *= 2;
+
+            coordinate largest_d = 0;
+            coordinate largest_w = 0;
+
+            for (size_t j = 0; j < n; ++j)
+            {
+                largest_d = std::max(largest_d, std::abs(d[j]));
+                largest_w = std::max(largest_w, std::abs(w[j]));
+            }
+
+            const coordinate tolerance = 8 * std::numeric_limits<coordinate>::epsilon() * std::max(largest_d, largest_w);
+
+            if (rho * largest_w <= tolerance)
+            {
+                return;
+            }
+
+            std::vector<size_t> order(n);
+            std::iota(order.begin(), order.end(), size_t{0});
+            std::stable_sort(order.begin(), order.end(), [d](size_t i, size_t j) { return d[i] < d[j]; });
+
+            // Halves of the rows where the columns of Q are non null: 1 for the first, 2 for the second, 3 for both
+            std::vector<unsigned char> halves(n);
+
+            for (size_t j = 0; j < n; ++j)
+            {
+                halves[j] = j < n1 ? 1 : 2;
+            }
+
+            // Deflation, the others being kept in ascending order
+            std::vector<size_t> kept;
+            kept.reserve(n);
+
+            size_t previous = n;
+
+            for (const size_t j : order)
+            {
+                if (rho * std::abs(w[j]) <= tolerance)
+                {
+                    continue;
+                }
+
+                if (previous != n)
+                {
+                    // The rotation cancelling w_previous leaves an off-diagonal coefficient (d_j - d_previous) * c * s
+                    const coordinate r = std::sqrt(w[previous] * w[previous] + w[j] * w[j]);
+                    const coordinate c = w[j] / r;
+                    const coordinate s = -w[previous] / r;
+
+                    if (std::abs((d[j] - d[previous]) * c * s) <= tolerance)
+                    {
+                        for (size_t i = 0; i < n; ++i)
+                        {
+                            coordinate*      row = z + i * ldz;
+                            const coordinate x   = row[previous];
+
+                            row[previous] = c * x + s * row[j];
+                            row[j]        = c * row[j] - s * x;
+                        }
+
+                        const coordinate d_previous = d[previous];
+
+                        d[previous] = d_previous * c * c + d[j] * s * s;
+                        d[j]        = d_previous * s * s + d[j] * c * c;
+                        w[previous] = 0;
+                        w[j]        = r;
+                        halves[j] |= halves[previous];
+                        previous = j;
+                        continue;
+                    }
+
+                    kept.push_back(previous);
+                }
+
+                previous = j;
+            }
+
+            kept.push_back(previous);
+
+            const size_t k = kept.size();
+
+            std::vector<coordinate> dk(k);
+            std::vector<coordinate> wk(k);
+            std::vector<coordinate> roots(k);
+            std::vector<coordinate> u(k * k);  // Row i: d_j - lambda_i, then the eigenvector i
+
+            for (size_t i = 0; i < k; ++i)
+            {
+                dk[i] = d[kept[i]];
+                wk[i] = w[kept[i]];
+            }
+
+            const size_t threshold = concurrency_threshold_for_work(k, k * k * 16);
+
+            for_each_chunk_concurrently(
+            k,
+            1,
+            [&](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    roots[i] = secular_root(k, i, dk.data(), wk.data(), rho, u.data() + i * k);
+                }
+            },
+            threshold);
+
+            // zhat_j^2 = prod of (lambda_i - d_j) / prod of (d_i - d_j) for i != j, up to the factor rho
+            std::vector<coordinate> zhat(k);
+
+            for_each_chunk_concurrently(
+            k,
+            1,
+            [&](size_t begin, size_t end)
+            {
+                for (size_t j = begin; j < end; ++j)
+                {
+                    coordinate product = u[j * k + j];
+
+                    for (size_t i = 0; i < k; ++i)
+                    {
+                        if (i != j)
+                        {
+                            product *= u[i * k + j] / (dk[j] - dk[i]);
+                        }
+                    }
+
+                    zhat[j] = std::copysign(std::sqrt(std::max(-product, coordinate{0})), wk[j]);
+                }
+            },
+            threshold);
+
+            // Columns of Q in the order first half only, both halves, second half only
+            std::vector<size_t> grouped;
+            grouped.reserve(k);
+
+            for (const unsigned char half : {1, 3, 2})
+            {
+                for (size_t j = 0; j < k; ++j)
+                {
+                    if (halves[kept[j]] == half)
+                    {
+                        grouped.push_back(j);
+                    }
+                }
+            }
+
+            const auto   count_half  = [&](unsigned char half) { return static_cast<size_t>(std::count_if(kept.begin(), kept.end(), [&](size_t j) { return halves[j] == half; })); };
+            const size_t first_count = count_half(1);
+            const size_t last_count  = count_half(2);
+
+            // Eigenvectors of D + rho * zhat * zhat^T in the rows of u, their coefficients permuted to the grouped order
+            for_each_chunk_concurrently(
+            k,
+            1,
+            [&](size_t begin, size_t end)
+            {
+                std::vector<coordinate> vector(k);
+
+                for (size_t i = begin; i < end; ++i)
+                {
+                    coordinate* row = u.data() + i * k;
+
+                    for (size_t g = 0; g < k; ++g)
+                    {
+                        vector[g] = zhat[grouped[g]] / row[grouped[g]];
+                    }
+
+                    const coordinate inverse_norm = coordinate{1} / std::sqrt(dot_product(vector.data(), vector.data(), k));
+
+                    for (size_t g = 0; g < k; ++g)
+                    {
+                        row[g] = vector[g] * inverse_norm;
+                    }
+                }
+            },
+            threshold);
+
+            // U, the eigenvectors in columns
+            for (size_t i = 0; i < k; ++i)
+            {
+                for (size_t j = i + 1; j < k; ++j)
+                {
+                    std::swap(u[i * k + j], u[j * k + i]);
+                }
+            }
+
+            std::vector<coordinate> q(n * k);
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                for (size_t g = 0; g < k; ++g)
+                {
+                    q[i * k + g] = z[i * ldz + kept[grouped[g]]];
+                }
+            }
+
+            // The deflated eigenpairs in the first k columns move to the columns after k of the kept ones, in q
+            std::vector<bool> is_kept(n);
+
+            for (const size_t j : kept)
+            {
+                is_kept[j] = true;
+            }
+
+            size_t destination = k;
+
+            for (size_t source = 0; source < k; ++source)
+            {
+                if (is_kept[source])
+                {
+                    continue;
+                }
+
+                while (!is_kept[destination])
+                {
+                    ++destination;
+                }
+
+                for (size_t i = 0; i < n; ++i)
+                {
+                    z[i * ldz + destination] = z[i * ldz + source];
+                }
+
+                d[destination++] = d[source];
+            }
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                std::fill(z + i * ldz, z + i * ldz + k, coordinate{0});
+            }
+
+            multiply_add_blocked(n1, k, k - last_count, coordinate{1}, q.data(), k, u.data(), k, z, ldz);
+            multiply_add_blocked(n - n1, k, k - first_count, coordinate{1}, q.data() + n1 * k + first_count, k, u.data() + first_count * k, k, z + n1 * ldz, ldz);
+
+            std::copy(roots.begin(), roots.end(), d);
+        }
+
+        /*!
+         * @brief Eigen decomposition of a n x n tridiagonal matrix scaled to max|T| = 1 by divide and conquer, see
+         *        divide_merge. The eigenvalues are not sorted.
+         * @param d holds the diagonal on input and the eigenvalues on output
+         * @param e holds the n - 1 subdiagonal coefficients
+         * @param z receives the eigenvectors in the columns of its n x n block, the matching eigenvalue in d
+         * @return false if the QL iterations of a small block did not converge
+         */
+        template <Coordinate coordinate>
+        bool tridiagonal_divide(size_t n, coordinate* d, const coordinate* e, coordinate* z, size_t ldz)
+        {
+            if (n <= divide_leaf_size)
+            {
+                for (size_t i = 0; i < n; ++i)
+                {
+                    std::fill(z + i * ldz, z + i * ldz + n, coordinate{0});
+                    z[i * ldz + i] = 1;
+                }
+
+                std::vector<coordinate> subdiagonal(e, e + n);
+
+                return tridiagonal_ql(n, d, subdiagonal.data(), z, ldz);
+            }
+
+            const size_t     n1  = n / 2;
+            const coordinate rho = std::abs(e[n1 - 1]);
+
+            d[n1 - 1] -= rho;
+            d[n1] -= rho;
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                coordinate* row = z + i * ldz;
+
+                i < n1 ? std::fill(row + n1, row + n, coordinate{0}) : std::fill(row, row + n1, coordinate{0});
+            }
+
+            if (!tridiagonal_divide(n1, d, e, z, ldz) || !tridiagonal_divide(n - n1, d + n1, e + n1, z + n1 * ldz + n1, ldz))
+            {
+                return false;
+            }
+
+            divide_merge(n, n1, d, rho, e[n1 - 1] < 0, z, ldz);
+
+            return true;
+        }
+
+        /*!
+         * @brief Eigenvalues in ascending order, and eigenvectors in place of the n x n symmetric matrix a of leading
+         *        dimension lda if vectors is true, see eigen_symmetric
+         */
+        template <Coordinate coordinate>
+        bool symmetric_eigen(coordinate* a, size_t lda, size_t n, coordinate* values, bool vectors)
+        {
+            if (n == 0)
+            {
+                return true;
+            }
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                if (!std::all_of(a + i * lda, a + i * lda + i + 1, [](coordinate value) { return std::isfinite(value); }))
+                {
+                    return false;
+                }
+            }
+
+            std::vector<coordinate> e(n);
+            std::vector<coordinate> tau(n);
+
+            tridiagonalize(a, lda, n, values, e.data(), tau.data());
+
+            // Scaled to max|T| = 1, the tolerances of the tridiagonal solvers being relative to it
+            coordinate largest = 0;
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                largest = std::max({largest, std::abs(values[i]), i + 1 < n ? std::abs(e[i]) : coordinate{0}});
+            }
+
+            const coordinate scale = largest == 0 ? coordinate{1} : largest;
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                values[i] /= scale;
+                e[i] /= scale;
+            }
+
+            std::vector<coordinate> z(vectors ? n * n : 0);
+
+            const bool converged = vectors ? tridiagonal_divide(n, values, e.data(), z.data(), n) : tridiagonal_ql<coordinate>(n, values, e.data(), nullptr, 0);
+
+            if (!converged)
+            {
+                return false;
+            }
+
+            sort_eigenpairs(n, values, vectors ? z.data() : nullptr, n);
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                values[i] *= scale;
+            }
+
+            if (vectors)
+            {
+                tridiagonal_apply_q(a, lda, n, tau.data(), z.data(), n, n);
+
+                for (size_t i = 0; i < n; ++i)
+                {
+                    std::copy(z.data() + i * n, z.data() + (i + 1) * n, a + i * lda);
+                }
+            }
+
+            return true;
+        }
+
+        /*!
+         * @brief y = A * x, A being the whole n x n matrix of leading dimension lda, the rows being split between threads
+         */
+        template <Coordinate coordinate>
+        void lanczos_multiply(const coordinate* a, size_t lda, size_t n, const coordinate* x, coordinate* y)
+        {
+            for_each_chunk_concurrently(
+            n,
+            1,
+            [=](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    y[i] = dot_product(a + i * lda, x, n);
+                }
+            },
+            concurrency_threshold_for_work(n, n * n));
+        }
+
+        /*!
+         * @brief v -= V * (V^T * v) twice (classical Gram-Schmidt with reorthogonalization), V being the first count
+         *        rows of basis
+         * @param coefficients receives V^T * v
+         */
+        template <Coordinate coordinate>
+        void lanczos_orthogonalize(const coordinate* basis, size_t n, size_t count, coordinate* v, coordinate* coefficients)
+        {
+            std::fill(coefficients, coefficients + count, coordinate{0});
+
+            std::vector<coordinate> products(count);
+
+            for (unsigned int pass = 0; pass < 2; ++pass)
+            {
+                for (size_t l = 0; l < count; ++l)
+                {
+                    products[l] = dot_product(basis + l * n, v, n);
+                }
+
+                for (size_t l = 0; l < count; ++l)
+                {
+                    add_scaled(n, -products[l], basis + l * n, v);
+                    coefficients[l] += products[l];
+                }
+            }
+        }
+
+        /*!
+         * @brief Thick restarted Lanczos iterations, see eigen_symmetric_lanczos. The basis V of m orthonormal vectors is
+         *        extended from the kept ones by v_(j+1) = A * v_j orthogonalized against V, and H = V^T * A * V is
+         *        obtained from the orthogonalization coefficients. Its eigenvectors S give the Ritz vectors V * S, whose
+         *        residuals are |beta * S(m - 1, i)|, beta being the norm of the last orthogonalized vector. If they have
+         *        not all converged, the basis restarts from the Ritz vectors of the wanted end of the spectrum and the
+         *        last vector, H being then diagonal but for its last row and column (Wu and Simon). A and the eigenvectors
+         *        have the leading dimensions lda and ldvectors.
+         */
+        template <Coordinate coordinate>
+        bool lanczos(const coordinate* a,
+                     size_t            lda,
+                     size_t            n,
+                     size_t            count,
+                     coordinate*       values,
+                     coordinate*       vectors,
+                     size_t            ldvectors,
+                     bool              largest)
+        {
+            constexpr coordinate epsilon = std::numeric_limits<coordinate>::epsilon();
+
+            const size_t m = std::min(n, std::max(2 * count, count + lanczos_extra_vectors));
+
+            std::vector<coordinate> basis((m + 1) * n);
+            std::vector<coordinate> h(m * m);
+            std::vector<coordinate> ritz(m * m);
+            std::vector<coordinate> theta(m);
+            std::vector<coordinate> coefficients(m + 1);
+
+            // Default seed, for reproducible results
+            std::mt19937                               generator;
+            std::uniform_real_distribution<coordinate> distribution(-1, 1);
+
+            const auto random_vector = [&](coordinate* v, size_t previous)
+            {
+                std::generate(v, v + n, [&]() { return distribution(generator); });
+                lanczos_orthogonalize(basis.data(), n, previous, v, coefficients.data());
+
+                return std::sqrt(dot_product(v, v, n));
+            };
+
+            const coordinate initial_norm = random_vector(basis.data(), 0);
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                basis[i] /= initial_norm;
+            }
+
+            const size_t first     = largest ? m - count : 0;
+            size_t       kept      = 0;
+            coordinate   beta      = 0;
+            coordinate   norm      = 0;
+            bool         converged = false;
+
+            for (unsigned int restart = 0;; ++restart)
+            {
+                for (size_t j = kept; j < m; ++j)
+                {
+                    coordinate* v = basis.data() + j * n;
+                    coordinate* w = v + n;
+
+                    lanczos_multiply(a, lda, n, v, w);
+                    lanczos_orthogonalize(basis.data(), n, j + 1, w, coefficients.data());
+
+                    for (size_t l = 0; l <= j; ++l)
+                    {
+                        h[l * m + j] = coefficients[l];
+                        h[j * m + l] = coefficients[l];
+                    }
+
+                    beta = std::sqrt(dot_product(w, w, n));
+                    norm = std::max({norm, std::abs(h[j * m + j]), beta});
+
+                    // In an invariant subspace, the basis is extended by a random vector instead
+                    if (beta <= epsilon * norm)
+                    {
+                        beta = 0;
+
+                        const coordinate random_norm = j + 1 < n ? random_vector(w, j + 1) : coordinate{0};
+                        const coordinate inverse     = random_norm > epsilon ? coordinate{1} / random_norm : coordinate{0};
+
+                        for (size_t i = 0; i < n; ++i)
+                        {
+                            w[i] *= inverse;
+                        }
+                    }
+                    else
+                    {
+                        for (size_t i = 0; i < n; ++i)
+                        {
+                            w[i] /= beta;
+                        }
+                    }
+
+                    if (j + 1 < m)
+                    {
+                        h[(j + 1) * m + j] = beta;
+                        h[j * m + j + 1]   = beta;
+                    }
+                }
+
+                std::copy(h.begin(), h.end(), ritz.begin());
+                symmetric_eigen(ritz.data(), m, m, theta.data(), true);
+
+                norm = std::max({norm, std::abs(theta[0]), std::abs(theta[m - 1])});
+
+                converged = true;
+
+                for (size_t i = first; i < first + count; ++i)
+                {
+                    converged = converged && std::abs(beta * ritz[(m - 1) * m + i]) <= lanczos_tolerance * epsilon * norm;
+                }
+
+                if (converged || restart == lanczos_max_restarts)
+                {
+                    break;
+                }
+
+                // The wanted Ritz vectors, and as many of the next ones as half the other vectors
+                kept = std::min(count + (m - count) / 2, m - 1);
+
+                const size_t            begin = largest ? m - kept : 0;
+                std::vector<coordinate> transposed(kept * m);
+                std::vector<coordinate> restarted(kept * n);
+
+                for (size_t l = 0; l < kept; ++l)
+                {
+                    for (size_t r = 0; r < m; ++r)
+                    {
+                        transposed[l * m + r] = ritz[r * m + begin + l];
+                    }
+                }
+
+                multiply_add_blocked(kept, n, m, coordinate{1}, transposed.data(), m, basis.data(), n, restarted.data(), n);
+
+                std::copy(restarted.begin(), restarted.end(), basis.begin());
+                std::copy(basis.begin() + static_cast<std::ptrdiff_t>(m * n), basis.end(), basis.begin() + static_cast<std::ptrdiff_t>(kept * n));
+
+                std::fill(h.begin(), h.end(), coordinate{0});
+
+                for (size_t l = 0; l < kept; ++l)
+                {
+                    h[l * m + l]    = theta[begin + l];
+                    h[l * m + kept] = beta * ritz[(m - 1) * m + begin + l];
+                    h[kept * m + l] = h[l * m + kept];
+                }
+            }
+
+            // Ritz vectors V^T * S of the wanted eigenvalues
+            std::vector<coordinate> selected(m * count);
+
+            for (size_t r = 0; r < m; ++r)
+            {
+                std::copy(ritz.begin() + static_cast<std::ptrdiff_t>(r * m + first),
+                          ritz.begin() + static_cast<std::ptrdiff_t>(r * m + first + count),
+                          selected.begin() + static_cast<std::ptrdiff_t>(r * count));
+            }
+
+            std::copy(theta.begin() + static_cast<std::ptrdiff_t>(first), theta.begin() + static_cast<std::ptrdiff_t>(first + count), values);
+            for (size_t i = 0; i < n; ++i)
+            {
+                std::fill(vectors + i * ldvectors, vectors + i * ldvectors + count, coordinate{0});
+            }
+
+            multiply_add_blocked<coordinate, true>(n, count, m, coordinate{1}, basis.data(), n, selected.data(), count, vectors, ldvectors);
+
+            return converged;
+        }
+
+        /*!
+         * @brief Check that a matrix of size coefficients has n rows and n columns
+         * @throw std::invalid_argument if size is not n^2
+         */
+        inline void check_eigen_matrix_size(size_t size, size_t n)
+        {
+            if (size != n * n)
+            {
+                throw std::invalid_argument("The matrix to decompose must have as many rows and columns as the eigenvectors have coefficients");
+            }
+        }
+
+        // NOLINTEND(readability-identifier-length)
+    }  // namespace ImplementationDetails
+
+    // NOLINTBEGIN(readability-identifier-length)
+    template <Coordinate coordinate, unsigned int size, StorageOrder order>
+    SymmetricEigenDecomposition<coordinate, size, order> eigenSymmetric(const Matrix<coordinate, size, size, order>& matrix)
+    requires(2 <= size && size <= 4 && std::is_floating_point_v<coordinate>)
+    {
+        using simd = ImplementationDetails::ScalarPack<coordinate>;
+
+        coordinate a[size][size] = {};
+        coordinate v[size][size];
+
+        for (unsigned int p = 0; p < size; ++p)
+        {
+            for (unsigned int q = p; q < size; ++q)
+            {
+                a[p][q] = matrix(p, q);
+            }
+        }
+
+        ImplementationDetails::jacobi_eigen<coordinate, size, simd>(a, v);
+
+        SymmetricEigenDecomposition<coordinate, size, order> result;
+
+        for (unsigned int p = 0; p < size; ++p)
+        {
+            result.eigenvalues[p] = a[p][p];
+
+            for (unsigned int q = 0; q < size; ++q)
+            {
+                result.eigenvectors(p, q) = v[p][q];
+            }
+        }
+
+        return result;
+    }
+
+    template <Coordinate coordinate, unsigned int size, StorageOrder order>
+    void eigenSymmetric(std::type_identity_t<std::span<const Matrix<coordinate, size, size, order>>> matrices,
+                        VectorArray<coordinate, size>&                                                 eigenvalues,
+                        std::type_identity_t<std::span<Matrix<coordinate, size, size, order>>>       eigenvectors)
+    requires(2 <= size && size <= 4 && std::is_floating_point_v<coordinate>)
+    {
+        ImplementationDetails::check_same_count(eigenvalues, matrices.size());
+
+        if (eigenvectors.size() != matrices.size())
+        {
+            throw std::invalid_argument("The destination must have the same number of matrices");
+        }
+
+        const auto dst = ImplementationDetails::lanes_of(eigenvalues);
+
+        ImplementationDetails::for_each_matrix_pack(matrices,
+                                                    [dst, eigenvectors](auto pack, const auto& lanes, size_t i, size_t index)
+                                                    {
+                                                        using simd = decltype(pack);
+
+                                                        typename simd::type a[size][size];
+                                                        typename simd::type v[size][size];
+
+                                                        for (unsigned int p = 0; p < size; ++p)
+                                                        {
+                                                            for (unsigned int q = p; q < size; ++q)
+                                                            {
+                                                                a[p][q] = simd::load(lanes[p * size + q].data() + i);
+                                                            }
+                                                        }
+
+                                                        ImplementationDetails::jacobi_eigen<coordinate, size, simd>(a, v);
+
+                                                        coordinate values[simd::width];
+
+                                                        for (unsigned int p = 0; p < size; ++p)
+                                                        {
+                                                            simd::store(dst[p] + index, a[p][p]);
+
+                                                            for (unsigned int q = 0; q < size; ++q)
+                                                            {
+                                                                simd::store(values, v[p][q]);
+
+                                                                for (size_t lane = 0; lane < simd::width; ++lane)
+                                                                {
+                                                                    eigenvectors[index + lane](p, q) = values[lane];
+                                                                }
+                                                            }
+                                                        }
+                                                    });
+    }
+
+    template <Coordinate coordinate>
+    bool eigen_symmetric(std::span<coordinate> matrix, std::span<coordinate> eigenvalues) requires(std::is_floating_point_v<coordinate>)
+    {
+        ImplementationDetails::check_eigen_matrix_size(matrix.size(), eigenvalues.size());
+
+        return ImplementationDetails::symmetric_eigen(matrix.data(), eigenvalues.size(), eigenvalues.size(), eigenvalues.data(), true);
+    }
+
+    template <Coordinate coordinate>
+    bool eigenvalues_symmetric(std::span<coordinate> matrix, std::span<coordinate> eigenvalues) requires(std::is_floating_point_v<coordinate>)
+    {
+        ImplementationDetails::check_eigen_matrix_size(matrix.size(), eigenvalues.size());
+
+        return ImplementationDetails::symmetric_eigen(matrix.data(), eigenvalues.size(), eigenvalues.size(), eigenvalues.data(), false);
+    }
+
+    template <Coordinate coordinate>
+    bool eigen_symmetric_lanczos(std::span<const coordinate> matrix,
+                                 std::span<coordinate>       eigenvalues,
+                                 std::span<coordinate>       eigenvectors,
+                                 Spectrum                    spectrum) requires(std::is_floating_point_v<coordinate>)
+    {
+        const size_t count = eigenvalues.size();
+        const size_t n     = count == 0 ? 0 : eigenvectors.size() / count;
+
+        if (count == 0 || count > n || eigenvectors.size() != n * count)
+        {
+            throw std::invalid_argument("The eigenvectors must have between 1 and as many columns as rows, one per eigenvalue");
+        }
+
+        ImplementationDetails::check_eigen_matrix_size(matrix.size(), n);
+
+        return ImplementationDetails::lanczos(matrix.data(),
+                                              n,
+                                              n,
+                                              count,
+                                              eigenvalues.data(),
+                                              eigenvectors.data(),
+                                              count,
+                                              spectrum == Spectrum::Largest);
+    }
+    // NOLINTEND(readability-identifier-length)
+}  // namespace LCNS::Algebra
@@ -0,0 +1,899 @@
+#pragma once
+
+#include "algebra/BlockedMultiplication.hpp"
+#include "algebra/Concurrency.hpp"
+#include "algebra/Matrix.hpp"
+#include "algebra/VectorKernels.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+/*
+ * Krylov solvers of A * x = b for large operators which are only known by their products with vectors:
+ * - conjugate_gradient for symmetric positive definite A, with a symmetric positive definite preconditioner M applied
+ *   on both sides, in 4n work coefficients.
+ * - bicgstab for general A (van der Vorst), right preconditioned, two products by A per iteration, in 7n.
+ * - gmres, restarted every restart iterations (Saad and Schultz), right preconditioned so that the residual it
+ *   minimizes is the one of the original system. The Arnoldi basis is orthogonalized by modified Gram-Schmidt and the
+ *   Hessenberg matrix reduced by Givens rotations as it grows, the residual norm being known at each iteration
+ *   without computing x. It needs (restart + 3) * n coefficients plus O(restart^2).
+ *
+ * The operator is a dense Matrix, a SparseMatrix in compressed rows, or any callable op(x, y) computing y = A * x
+ * from spans. The preconditioners, whose application z = M^-1 * r has the same form, are set up once: the inverse of
+ * the diagonal (Jacobi), or the incomplete Cholesky factor L * L^T ~ A restricted to the sparsity pattern of A (IC(0)).
+ * No work vector is allocated by the solvers, which run in a workspace provided by the caller, of a size given by
+ * the *_workspace_size functions, so that it can be reused between solves. The operations on vectors are the level 1
+ * kernels of VectorKernels.hpp, split between threads for long vectors.
+ *
+ * The iterations stop once |b - A * x| <= tolerance * |b|, as tracked by the recurrences of the methods, which may
+ * drift from the true residual by a few epsilon * |A| * |x|. The result reports the true residual, computed at the end.
+ */
+
+namespace LCNS::Algebra
+{
+    /*!
+     * \brief Outcome of an iterative solve
+     */
+    template <Coordinate coordinate>
+    struct KrylovResult
+    {
+        bool         converged  = false;  // The residual of the recurrence fell below the tolerance
+        unsigned int iterations = 0;      // Number of iterations, of products by the preconditioned operator for GMRES
+        coordinate   residual   = 0;      // |b - A * x| / |b| for the returned x
+    };
+
+    /*!
+     * \brief Square sparse matrix in compressed sparse rows (CSR): the coefficients of row i are values[k] for k in
+     *        [row_offsets[i], row_offsets[i + 1][, in the columns columns[k], increasing within each row
+     */
+    template <Coordinate coordinate>
+    struct SparseMatrix
+    {
+        size_t                  size = 0;
+        std::vector<size_t>     row_offsets;  // size + 1 offsets, the first one being 0
+        std::vector<size_t>     columns;
+        std::vector<coordinate> values;
+
+        /*!
+         * \brief y = A * x, the rows being split between threads for large matrices
+         */
+        void operator()(std::span<const coordinate> x, std::span<coordinate> y) const;
+    };
+
+    /*!
+     * \brief No preconditioning, z = r
+     */
+    struct IdentityPreconditioner
+    {
+        template <Coordinate coordinate>
+        void operator()(std::span<const coordinate> r, std::span<coordinate> z) const
+        {
+            std::copy(r.begin(), r.end(), z.begin());
+        }
+    };
+
+    /*!
+     * \brief Jacobi preconditioner M = diag(A), cheap and effective when A is diagonally dominant with diagonal
+     *        coefficients of different magnitudes
+     */
+    template <Coordinate coordinate>
+    class JacobiPreconditioner
+    {
+    public:
+        /*!
+         * \brief Set up from the diagonal of A
+         * @throw std::invalid_argument if a diagonal coefficient is null
+         */
+        explicit JacobiPreconditioner(std::span<const coordinate> diagonal);
+
+        /*!
+         * \brief Set up from the diagonal of a sparse matrix
+         * @throw std::invalid_argument if a diagonal coefficient is null or missing
+         */
+        explicit JacobiPreconditioner(const SparseMatrix<coordinate>& matrix);
+
+        /*!
+         * \brief Set up from the diagonal of a dense matrix
+         * @throw std::invalid_argument if a diagonal coefficient is null
+         */
+        template <unsigned int size, StorageOrder order>
+        explicit JacobiPreconditioner(const Matrix<coordinate, size, size, order>& matrix);
+
+        /*!
+         * \brief z = diag(A)^-1 * r
+         */
+        void operator()(std::span<const coordinate> r, std::span<coordinate> z) const;
+
+    private:
+        std::vector<coordinate> _inverse_diagonal;
+    };
+
+    /*!
+     * \brief Incomplete Cholesky preconditioner without fill-in, IC(0): M = L * L^T, L having the sparsity pattern of
+     *        the lower triangle of A, for symmetric positive definite sparse matrices such as discretized diffusion
+     *        operators. When a pivot is not positive, which may happen even for positive definite matrices, A is
+     *        replaced by A + shift * diag(A), the shift starting at 1e-3 and doubling until the factorization succeeds.
+     */
+    template <Coordinate coordinate>
+    class IncompleteCholeskyPreconditioner
+    {
+    public:
+        /*!
+         * \brief Factorize the lower triangle of the matrix
+         * @throw std::invalid_argument if a diagonal coefficient is missing or not positive
+         */
+        explicit IncompleteCholeskyPreconditioner(const SparseMatrix<coordinate>& matrix);
+
+        /*!
+         * \brief z = (L * L^T)^-1 * r, by a forward and a backward substitution in place in z
+         */
+        void operator()(std::span<const coordinate> r, std::span<coordinate> z) const;
+
+        /*!
+         * \brief Shift of the diagonal needed by the factorization, 0 if none
+         */
+        coordinate shift() const { return _shift; }
+
+    private:
+        SparseMatrix<coordinate> _factor;  // L row by row, the diagonal coefficient last in each row
+        coordinate               _shift = 0;
+    };
+
+    /*!
+     * \brief Number of coefficients of the workspaces of conjugate_gradient, bicgstab and gmres for n unknowns
+     */
+    constexpr size_t conjugate_gradient_workspace_size(size_t n) { return 4 * n; }
+    constexpr size_t bicgstab_workspace_size(size_t n) { return 7 * n; }
+    constexpr size_t gmres_workspace_size(size_t n, size_t restart) { return (restart + 3) * n + (restart + 1) * restart + 4 * restart + 1; }
+
+    /*!
+     * \brief Preconditioned conjugate gradient solve of A * x = b, A being symmetric positive definite, see the
+     *        introduction of IterativeSolvers.hpp
+     * @param op is the operator A: a Matrix, a SparseMatrix or a callable op(x, y) computing y = A * x
+     * @param b is the right hand side
+     * @param x holds the initial guess on input, for instance zeros, and the solution on output
+     * @param workspace holds at least conjugate_gradient_workspace_size(n) coefficients, overwritten
+     * @param tolerance is the relative residual |b - A * x| / |b| under which the iterations stop
+     * @param max_iterations is the largest number of iterations
+     * @param preconditioner is the symmetric positive definite preconditioner M, a callable preconditioner(r, z)
+     *        computing z = M^-1 * r
+     * @return whether the iterations converged, their number and the true relative residual. They also stop without
+     *         converging if A or M turns out not to be positive definite.
+     * @throw std::invalid_argument if b and x do not have the same size or if the workspace is too small
+     */
+    template <Coordinate coordinate, typename Operator, typename Preconditioner = IdentityPreconditioner>
+    KrylovResult<coordinate> conjugate_gradient(const Operator&             op,
+                                                std::span<const coordinate> b,
+                                                std::span<coordinate>       x,
+                                                std::span<coordinate>       workspace,
+                                                coordinate                  tolerance,
+                                                unsigned int                max_iterations,
+                                                const Preconditioner&       preconditioner = {}) requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief Right preconditioned BiCGSTAB solve of A * x = b for any invertible A, see conjugate_gradient for the
+     *        parameters. The workspace must hold at least bicgstab_workspace_size(n) coefficients.
+     * @return whether the iterations converged, their number and the true relative residual. They also stop without
+     *         converging on a breakdown of the method, a scalar product being null.
+     */
+    template <Coordinate coordinate, typename Operator, typename Preconditioner = IdentityPreconditioner>
+    KrylovResult<coordinate> bicgstab(const Operator&             op,
+                                      std::span<const coordinate> b,
+                                      std::span<coordinate>       x,
+                                      std::span<coordinate>       workspace,
+                                      coordinate                  tolerance,
+                                      unsigned int                max_iterations,
+                                      const Preconditioner&       preconditioner = {}) requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief Restarted and right preconditioned GMRES solve of A * x = b for any invertible A, see conjugate_gradient
+     *        for the parameters. The workspace must hold at least gmres_workspace_size(n, restart) coefficients.
+     * @param restart is the number of vectors of the Arnoldi basis, the iterations restarting from the current x once
+     *        it is full. The residual decreases at each iteration, but may stagnate for a too small restart.
+     * @throw std::invalid_argument if restart is null, see conjugate_gradient
+     */
+    template <Coordinate coordinate, typename Operator, typename Preconditioner = IdentityPreconditioner>
+    KrylovResult<coordinate> gmres(const Operator&             op,
+                                   std::span<const coordinate> b,
+                                   std::span<coordinate>       x,
+                                   std::span<coordinate>       workspace,
+                                   coordinate                  tolerance,
+                                   unsigned int                max_iterations,
+                                   size_t                      restart        = 30,
+                                   const Preconditioner&       preconditioner = {}) requires(std::is_floating_point_v<coordinate>);
+
+    namespace ImplementationDetails
+    {
+        // NOLINTBEGIN(readability-identifier-length)
+
+        /*!
+         * @brief Number of rows of a sparse matrix under which a product stays on the calling thread
+         */
+        constexpr size_t sparse_multiply_granularity = 256;
+
+        /*!
+         * @brief Largest number of attempts of the incomplete Cholesky factorization, the shift doubling each time
+         */
+        constexpr unsigned int incomplete_cholesky_attempts = 32;
+
+        /*!
+         * @brief y = A * x for a dense matrix
+         */
+        template <Coordinate coordinate, unsigned int size, StorageOrder order>
+        void krylov_multiply(const Matrix<coordinate, size, size, order>& op, const coordinate* x, coordinate* y, size_t n)
+        {
+            if (n != size)
+            {
+                throw std::invalid_argument("The matrix must have as many rows as the right hand side");
+            }
+
+            for (unsigned int i = 0; i < size; ++i)
+            {
+                coordinate value = 0;
+
+                for (unsigned int j = 0; j < size; ++j)
+                {
+                    value += op(i, j) * x[j];
+                }
+
+                y[i] = value;
+            }
+        }
+
+        /*!
+         * @brief y = A * x for a sparse matrix or a callable
+         */
+        template <Coordinate coordinate, typename Operator>
+        void krylov_multiply(const Operator& op, const coordinate* x, coordinate* y, size_t n)
+        {
+            op(std::span<const coordinate>(x, n), std::span<coordinate>(y, n));
+        }
+
+        /*!
+         * @brief z = M^-1 * r
+         */
+        template <Coordinate coordinate, typename Preconditioner>
+        void krylov_precondition(const Preconditioner& preconditioner, const coordinate* r, coordinate* z, size_t n)
+        {
+            preconditioner(std::span<const coordinate>(r, n), std::span<coordinate>(z, n));
+        }
+
+        /*!
+         * @brief Euclidean norm of x, see nrm2
+         */
+        template <Coordinate coordinate>
+        coordinate krylov_norm(const coordinate* x, size_t n)
+        {
+            return LCNS::Algebra::nrm2(std::span<const coordinate>(x, n));
+        }
+
+        /*!
+         * @brief Scalar product of x and y, see dot
+         */
+        template <Coordinate coordinate>
+        coordinate krylov_dot(const coordinate* x, const coordinate* y, size_t n)
+        {
+            return LCNS::Algebra::dot(std::span<const coordinate>(x, n), std::span<const coordinate>(y, n));
+        }
+
+        /*!
+         * @brief y += alpha * x, see axpy
+         */
+        template <Coordinate coordinate>
+        void krylov_axpy(size_t n, coordinate alpha, const coordinate* x, coordinate* y)
+        {
+            LCNS::Algebra::axpy(alpha, std::span<const coordinate>(x, n), std::span<coordinate>(y, n));
+        }
+
+        /*!
+         * @brief r = b - A * x
+         */
+        template <Coordinate coordinate, typename Operator>
+        void krylov_residual(const Operator& op, const coordinate* b, const coordinate* x, coordinate* r, size_t n)
+        {
+            krylov_multiply(op, x, r, n);
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                r[i] = b[i] - r[i];
+            }
+        }
+
+        /*!
+         * @brief Check the sizes of an iterative solve and return the number of unknowns
+         */
+        inline size_t check_krylov_sizes(size_t b, size_t x, size_t workspace, size_t needed)
+        {
+            if (b != x)
+            {
+                throw std::invalid_argument("The solution must have as many coefficients as the right hand side");
+            }
+
+            if (workspace < needed)
+            {
+                throw std::invalid_argument("The workspace is too small for the number of unknowns");
+            }
+
+            return b;
+        }
+
+        /*!
+         * @brief Result of a solve which stopped after iterations, its true residual being computed in r
+         */
+        template <Coordinate coordinate, typename Operator>
+        KrylovResult<coordinate> krylov_result(const Operator&   op,
+                                               const coordinate* b,
+                                               const coordinate* x,
+                                               coordinate*       r,
+                                               size_t            n,
+                                               coordinate        b_norm,
+                                               bool              converged,
+                                               unsigned int      iterations)
+        {
+            krylov_residual(op, b, x, r, n);
+
+            return { converged, iterations, krylov_norm(r, n) / b_norm };
+        }
+
+        /*!
+         * @brief Incomplete Cholesky factorization of the lower triangle of a + shift * diag(a), see
+         *        IncompleteCholeskyPreconditioner. The coefficient l_ij is (a_ij - sum of l_ik * l_jk) / l_jj, the
+         *        sum running over the columns k < j of both rows i and j, merged since they are sorted.
+         * @return false if a pivot is not positive
+         */
+        template <Coordinate coordinate>
+        bool incomplete_cholesky(const SparseMatrix<coordinate>& a, coordinate shift, SparseMatrix<coordinate>& l)
+        {
+            for (size_t i = 0; i < l.size; ++i)
+            {
+                const size_t row_begin = l.row_offsets[i];
+                const size_t diagonal  = l.row_offsets[i + 1] - 1;
+
+                for (size_t e = row_begin; e <= diagonal; ++e)
+                {
+                    // The lower triangle of row i of a being the beginning of the row, a_ij is at the same rank
+                    const size_t j     = l.columns[e];
+                    coordinate   value = a.values[a.row_offsets[i] + e - row_begin];
+
+                    // The diagonal coefficient is shifted
+                    if (e == diagonal)
+                    {
+                        value += shift * value;
+                    }
+
+                    size_t f = l.row_offsets[j];
+
+                    for (size_t k = row_begin; k < e; ++k)
+                    {
+                        while (l.columns[f] < l.columns[k])
+                        {
+                            ++f;
+                        }
+
+                        if (l.columns[f] == l.columns[k])
+                        {
+                            value -= l.values[k] * l.values[f];
+                        }
+                    }
+
+                    if (e < diagonal)
+                    {
+                        l.values[e] = value / l.values[l.row_offsets[j + 1] - 1];
+                    }
+                    else
+                    {
+                        if (!(value > 0))
+                        {
+                            return false;
+                        }
+
+                        l.values[e] = std::sqrt(value);
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        // NOLINTEND(readability-identifier-length)
+    }  // namespace ImplementationDetails
+
+    // NOLINTBEGIN(readability-identifier-length)
+    template <Coordinate coordinate>
+    void SparseMatrix<coordinate>::operator()(std::span<const coordinate> x, std::span<coordinate> y) const
+    {
+        ImplementationDetails::for_each_chunk_concurrently(
+        size,
+        ImplementationDetails::sparse_multiply_granularity,
+        [this, x, y](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                coordinate value = 0;
+
+                for (size_t k = row_offsets[i]; k < row_offsets[i + 1]; ++k)
+                {
+                    value += values[k] * x[columns[k]];
+                }
+
+                y[i] = value;
+            }
+        },
+        ImplementationDetails::concurrency_threshold_for_work(size, values.size()));
+    }
+
+    template <Coordinate coordinate>
+    JacobiPreconditioner<coordinate>::JacobiPreconditioner(std::span<const coordinate> diagonal) : _inverse_diagonal(diagonal.size())
+    {
+        for (size_t i = 0; i < diagonal.size(); ++i)
+        {
+            if (diagonal[i] == 0)
+            {
+                throw std::invalid_argument("The diagonal coefficients of a Jacobi preconditioner must not be null");
+            }
+
+            _inverse_diagonal[i] = 1 / diagonal[i];
+        }
+    }
+
+    template <Coordinate coordinate>
+    JacobiPreconditioner<coordinate>::JacobiPreconditioner(const SparseMatrix<coordinate>& matrix)
+    : JacobiPreconditioner(
+      [&matrix]()
+      {
+          std::vector<coordinate> diagonal(matrix.size);
+
+          for (size_t i = 0; i < matrix.size; ++i)
+          {
+              for (size_t k = matrix.row_offsets[i]; k < matrix.row_offsets[i + 1]; ++k)
+              {
+                  if (matrix.columns[k] == i)
+                  {
+                      diagonal[i] = matrix.values[k];
+                  }
+              }
+          }
+
+          return diagonal;
+      }())
+    {
+    }
+
+    template <Coordinate coordinate>
+    template <unsigned int size, StorageOrder order>
+    JacobiPreconditioner<coordinate>::JacobiPreconditioner(const Matrix<coordinate, size, size, order>& matrix)
+    : JacobiPreconditioner(
+      [&matrix]()
+      {
+          std::vector<coordinate> diagonal(size);
+
+          for (unsigned int i = 0; i < size; ++i)
+          {
+              diagonal[i] = matrix(i, i);
+          }
+
+          return diagonal;
+      }())
+    {
+    }
+
+    template <Coordinate coordinate>
+    void JacobiPreconditioner<coordinate>::operator()(std::span<const coordinate> r, std::span<coordinate> z) const
+    {
+        const coordinate* inverse = _inverse_diagonal.data();
+
+        ImplementationDetails::for_each_pack<coordinate>(0,
+                                                         r.size(),
+                                                         [inverse, r, z](auto pack, size_t i)
+                                                         {
+                                                             using simd = decltype(pack);
+                                                             simd::store(z.data() + i, simd::mul(simd::load(inverse + i), simd::load(r.data() + i)));
+                                                         });
+    }
+
+    template <Coordinate coordinate>
+    IncompleteCholeskyPreconditioner<coordinate>::IncompleteCholeskyPreconditioner(const SparseMatrix<coordinate>& matrix)
+    {
+        // Pattern of the lower triangle, each row ending with its diagonal coefficient
+        _factor.size = matrix.size;
+        _factor.row_offsets.assign(1, 0);
+
+        for (size_t i = 0; i < matrix.size; ++i)
+        {
+            bool has_diagonal = false;
+
+            for (size_t k = matrix.row_offsets[i]; k < matrix.row_offsets[i + 1] && matrix.columns[k] <= i; ++k)
+            {
+                _factor.columns.push_back(matrix.columns[k]);
+                has_diagonal = matrix.columns[k] == i && matrix.values[k] > 0;
+            }
+
+            if (!has_diagonal)
+            {
+                throw std::invalid_argument("The matrix to factorize must have positive diagonal coefficients");
+            }
+
+            _factor.row_offsets.push_back(_factor.columns.size());
+        }
+
+        _factor.values.resize(_factor.columns.size());
+
+        if (ImplementationDetails::incomplete_cholesky(matrix, coordinate{0}, _factor))
+        {
+            return;
+        }
+
+        _shift = static_cast<coordinate>(1e-3);
+
+        for (unsigned int attempt = 1; attempt < ImplementationDetails::incomplete_cholesky_attempts; ++attempt, _shift *= 2)
+        {
+            if (ImplementationDetails::incomplete_cholesky(matrix, _shift, _factor))
+            {
+                return;
+            }
+        }
+    }
+
+    template <Coordinate coordinate>
+    void IncompleteCholeskyPreconditioner<coordinate>::operator()(std::span<const coordinate> r, std::span<coordinate> z) const
+    {
+        const auto& offsets = _factor.row_offsets;
+        const auto& columns = _factor.columns;
+        const auto& values  = _factor.values;
+
+        // L * y = r row by row
+        for (size_t i = 0; i < _factor.size; ++i)
+        {
+            const size_t diagonal = offsets[i + 1] - 1;
+            coordinate   value    = r[i];
+
+            for (size_t k = offsets[i]; k < diagonal; ++k)
+            {
+                value -= values[k] * z[columns[k]];
+            }
+
+            z[i] = value / values[diagonal];
+        }
+
+        // L^T * z = y column by column, the columns of L^T being its rows
+        for (size_t i = _factor.size; i-- > 0;)
+        {
+            const size_t diagonal = offsets[i + 1] - 1;
+
+            z[i] /= values[diagonal];
+
+            for (size_t k = offsets[i]; k < diagonal; ++k)
+            {
+                z[columns[k]] -= values[k] * z[i];
+            }
+        }
+    }
+
+    template <Coordinate coordinate, typename Operator, typename Preconditioner>
+    KrylovResult<coordinate> conjugate_gradient(const Operator&             op,
+                                                std::span<const coordinate> b,
+                                                std::span<coordinate>       x,
+                                                std::span<coordinate>       workspace,
+                                                coordinate                  tolerance,
+                                                unsigned int                max_iterations,
+                                                const Preconditioner&       preconditioner) requires(std::is_floating_point_v<coordinate>)
+    {
+        using namespace ImplementationDetails;
+
+        const size_t n = check_krylov_sizes(b.size(), x.size(), workspace.size(), conjugate_gradient_workspace_size(b.size()));
+
+        coordinate* r = workspace.data();
+        coordinate* z = r + n;
+        coordinate* p = z + n;
+        coordinate* q = p + n;
+
+        const coordinate b_norm = krylov_norm(b.data(), n);
+
+        if (b_norm == 0)
+        {
+            std::fill(x.begin(), x.end(), coordinate{0});
+            return { true, 0, 0 };
+        }
+
+        krylov_residual(op, b.data(), x.data(), r, n);
+        krylov_precondition(preconditioner, r, z, n);
+        std::copy(z, z + n, p);
+
+        coordinate   rz        = krylov_dot(r, z, n);
+        bool         converged = krylov_norm(r, n) <= tolerance * b_norm;
+        unsigned int iteration = 0;
+
+        for (; !converged && iteration < max_iterations; ++iteration)
+        {
+            krylov_multiply(op, p, q, n);
+
+            const coordinate pq = krylov_dot(p, q, n);
+
+            // A or M is not positive definite
+            if (!(pq > 0) || !(rz > 0))
+            {
+                break;
+            }
+
+            const coordinate alpha = rz / pq;
+
+            krylov_axpy(n, alpha, p, x.data());
+            krylov_axpy(n, -alpha, q, r);
+
+            if (krylov_norm(r, n) <= tolerance * b_norm)
+            {
+                converged = true;
+                ++iteration;
+                break;
+            }
+
+            krylov_precondition(preconditioner, r, z, n);
+
+            const coordinate rz_next = krylov_dot(r, z, n);
+            const coordinate beta    = rz_next / rz;
+
+            rz = rz_next;
+
+            // p = z + beta * p
+            for (size_t i = 0; i < n; ++i)
+            {
+                p[i] = z[i] + beta * p[i];
+            }
+        }
+
+        return krylov_result(op, b.data(), x.data(), r, n, b_norm, converged, iteration);
+    }
+
+    template <Coordinate coordinate, typename Operator, typename Preconditioner>
+    KrylovResult<coordinate> bicgstab(const Operator&             op,
+                                      std::span<const coordinate> b,
+                                      std::span<coordinate>       x,
+                                      std::span<coordinate>       workspace,
+                                      coordinate                  tolerance,
+                                      unsigned int                max_iterations,
+                                      const Preconditioner&       preconditioner) requires(std::is_floating_point_v<coordinate>)
+    {
+        using namespace ImplementationDetails;
+
+        const size_t n = check_krylov_sizes(b.size(), x.size(), workspace.size(), bicgstab_workspace_size(b.size()));
+
+        coordinate* r      = workspace.data();
+        coordinate* shadow = r + n;  // r^ = r_0, which the residuals are made orthogonal to
+        coordinate* p      = shadow + n;
+        coordinate* v      = p + n;
+        coordinate* t      = v + n;
+        coordinate* y      = t + n;  // M^-1 * p
+        coordinate* z      = y + n;  // M^-1 * s
+
+        const coordinate b_norm = krylov_norm(b.data(), n);
+
+        if (b_norm == 0)
+        {
+            std::fill(x.begin(), x.end(), coordinate{0});
+            return { true, 0, 0 };
+        }
+
+        krylov_residual(op, b.data(), x.data(), r, n);
+        std::copy(r, r + n, shadow);
+        std::fill(p, p + n, coordinate{0});
+        std::fill(v, v + n, coordinate{0});
+
+        coordinate rho   = 1;
+        coordinate alpha = 1;
+        coordinate omega = 1;
+
+        bool         converged = krylov_norm(r, n) <= tolerance * b_norm;
+        unsigned int iteration = 0;
+
+        for (; !converged && iteration < max_iterations; ++iteration)
+        {
+            const coordinate rho_next = krylov_dot(shadow, r, n);
+
+            if (rho_next == 0 || omega == 0)
+            {
+                break;
+            }
+
+            const coordinate beta = rho_next / rho * (alpha / omega);
+
+            rho = rho_next;
+
+            // p = r + beta * (p - omega * v)
+            for (size_t i = 0; i < n; ++i)
+            {
+                p[i] = r[i] + beta * (p[i] - omega * v[i]);
+            }
+
+            krylov_precondition(preconditioner, p, y, n);
+            krylov_multiply(op, y, v, n);
+
+            const coordinate shadow_v = krylov_dot(shadow, v, n);
+
+            if (shadow_v == 0)
+            {
+                break;
+            }
+
+            alpha = rho / shadow_v;
+
+            // s = r - alpha * v, in place in r
+            krylov_axpy(n, -alpha, v, r);
+            krylov_axpy(n, alpha, y, x.data());
+
+            if (krylov_norm(r, n) <= tolerance * b_norm)
+            {
+                converged = true;
+                ++iteration;
+                break;
+            }
+
+            krylov_precondition(preconditioner, r, z, n);
+            krylov_multiply(op, z, t, n);
+
+            const coordinate tt = krylov_dot(t, t, n);
+
+            omega = tt > 0 ? krylov_dot(t, r, n) / tt : coordinate{0};
+
+            krylov_axpy(n, omega, z, x.data());
+            krylov_axpy(n, -omega, t, r);
+
+            if (krylov_norm(r, n) <= tolerance * b_norm)
+            {
+                converged = true;
+                ++iteration;
+                break;
+            }
+        }
+
+        return krylov_result(op, b.data(), x.data(), r, n, b_norm, converged, iteration);
+    }
+
+    template <Coordinate coordinate, typename Operator, typename Preconditioner>
+    KrylovResult<coordinate> gmres(const Operator&             op,
+                                   std::span<const coordinate> b,
+                                   std::span<coordinate>       x,
+                                   std::span<coordinate>       workspace,
+                                   coordinate                  tolerance,
+                                   unsigned int                max_iterations,
+                                   size_t                      restart,
+                                   const Preconditioner&       preconditioner) requires(std::is_floating_point_v<coordinate>)
+    {
+        using namespace ImplementationDetails;
+
+        if (restart == 0)
+        {
+            throw std::invalid_argument("The Arnoldi basis of GMRES must have at least one vector");
+        }
+
+        const size_t n = check_krylov_sizes(b.size(), x.size(), workspace.size(), gmres_workspace_size(b.size(), restart));
+        const size_t m = restart;
+
+        coordinate* basis = workspace.data();        // m + 1 vectors of the Arnoldi basis, one after the other
+        coordinate* z     = basis + (m + 1) * n;     // M^-1 * v_j
+        coordinate* u     = z + n;                   // V * y, then the true residual
+        coordinate* h     = u + n;                   // Hessenberg matrix, m + 1 rows of m coefficients
+        coordinate* c     = h + (m + 1) * m;         // Givens rotations
+        coordinate* s     = c + m;
+        coordinate* g     = s + m;                   // Q^T * |r| * e_1, m + 1 coefficients
+        coordinate* y     = g + m + 1;
+
+        const coordinate b_norm = krylov_norm(b.data(), n);
+
+        if (b_norm == 0)
+        {
+            std::fill(x.begin(), x.end(), coordinate{0});
+            return { true, 0, 0 };
+        }
+
+        bool         converged = false;
+        unsigned int iteration = 0;
+
+        while (!converged && iteration < max_iterations)
+        {
+            krylov_residual(op, b.data(), x.data(), basis, n);
+
+            const coordinate beta = krylov_norm(basis, n);
+
+            if (beta <= tolerance * b_norm)
+            {
+                converged = true;
+                break;
+            }
+
+            scal(1 / beta, std::span<coordinate>(basis, n));
+
+            std::fill(g, g + m + 1, coordinate{0});
+            g[0] = beta;
+
+            size_t k = 0;
+
+            while (k < m && iteration < max_iterations)
+            {
+                coordinate* w = basis + (k + 1) * n;
+
+                krylov_precondition(preconditioner, basis + k * n, z, n);
+                krylov_multiply(op, z, w, n);
+
+                // Modified Gram-Schmidt
+                for (size_t i = 0; i <= k; ++i)
+                {
+                    const coordinate factor = krylov_dot(w, basis + i * n, n);
+
+                    h[i * m + k] = factor;
+                    krylov_axpy(n, -factor, basis + i * n, w);
+                }
+
+                const coordinate norm = krylov_norm(w, n);
+
+                h[(k + 1) * m + k] = norm;
+
+                // A null norm is a lucky breakdown: the solution is in the basis, w is then never used
+                if (norm > 0)
+                {
+                    scal(1 / norm, std::span<coordinate>(w, n));
+                }
+
+                // The previous rotations, then the one cancelling h(k + 1, k)
+                for (size_t i = 0; i < k; ++i)
+                {
+                    const coordinate upper = h[i * m + k];
+                    const coordinate lower = h[(i + 1) * m + k];
+
+                    h[i * m + k]       = c[i] * upper + s[i] * lower;
+                    h[(i + 1) * m + k] = c[i] * lower - s[i] * upper;
+                }
+
+                const coordinate radius = std::hypot(h[k * m + k], norm);
+
+                c[k] = radius > 0 ? h[k * m + k] / radius : coordinate{1};
+                s[k] = radius > 0 ? norm / radius : coordinate{0};
+
+                h[k * m + k]       = radius;
+                h[(k + 1) * m + k] = 0;
+
+                g[k + 1] = -s[k] * g[k];
+                g[k]     = c[k] * g[k];
+
+                ++k;
+                ++iteration;
+
+                if (std::abs(g[k]) <= tolerance * b_norm || norm == 0)
+                {
+                    converged = true;
+                    break;
+                }
+            }
+
+            // y = H^-1 * g, then x += M^-1 * V * y
+            for (size_t i = k; i-- > 0;)
+            {
+                coordinate value = g[i];
+
+                for (size_t j = i + 1; j < k; ++j)
+                {
+                    value -= h[i * m + j] * y[j];
+                }
+
+                y[i] = h[i * m + i] != 0 ? value / h[i * m + i] : coordinate{0};
+            }
+
+            std::fill(u, u + n, coordinate{0});
+
+            for (size_t i = 0; i < k; ++i)
+            {
+                krylov_axpy(n, y[i], basis + i * n, u);
+            }
+
+            krylov_precondition(preconditioner, u, z, n);
+            krylov_axpy(n, coordinate{1}, z, x.data());
+        }
+
+        return krylov_result(op, b.data(), x.data(), u, n, b_norm, converged, iteration);
+    }
+    // NOLINTEND(readability-identifier-length)
+}  // namespace LCNS::Algebra
@@ -0,0 +1,691 @@
+#pragma once
+
+#include "algebra/BlockedMultiplication.hpp"
+#include "algebra/Concurrency.hpp"
+#include "algebra/Internal.hpp"
+#include "algebra/Simd.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*
+ * LU decomposition with partial pivoting, P * A = L * U, of square matrices stored row by row. L (unit diagonal) and U
+ * overwrite A, and the row interchanges are recorded LAPACK style: row k was swapped with row pivots[k] >= k.
+ *
+ * Up to lu_unrolled_size, the loops are unrolled at compile time: the elimination is a straight sequence of
+ * multiply-adds on a std::array, which the compiler keeps in registers for the smallest sizes. Above, the right-looking
+ * blocked algorithm factorizes a panel of lu_block_size columns (recursively, so that the panel is mostly updated by
+ * multiplications too), applies it to the rows on its right with a triangular solve, and updates the trailing matrix
+ * with multiply_add_blocked, where almost all the work is done. The triangular solves are blocked the same way.
+ */
+
+namespace LCNS::Algebra
+{
+    /*!
+     * \brief Triangle of a square matrix used by solve_triangular, the unit variants ignoring the diagonal coefficients
+     *        and taking them as 1 (as the L factor of lu_factorize)
+     */
+    enum class Triangle
+    {
+        Lower,
+        UnitLower,
+        Upper,
+        UnitUpper
+    };
+
+    /*!
+     * \brief LU decomposition with partial pivoting, P * A = L * U, of a large matrix whose size is known at run time.
+     *        The trailing matrix updates, where almost all the work is done, are blocked matrix multiplications split
+     *        between threads.
+     * @param matrix holds the n x n matrix A row by row on input, and L (below the diagonal, its unit diagonal being
+     *        implied) and U on output
+     * @param pivots receives the row interchanges, its size being n: row k was swapped with row pivots[k]
+     * @return false if A is singular, one of its pivots being not larger than n * epsilon * max|A|. The decomposition
+     *         is then incomplete.
+     * @throw std::invalid_argument if the size of matrix is not the square of the size of pivots
+     */
+    template <Coordinate coordinate>
+    bool lu_factorize(std::span<coordinate> matrix, std::span<unsigned int> pivots) requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief Solve A * X = B from the decomposition of A by lu_factorize
+     * @param lu and pivots are the results of lu_factorize
+     * @param rhs holds B row by row on input, and X on output
+     * @param rhs_cols is the number of columns of B, one per system
+     * @throw std::invalid_argument if the sizes of lu or rhs do not match the size of pivots
+     */
+    template <Coordinate coordinate>
+    void lu_solve(std::span<const coordinate> lu, std::span<const unsigned int> pivots, std::span<coordinate> rhs, size_t rhs_cols = 1)
+    requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief Solve T * X = B by substitution, T being a triangle of a n x n matrix stored row by row
+     * @param matrix is the n x n matrix, the coefficients outside of the triangle are not read
+     * @param rhs holds B row by row on input, and X on output. Its size gives n.
+     * @param rhs_cols is the number of columns of B, one per system
+     * @throw std::invalid_argument if the size of matrix does not match the size of rhs
+     */
+    template <Coordinate coordinate>
+    void solve_triangular(std::span<const coordinate> matrix, Triangle triangle, std::span<coordinate> rhs, size_t rhs_cols = 1)
+    requires(std::is_floating_point_v<coordinate>);
+
+    namespace ImplementationDetails
+    {
+        // NOLINTBEGIN(readability-identifier-length)
+
+        /*!
+         * @brief Call function(std::integral_constant<size_t, i>) for i in [0, count[, unrolled at compile time
+         */
+        template <size_t count, typename Function>
+        constexpr void unroll(Function&& function)
+        {
+            [&function]<size_t... indices>(std::index_sequence<indices...>)
+            {
+                (function(std::integral_constant<size_t, indices>{}), ...);
+            }(std::make_index_sequence<count>{});
+        }
+
+        /*!
+         * @brief Largest size for which the decomposition and the solves are unrolled at compile time
+         */
+        constexpr unsigned int lu_unrolled_size = 16;
+
+        /*!
+         * @brief Number of columns of the panels of the blocked decomposition, and of the diagonal blocks of the
+         *        triangular solves
+         */
+        constexpr size_t lu_block_size = 128;
+
+        /*!
+         * @brief Number of columns under which the panels are decomposed without recursion
+         */
+        constexpr size_t lu_recursion_size = 16;
+
+        /*!
+         * @brief Coefficients of a n x n matrix: on the stack when the loops are unrolled, on the heap otherwise
+         */
+        template <Coordinate coordinate, unsigned int n>
+        using lu_storage = std::conditional_t<(n <= lu_unrolled_size), std::array<coordinate, n * n>, std::vector<coordinate>>;
+
+        /*!
+         * @brief Result of lu_factorize
+         */
+        template <Coordinate coordinate, unsigned int n>
+        struct LUFactors
+        {
+            lu_storage<coordinate, n>   lu     = {};  // L below the diagonal, U on and above, row by row
+            std::array<unsigned int, n> pivots = {};  // Row k was swapped with row pivots[k]
+            int                         sign   = 0;   // Sign of the permutation, 0 if the matrix is singular
+        };
+
+        /*!
+         * @brief Copy the coefficients of a n x n matrix to decompose
+         * @param coefficients are stored row by row, or column by column if transpose is true
+         */
+        template <Coordinate coordinate, unsigned int n, typename source>
+        constexpr LUFactors<coordinate, n> lu_load(const source* coefficients, bool transpose)
+        {
+            LUFactors<coordinate, n> factors;
+
+            if constexpr (n > lu_unrolled_size)
+            {
+                factors.lu.resize(size_t{n} * n);
+            }
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                for (size_t j = 0; j < n; ++j)
+                {
+                    factors.lu[i * n + j] = static_cast<coordinate>(transpose ? coefficients[j * n + i] : coefficients[i * n + j]);
+                }
+            }
+
+            return factors;
+        }
+
+        /*!
+         * @brief Pivots smaller than n * epsilon * max|A| are considered null: beyond, the solution would be dominated by
+         *        rounding errors
+         */
+        template <Coordinate coordinate>
+        constexpr coordinate lu_relative_tolerance(const coordinate* a, size_t lda, size_t n)
+        {
+            coordinate max_abs = 0;
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                for (size_t j = 0; j < n; ++j)
+                {
+                    max_abs = std::max(max_abs, std::abs(a[i * lda + j]));
+                }
+            }
+
+            return static_cast<coordinate>(n) * std::numeric_limits<coordinate>::epsilon() * max_abs;
+        }
+
+        /*!
+         * @brief Decomposition unrolled at compile time
+         * @return the sign of the permutation, 0 if a pivot is not larger than tolerance
+         */
+        template <Coordinate coordinate, unsigned int n>
+        constexpr int lu_unrolled(std::array<coordinate, n * n>& a, std::array<unsigned int, n>& pivots, coordinate tolerance)
+        {
+            int sign = 1;
+
+            unroll<n>(
+            [&](auto k_)
+            {
+                constexpr size_t k = decltype(k_)::value;
+
+                if (sign == 0)
+                {
+                    return;
+                }
+
+                size_t     pivot     = k;
+                coordinate pivot_abs = std::abs(a[k * n + k]);
+
+                unroll<n>(
+                [&](auto i_)
+                {
+                    constexpr size_t i = decltype(i_)::value;
+
+                    if constexpr (i > k)
+                    {
+                        if (const auto value = std::abs(a[i * n + k]); value > pivot_abs)
+                        {
+                            pivot     = i;
+                            pivot_abs = value;
+                        }
+                    }
+                });
+
+                pivots[k] = static_cast<unsigned int>(pivot);
+
+                if (pivot_abs <= tolerance)
+                {
+                    sign = 0;
+                    return;
+                }
+
+                if (pivot != k)
+                {
+                    sign = -sign;
+                    unroll<n>([&](auto j_) { std::swap(a[k * n + decltype(j_)::value], a[pivot * n + decltype(j_)::value]); });
+                }
+
+                unroll<n>(
+                [&](auto i_)
+                {
+                    constexpr size_t i = decltype(i_)::value;
+
+                    if constexpr (i > k)
+                    {
+                        const coordinate l = a[i * n + k] /= a[k * n + k];
+
+                        unroll<n>(
+                        [&](auto j_)
+                        {
+                            constexpr size_t j = decltype(j_)::value;
+
+                            if constexpr (j > k)
+                            {
+                                a[i * n + j] -= l * a[k * n + j];
+                            }
+                        });
+                    }
+                });
+            });
+
+            return sign;
+        }
+
+        /*!
+         * @brief Decomposition of the columns [begin, end[ of a n x n matrix whose columns before begin are already
+         *        decomposed and applied. The row interchanges are applied to the whole rows. With begin = 0 and end = n,
+         *        this is the unblocked decomposition of the matrix.
+         * @return the sign of the permutation of the panel, 0 if a pivot is not larger than tolerance
+         */
+        template <Coordinate coordinate>
+        constexpr int lu_panel(coordinate* a, size_t lda, size_t n, size_t begin, size_t end, unsigned int* pivots, coordinate tolerance)
+        {
+            int sign = 1;
+
+            for (size_t k = begin; k < end; ++k)
+            {
+                size_t     pivot     = k;
+                coordinate pivot_abs = std::abs(a[k * lda + k]);
+
+                for (size_t i = k + 1; i < n; ++i)
+                {
+                    if (const auto value = std::abs(a[i * lda + k]); value > pivot_abs)
+                    {
+                        pivot     = i;
+                        pivot_abs = value;
+                    }
+                }
+
+                pivots[k] = static_cast<unsigned int>(pivot);
+
+                if (pivot_abs <= tolerance)
+                {
+                    return 0;
+                }
+
+                if (pivot != k)
+                {
+                    sign = -sign;
+                    std::swap_ranges(a + k * lda, a + k * lda + n, a + pivot * lda);
+                }
+
+                const coordinate* row_k = a + k * lda;
+
+                for (size_t i = k + 1; i < n; ++i)
+                {
+                    coordinate*      row_i = a + i * lda;
+                    const coordinate l     = row_i[k] /= row_k[k];
+
+                    for (size_t j = k + 1; j < end; ++j)
+                    {
+                        row_i[j] -= l * row_k[j];
+                    }
+                }
+            }
+
+            return sign;
+        }
+
+        /*!
+         * @brief Solve T * X = B for the columns [begin, end[ of X, T being a triangle of a m x m matrix
+         * @param t points to the matrix, t[i * ldt + k] being T(i, k)
+         * @param x holds B on input and X on output, x[i * ldx + j] being X(i, j)
+         */
+        template <bool lower, bool unit_diagonal, Coordinate coordinate>
+        void solve_triangular_columns(size_t m, const coordinate* t, size_t ldt, coordinate* x, size_t ldx, size_t begin, size_t end)
+        {
+            const auto subtract = [=](coordinate* row_i, coordinate factor, const coordinate* row_k)
+            {
+                for_each_pack<coordinate>(begin,
+                                          end,
+                                          [=](auto pack, size_t j)
+                                          {
+                                              using simd = decltype(pack);
+                                              simd::store(row_i + j, simd::sub(simd::load(row_i + j), simd::mul(simd::broadcast(factor), simd::load(row_k + j))));
+                                          });
+            };
+
+            const auto divide = [=](coordinate* row_i, coordinate diagonal)
+            {
+                for_each_pack<coordinate>(begin,
+                                          end,
+                                          [=](auto pack, size_t j)
+                                          {
+                                              using simd = decltype(pack);
+                                              simd::store(row_i + j, simd::div(simd::load(row_i + j), simd::broadcast(diagonal)));
+                                          });
+            };
+
+            for (size_t r = 0; r < m; ++r)
+            {
+                const size_t i     = lower ? r : m - 1 - r;
+                coordinate*  row_i = x + i * ldx;
+
+                for (size_t k = lower ? 0 : i + 1; k < (lower ? i : m); ++k)
+                {
+                    subtract(row_i, t[i * ldt + k], x + k * ldx);
+                }
+
+                if constexpr (!unit_diagonal)
+                {
+                    divide(row_i, t[i * ldt + i]);
+                }
+            }
+        }
+
+        /*!
+         * @brief Blocked solve of T * X = B, see solve_triangular_columns. The diagonal blocks are solved by
+         *        substitution, the columns of X being split between threads, and applied to the remaining rows of X
+         *        with multiply_add_blocked.
+         */
+        template <bool lower, bool unit_diagonal, Coordinate coordinate>
+        void solve_triangular_blocked(size_t m, size_t cols, const coordinate* t, size_t ldt, coordinate* x, size_t ldx)
+        {
+            const auto solve_diagonal_block = [=](size_t k0, size_t k1)
+            {
+                const size_t size = k1 - k0;
+
+                for_each_chunk_concurrently(
+                cols,
+                64,
+                [=](size_t begin, size_t end) { solve_triangular_columns<lower, unit_diagonal>(size, t + k0 * ldt + k0, ldt, x + k0 * ldx, ldx, begin, end); },
+                concurrency_threshold_for_work(cols, size * size * cols / 2));
+            };
+
+            if constexpr (lower)
+            {
+                for (size_t k0 = 0; k0 < m; k0 += lu_block_size)
+                {
+                    const size_t k1 = std::min(k0 + lu_block_size, m);
+
+                    solve_diagonal_block(k0, k1);
+                    multiply_add_blocked(m - k1, cols, k1 - k0, coordinate{-1}, t + k1 * ldt + k0, ldt, x + k0 * ldx, ldx, x + k1 * ldx, ldx);
+                }
+            }
+            else
+            {
+                for (size_t k1 = m; k1 > 0;)
+                {
+                    const size_t k0 = k1 > lu_block_size ? k1 - lu_block_size : 0;
+
+                    solve_diagonal_block(k0, k1);
+                    multiply_add_blocked(k0, cols, k1 - k0, coordinate{-1}, t + k0, ldt, x + k0 * ldx, ldx, x, ldx);
+
+                    k1 = k0;
+                }
+            }
+        }
+
+        /*!
+         * @brief Recursive decomposition of the columns [begin, end[ of a n x n matrix, see lu_panel: the left half is
+         *        decomposed, applied to the right half with a triangular solve and a multiplication, then the right half
+         *        is decomposed. Most of the work of a panel is thus done by multiply_add_blocked too.
+         * @return the sign of the permutation of the panel, 0 if a pivot is not larger than tolerance
+         */
+        template <Coordinate coordinate>
+        int lu_panel_recursive(coordinate* a, size_t lda, size_t n, size_t begin, size_t end, unsigned int* pivots, coordinate tolerance)
+        {
+            if (end - begin <= lu_recursion_size)
+            {
+                return lu_panel(a, lda, n, begin, end, pivots, tolerance);
+            }
+
+            const size_t middle = begin + (end - begin) / 2;
+            const int    sign   = lu_panel_recursive(a, lda, n, begin, middle, pivots, tolerance);
+
+            if (sign == 0)
+            {
+                return 0;
+            }
+
+            // A12 = L11^-1 * A12, then A22 -= L21 * A12
+            solve_triangular_blocked<true, true>(middle - begin, end - middle, a + begin * lda + begin, lda, a + begin * lda + middle, lda);
+            multiply_add_blocked(n - middle,
+                                 end - middle,
+                                 middle - begin,
+                                 coordinate{-1},
+                                 a + middle * lda + begin,
+                                 lda,
+                                 a + begin * lda + middle,
+                                 lda,
+                                 a + middle * lda + middle,
+                                 lda);
+
+            return sign * lu_panel_recursive(a, lda, n, middle, end, pivots, tolerance);
+        }
+
+        /*!
+         * @brief Right-looking blocked decomposition of a n x n matrix, a[i * lda + j] being A(i, j)
+         * @return the sign of the permutation, 0 if a pivot is not larger than tolerance
+         */
+        template <Coordinate coordinate>
+        int lu_blocked(coordinate* a, size_t lda, size_t n, unsigned int* pivots, coordinate tolerance)
+        {
+            int sign = 1;
+
+            for (size_t k0 = 0; k0 < n; k0 += lu_block_size)
+            {
+                const size_t k1 = std::min(k0 + lu_block_size, n);
+
+                sign *= lu_panel_recursive(a, lda, n, k0, k1, pivots, tolerance);
+
+                if (sign == 0 || k1 == n)
+                {
+                    return sign;
+                }
+
+                // U12 = L11^-1 * A12, then A22 -= L21 * U12
+                const size_t trailing = n - k1;
+
+                solve_triangular_blocked<true, true>(k1 - k0, trailing, a + k0 * lda + k0, lda, a + k0 * lda + k1, lda);
+                multiply_add_blocked(trailing,
+                                     trailing,
+                                     k1 - k0,
+                                     coordinate{-1},
+                                     a + k1 * lda + k0,
+                                     lda,
+                                     a + k0 * lda + k1,
+                                     lda,
+                                     a + k1 * lda + k1,
+                                     lda);
+            }
+
+            return sign;
+        }
+
+        /*!
+         * @brief Apply the row interchanges of a decomposition to the n rows of cols coefficients of x, x[i * ldx + j]
+         *        being X(i, j)
+         */
+        template <Coordinate coordinate>
+        constexpr void lu_permute(const unsigned int* pivots, size_t n, coordinate* x, size_t ldx, size_t cols)
+        {
+            for (size_t k = 0; k < n; ++k)
+            {
+                if (const size_t pivot = pivots[k]; pivot != k)
+                {
+                    std::swap_ranges(x + k * ldx, x + k * ldx + cols, x + pivot * ldx);
+                }
+            }
+        }
+
+        /*!
+         * @brief Decompose factors.lu in place, the coefficients of the matrix having been copied there row by row
+         * @param tolerance is the magnitude under which a pivot is considered null
+         */
+        template <Coordinate coordinate, unsigned int n>
+        constexpr void lu_factorize(LUFactors<coordinate, n>& factors, coordinate tolerance)
+        {
+            if constexpr (n <= lu_unrolled_size)
+            {
+                factors.sign = lu_unrolled<coordinate, n>(factors.lu, factors.pivots, tolerance);
+            }
+            else if (std::is_constant_evaluated())
+            {
+                factors.sign = lu_panel(factors.lu.data(), n, n, 0, n, factors.pivots.data(), tolerance);
+            }
+            else
+            {
+                factors.sign = lu_blocked(factors.lu.data(), n, n, factors.pivots.data(), tolerance);
+            }
+        }
+
+        /*!
+         * @brief Solve A * X = B from the decomposition of A, unrolled at compile time
+         * @param x holds B on input and X on output, n rows of cols coefficients
+         */
+        template <Coordinate coordinate, unsigned int n>
+        constexpr void lu_solve_unrolled(const LUFactors<coordinate, n>& factors, coordinate* x, size_t cols)
+        {
+            const auto& lu = factors.lu;
+
+            unroll<n>(
+            [&](auto k_)
+            {
+                constexpr size_t k = decltype(k_)::value;
+
+                if (const size_t pivot = factors.pivots[k]; pivot != k)
+                {
+                    std::swap_ranges(x + k * cols, x + (k + 1) * cols, x + pivot * cols);
+                }
+            });
+
+            // Forward substitution with the unit lower triangle
+            unroll<n>(
+            [&](auto i_)
+            {
+                constexpr size_t i = decltype(i_)::value;
+
+                unroll<i>(
+                [&](auto k_)
+                {
+                    constexpr size_t k = decltype(k_)::value;
+
+                    for (size_t j = 0; j < cols; ++j)
+                    {
+                        x[i * cols + j] -= lu[i * n + k] * x[k * cols + j];
+                    }
+                });
+            });
+
+            // Backward substitution with the upper triangle
+            unroll<n>(
+            [&](auto r_)
+            {
+                constexpr size_t i = n - 1 - decltype(r_)::value;
+
+                unroll<n>(
+                [&](auto k_)
+                {
+                    constexpr size_t k = decltype(k_)::value;
+
+                    if constexpr (k > i)
+                    {
+                        for (size_t j = 0; j < cols; ++j)
+                        {
+                            x[i * cols + j] -= lu[i * n + k] * x[k * cols + j];
+                        }
+                    }
+                });
+
+                for (size_t j = 0; j < cols; ++j)
+                {
+                    x[i * cols + j] /= lu[i * n + i];
+                }
+            });
+        }
+
+        /*!
+         * @brief Solve A * X = B from the decomposition of A, which must not be singular
+         * @param x holds B on input and X on output, n rows of cols coefficients
+         */
+        template <Coordinate coordinate, unsigned int n>
+        constexpr void lu_solve(const LUFactors<coordinate, n>& factors, coordinate* x, size_t cols)
+        {
+            if constexpr (n <= lu_unrolled_size)
+            {
+                lu_solve_unrolled(factors, x, cols);
+            }
+            else
+            {
+                lu_permute(factors.pivots.data(), n, x, cols, cols);
+
+                if (std::is_constant_evaluated())
+                {
+                    for (size_t j = 0; j < cols; ++j)
+                    {
+                        for (size_t i = 0; i < n; ++i)
+                        {
+                            for (size_t k = 0; k < i; ++k)
+                            {
+                                x[i * cols + j] -= factors.lu[i * n + k] * x[k * cols + j];
+                            }
+                        }
+
+                        for (size_t i = n; i-- > 0;)
+                        {
+                            for (size_t k = i + 1; k < n; ++k)
+                            {
+                                x[i * cols + j] -= factors.lu[i * n + k] * x[k * cols + j];
+                            }
+
+                            x[i * cols + j] /= factors.lu[i * n + i];
+                        }
+                    }
+                }
+                else
+                {
+                    solve_triangular_blocked<true, true>(n, cols, factors.lu.data(), n, x, cols);
+                    solve_triangular_blocked<false, false>(n, cols, factors.lu.data(), n, x, cols);
+                }
+            }
+        }
+
+        /*!
+         * @brief Solve T * X = B for the cols columns of X, T being a triangle of the n x n matrix t, see solve_triangular
+         */
+        template <Coordinate coordinate>
+        void solve_triangle(Triangle triangle, size_t n, size_t cols, const coordinate* t, size_t ldt, coordinate* x, size_t ldx)
+        {
+            switch (triangle)
+            {
+                case Triangle::Lower:
+                    solve_triangular_blocked<true, false>(n, cols, t, ldt, x, ldx);
+                    break;
+                case Triangle::UnitLower:
+                    solve_triangular_blocked<true, true>(n, cols, t, ldt, x, ldx);
+                    break;
+                case Triangle::Upper:
+                    solve_triangular_blocked<false, false>(n, cols, t, ldt, x, ldx);
+                    break;
+                case Triangle::UnitUpper:
+                    solve_triangular_blocked<false, true>(n, cols, t, ldt, x, ldx);
+                    break;
+            }
+        }
+
+        // NOLINTEND(readability-identifier-length)
+    }  // namespace ImplementationDetails
+
+    template <Coordinate coordinate>
+    bool lu_factorize(std::span<coordinate> matrix, std::span<unsigned int> pivots) requires(std::is_floating_point_v<coordinate>)
+    {
+        const size_t n = pivots.size();
+
+        if (matrix.size() != n * n)
+        {
+            throw std::invalid_argument("The matrix to decompose must have as many rows and columns as pivots");
+        }
+
+        const coordinate tolerance = ImplementationDetails::lu_relative_tolerance(matrix.data(), n, n);
+
+        return ImplementationDetails::lu_blocked(matrix.data(), n, n, pivots.data(), tolerance) != 0;
+    }
+
+    template <Coordinate coordinate>
+    void lu_solve(std::span<const coordinate> lu, std::span<const unsigned int> pivots, std::span<coordinate> rhs, size_t rhs_cols)
+    requires(std::is_floating_point_v<coordinate>)
+    {
+        const size_t n = pivots.size();
+
+        if (lu.size() != n * n || rhs.size() != n * rhs_cols)
+        {
+            throw std::invalid_argument("The decomposition and the right hand sides must have as many rows as pivots");
+        }
+
+        ImplementationDetails::lu_permute(pivots.data(), n, rhs.data(), rhs_cols, rhs_cols);
+        ImplementationDetails::solve_triangular_blocked<true, true>(n, rhs_cols, lu.data(), n, rhs.data(), rhs_cols);
+        ImplementationDetails::solve_triangular_blocked<false, false>(n, rhs_cols, lu.data(), n, rhs.data(), rhs_cols);
+    }
+
+    template <Coordinate coordinate>
+    void solve_triangular(std::span<const coordinate> matrix, Triangle triangle, std::span<coordinate> rhs, size_t rhs_cols)
+    requires(std::is_floating_point_v<coordinate>)
+    {
+        const size_t n = rhs_cols == 0 ? 0 : rhs.size() / rhs_cols;
+
+        if (rhs.size() != n * rhs_cols || matrix.size() != n * n)
+        {
+            throw std::invalid_argument("The matrix must have as many rows and columns as the right hand sides have rows");
+        }
+
+        ImplementationDetails::solve_triangle(triangle, n, rhs_cols, matrix.data(), n, rhs.data(), rhs_cols);
+    }
+}  // namespace LCNS::Algebra
@@ -3,17 +3,24 @@
 #include "algebra/Vector.hpp"
 #include "algebra/Matrix.hpp"
 #include "algebra/Quaternion.hpp"
+#include "algebra/Simd.hpp"
+#include "algebra/SimdMath.hpp"
+#include "algebra/VectorArray.hpp"
 
+#include <algorithm>
+#include <array>
 #include <tuple>
 #include <cmath>
 #include <numbers>
+#include <span>
+#include <type_traits>
 
 using std::numbers::pi;
 
 namespace LCNS::Algebra
 {
-    template <Coordinate coordinate>
-    std::tuple<double, double, double> EulerAnglesFromRotationMatrix(const Matrix<coordinate, 3, 3>& mat)
+    template <Coordinate coordinate, StorageOrder order>
+    std::tuple<double, double, double> EulerAnglesFromRotationMatrix(const Matrix<coordinate, 3, 3, order>& mat)
     requires std::is_floating_point_v<coordinate>
     {
         constexpr coordinate one = 1.0;
@@ -42,31 +49,238 @@ namespace LCNS::Algebra
         return { psi, theta, 0.0 };
     }
 
+    namespace ImplementationDetails
+    {
+        /*!
+         * @brief Number of matrices copied at once between an array of matrices and lanes on the stack
+         */
+        constexpr size_t matrix_block_size = 256;
+
+        /*!
+         * @brief Copy the coefficients of the matrices by blocks into lanes on the stack, as in transform_vectors, then
+         *        call kernel(pack, lanes, i, index) where lanes[row * size + col][i] is the coefficient of
+         *        matrices[index]. Large arrays are split between threads.
+         */
+        template <Coordinate coordinate, unsigned int size, StorageOrder order, typename Kernel>
+        void for_each_matrix_pack(std::span<const Matrix<coordinate, size, size, order>> matrices, const Kernel& kernel)
+        {
+            for_each_chunk_concurrently(matrices.size(),
+                                        matrix_block_size,
+                                        [matrices, &kernel](size_t begin, size_t end)
+                                        {
+                                            std::array<std::array<coordinate, matrix_block_size>, size * size> lanes;
+
+                                            for (size_t block_begin = begin; block_begin < end; block_begin += matrix_block_size)
+                                            {
+                                                const size_t count = std::min(matrix_block_size, end - block_begin);
+
+                                                for (size_t i = 0; i < count; ++i)
+                                                {
+                                                    const auto& matrix = matrices[block_begin + i];
+
+                                                    for (unsigned int k = 0; k < size * size; ++k)
+                                                    {
+                                                        lanes[k][i] = matrix(k / size, k % size);
+                                                    }
+                                                }
+
+                                                for_each_pack<coordinate>(0,
+                                                                          count,
+                                                                          [&lanes, &kernel, block_begin](auto pack, size_t i)
+                                                                          { kernel(pack, lanes, i, block_begin + i); });
+                                            }
+                                        });
+        }
+    }  // namespace ImplementationDetails
+
+    /*!
+     * \brief Convert each rotation matrix to Euler angles, see EulerAnglesFromRotationMatrix. Several matrices are
+     *        converted at once with the SIMD functions of SimdMath.hpp, large arrays are split between threads.
+     *        Unlike EulerAnglesFromRotationMatrix, |mat(2, 0)| slightly above 1 is handled as the gimbal lock case.
+     * @param matrices are the rotation matrices to convert
+     * @param angles is the destination, angles[i] = (psi, theta, phi) of matrices[i]. Its count must be matrices.size().
+     */
+    template <Coordinate coordinate, StorageOrder order = StorageOrder::RowMajor>
+    void EulerAnglesFromRotationMatrices(std::type_identity_t<std::span<const Matrix<coordinate, 3, 3, order>>> matrices,
+                                         VectorArray<coordinate, 3>&                                           angles)
+    requires std::is_floating_point_v<coordinate>
+    {
+        ImplementationDetails::check_same_count(angles, matrices.size());
+
+        const auto       dst        = ImplementationDetails::lanes_of(angles);
+        const coordinate before_one = std::nextafter(coordinate{1}, coordinate{0});
+
+        ImplementationDetails::for_each_matrix_pack(matrices,
+                                                    [dst, before_one](auto pack, const auto& lanes, size_t i, size_t index)
+                                                    {
+                                                        using simd = decltype(pack);
+
+                                                        const auto load = [&lanes, i](unsigned int row, unsigned int col)
+                                                        { return simd::load(lanes[row * 3 + col].data() + i); };
+
+                                                        const auto zero = simd::broadcast(coordinate{0});
+                                                        const auto one  = simd::broadcast(coordinate{1});
+                                                        const auto m20  = load(2, 0);
+
+                                                        const auto theta = simd::sub(zero, ImplementationDetails::asin_simd<coordinate, simd>(m20));
+
+                                                        // cos(theta) > 0 is divided out of both arguments of atan2. With |m20| = 1 (gimbal
+                                                        // lock), phi is set to 0 and psi depends on the sign of m20.
+                                                        const auto gimbal_lock = simd::select_greater(simd::abs(m20), simd::broadcast(before_one), one, zero);
+                                                        const auto sign        = simd::select_greater(m20, zero, simd::sub(zero, one), one);
+
+                                                        const auto psi = ImplementationDetails::atan2_simd<coordinate, simd>(
+                                                        simd::select_non_zero(gimbal_lock, simd::mul(sign, load(0, 1)), load(2, 1)),
+                                                        simd::select_non_zero(gimbal_lock, simd::mul(sign, load(0, 2)), load(2, 2)));
+
+                                                        const auto phi = simd::select_non_zero(gimbal_lock,
+                                                                                               zero,
+                                                                                               ImplementationDetails::atan2_simd<coordinate, simd>(load(1, 0), load(0, 0)));
+
+                                                        simd::store(dst[0] + index, psi);
+                                                        simd::store(dst[1] + index, theta);
+                                                        simd::store(dst[2] + index, phi);
+                                                    });
+    }
+
+    /*!
+     * \brief Convert Euler angles to a quaternion, the inverse of EulerAnglesFromRotationMatrix followed by
+     *        RotationMatrixAsQuaternion. Computed in the precision of the coordinate type.
+     * @param psi is the rotation around x
+     * @param theta is the rotation around y
+     * @param phi is the rotation around z
+     * @return a quaternion of length 1
+     */
     template <Coordinate coordinate>
-    Quaternion<coordinate> RotationMatrixAsQuaternion(const Matrix<coordinate, 3, 3>& mat) requires std::is_floating_point_v<coordinate>
+    Quaternion<coordinate> EulerAnglesAsQuaternion(coordinate psi, coordinate theta, coordinate phi) requires std::is_floating_point_v<coordinate>
+    {
+        constexpr coordinate half = 0.5;
+
+        const coordinate cos_psi   = std::cos(psi * half);
+        const coordinate sin_psi   = std::sin(psi * half);
+        const coordinate cos_theta = std::cos(theta * half);
+        const coordinate sin_theta = std::sin(theta * half);
+        const coordinate cos_phi   = std::cos(phi * half);
+        const coordinate sin_phi   = std::sin(phi * half);
+
+        return { (sin_psi * cos_theta * cos_phi) - (cos_psi * sin_theta * sin_phi),
+                 (cos_psi * sin_theta * cos_phi) + (sin_psi * cos_theta * sin_phi),
+                 (cos_psi * cos_theta * sin_phi) - (sin_psi * sin_theta * cos_phi),
+                 (cos_psi * cos_theta * cos_phi) + (sin_psi * sin_theta * sin_phi) };
+    }
+
+    namespace ImplementationDetails
+    {
+        // NOLINTBEGIN(readability-identifier-length)
+        /*!
+         * @brief Shepperd's method: the largest of 4w², 4x², 4y² and 4z² is computed from the diagonal with a single
+         *        square root, the three other coordinates from the off-diagonal coefficients divided by it. Choosing
+         *        the largest keeps the division well conditioned for all rotations, including those close to pi.
+         *        Branch-free so that it also works on SimdPack. The result has w >= 0.
+         */
+        template <Coordinate coordinate, typename simd>
+        void shepperd(typename simd::type  m00,
+                      typename simd::type  m01,
+                      typename simd::type  m02,
+                      typename simd::type  m10,
+                      typename simd::type  m11,
+                      typename simd::type  m12,
+                      typename simd::type  m20,
+                      typename simd::type  m21,
+                      typename simd::type  m22,
+                      typename simd::type& x,
+                      typename simd::type& y,
+                      typename simd::type& z,
+                      typename simd::type& w)
+        {
+            const auto one = simd::broadcast(coordinate{1});
+
+            // 4w², 4x², 4y² and 4z² for an orthonormal matrix
+            const auto dw = simd::add(one, simd::add(m00, simd::add(m11, m22)));
+            const auto dx = simd::add(one, simd::sub(m00, simd::add(m11, m22)));
+            const auto dy = simd::add(one, simd::sub(m11, simd::add(m00, m22)));
+            const auto dz = simd::add(one, simd::sub(m22, simd::add(m00, m11)));
+
+            // 4wx, 4wy, 4wz, 4xy, 4xz and 4yz
+            const auto wx = simd::sub(m21, m12);
+            const auto wy = simd::sub(m02, m20);
+            const auto wz = simd::sub(m10, m01);
+            const auto xy = simd::add(m01, m10);
+            const auto xz = simd::add(m02, m20);
+            const auto yz = simd::add(m12, m21);
+
+            // Numerators of each coordinate for the largest pivot, each coordinate is then numerator / (2 * sqrt(pivot))
+            auto pivot = dw;
+            auto nx    = wx;
+            auto ny    = wy;
+            auto nz    = wz;
+            auto nw    = dw;
+
+            const auto choose = [&](auto d, auto cx, auto cy, auto cz, auto cw)
+            {
+                nx    = simd::select_greater(d, pivot, cx, nx);
+                ny    = simd::select_greater(d, pivot, cy, ny);
+                nz    = simd::select_greater(d, pivot, cz, nz);
+                nw    = simd::select_greater(d, pivot, cw, nw);
+                pivot = simd::max(d, pivot);
+            };
+
+            choose(dx, dx, xy, xz, wx);
+            choose(dy, xy, dy, yz, wy);
+            choose(dz, xz, yz, dz, wz);
+
+            // q and -q are the same rotation, the sign is chosen so that w >= 0
+            auto scale = simd::div(simd::broadcast(coordinate{0.5}), simd::sqrt(pivot));
+            scale      = simd::select_greater(simd::broadcast(coordinate{0}), nw, simd::sub(simd::broadcast(coordinate{0}), scale), scale);
+
+            x = simd::mul(nx, scale);
+            y = simd::mul(ny, scale);
+            z = simd::mul(nz, scale);
+            w = simd::mul(nw, scale);
+        }
+        // NOLINTEND(readability-identifier-length)
+    }  // namespace ImplementationDetails
+
+    /*!
+     * \brief Convert a rotation matrix to a quaternion with Shepperd's method: a single square root and no
+     *        trigonometric function, computed in the precision of the coordinate type.
+     * @param mat is a rotation matrix
+     * @return the corresponding quaternion with w >= 0, or the null quaternion for the null matrix
+     */
+    template <Coordinate coordinate, StorageOrder order>
+    Quaternion<coordinate> RotationMatrixAsQuaternion(const Matrix<coordinate, 3, 3, order>& mat) requires std::is_floating_point_v<coordinate>
     {
         if (mat.isNull())
         {
             return {};
         }
 
-        const auto [psi, theta, phi] = EulerAnglesFromRotationMatrix(mat);
+        using pack = ImplementationDetails::ScalarPack<coordinate>;
 
-        const double cos_psi   = cos(psi * 0.5);
-        const double sin_psi   = sin(psi * 0.5);
-        const double cos_theta = cos(theta * 0.5);
-        const double sin_theta = sin(theta * 0.5);
-        const double cos_phi   = cos(phi * 0.5);
-        const double sin_phi   = sin(phi * 0.5);
+        coordinate x = 0;  // NOLINT(readability-identifier-length)
+        coordinate y = 0;  // NOLINT(readability-identifier-length)
+        coordinate z = 0;  // NOLINT(readability-identifier-length)
+        coordinate w = 0;  // NOLINT(readability-identifier-length)
 
-        return { static_cast<coordinate>((sin_psi * cos_theta * cos_phi) - (cos_psi * sin_theta * sin_phi)),
-                 static_cast<coordinate>((cos_psi * sin_theta * cos_phi) + (sin_psi * cos_theta * sin_phi)),
-                 static_cast<coordinate>((cos_psi * cos_theta * sin_phi) - (sin_psi * sin_theta * cos_phi)),
-                 static_cast<coordinate>((cos_psi * cos_theta * cos_phi) + (sin_psi * sin_theta * sin_phi)) };
+        ImplementationDetails::shepperd<coordinate, pack>(mat(0, 0),
+                                                          mat(0, 1),
+                                                          mat(0, 2),
+                                                          mat(1, 0),
+                                                          mat(1, 1),
+                                                          mat(1, 2),
+                                                          mat(2, 0),
+                                                          mat(2, 1),
+                                                          mat(2, 2),
+                                                          x,
+                                                          y,
+                                                          z,
+                                                          w);
+
+        return { x, y, z, w };
     }
 
-    template <Coordinate coordinate>
-    Matrix<coordinate, 3, 3> QuaternionAsRotationMatrix(const Quaternion<coordinate>& quat) requires std::is_floating_point_v<coordinate>
+    template <Coordinate coordinate, StorageOrder order = StorageOrder::RowMajor>
+    Matrix<coordinate, 3, 3, order> QuaternionAsRotationMatrix(const Quaternion<coordinate>& quat) requires std::is_floating_point_v<coordinate>
     {
         const auto impl = [](const Quaternion<coordinate>& qtn)
         {
@@ -87,9 +301,9 @@ namespace LCNS::Algebra
             const coordinate two = 2.0;
 
             // clang-format off
-            return Matrix<coordinate, 3, 3>({ws + xs - ys - zs,     two*(xy - wz),     two*(wy + xz),
-                                                 two*(xy + wz), ws - xs + ys - zs,     two*(yz - wx),
-                                                 two*(xz - wy),     two*(wx + yz), ws - xs - ys + zs});
+            return Matrix<coordinate, 3, 3, order>({ws + xs - ys - zs,     two*(xy - wz),     two*(wy + xz),
+                                                        two*(xy + wz), ws - xs + ys - zs,     two*(yz - wx),
+                                                        two*(xz - wy),     two*(wx + yz), ws - xs - ys + zs});
             //clang-format on
         };
 
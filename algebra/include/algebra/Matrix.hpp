@@ -1,19 +1,35 @@
 #pragma once
 
+#include "algebra/CholeskyDecomposition.hpp"
 #include "algebra/Internal.hpp"
+#include "algebra/LUDecomposition.hpp"
+#include "algebra/QRDecomposition.hpp"
 #include "algebra/Vector.hpp"
+#include "algebra/VectorKernels.hpp"
+#include "algebra/Matrix4x4Simd.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <cstring>
 #include <array>
 #include <stdexcept>
 #include <ostream>
+#include <span>
 #include <iomanip>
 #include <tuple>
 
 namespace LCNS::Algebra
 {
-    template <Coordinate coordinate, unsigned int rows, unsigned int cols>
+    /*!
+     * @brief Order in which the coefficients of a matrix are stored in memory, see Matrix::data()
+     */
+    enum class StorageOrder
+    {
+        RowMajor,
+        ColumnMajor
+    };
+
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order = StorageOrder::RowMajor>
     class Matrix
     {
     public:
@@ -30,10 +46,17 @@ namespace LCNS::Algebra
 
         /*!
          * @brief Constructor with initializer list parameter.
-         * @param coeffs contains the coefficients of the matrix, row by row
+         * @param coeffs contains the coefficients of the matrix, row by row whatever the storage order
          */
         constexpr Matrix(const std::initializer_list<coordinate>& coeffs);
 
+        /*!
+         * @brief Constructor from a matrix stored in the other storage order
+         * @param other is the matrix to copy the coefficients from
+         */
+        template <StorageOrder other_order>
+        constexpr explicit Matrix(const Matrix<coordinate, rows, cols, other_order>& other) requires(other_order != order);
+
         /*!
          * @brief Accessor (read/write)
          * @param i is the index of the row where to find the coefficient to access
@@ -55,35 +78,35 @@ namespace LCNS::Algebra
          * @param rhs is the matrix to compare coefficients from
          * @return true if all coordinates of this matrix and rhs are equal
          */
-        constexpr bool operator==(const Matrix<coordinate, rows, cols>& rhs) const;
+        constexpr bool operator==(const Matrix<coordinate, rows, cols, order>& rhs) const;
 
         /*!
          * @brief Addition operator. Do not modify this object.
          * @param rhs is the matrix to add to this one
          * @return a matrix corresponding to the addition: this + rhs
          */
-        constexpr Matrix<coordinate, rows, cols> operator+(const Matrix<coordinate, rows, cols>& rhs) const;
+        constexpr Matrix<coordinate, rows, cols, order> operator+(const Matrix<coordinate, rows, cols, order>& rhs) const;
 
         /*!
          * @brief Substraction operator. Do not modify this object.
          * @param rhs is the matrix to substract from this one
          * @return a matrix corresponding to the substraction: this - rhs
          */
-        constexpr Matrix<coordinate, rows, cols> operator-(const Matrix<coordinate, rows, cols>& rhs) const;
+        constexpr Matrix<coordinate, rows, cols, order> operator-(const Matrix<coordinate, rows, cols, order>& rhs) const;
 
         /*!
          * @brief Multiplication by a scalar operator
          * @param scalar is the scalar value that will multiply all the coefficients
          * @return a reference on this object after the operation
          */
-        Matrix<coordinate, rows, cols>& operator*=(auto scalar);
+        Matrix<coordinate, rows, cols, order>& operator*=(auto scalar);
 
         /*!
          * @brief Division by a scalar operator
          * @param scalar is the scalar value from which all the coefficients will be divided
          * @return a reference on this object after the operation
          */
-        Matrix<coordinate, rows, cols>& operator/=(auto scalar);
+        Matrix<coordinate, rows, cols, order>& operator/=(auto scalar);
 
         /*! Other operations are achieved using an external operator, see below */
 
@@ -94,13 +117,13 @@ namespace LCNS::Algebra
         constexpr std::tuple<unsigned int, unsigned int> dimensions() const;
 
         /*!
-         * @brief Get a pointer to the internal coefficients (read/write)
+         * @brief Get a pointer to the internal coefficients (read/write), stored row by row or column by column depending on order
          * @return a pointer to the first element of _coeff
          */
         coordinate* data();
 
         /*!
-         * @brief Get a pointer to the internal coefficients (read only)
+         * @brief Get a pointer to the internal coefficients (read only), stored row by row or column by column depending on order
          * @return a pointer to the first element of _coeff
          */
         const coordinate* data() const;
@@ -109,19 +132,21 @@ namespace LCNS::Algebra
          * @brief Transpose this matrix if it's a square matrix
          * @return a reference on this object after the operation
          */
-        Matrix<coordinate, rows, cols>& transpose() requires(rows == cols);
+        Matrix<coordinate, rows, cols, order>& transpose() requires(rows == cols);
 
         /*!
          * @brief Create a matrix that is the transpose of this, also works for rectangular matrices
          * @return a new matrix
          */
-        constexpr Matrix<coordinate, cols, rows> transposed() const;
+        constexpr Matrix<coordinate, cols, rows, order> transposed() const;
 
         /*!
-         * @brief Compute the determinant of this matrix. Only works for square matrices of size 1,2,3 or 4
+         * @brief Compute the determinant of this matrix if it's a square matrix. Closed forms are used up to the size 4,
+         *        an LU decomposition with partial pivoting above (rounded to the nearest value for integer coordinates).
+         *        At run time, the 4x4 float and double determinants use the SIMD block method of the inverse when AVX is available.
          * @return the determinant of this matrix.
          */
-        constexpr coordinate determinant() const requires(rows == cols && (0 < rows && rows < 5));
+        constexpr coordinate determinant() const requires(rows == cols && 0 < rows);
 
         /*!
          * @brief Compute the trace of this matrix if it's a square matrix
@@ -130,17 +155,129 @@ namespace LCNS::Algebra
         constexpr coordinate trace() const requires(rows == cols);
 
         /*!
-         * @brief Inverse this matrix if it's a square matrix of floating point coordinates and if its determinant is not null
-         * @return a reference to this
+         * @brief Inverse this matrix if it's a square matrix of floating point coordinates and if its determinant is not null.
+         *        Above the size 4, the matrix is considered singular when a pivot of its LU decomposition is not larger than
+         *        rows * epsilon * max|coefficient|.
+         * @return a reference to this, left unchanged if the matrix is singular
          */
-        Matrix<coordinate, rows, cols>& inverse() requires(rows == cols && (0 < rows && rows < 5) && std::is_floating_point_v<coordinate>);
+        Matrix<coordinate, rows, cols, order>& inverse() requires(rows == cols && 0 < rows && std::is_floating_point_v<coordinate>);
 
         /*!
          * @brief Compute the inverse of this matrix if it's a square matrix of floating point coordinates and if its determinant is not null
          * @return a new matrix that is the inverse of this matrix if the operation is successful, a null matrix otherwise
          */
-        constexpr Matrix<coordinate, rows, cols> inversed() const
-        requires(rows == cols && (0 < rows && rows < 5) && std::is_floating_point_v<coordinate>);
+        constexpr Matrix<coordinate, rows, cols, order> inversed() const
+        requires(rows == cols && 0 < rows && std::is_floating_point_v<coordinate>);
+
+        /*!
+         * @brief Solve this * x = rhs with an LU decomposition with partial pivoting, cheaper and more accurate than
+         *        computing the inverse
+         * @param rhs is the right hand side of the system
+         * @return the solution x
+         * @throw std::runtime_error if this matrix is singular, see inverse()
+         */
+        constexpr Vector<coordinate, rows> solve(const Vector<coordinate, rows>& rhs) const
+        requires(rows == cols && 0 < rows && std::is_floating_point_v<coordinate>);
+
+        /*!
+         * @brief Solve this * X = rhs for all the columns of rhs at once, the decomposition being shared
+         * @param rhs is the right hand side of the system, one column per system
+         * @return the solution X
+         * @throw std::runtime_error if this matrix is singular, see inverse()
+         */
+        template <unsigned int rhs_cols>
+        constexpr Matrix<coordinate, rows, rhs_cols, order> solve(const Matrix<coordinate, rows, rhs_cols, order>& rhs) const
+        requires(rows == cols && 0 < rows && std::is_floating_point_v<coordinate>);
+
+        /*!
+         * @brief Decompose this symmetric positive definite matrix in place, this = L * L^T, with L lower triangular.
+         *        Only one triangle of this matrix is read. Unrolled up to the size 16, blocked and multithreaded above.
+         * @return a reference to this, which holds L, the coefficients above the diagonal being null
+         * @throw std::runtime_error if this matrix is not positive definite, a pivot being not larger than
+         *        rows * epsilon * max|diagonal|. The coefficients are then left partially decomposed.
+         */
+        Matrix<coordinate, rows, cols, order>& decomposeCholesky() requires(rows == cols && 0 < rows && std::is_floating_point_v<coordinate>);
+
+        /*!
+         * @brief Compute the Cholesky factor of this symmetric positive definite matrix, see decomposeCholesky()
+         * @return a new lower triangular matrix L such that this = L * L^T
+         * @throw std::runtime_error if this matrix is not positive definite
+         */
+        Matrix<coordinate, rows, cols, order> choleskyFactor() const requires(rows == cols && 0 < rows && std::is_floating_point_v<coordinate>);
+
+        /*!
+         * @brief Solve this * x = rhs with a Cholesky decomposition, this matrix being symmetric positive definite: half
+         *        the work of solve() and stable without pivoting
+         * @param rhs is the right hand side of the system
+         * @return the solution x
+         * @throw std::runtime_error if this matrix is not positive definite, see decomposeCholesky()
+         */
+        Vector<coordinate, rows> solveCholesky(const Vector<coordinate, rows>& rhs) const
+        requires(rows == cols && 0 < rows && std::is_floating_point_v<coordinate>);
+
+        /*!
+         * @brief Solve this * X = rhs for all the columns of rhs at once with a Cholesky decomposition, see solveCholesky()
+         * @param rhs is the right hand side of the system, one column per system
+         * @return the solution X
+         * @throw std::runtime_error if this matrix is not positive definite, see decomposeCholesky()
+         */
+        template <unsigned int rhs_cols>
+        Matrix<coordinate, rows, rhs_cols, order> solveCholesky(const Matrix<coordinate, rows, rhs_cols, order>& rhs) const
+        requires(rows == cols && 0 < rows && std::is_floating_point_v<coordinate>);
+
+        /*!
+         * @brief Inverse this symmetric positive definite matrix in place with its Cholesky decomposition, A^-1 = L^-T * L^-1,
+         *        about half the work of inverse(). Only one triangle of this matrix is read, and no second matrix is used.
+         * @return a reference to this
+         * @throw std::runtime_error if this matrix is not positive definite, see decomposeCholesky(). The coefficients are
+         *        then left partially decomposed.
+         */
+        Matrix<coordinate, rows, cols, order>& inverseCholesky() requires(rows == cols && 0 < rows && std::is_floating_point_v<coordinate>);
+
+        /*!
+         * @brief Compute the inverse of this symmetric positive definite matrix with its Cholesky decomposition, see
+         *        inverseCholesky()
+         * @return a new matrix that is the inverse of this matrix
+         * @throw std::runtime_error if this matrix is not positive definite
+         */
+        Matrix<coordinate, rows, cols, order> inversedCholesky() const requires(rows == cols && 0 < rows && std::is_floating_point_v<coordinate>);
+
+        /*!
+         * @brief Least squares solution of this * x = rhs, minimizing |this * x - rhs|, with a Householder QR decomposition
+         *        of this matrix, which has at least as many rows as columns. Unlike the normal equations
+         *        transposed() * this * x = transposed() * rhs, the condition number of this matrix is not squared.
+         * @param rhs is the right hand side of the system
+         * @return the solution x
+         * @throw std::runtime_error if this matrix does not have full column rank, a diagonal coefficient of R being not
+         *        larger than rows * epsilon * max|diagonal of R|
+         */
+        Vector<coordinate, cols> solveLeastSquares(const Vector<coordinate, rows>& rhs) const
+        requires(0 < cols && cols <= rows && std::is_floating_point_v<coordinate>);
+
+        /*!
+         * @brief Least squares solution of this * X = rhs for all the columns of rhs at once, the decomposition being
+         *        shared, see solveLeastSquares()
+         * @param rhs is the right hand side of the system, one column per system
+         * @return the solution X
+         * @throw std::runtime_error if this matrix does not have full column rank
+         */
+        template <unsigned int rhs_cols>
+        Matrix<coordinate, cols, rhs_cols, order> solveLeastSquares(const Matrix<coordinate, rows, rhs_cols, order>& rhs) const
+        requires(0 < cols && cols <= rows && std::is_floating_point_v<coordinate>);
+
+        /*!
+         * @brief Inverse this 4x4 matrix of floats using an approximated reciprocal of the determinant (~22 bits of precision)
+         *        instead of a division. Same as inverse() if SIMD instructions are not available.
+         * @return a reference to this
+         */
+        Matrix<coordinate, rows, cols, order>& inverseFast() requires(rows == 4 && cols == 4 && std::is_same_v<coordinate, float>);
+
+        /*!
+         * @brief Compute the inverse of this 4x4 matrix of floats using an approximated reciprocal of the determinant
+         *        (~22 bits of precision) instead of a division. Same as inversed() if SIMD instructions are not available.
+         * @return a new matrix that is the inverse of this matrix if the operation is successful, a null matrix otherwise
+         */
+        Matrix<coordinate, rows, cols, order> inversedFast() const requires(rows == 4 && cols == 4 && std::is_same_v<coordinate, float>);
 
         /*!
          * @brief Check if this matrix is the null matrix
@@ -158,29 +295,55 @@ namespace LCNS::Algebra
         constexpr unsigned int _(unsigned int i, unsigned int j) const;
 
         /*!
-         * @brief Helper method to compute the matrix inverse
+         * @brief Helper method to compute the matrix inverse. Works directly on _coeff for both storage orders
+         *        since the inverse of the transpose is the transpose of the inverse.
          * @param copy takes the coefficients of this matrix as a copy
          * @param det is the determinant of this matrix
          */
         constexpr void _inverseImpl(std::array<coordinate, rows * cols> copy, coordinate det)
         requires(rows == cols && (0 < rows && rows < 5) && std::is_floating_point_v<coordinate>);
 
+        /*!
+         * @brief Helper method to compute the inverse of matrices larger than 4x4 with an LU decomposition. Works directly
+         *        on _coeff for both storage orders, like _inverseImpl.
+         * @param result is the matrix where to write the inverse, can be this
+         * @return false, result being left unchanged, if this matrix is singular
+         */
+        constexpr bool _inverseLU(Matrix<coordinate, rows, cols, order>& result) const
+        requires(rows == cols && 4 < rows && std::is_floating_point_v<coordinate>);
+
+        /*!
+         * @brief Helper method to solve this * X = B, where B has rhs_cols columns stored row by row in x
+         * @param x holds B on input and X on output
+         */
+        constexpr void _solveLU(coordinate* x, unsigned int rhs_cols) const requires(rows == cols && std::is_floating_point_v<coordinate>);
+
+        /*!
+         * @brief Helper method to solve this * X = B with a Cholesky decomposition, where B has rhs_cols columns stored
+         *        row by row in x
+         * @param x holds B on input and X on output
+         */
+        void _solveCholesky(coordinate* x, unsigned int rhs_cols) const requires(rows == cols && std::is_floating_point_v<coordinate>);
+
+        /*!
+         * @brief Helper method to solve this * X = B in the least squares sense, where B has rhs_cols columns stored row by
+         *        row in x
+         * @param x holds B on input, and X in its first cols rows on output
+         */
+        void _solveLeastSquares(coordinate* x, unsigned int rhs_cols) const requires(0 < cols && cols <= rows && std::is_floating_point_v<coordinate>);
+
     private:
         std::array<coordinate, rows * cols> _coeff = {};
 
         static constexpr double _epsilon = 1E-9;
-
-        unsigned int _rows = rows;
-        unsigned int _cols = cols;
-
     };  // class Matrix
 
-    template <Coordinate coordinate, unsigned int rows, unsigned int cols>
-    constexpr Matrix<coordinate, rows, cols>::Matrix(auto scalar)
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    constexpr Matrix<coordinate, rows, cols, order>::Matrix(auto scalar)
     {
         static_assert(std::is_same_v<decltype(scalar), coordinate>);
 
-        const auto diag = std::min(_rows, _cols);
+        constexpr auto diag = std::min(rows, cols);
 
         for (unsigned int i = 0; i < diag; ++i)
         {
@@ -191,8 +354,8 @@ namespace LCNS::Algebra
         }
     }
 
-    template <Coordinate coordinate, unsigned int rows, unsigned int cols>
-    constexpr Matrix<coordinate, rows, cols>::Matrix(const std::initializer_list<coordinate>& coeffs)
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    constexpr Matrix<coordinate, rows, cols, order>::Matrix(const std::initializer_list<coordinate>& coeffs)
     {
         if (coeffs.size() > _coeff.size())
         {
@@ -200,14 +363,28 @@ namespace LCNS::Algebra
         }
 
         unsigned int i = 0;
-        for (auto it = coeffs.begin(); it < coeffs.end(); it++)
+        for (auto it = coeffs.begin(); it < coeffs.end(); it++, i++)
         {
-            _coeff[i++] = *it;
+            _coeff[_(i / cols, i % cols)] = *it;
         }
     }
 
-    template <Coordinate coordinate, unsigned int rows, unsigned int cols>
-    constexpr coordinate& Matrix<coordinate, rows, cols>::operator()(unsigned int i, unsigned int j)
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    template <StorageOrder other_order>
+    constexpr Matrix<coordinate, rows, cols, order>::Matrix(const Matrix<coordinate, rows, cols, other_order>& other)
+    requires(other_order != order)
+    {
+        for (unsigned int i = 0; i < rows; ++i)
+        {
+            for (unsigned int j = 0; j < cols; ++j)
+            {
+                _coeff[_(i, j)] = other(i, j);
+            }
+        }
+    }
+
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    constexpr coordinate& Matrix<coordinate, rows, cols, order>::operator()(unsigned int i, unsigned int j)
     {
         if (rows <= i || cols <= j)
         {
@@ -217,10 +394,10 @@ namespace LCNS::Algebra
         return _coeff[_(i, j)];
     }
 
-    template <Coordinate coordinate, unsigned int rows, unsigned int cols>
-    constexpr coordinate Matrix<coordinate, rows, cols>::operator()(unsigned int i, unsigned int j) const
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    constexpr coordinate Matrix<coordinate, rows, cols, order>::operator()(unsigned int i, unsigned int j) const
     {
-        if (_rows <= i || _cols <= j)
+        if (rows <= i || cols <= j)
         {
             throw std::out_of_range("Index out of range to access matrix coefficient");
         }
@@ -228,20 +405,15 @@ namespace LCNS::Algebra
         return _coeff[_(i, j)];
     }
 
-    template <Coordinate coordinate, unsigned int rows, unsigned int cols>
-    constexpr bool Matrix<coordinate, rows, cols>::operator==(const Matrix<coordinate, rows, cols>& rhs) const
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    constexpr bool Matrix<coordinate, rows, cols, order>::operator==(const Matrix<coordinate, rows, cols, order>& rhs) const
     {
         return _coeff == rhs._coeff;
     }
 
-    template <Coordinate coordinate, unsigned int rows, unsigned int cols>
-    constexpr Matrix<coordinate, rows, cols> Matrix<coordinate, rows, cols>::operator+(const Matrix<coordinate, rows, cols>& rhs) const
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    constexpr Matrix<coordinate, rows, cols, order> Matrix<coordinate, rows, cols, order>::operator+(const Matrix<coordinate, rows, cols, order>& rhs) const
     {
-        if (_rows != rhs._rows || _cols != rhs._cols)
-        {
-            throw std::runtime_error("Addition requires matrices of equal dimentions");
-        }
-
         auto result = *this;
 
         for (unsigned int i = 0; i < rows * cols; ++i)
@@ -252,14 +424,9 @@ namespace LCNS::Algebra
         return result;
     }
 
-    template <Coordinate coordinate, unsigned int rows, unsigned int cols>
-    constexpr Matrix<coordinate, rows, cols> Matrix<coordinate, rows, cols>::operator-(const Matrix<coordinate, rows, cols>& rhs) const
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    constexpr Matrix<coordinate, rows, cols, order> Matrix<coordinate, rows, cols, order>::operator-(const Matrix<coordinate, rows, cols, order>& rhs) const
     {
-        if (_rows != rhs._rows || _cols != rhs._cols)
-        {
-            throw std::runtime_error("Substraction requires matrices of equal dimentions");
-        }
-
         auto result = *this;
 
         for (unsigned int i = 0; i < rows * cols; ++i)
@@ -270,8 +437,8 @@ namespace LCNS::Algebra
         return result;
     }
 
-    template <Coordinate coordinate, unsigned int rows, unsigned int cols>
-    Matrix<coordinate, rows, cols>& Matrix<coordinate, rows, cols>::operator*=(auto scalar)
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    Matrix<coordinate, rows, cols, order>& Matrix<coordinate, rows, cols, order>::operator*=(auto scalar)
     {
         static_assert(std::is_same_v<decltype(scalar), coordinate>);
 
@@ -283,8 +450,8 @@ namespace LCNS::Algebra
         return *this;
     }
 
-    template <Coordinate coordinate, unsigned int rows, unsigned int cols>
-    Matrix<coordinate, rows, cols>& Matrix<coordinate, rows, cols>::operator/=(auto scalar)
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    Matrix<coordinate, rows, cols, order>& Matrix<coordinate, rows, cols, order>::operator/=(auto scalar)
     {
         static_assert(std::is_same_v<decltype(scalar), coordinate>);
 
@@ -301,30 +468,30 @@ namespace LCNS::Algebra
         return *this;
     }
 
-    template <Coordinate coordinate, unsigned int rows, unsigned int cols>
-    constexpr std::tuple<unsigned int, unsigned int> Matrix<coordinate, rows, cols>::dimensions() const
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    constexpr std::tuple<unsigned int, unsigned int> Matrix<coordinate, rows, cols, order>::dimensions() const
     {
-        return std::make_tuple(_rows, _cols);
+        return std::make_tuple(rows, cols);
     }
 
-    template <Coordinate coordinate, unsigned int rows, unsigned int cols>
-    coordinate* Matrix<coordinate, rows, cols>::data()
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    coordinate* Matrix<coordinate, rows, cols, order>::data()
     {
         return _coeff.data();
     }
 
-    template <Coordinate coordinate, unsigned int rows, unsigned int cols>
-    const coordinate* Matrix<coordinate, rows, cols>::data() const
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    const coordinate* Matrix<coordinate, rows, cols, order>::data() const
     {
         return _coeff.data();
     }
 
-    template <Coordinate coordinate, unsigned int rows, unsigned int cols>
-    Matrix<coordinate, rows, cols>& Matrix<coordinate, rows, cols>::transpose() requires(rows == cols)
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    Matrix<coordinate, rows, cols, order>& Matrix<coordinate, rows, cols, order>::transpose() requires(rows == cols)
     {
-        for (unsigned int i = 0; i < _rows; ++i)
+        for (unsigned int i = 0; i < rows; ++i)
         {
-            for (unsigned int j = i + 1; j < _cols; ++j)
+            for (unsigned int j = i + 1; j < cols; ++j)
             {
                 std::swap(_coeff[_(i, j)], _coeff[_(j, i)]);
             }
@@ -333,14 +500,14 @@ namespace LCNS::Algebra
         return *this;
     }
 
-    template <Coordinate coordinate, unsigned int rows, unsigned int cols>
-    constexpr Matrix<coordinate, cols, rows> Matrix<coordinate, rows, cols>::transposed() const
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    constexpr Matrix<coordinate, cols, rows, order> Matrix<coordinate, rows, cols, order>::transposed() const
     {
-        Matrix<coordinate, cols, rows> result;
+        Matrix<coordinate, cols, rows, order> result;
 
-        for (unsigned int i = 0; i < _rows; ++i)
+        for (unsigned int i = 0; i < rows; ++i)
         {
-            for (unsigned int j = 0; j < _cols; ++j)
+            for (unsigned int j = 0; j < cols; ++j)
             {
                 result(j, i) = _coeff[_(i, j)];
             }
@@ -349,14 +516,49 @@ namespace LCNS::Algebra
         return result;
     }
 
-    template <Coordinate coordinate, unsigned int rows, unsigned int cols>
-    constexpr coordinate Matrix<coordinate, rows, cols>::determinant() const requires(rows == cols && (0 < rows && rows < 5))
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    constexpr coordinate Matrix<coordinate, rows, cols, order>::determinant() const requires(rows == cols && 0 < rows)
     {
-        if constexpr (rows == 1)
+        if constexpr (rows > 4)
+        {
+            // Product of the pivots, computed in double precision for integers and floats like the closed forms below.
+            // The determinant of the transpose being the same, _coeff is decomposed as is for both storage orders.
+            using precision = std::conditional_t<std::is_same_v<coordinate, long double>, long double, double>;
+
+            auto factors = ImplementationDetails::lu_load<precision, rows>(_coeff.data(), false);
+            ImplementationDetails::lu_factorize(factors, precision{0});
+
+            precision result = factors.sign;
+
+            for (unsigned int i = 0; i < rows && result != 0; ++i)
+            {
+                result *= factors.lu[(i * rows) + i];
+            }
+
+            if constexpr (std::is_integral_v<coordinate>)
+            {
+                return static_cast<coordinate>(result < 0 ? result - 0.5 : result + 0.5);
+            }
+            else
+            {
+                return static_cast<coordinate>(result);
+            }
+        }
+        else if constexpr (rows == 1)
         {
             return _coeff[0];
         }
 
+#ifdef AVX_ENABLED_ON_CPU
+        if constexpr (rows == 4 && (std::is_same_v<coordinate, float> || std::is_same_v<coordinate, double>))
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return ImplementationDetails::determinant_4x4_simd(_coeff.data());
+            }
+        }
+#endif
+
         // clang-format off
         if constexpr (std::is_same_v<coordinate,float>)
         {
@@ -404,8 +606,8 @@ namespace LCNS::Algebra
         // clang-format on
     }
 
-    template <Coordinate coordinate, unsigned int rows, unsigned int cols>
-    constexpr coordinate Matrix<coordinate, rows, cols>::trace() const requires(rows == cols)
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    constexpr coordinate Matrix<coordinate, rows, cols, order>::trace() const requires(rows == cols)
     {
         coordinate result = 0;
 
@@ -417,34 +619,308 @@ namespace LCNS::Algebra
         return result;
     }
 
-    template <Coordinate coordinate, unsigned int rows, unsigned int cols>
-    Matrix<coordinate, rows, cols>& Matrix<coordinate, rows, cols>::inverse()
-    requires(rows == cols && (0 < rows && rows < 5) && std::is_floating_point_v<coordinate>)
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    Matrix<coordinate, rows, cols, order>& Matrix<coordinate, rows, cols, order>::inverse()
+    requires(rows == cols && 0 < rows && std::is_floating_point_v<coordinate>)
     {
-        if (const auto det = determinant(); std::abs(det) > _epsilon)
+        if constexpr (rows > 4)
         {
-            _inverseImpl(_coeff, det);
+            _inverseLU(*this);
+        }
+        else
+        {
+#ifdef AVX_ENABLED_ON_CPU
+            if constexpr (rows == 4 && (std::is_same_v<coordinate, float> || std::is_same_v<coordinate, double>))
+            {
+                // The determinant is obtained while computing the inverse, the coefficients are left unchanged if it is null
+                ImplementationDetails::inverse_4x4_simd(_coeff.data(), _coeff.data(), _epsilon);
+                return *this;
+            }
+#endif
+
+            if (const auto det = determinant(); std::abs(det) > _epsilon)
+            {
+                _inverseImpl(_coeff, det);
+            }
         }
 
         return *this;
     }
 
-    template <Coordinate coordinate, unsigned int rows, unsigned int cols>
-    constexpr Matrix<coordinate, rows, cols> Matrix<coordinate, rows, cols>::inversed() const
-    requires(rows == cols && (0 < rows && rows < 5) && std::is_floating_point_v<coordinate>)
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    constexpr Matrix<coordinate, rows, cols, order> Matrix<coordinate, rows, cols, order>::inversed() const
+    requires(rows == cols && 0 < rows && std::is_floating_point_v<coordinate>)
+    {
+        Matrix<coordinate, rows, cols, order> result;
+
+        if constexpr (rows > 4)
+        {
+            _inverseLU(result);
+        }
+        else
+        {
+#ifdef AVX_ENABLED_ON_CPU
+            if constexpr (rows == 4 && (std::is_same_v<coordinate, float> || std::is_same_v<coordinate, double>))
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    ImplementationDetails::inverse_4x4_simd(_coeff.data(), result._coeff.data(), _epsilon);
+                    return result;
+                }
+            }
+#endif
+
+            if (const auto det = determinant(); std::abs(det) > _epsilon)
+            {
+                result._inverseImpl(_coeff, det);
+            }
+        }
+
+        return result;
+    }
+
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    constexpr Vector<coordinate, rows> Matrix<coordinate, rows, cols, order>::solve(const Vector<coordinate, rows>& rhs) const
+    requires(rows == cols && 0 < rows && std::is_floating_point_v<coordinate>)
+    {
+        std::array<coordinate, rows> x = {};
+
+        for (unsigned int i = 0; i < rows; ++i)
+        {
+            x[i] = rhs[i];
+        }
+
+        _solveLU(x.data(), 1);
+
+        Vector<coordinate, rows> result;
+
+        for (unsigned int i = 0; i < rows; ++i)
+        {
+            result[i] = x[i];
+        }
+
+        return result;
+    }
+
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    template <unsigned int rhs_cols>
+    constexpr Matrix<coordinate, rows, rhs_cols, order> Matrix<coordinate, rows, cols, order>::solve(const Matrix<coordinate, rows, rhs_cols, order>& rhs) const
+    requires(rows == cols && 0 < rows && std::is_floating_point_v<coordinate>)
     {
-        Matrix<coordinate, rows, cols> result;
+        std::array<coordinate, rows * rhs_cols> x = {};
+
+        for (unsigned int i = 0; i < rows; ++i)
+        {
+            for (unsigned int j = 0; j < rhs_cols; ++j)
+            {
+                x[(i * rhs_cols) + j] = rhs(i, j);
+            }
+        }
+
+        _solveLU(x.data(), rhs_cols);
 
-        if (const auto det = determinant(); std::abs(det) > _epsilon)
+        Matrix<coordinate, rows, rhs_cols, order> result;
+
+        for (unsigned int i = 0; i < rows; ++i)
         {
-            result._inverseImpl(_coeff, det);
+            for (unsigned int j = 0; j < rhs_cols; ++j)
+            {
+                result(i, j) = x[(i * rhs_cols) + j];
+            }
         }
 
         return result;
     }
 
-    template <Coordinate coordinate, unsigned int rows, unsigned int cols>
-    constexpr bool Matrix<coordinate, rows, cols>::isNull() const noexcept
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    Matrix<coordinate, rows, cols, order>& Matrix<coordinate, rows, cols, order>::decomposeCholesky()
+    requires(rows == cols && 0 < rows && std::is_floating_point_v<coordinate>)
+    {
+        // The decomposition is symmetric, L^T being above the diagonal, so _coeff is decomposed as is for both storage orders
+        if (!ImplementationDetails::cholesky_factorize<coordinate, rows>(_coeff.data()))
+        {
+            throw std::runtime_error("Cannot decompose a matrix which is not positive definite");
+        }
+
+        for (unsigned int i = 0; i < rows; ++i)
+        {
+            for (unsigned int j = i + 1; j < cols; ++j)
+            {
+                (*this)(i, j) = 0;
+            }
+        }
+
+        return *this;
+    }
+
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    Matrix<coordinate, rows, cols, order> Matrix<coordinate, rows, cols, order>::choleskyFactor() const
+    requires(rows == cols && 0 < rows && std::is_floating_point_v<coordinate>)
+    {
+        Matrix<coordinate, rows, cols, order> result = *this;
+        result.decomposeCholesky();
+
+        return result;
+    }
+
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    Vector<coordinate, rows> Matrix<coordinate, rows, cols, order>::solveCholesky(const Vector<coordinate, rows>& rhs) const
+    requires(rows == cols && 0 < rows && std::is_floating_point_v<coordinate>)
+    {
+        std::array<coordinate, rows> x = {};
+
+        for (unsigned int i = 0; i < rows; ++i)
+        {
+            x[i] = rhs[i];
+        }
+
+        _solveCholesky(x.data(), 1);
+
+        Vector<coordinate, rows> result;
+
+        for (unsigned int i = 0; i < rows; ++i)
+        {
+            result[i] = x[i];
+        }
+
+        return result;
+    }
+
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    template <unsigned int rhs_cols>
+    Matrix<coordinate, rows, rhs_cols, order> Matrix<coordinate, rows, cols, order>::solveCholesky(const Matrix<coordinate, rows, rhs_cols, order>& rhs) const
+    requires(rows == cols && 0 < rows && std::is_floating_point_v<coordinate>)
+    {
+        std::array<coordinate, rows * rhs_cols> x = {};
+
+        for (unsigned int i = 0; i < rows; ++i)
+        {
+            for (unsigned int j = 0; j < rhs_cols; ++j)
+            {
+                x[(i * rhs_cols) + j] = rhs(i, j);
+            }
+        }
+
+        _solveCholesky(x.data(), rhs_cols);
+
+        Matrix<coordinate, rows, rhs_cols, order> result;
+
+        for (unsigned int i = 0; i < rows; ++i)
+        {
+            for (unsigned int j = 0; j < rhs_cols; ++j)
+            {
+                result(i, j) = x[(i * rhs_cols) + j];
+            }
+        }
+
+        return result;
+    }
+
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    Matrix<coordinate, rows, cols, order>& Matrix<coordinate, rows, cols, order>::inverseCholesky()
+    requires(rows == cols && 0 < rows && std::is_floating_point_v<coordinate>)
+    {
+        // The inverse is symmetric too, see decomposeCholesky()
+        if (!ImplementationDetails::cholesky_factorize<coordinate, rows>(_coeff.data()))
+        {
+            throw std::runtime_error("Cannot inverse a matrix which is not positive definite");
+        }
+
+        ImplementationDetails::cholesky_inverse<coordinate, rows>(_coeff.data());
+
+        return *this;
+    }
+
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    Matrix<coordinate, rows, cols, order> Matrix<coordinate, rows, cols, order>::inversedCholesky() const
+    requires(rows == cols && 0 < rows && std::is_floating_point_v<coordinate>)
+    {
+        Matrix<coordinate, rows, cols, order> result = *this;
+        result.inverseCholesky();
+
+        return result;
+    }
+
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    Vector<coordinate, cols> Matrix<coordinate, rows, cols, order>::solveLeastSquares(const Vector<coordinate, rows>& rhs) const
+    requires(0 < cols && cols <= rows && std::is_floating_point_v<coordinate>)
+    {
+        std::array<coordinate, rows> x = {};
+
+        for (unsigned int i = 0; i < rows; ++i)
+        {
+            x[i] = rhs[i];
+        }
+
+        _solveLeastSquares(x.data(), 1);
+
+        Vector<coordinate, cols> result;
+
+        for (unsigned int i = 0; i < cols; ++i)
+        {
+            result[i] = x[i];
+        }
+
+        return result;
+    }
+
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    template <unsigned int rhs_cols>
+    Matrix<coordinate, cols, rhs_cols, order> Matrix<coordinate, rows, cols, order>::solveLeastSquares(const Matrix<coordinate, rows, rhs_cols, order>& rhs) const
+    requires(0 < cols && cols <= rows && std::is_floating_point_v<coordinate>)
+    {
+        std::array<coordinate, rows * rhs_cols> x = {};
+
+        for (unsigned int i = 0; i < rows; ++i)
+        {
+            for (unsigned int j = 0; j < rhs_cols; ++j)
+            {
+                x[(i * rhs_cols) + j] = rhs(i, j);
+            }
+        }
+
+        _solveLeastSquares(x.data(), rhs_cols);
+
+        Matrix<coordinate, cols, rhs_cols, order> result;
+
+        for (unsigned int i = 0; i < cols; ++i)
+        {
+            for (unsigned int j = 0; j < rhs_cols; ++j)
+            {
+                result(i, j) = x[(i * rhs_cols) + j];
+            }
+        }
+
+        return result;
+    }
+
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    Matrix<coordinate, rows, cols, order>& Matrix<coordinate, rows, cols, order>::inverseFast()
+    requires(rows == 4 && cols == 4 && std::is_same_v<coordinate, float>)
+    {
+#ifdef AVX_ENABLED_ON_CPU
+        ImplementationDetails::inverse_4x4_simd(_coeff.data(), _coeff.data(), _epsilon, true);
+        return *this;
+#else
+        return inverse();
+#endif
+    }
+
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    Matrix<coordinate, rows, cols, order> Matrix<coordinate, rows, cols, order>::inversedFast() const
+    requires(rows == 4 && cols == 4 && std::is_same_v<coordinate, float>)
+    {
+#ifdef AVX_ENABLED_ON_CPU
+        Matrix<coordinate, rows, cols, order> result;
+        ImplementationDetails::inverse_4x4_simd(_coeff.data(), result._coeff.data(), _epsilon, true);
+        return result;
+#else
+        return inversed();
+#endif
+    }
+
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    constexpr bool Matrix<coordinate, rows, cols, order>::isNull() const noexcept
     {
         for (const auto& coeff : _coeff)
         {
@@ -457,14 +933,21 @@ namespace LCNS::Algebra
         return true;
     }
 
-    template <Coordinate coordinate, unsigned int rows, unsigned int cols>
-    constexpr unsigned int Matrix<coordinate, rows, cols>::_(unsigned int i, unsigned int j) const
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    constexpr unsigned int Matrix<coordinate, rows, cols, order>::_(unsigned int i, unsigned int j) const
     {
-        return (i * _cols) + j;
+        if constexpr (order == StorageOrder::RowMajor)
+        {
+            return (i * cols) + j;
+        }
+        else
+        {
+            return (j * rows) + i;
+        }
     }
 
-    template <Coordinate coordinate, unsigned int rows, unsigned int cols>
-    constexpr void Matrix<coordinate, rows, cols>::_inverseImpl(std::array<coordinate, rows * cols> copy, coordinate det)
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    constexpr void Matrix<coordinate, rows, cols, order>::_inverseImpl(std::array<coordinate, rows * cols> copy, coordinate det)
     requires(rows == cols && (0 < rows && rows < 5) && std::is_floating_point_v<coordinate>)
     {
         if constexpr (rows == 1)
@@ -523,10 +1006,109 @@ namespace LCNS::Algebra
         }
     }
 
-    template <Coordinate coordinate, unsigned int rows, unsigned int cols>
-    constexpr Matrix<coordinate, rows, cols> operator*(const Matrix<coordinate, rows, cols>& lhs, const coordinate rhs)
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    constexpr bool Matrix<coordinate, rows, cols, order>::_inverseLU(Matrix<coordinate, rows, cols, order>& result) const
+    requires(rows == cols && 4 < rows && std::is_floating_point_v<coordinate>)
+    {
+        auto factors = ImplementationDetails::lu_load<coordinate, rows>(_coeff.data(), false);
+        ImplementationDetails::lu_factorize(factors, ImplementationDetails::lu_relative_tolerance(_coeff.data(), rows, rows));
+
+        if (factors.sign == 0)
+        {
+            return false;
+        }
+
+        // Solve against the identity, in place
+        ImplementationDetails::lu_storage<coordinate, rows> inverse = {};
+
+        if constexpr (rows > ImplementationDetails::lu_unrolled_size)
+        {
+            inverse.resize(size_t{rows} * rows);
+        }
+
+        for (unsigned int i = 0; i < rows; ++i)
+        {
+            inverse[(i * rows) + i] = 1;
+        }
+
+        ImplementationDetails::lu_solve(factors, inverse.data(), rows);
+
+        std::copy(inverse.begin(), inverse.end(), result._coeff.begin());
+
+        return true;
+    }
+
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    constexpr void Matrix<coordinate, rows, cols, order>::_solveLU(coordinate* x, unsigned int rhs_cols) const
+    requires(rows == cols && std::is_floating_point_v<coordinate>)
     {
-        Matrix<coordinate, rows, cols> result;
+        auto factors = ImplementationDetails::lu_load<coordinate, rows>(_coeff.data(), order == StorageOrder::ColumnMajor);
+        ImplementationDetails::lu_factorize(factors, ImplementationDetails::lu_relative_tolerance(_coeff.data(), rows, rows));
+
+        if (factors.sign == 0)
+        {
+            throw std::runtime_error("Cannot solve a system with a singular matrix");
+        }
+
+        ImplementationDetails::lu_solve(factors, x, rhs_cols);
+    }
+
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    void Matrix<coordinate, rows, cols, order>::_solveCholesky(coordinate* x, unsigned int rhs_cols) const
+    requires(rows == cols && std::is_floating_point_v<coordinate>)
+    {
+        ImplementationDetails::lu_storage<coordinate, rows> factor = {};
+
+        if constexpr (rows > ImplementationDetails::lu_unrolled_size)
+        {
+            factor.resize(size_t{rows} * rows);
+        }
+
+        std::copy(_coeff.begin(), _coeff.end(), factor.begin());
+
+        if (!ImplementationDetails::cholesky_factorize<coordinate, rows>(factor.data()))
+        {
+            throw std::runtime_error("Cannot solve a system with a matrix which is not positive definite");
+        }
+
+        ImplementationDetails::cholesky_solve<coordinate, rows>(factor.data(), x, rhs_cols);
+    }
+
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    void Matrix<coordinate, rows, cols, order>::_solveLeastSquares(coordinate* x, unsigned int rhs_cols) const
+    requires(0 < cols && cols <= rows && std::is_floating_point_v<coordinate>)
+    {
+        // Decomposed row by row whatever the storage order, on the stack for the smallest sizes
+        constexpr bool on_stack = rows * cols <= ImplementationDetails::lu_unrolled_size * ImplementationDetails::lu_unrolled_size;
+
+        std::conditional_t<on_stack, std::array<coordinate, rows * cols>, std::vector<coordinate>> qr = {};
+        std::array<coordinate, cols>                                                               tau = {};
+
+        if constexpr (!on_stack)
+        {
+            qr.resize(size_t{rows} * cols);
+        }
+
+        for (unsigned int i = 0; i < rows; ++i)
+        {
+            for (unsigned int j = 0; j < cols; ++j)
+            {
+                qr[(i * cols) + j] = (*this)(i, j);
+            }
+        }
+
+        ImplementationDetails::qr_blocked(qr.data(), cols, rows, cols, tau.data());
+
+        if (!ImplementationDetails::qr_solve(qr.data(), cols, rows, cols, tau.data(), x, rhs_cols, rhs_cols, true, rows))
+        {
+            throw std::runtime_error("Cannot solve a least squares problem whose matrix does not have full column rank");
+        }
+    }
+
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    constexpr Matrix<coordinate, rows, cols, order> operator*(const Matrix<coordinate, rows, cols, order>& lhs, const coordinate rhs)
+    {
+        Matrix<coordinate, rows, cols, order> result;
 
         for (size_t i = 0; i < rows; ++i)
         {
@@ -539,10 +1121,10 @@ namespace LCNS::Algebra
         return result;
     }
 
-    template <Coordinate coordinate, unsigned int rows, unsigned int cols>
-    constexpr Matrix<coordinate, rows, cols> operator*(const coordinate lhs, const Matrix<coordinate, rows, cols>& rhs)
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    constexpr Matrix<coordinate, rows, cols, order> operator*(const coordinate lhs, const Matrix<coordinate, rows, cols, order>& rhs)
     {
-        Matrix<coordinate, rows, cols> result;
+        Matrix<coordinate, rows, cols, order> result;
 
         for (size_t i = 0; i < rows; ++i)
         {
@@ -555,16 +1137,16 @@ namespace LCNS::Algebra
         return result;
     }
 
-    template <Coordinate coordinate, unsigned int rows_lhs, unsigned int cols_lhs, unsigned int rows_rhs, unsigned int cols_rhs>
-    constexpr Matrix<coordinate, rows_lhs, cols_rhs> operator*(const Matrix<coordinate, rows_lhs, cols_lhs>& lhs,
-                                                               const Matrix<coordinate, rows_rhs, cols_rhs>& rhs)
+    template <Coordinate coordinate, unsigned int rows_lhs, unsigned int cols_lhs, unsigned int rows_rhs, unsigned int cols_rhs, StorageOrder order>
+    constexpr Matrix<coordinate, rows_lhs, cols_rhs, order> operator*(const Matrix<coordinate, rows_lhs, cols_lhs, order>& lhs,
+                                                                      const Matrix<coordinate, rows_rhs, cols_rhs, order>& rhs)
     {
         if (cols_lhs != rows_rhs)
         {
             throw std::runtime_error("Multiplication requires the number of column of this matrix to match the number of rows of rhs");
         }
 
-        Matrix<coordinate, rows_lhs, cols_rhs> result;
+        Matrix<coordinate, rows_lhs, cols_rhs, order> result;
 
         for (size_t i = 0; i < rows_lhs; ++i)
         {
@@ -580,12 +1162,31 @@ namespace LCNS::Algebra
         return result;
     }
 
-    template <Coordinate coordinate, unsigned int rows_lhs, unsigned int cols_lhs, unsigned int size_rhs>
-    constexpr Vector<coordinate, rows_lhs> operator*(const Matrix<coordinate, rows_lhs, cols_lhs>& lhs, const Vector<coordinate, size_rhs>& rhs)
+    template <Coordinate coordinate, unsigned int rows_lhs, unsigned int cols_lhs, unsigned int size_rhs, StorageOrder order>
+    constexpr Vector<coordinate, rows_lhs> operator*(const Matrix<coordinate, rows_lhs, cols_lhs, order>& lhs, const Vector<coordinate, size_rhs>& rhs)
     requires(cols_lhs == size_rhs)
     {
         Vector<coordinate, rows_lhs> result;
 
+        if (!std::is_constant_evaluated() && size_t{rows_lhs} * cols_lhs >= ImplementationDetails::matrix_vector_kernel_size)
+        {
+            // Stored by columns, the coefficients are those of the transpose stored by rows
+            const bool                        transpose = order == StorageOrder::ColumnMajor;
+            const std::span<const coordinate> coefficients(lhs.data(), size_t{rows_lhs} * cols_lhs);
+
+            gemv<coordinate>(transpose,
+                             transpose ? cols_lhs : rows_lhs,
+                             transpose ? rows_lhs : cols_lhs,
+                             1,
+                             coefficients,
+                             transpose ? rows_lhs : cols_lhs,
+                             std::span<const coordinate>(rhs.data(), cols_lhs),
+                             0,
+                             std::span<coordinate>(result.data(), rows_lhs));
+
+            return result;
+        }
+
         for (size_t i = 0; i < rows_lhs; ++i)
         {
             for (size_t j = 0; j < cols_lhs; ++j)
@@ -597,15 +1198,15 @@ namespace LCNS::Algebra
         return result;
     }
 
-    template <Coordinate coordinate, unsigned int rows, unsigned int cols>
-    constexpr Matrix<coordinate, rows, cols> operator/(const Matrix<coordinate, rows, cols>& lhs, const coordinate rhs)
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    constexpr Matrix<coordinate, rows, cols, order> operator/(const Matrix<coordinate, rows, cols, order>& lhs, const coordinate rhs)
     {
         if (rhs == static_cast<coordinate>(0))
         {
             throw std::runtime_error("Divide by zero");
         }
 
-        Matrix<coordinate, rows, cols> result;
+        Matrix<coordinate, rows, cols, order> result;
 
         for (size_t i = 0; i < rows; ++i)
         {
@@ -618,8 +1219,8 @@ namespace LCNS::Algebra
         return result;
     }
 
-    template <Coordinate coordinate, unsigned int rows, unsigned int cols>
-    std::ostream& operator<<(std::ostream& output_stream, const Matrix<coordinate, rows, cols>& mat)
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    std::ostream& operator<<(std::ostream& output_stream, const Matrix<coordinate, rows, cols, order>& mat)
     {
         for (size_t i = 0; i < rows; ++i)
         {
@@ -633,4 +1234,27 @@ namespace LCNS::Algebra
 
         return output_stream;
     }
+
+    namespace ImplementationDetails
+    {
+        /*!
+         * @brief True if a matrix is nothing but its coefficients, i.e. arrays of matrices can be copied with memcpy or
+         *        handed to an API expecting tightly packed coefficients
+         */
+        template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order = StorageOrder::RowMajor>
+        constexpr bool is_packed_matrix = sizeof(Matrix<coordinate, rows, cols, order>) == rows * cols * sizeof(coordinate)
+                                       && std::is_standard_layout_v<Matrix<coordinate, rows, cols, order>>
+                                       && std::is_trivially_copyable_v<Matrix<coordinate, rows, cols, order>>;
+    }  // namespace ImplementationDetails
+
+    static_assert(ImplementationDetails::is_packed_matrix<float, 2, 2>);
+    static_assert(ImplementationDetails::is_packed_matrix<float, 3, 3>);
+    static_assert(ImplementationDetails::is_packed_matrix<float, 4, 4>);
+    static_assert(ImplementationDetails::is_packed_matrix<double, 2, 2>);
+    static_assert(ImplementationDetails::is_packed_matrix<double, 3, 3>);
+    static_assert(ImplementationDetails::is_packed_matrix<double, 4, 4>);
+    static_assert(ImplementationDetails::is_packed_matrix<int, 4, 4>);
+    static_assert(ImplementationDetails::is_packed_matrix<float, 3, 4>);
+    static_assert(ImplementationDetails::is_packed_matrix<float, 4, 4, StorageOrder::ColumnMajor>);
+    static_assert(ImplementationDetails::is_packed_matrix<double, 4, 4, StorageOrder::ColumnMajor>);
 }  // namespace LCNS::Algebra
@@ -0,0 +1,297 @@
+#pragma once
+
+#ifdef AVX_ENABLED_ON_CPU
+#include <immintrin.h>
+#endif
+
+#include <cmath>
+
+namespace LCNS::Algebra
+{
+    namespace ImplementationDetails
+    {
+#ifdef AVX_ENABLED_ON_CPU
+        /*!
+         * @brief Immediate value for the shuffle/permute intrinsics, the lane order is (x, y, z, w)
+         */
+        consteval int shuffle_mask(int x, int y, int z, int w)
+        {
+            return x | (y << 2) | (z << 4) | (w << 6);
+        }
+
+        // The 4x4 inverse below uses the block matrix method: the matrix is split into 4 2x2 sub-matrices
+        //     M = | A B |
+        //         | C D |
+        // each one stored row by row in a single register. With A# the adjugate of A and |A| its determinant:
+        //     |M| = |A||D| + |B||C| - tr((A#B)(D#C))
+        //     M^-1 = 1/|M| * | X Y |   with   X# = |D|A - B(D#C),  Y# = |B|C - D(A#B)#
+        //                    | Z W |          Z# = |C|B - A(D#C)#, W# = |A|D - C(A#B)
+        // so the determinant and the inverse are obtained in one pass, using only 2x2 products.
+
+        template <int x, int y, int z, int w>
+        inline __m128 swizzle(__m128 vec)
+        {
+            return _mm_castsi128_ps(_mm_shuffle_epi32(_mm_castps_si128(vec), shuffle_mask(x, y, z, w)));
+        }
+
+        template <int x, int y, int z, int w>
+        inline __m256d swizzle(__m256d vec)
+        {
+            return _mm256_permute4x64_pd(vec, shuffle_mask(x, y, z, w));
+        }
+
+        // clang-format off
+        inline __m128  simd_add(__m128 lhs, __m128 rhs)   { return _mm_add_ps(lhs, rhs); }
+        inline __m128  simd_sub(__m128 lhs, __m128 rhs)   { return _mm_sub_ps(lhs, rhs); }
+        inline __m128  simd_mul(__m128 lhs, __m128 rhs)   { return _mm_mul_ps(lhs, rhs); }
+        inline __m256d simd_add(__m256d lhs, __m256d rhs) { return _mm256_add_pd(lhs, rhs); }
+        inline __m256d simd_sub(__m256d lhs, __m256d rhs) { return _mm256_sub_pd(lhs, rhs); }
+        inline __m256d simd_mul(__m256d lhs, __m256d rhs) { return _mm256_mul_pd(lhs, rhs); }
+        // clang-format on
+
+        /*!
+         * @brief 2x2 matrix product lhs * rhs
+         */
+        template <typename simd_type>
+        inline simd_type mat2_mul(simd_type lhs, simd_type rhs)
+        {
+            return simd_add(simd_mul(lhs, swizzle<0, 3, 0, 3>(rhs)), simd_mul(swizzle<1, 0, 3, 2>(lhs), swizzle<2, 1, 2, 1>(rhs)));
+        }
+
+        /*!
+         * @brief 2x2 matrix product lhs# * rhs
+         */
+        template <typename simd_type>
+        inline simd_type mat2_adj_mul(simd_type lhs, simd_type rhs)
+        {
+            return simd_sub(simd_mul(swizzle<3, 3, 0, 0>(lhs), rhs), simd_mul(swizzle<1, 1, 2, 2>(lhs), swizzle<2, 3, 0, 1>(rhs)));
+        }
+
+        /*!
+         * @brief 2x2 matrix product lhs * rhs#
+         */
+        template <typename simd_type>
+        inline simd_type mat2_mul_adj(simd_type lhs, simd_type rhs)
+        {
+            return simd_sub(simd_mul(lhs, swizzle<3, 0, 3, 0>(rhs)), simd_mul(swizzle<1, 0, 3, 2>(lhs), swizzle<2, 1, 2, 1>(rhs)));
+        }
+
+        /*!
+         * @brief Determinant |A||D| + |B||C| - tr((A#B)(D#C)) of a 4x4 matrix given as 2x2 blocks
+         * @param det_sub holds (|A|, |B|, |C|, |D|)
+         * @return the determinant, broadcast in all the lanes of the register
+         */
+        template <typename simd_type>
+        inline simd_type determinant_4x4(simd_type det_sub, simd_type A_B, simd_type D_C)
+        {
+            // NOLINTBEGIN(readability-identifier-length)
+            simd_type trace = simd_mul(A_B, swizzle<0, 2, 1, 3>(D_C));
+            trace           = simd_add(trace, swizzle<1, 0, 3, 2>(trace));
+            trace           = simd_add(trace, swizzle<2, 3, 0, 1>(trace));
+
+            const simd_type products = simd_mul(det_sub, swizzle<3, 2, 1, 0>(det_sub));
+
+            return simd_sub(simd_add(swizzle<0, 0, 0, 0>(products), swizzle<1, 1, 1, 1>(products)), trace);
+            // NOLINTEND(readability-identifier-length)
+        }
+
+        /*!
+         * @brief Compute the adjugate blocks X#, Y#, Z#, W# and the determinant of a 4x4 matrix given as 2x2 blocks
+         * @return the determinant, broadcast in all the lanes of the register
+         */
+        template <typename simd_type>
+        inline simd_type adjugate_4x4(simd_type  A,
+                                      simd_type  B,
+                                      simd_type  C,
+                                      simd_type  D,
+                                      simd_type  det_sub,
+                                      simd_type& X,
+                                      simd_type& Y,
+                                      simd_type& Z,
+                                      simd_type& W)
+        {
+            // NOLINTBEGIN(readability-identifier-length)
+            const simd_type det_A = swizzle<0, 0, 0, 0>(det_sub);
+            const simd_type det_B = swizzle<1, 1, 1, 1>(det_sub);
+            const simd_type det_C = swizzle<2, 2, 2, 2>(det_sub);
+            const simd_type det_D = swizzle<3, 3, 3, 3>(det_sub);
+
+            const simd_type D_C = mat2_adj_mul(D, C);
+            const simd_type A_B = mat2_adj_mul(A, B);
+
+            X = simd_sub(simd_mul(det_D, A), mat2_mul(B, D_C));
+            W = simd_sub(simd_mul(det_A, D), mat2_mul(C, A_B));
+            Y = simd_sub(simd_mul(det_B, C), mat2_mul_adj(D, A_B));
+            Z = simd_sub(simd_mul(det_C, B), mat2_mul_adj(A, D_C));
+
+            return determinant_4x4(det_sub, A_B, D_C);
+            // NOLINTEND(readability-identifier-length)
+        }
+
+        /*!
+         * @brief Split the rows of a 4x4 matrix of doubles into its 2x2 blocks A, B, C, D, each one stored row by row
+         * @return (|A|, |B|, |C|, |D|)
+         */
+        inline __m256d blocks_4x4(__m256d row_0, __m256d row_1, __m256d row_2, __m256d row_3, __m256d& A, __m256d& B, __m256d& C, __m256d& D)
+        {
+            // NOLINTBEGIN(readability-identifier-length)
+            A = _mm256_permute2f128_pd(row_0, row_1, 0x20);
+            B = _mm256_permute2f128_pd(row_0, row_1, 0x31);
+            C = _mm256_permute2f128_pd(row_2, row_3, 0x20);
+            D = _mm256_permute2f128_pd(row_2, row_3, 0x31);
+
+            // Gather the coefficients of the 2x2 blocks to get (|A|, |B|, |C|, |D|) with a single product
+            const __m256d AB_even = _mm256_unpacklo_pd(A, B);
+            const __m256d AB_odd  = _mm256_unpackhi_pd(A, B);
+            const __m256d CD_even = _mm256_unpacklo_pd(C, D);
+            const __m256d CD_odd  = _mm256_unpackhi_pd(C, D);
+
+            return _mm256_sub_pd(
+            _mm256_mul_pd(_mm256_permute2f128_pd(AB_even, CD_even, 0x20), _mm256_permute2f128_pd(AB_odd, CD_odd, 0x31)),
+            _mm256_mul_pd(_mm256_permute2f128_pd(AB_odd, CD_odd, 0x20), _mm256_permute2f128_pd(AB_even, CD_even, 0x31)));
+            // NOLINTEND(readability-identifier-length)
+        }
+
+        /*!
+         * @brief Determinant of the 4x4 matrix of doubles whose rows are given, by the block method of inverse_4x4_simd
+         */
+        inline double determinant_4x4_simd(__m256d row_0, __m256d row_1, __m256d row_2, __m256d row_3)
+        {
+            // NOLINTBEGIN(readability-identifier-length)
+            __m256d       A, B, C, D;
+            const __m256d det_sub = blocks_4x4(row_0, row_1, row_2, row_3, A, B, C, D);
+
+            return _mm256_cvtsd_f64(determinant_4x4(det_sub, mat2_adj_mul(A, B), mat2_adj_mul(D, C)));
+            // NOLINTEND(readability-identifier-length)
+        }
+
+        /*!
+         * @brief Determinant of a 4x4 matrix of doubles stored row by row, or column by column
+         */
+        inline double determinant_4x4_simd(const double* src)
+        {
+            return determinant_4x4_simd(_mm256_loadu_pd(src), _mm256_loadu_pd(src + 4), _mm256_loadu_pd(src + 8), _mm256_loadu_pd(src + 12));
+        }
+
+        /*!
+         * @brief Determinant of a 4x4 matrix of floats stored row by row, or column by column. Like the closed form of
+         *        Matrix::determinant, it is computed in double precision.
+         */
+        inline float determinant_4x4_simd(const float* src)
+        {
+            return static_cast<float>(determinant_4x4_simd(_mm256_cvtps_pd(_mm_loadu_ps(src)),
+                                                           _mm256_cvtps_pd(_mm_loadu_ps(src + 4)),
+                                                           _mm256_cvtps_pd(_mm_loadu_ps(src + 8)),
+                                                           _mm256_cvtps_pd(_mm_loadu_ps(src + 12))));
+        }
+
+        /*!
+         * @brief Invert a 4x4 matrix of floats stored row by row. src and dst can point to the same coefficients.
+         * @param src points to the 16 coefficients of the matrix to invert
+         * @param dst points to the 16 coefficients where to write the inverse, only written if the matrix is invertible
+         * @param epsilon is the threshold under which the determinant is considered null
+         * @param fast_reciprocal uses rcpps with one Newton-Raphson step (~22 bits of precision) instead of a division
+         * @return the determinant of the matrix
+         */
+        inline float inverse_4x4_simd(const float* src, float* dst, double epsilon, bool fast_reciprocal = false)
+        {
+            // NOLINTBEGIN(readability-identifier-length)
+            const __m128 row_0 = _mm_loadu_ps(src);
+            const __m128 row_1 = _mm_loadu_ps(src + 4);
+            const __m128 row_2 = _mm_loadu_ps(src + 8);
+            const __m128 row_3 = _mm_loadu_ps(src + 12);
+
+            const __m128 A = _mm_movelh_ps(row_0, row_1);
+            const __m128 B = _mm_movehl_ps(row_1, row_0);
+            const __m128 C = _mm_movelh_ps(row_2, row_3);
+            const __m128 D = _mm_movehl_ps(row_3, row_2);
+
+            // (|A|, |B|, |C|, |D|)
+            const __m128 det_sub = _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(row_0, row_2, shuffle_mask(0, 2, 0, 2)),
+                                                         _mm_shuffle_ps(row_1, row_3, shuffle_mask(1, 3, 1, 3))),
+                                              _mm_mul_ps(_mm_shuffle_ps(row_0, row_2, shuffle_mask(1, 3, 1, 3)),
+                                                         _mm_shuffle_ps(row_1, row_3, shuffle_mask(0, 2, 0, 2))));
+
+            __m128       X, Y, Z, W;
+            const __m128 det = adjugate_4x4(A, B, C, D, det_sub, X, Y, Z, W);
+
+            const float det_value = _mm_cvtss_f32(det);
+            if (std::abs(det_value) <= epsilon)
+            {
+                return det_value;
+            }
+
+            __m128 reciprocal;
+            if (fast_reciprocal)
+            {
+                const __m128 estimate = _mm_rcp_ps(det);
+                reciprocal            = _mm_mul_ps(estimate, _mm_sub_ps(_mm_set1_ps(2.0f), _mm_mul_ps(det, estimate)));
+            }
+            else
+            {
+                reciprocal = _mm_div_ps(_mm_set1_ps(1.0f), det);
+            }
+
+            // The adjugate of each 2x2 block is (d, -b, -c, a), the signs are merged with the reciprocal
+            reciprocal = _mm_mul_ps(reciprocal, _mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f));
+
+            X = _mm_mul_ps(X, reciprocal);
+            Y = _mm_mul_ps(Y, reciprocal);
+            Z = _mm_mul_ps(Z, reciprocal);
+            W = _mm_mul_ps(W, reciprocal);
+
+            // Apply the 2x2 adjugate shuffle while rebuilding the rows
+            _mm_storeu_ps(dst, _mm_shuffle_ps(X, Y, shuffle_mask(3, 1, 3, 1)));
+            _mm_storeu_ps(dst + 4, _mm_shuffle_ps(X, Y, shuffle_mask(2, 0, 2, 0)));
+            _mm_storeu_ps(dst + 8, _mm_shuffle_ps(Z, W, shuffle_mask(3, 1, 3, 1)));
+            _mm_storeu_ps(dst + 12, _mm_shuffle_ps(Z, W, shuffle_mask(2, 0, 2, 0)));
+
+            return det_value;
+            // NOLINTEND(readability-identifier-length)
+        }
+
+        /*!
+         * @brief Invert a 4x4 matrix of doubles stored row by row. src and dst can point to the same coefficients.
+         * @param src points to the 16 coefficients of the matrix to invert
+         * @param dst points to the 16 coefficients where to write the inverse, only written if the matrix is invertible
+         * @param epsilon is the threshold under which the determinant is considered null
+         * @return the determinant of the matrix
+         */
+        inline double inverse_4x4_simd(const double* src, double* dst, double epsilon)
+        {
+            // NOLINTBEGIN(readability-identifier-length)
+            const __m256d row_0 = _mm256_loadu_pd(src);
+            const __m256d row_1 = _mm256_loadu_pd(src + 4);
+            const __m256d row_2 = _mm256_loadu_pd(src + 8);
+            const __m256d row_3 = _mm256_loadu_pd(src + 12);
+
+            __m256d       A, B, C, D;
+            const __m256d det_sub = blocks_4x4(row_0, row_1, row_2, row_3, A, B, C, D);
+
+            __m256d       X, Y, Z, W;
+            const __m256d det = adjugate_4x4(A, B, C, D, det_sub, X, Y, Z, W);
+
+            const double det_value = _mm256_cvtsd_f64(det);
+            if (std::abs(det_value) <= epsilon)
+            {
+                return det_value;
+            }
+
+            const __m256d reciprocal = _mm256_div_pd(_mm256_setr_pd(1.0, -1.0, -1.0, 1.0), det);
+
+            X = swizzle<3, 1, 2, 0>(_mm256_mul_pd(X, reciprocal));
+            Y = swizzle<3, 1, 2, 0>(_mm256_mul_pd(Y, reciprocal));
+            Z = swizzle<3, 1, 2, 0>(_mm256_mul_pd(Z, reciprocal));
+            W = swizzle<3, 1, 2, 0>(_mm256_mul_pd(W, reciprocal));
+
+            _mm256_storeu_pd(dst, _mm256_permute2f128_pd(X, Y, 0x20));
+            _mm256_storeu_pd(dst + 4, _mm256_permute2f128_pd(X, Y, 0x31));
+            _mm256_storeu_pd(dst + 8, _mm256_permute2f128_pd(Z, W, 0x20));
+            _mm256_storeu_pd(dst + 12, _mm256_permute2f128_pd(Z, W, 0x31));
+
+            return det_value;
+            // NOLINTEND(readability-identifier-length)
+        }
+#endif
+    }  // namespace ImplementationDetails
+}  // namespace LCNS::Algebra
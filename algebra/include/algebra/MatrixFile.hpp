@@ -0,0 +1,630 @@
+#pragma once
+
+#include "algebra/Internal.hpp"
+#include "algebra/MatrixView.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define LCNS_ALGEBRA_MMAP_AVAILABLE
+#endif
+
+/*
+ * Binary matrix files, loaded without parsing nor copying: the coefficients are stored as they are in memory, after a
+ * header holding their type, the dimensions and strides of the matrix, the alignment of the coefficients in the file,
+ * and a checksum of the coefficients. MappedMatrix maps the file in memory (mmap) and exposes its coefficients as a
+ * MatrixView: loading only reads the header, the pages of the coefficients being read by the system on first access,
+ * or not read at all when they are already in the page cache. Where mmap is not available, the coefficients are read
+ * in memory instead.
+ *
+ * MatrixFileWriter writes the coefficients as they come, so that matrices larger than the memory can be written, then
+ * completes the header on close(): the files which were not closed, and the files written on a machine of another
+ * byte order, are rejected by the loader. The checksum is computed while writing, and only verified on load when asked
+ * for, since it reads all the coefficients.
+ *
+ * Layout, in the byte order of the machine which wrote the file:
+ *
+ *     0   magic "LCNSMAT" and a null character, written on close()
+ *     8   version, 32 bits
+ *    12   byte order mark 0x01020304, 32 bits
+ *    16   type of the coefficients, 32 bits, see matrix_file_type
+ *    20   alignment of the coefficients in bytes, 32 bits, a power of 2
+ *    24   rows, cols, row stride and column stride, in coefficients, 64 bits each
+ *    56   offset of the coefficients from the start of the file in bytes, 64 bits, a multiple of the alignment
+ *    64   checksum of the coefficients, 64 bits, see MatrixFileChecksum
+ */
+
+namespace LCNS::Algebra
+{
+    /*!
+     * \brief Checksum of the coefficients of matrix files: 4 interleaved lanes of 64 bit multiplicative hashes of 8 byte
+     *        words, so that the multiplications of the lanes overlap. The bytes may be given in any number of chunks.
+     */
+    class MatrixFileChecksum
+    {
+    public:
+        /*!
+         * \brief Add bytes to the checksum
+         */
+        void update(std::span<const std::byte> bytes);
+
+        /*!
+         * \brief Checksum of all the bytes added so far
+         */
+        [[nodiscard]] uint64_t value() const;
+
+    private:
+        static constexpr size_t   _lane_count = 4;
+        static constexpr uint64_t _prime      = 0x100000001B3ULL;
+
+        void _consume(const std::byte* block);
+
+        std::array<uint64_t, _lane_count>      _lanes        = { 0xCBF29CE484222325ULL, 0x84222325CBF29CE4ULL, 0x9E3779B97F4A7C15ULL,
+                                                               0x7F4A7C159E3779B9ULL };
+        std::array<std::byte, 8 * _lane_count> _pending      = {};
+        size_t                                 _pending_size = 0;
+        uint64_t                               _size         = 0;
+    };
+
+    /*!
+     * \brief Write a matrix file coefficient by coefficient, in the storage order of the file
+     */
+    template <Coordinate coordinate>
+    class MatrixFileWriter
+    {
+    public:
+        /*!
+         * \brief Create the file and write a header, completed by close()
+         * @param path is the path of the file, replaced if it exists
+         * @param rows is the number of rows of the matrix
+         * @param cols is the number of columns of the matrix
+         * @param order is the order in which the coefficients will be written: row by row or column by column
+         * @param alignment is the alignment of the first coefficient in the file, in bytes, a power of 2
+         * @throw std::invalid_argument if alignment is not a power of 2 multiple of the size of the coefficients
+         * @throw std::runtime_error if the file cannot be created
+         */
+        MatrixFileWriter(const std::filesystem::path& path, size_t rows, size_t cols, StorageOrder order = StorageOrder::RowMajor,
+                         size_t alignment = 64);
+
+        MatrixFileWriter(const MatrixFileWriter&)            = delete;
+        MatrixFileWriter& operator=(const MatrixFileWriter&) = delete;
+
+        /*!
+         * \brief Append coefficients to the file
+         * @throw std::invalid_argument if there are more coefficients than the matrix holds
+         * @throw std::runtime_error if the coefficients cannot be written
+         */
+        void write(std::span<const coordinate> coefficients);
+
+        /*!
+         * \brief Complete the header. The file is not valid before.
+         * @throw std::runtime_error if fewer coefficients than the matrix holds were written, or if the header cannot be
+         *        written
+         */
+        void close();
+
+    private:
+        std::ofstream      _file;
+        size_t             _rows;
+        size_t             _cols;
+        StorageOrder       _order;
+        size_t             _alignment;
+        size_t             _written = 0;
+        MatrixFileChecksum _checksum;
+    };
+
+    /*!
+     * \brief Write the coefficients of a matrix held by a view in a file, row by row, see MatrixFileWriter
+     */
+    template <Coordinate coordinate>
+    void write_matrix_file(const std::filesystem::path& path, std::type_identity_t<MatrixView<const coordinate>> matrix, size_t alignment = 64);
+
+    /*!
+     * \brief Matrix file mapped in memory, read only. The views on its coefficients are valid as long as it is alive.
+     */
+    template <Coordinate coordinate>
+    class MappedMatrix
+    {
+    public:
+        /*!
+         * \brief Map a matrix file in memory
+         * @param path is the path of a file written by MatrixFileWriter
+         * @param verify_checksum is true to read all the coefficients to check them against the checksum of the header
+         * @throw std::runtime_error if the file cannot be read, is not a complete matrix file of coordinate, or if the
+         *        checksum is verified and does not match
+         */
+        explicit MappedMatrix(const std::filesystem::path& path, bool verify_checksum = false);
+
+        MappedMatrix(MappedMatrix&& other) noexcept;
+        MappedMatrix& operator=(MappedMatrix&& other) noexcept;
+
+        MappedMatrix(const MappedMatrix&)            = delete;
+        MappedMatrix& operator=(const MappedMatrix&) = delete;
+
+        ~MappedMatrix();
+
+        /*!
+         * \brief View on the coefficients of the file
+         */
+        [[nodiscard]] MatrixView<const coordinate> view() const;
+
+        /*!
+         * \brief Check the coefficients against the checksum of the header, reading all of them
+         */
+        [[nodiscard]] bool verifyChecksum() const;
+
+    private:
+        void _release() noexcept;
+
+        const std::byte*             _mapping      = nullptr;
+        size_t                       _mapping_size = 0;
+        std::vector<std::byte>       _copy;  // Coefficients read from the file where mmap is not available
+        MatrixView<const coordinate> _view;
+        uint64_t                     _checksum = 0;
+    };
+
+    namespace ImplementationDetails
+    {
+        // NOLINTBEGIN(readability-identifier-length)
+
+        /*!
+         * @brief Header of the matrix files, see MatrixFile.hpp
+         */
+        struct MatrixFileHeader
+        {
+            std::array<char, 8> magic;
+            uint32_t            version;
+            uint32_t            byte_order;
+            uint32_t            type;
+            uint32_t            alignment;
+            uint64_t            rows;
+            uint64_t            cols;
+            uint64_t            row_stride;
+            uint64_t            col_stride;
+            uint64_t            data_offset;
+            uint64_t            checksum;
+        };
+
+        static_assert(sizeof(MatrixFileHeader) == 72 && std::is_trivially_copyable_v<MatrixFileHeader>);
+
+        constexpr std::array<char, 8> matrix_file_magic      = { 'L', 'C', 'N', 'S', 'M', 'A', 'T', '\0' };
+        constexpr uint32_t            matrix_file_version    = 1;
+        constexpr uint32_t            matrix_file_byte_order = 0x01020304;
+
+        /*!
+         * @brief Code of a coordinate type in the matrix files: 'f', 'i' or 'u' for floating point, signed and unsigned
+         *        types, times 256, plus the size of the type in bytes
+         */
+        template <Coordinate coordinate>
+        constexpr uint32_t matrix_file_type()
+        {
+            const uint32_t kind = std::is_floating_point_v<coordinate> ? 'f' : (std::is_signed_v<coordinate> ? 'i' : 'u');
+
+            return kind * 256 + static_cast<uint32_t>(sizeof(coordinate));
+        }
+
+        /*!
+         * @brief Offset of the coefficients in a file, after the header
+         */
+        constexpr size_t matrix_file_data_offset(size_t alignment)
+        {
+            return (sizeof(MatrixFileHeader) + alignment - 1) / alignment * alignment;
+        }
+
+        /*!
+         * @brief Check the header of a file holding file_size bytes, and return the number of coefficients between the
+         *        first and one past the last coefficient of the matrix
+         */
+        template <Coordinate coordinate>
+        size_t check_matrix_file_header(const MatrixFileHeader& header, size_t file_size)
+        {
+            if (header.magic != matrix_file_magic)
+            {
+                throw std::runtime_error("Not a complete matrix file");
+            }
+
+            if (header.byte_order != matrix_file_byte_order)
+            {
+                throw std::runtime_error("The matrix file was written on a machine of another byte order");
+            }
+
+            if (header.version != matrix_file_version)
+            {
+                throw std::runtime_error("Unsupported version of the matrix file");
+            }
+
+            if (header.type != matrix_file_type<coordinate>())
+            {
+                throw std::runtime_error("The coefficients of the matrix file are not of the requested type");
+            }
+
+            if (!std::has_single_bit(header.alignment) || header.data_offset < sizeof(MatrixFileHeader) || header.data_offset % header.alignment != 0
+                || header.data_offset > file_size)
+            {
+                throw std::runtime_error("Invalid offset of the coefficients in the matrix file");
+            }
+
+            constexpr uint64_t largest = std::numeric_limits<size_t>::max() / sizeof(coordinate);
+
+            // Computed in steps checked against overflows, the header being read from a file
+            uint64_t extent = 0;
+
+            if (header.rows > 0 && header.cols > 0)
+            {
+                if ((header.row_stride > 0 && header.rows - 1 > largest / header.row_stride)
+                    || (header.col_stride > 0 && header.cols - 1 > largest / header.col_stride))
+                {
+                    throw std::runtime_error("Invalid dimensions in the matrix file");
+                }
+
+                const uint64_t last_row = (header.rows - 1) * header.row_stride;
+                const uint64_t last_col = (header.cols - 1) * header.col_stride;
+
+                if (last_row > largest - last_col - 1)
+                {
+                    throw std::runtime_error("Invalid dimensions in the matrix file");
+                }
+
+                extent = last_row + last_col + 1;
+            }
+
+            if (extent > (file_size - header.data_offset) / sizeof(coordinate))
+            {
+                throw std::runtime_error("The matrix file is truncated");
+            }
+
+            return static_cast<size_t>(extent);
+        }
+
+        // NOLINTEND(readability-identifier-length)
+    }  // namespace ImplementationDetails
+
+    // NOLINTBEGIN(readability-identifier-length)
+
+    inline void MatrixFileChecksum::update(std::span<const std::byte> bytes)
+    {
+        _size += bytes.size();
+
+        // Complete the pending block first
+        if (_pending_size > 0)
+        {
+            const size_t count = std::min(bytes.size(), _pending.size() - _pending_size);
+            std::memcpy(_pending.data() + _pending_size, bytes.data(), count);
+
+            _pending_size += count;
+            bytes = bytes.subspan(count);
+
+            if (_pending_size < _pending.size())
+            {
+                return;
+            }
+
+            _consume(_pending.data());
+            _pending_size = 0;
+        }
+
+        while (bytes.size() >= _pending.size())
+        {
+            _consume(bytes.data());
+            bytes = bytes.subspan(_pending.size());
+        }
+
+        std::memcpy(_pending.data(), bytes.data(), bytes.size());
+        _pending_size = bytes.size();
+    }
+
+    inline uint64_t MatrixFileChecksum::value() const
+    {
+        std::array<uint64_t, _lane_count> lanes = _lanes;
+
+        // The pending bytes, padded with zeros, then the size so that trailing zeros change the checksum
+        std::array<std::byte, 8 * _lane_count> last = {};
+        std::memcpy(last.data(), _pending.data(), _pending_size);
+
+        for (size_t lane = 0; lane < _lane_count; ++lane)
+        {
+            uint64_t word;
+            std::memcpy(&word, last.data() + 8 * lane, 8);
+            lanes[lane] = (lanes[lane] ^ word) * _prime;
+        }
+
+        uint64_t result = _size;
+
+        for (const uint64_t lane : lanes)
+        {
+            result = (result ^ lane) * _prime;
+            result ^= result >> 29;
+        }
+
+        return result;
+    }
+
+    inline void MatrixFileChecksum::_consume(const std::byte* block)
+    {
+        for (size_t lane = 0; lane < _lane_count; ++lane)
+        {
+            uint64_t word;
+            std::memcpy(&word, block + 8 * lane, 8);
+            _lanes[lane] = (_lanes[lane] ^ word) * _prime;
+        }
+    }
+
+    template <Coordinate coordinate>
+    MatrixFileWriter<coordinate>::MatrixFileWriter(const std::filesystem::path& path, size_t rows, size_t cols, StorageOrder order, size_t alignment)
+    : _rows(rows)
+    , _cols(cols)
+    , _order(order)
+    , _alignment(alignment)
+    {
+        using namespace ImplementationDetails;
+
+        if (!std::has_single_bit(alignment) || alignment < sizeof(coordinate) || alignment > std::numeric_limits<uint32_t>::max())
+        {
+            throw std::invalid_argument("The alignment must be a power of 2, at least the size of the coefficients");
+        }
+
+        _file.open(path, std::ios::binary | std::ios::trunc);
+
+        // Zeros until close(), the magic of an incomplete file being invalid
+        const std::vector<char> zeros(matrix_file_data_offset(alignment), 0);
+        _file.write(zeros.data(), static_cast<std::streamsize>(zeros.size()));
+
+        if (!_file)
+        {
+            throw std::runtime_error("Cannot create the matrix file " + path.string());
+        }
+    }
+
+    template <Coordinate coordinate>
+    void MatrixFileWriter<coordinate>::write(std::span<const coordinate> coefficients)
+    {
+        if (coefficients.size() > _rows * _cols - _written)
+        {
+            throw std::invalid_argument("More coefficients than the matrix holds");
+        }
+
+        const std::span<const std::byte> bytes = std::as_bytes(coefficients);
+
+        _file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+
+        if (!_file)
+        {
+            throw std::runtime_error("Cannot write the coefficients of the matrix file");
+        }
+
+        _checksum.update(bytes);
+        _written += coefficients.size();
+    }
+
+    template <Coordinate coordinate>
+    void MatrixFileWriter<coordinate>::close()
+    {
+        using namespace ImplementationDetails;
+
+        if (_written != _rows * _cols)
+        {
+            throw std::runtime_error("Fewer coefficients than the matrix holds were written");
+        }
+
+        const bool row_major = _order == StorageOrder::RowMajor;
+
+        MatrixFileHeader header;
+        header.magic       = matrix_file_magic;
+        header.version     = matrix_file_version;
+        header.byte_order  = matrix_file_byte_order;
+        header.type        = matrix_file_type<coordinate>();
+        header.alignment   = static_cast<uint32_t>(_alignment);
+        header.rows        = _rows;
+        header.cols        = _cols;
+        header.row_stride  = row_major ? _cols : 1;
+        header.col_stride  = row_major ? 1 : _rows;
+        header.data_offset = matrix_file_data_offset(_alignment);
+        header.checksum    = _checksum.value();
+
+        _file.seekp(0);
+        _file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        _file.close();
+
+        if (!_file)
+        {
+            throw std::runtime_error("Cannot write the header of the matrix file");
+        }
+    }
+
+    template <Coordinate coordinate>
+    void write_matrix_file(const std::filesystem::path& path, std::type_identity_t<MatrixView<const coordinate>> matrix, size_t alignment)
+    {
+        MatrixFileWriter<coordinate> writer(path, matrix.rows(), matrix.cols(), StorageOrder::RowMajor, alignment);
+
+        std::vector<coordinate> row(matrix.cols());
+
+        for (size_t i = 0; i < matrix.rows(); ++i)
+        {
+            if (matrix.colStride() == 1)
+            {
+                writer.write(std::span<const coordinate>(matrix.data() + i * matrix.rowStride(), matrix.cols()));
+                continue;
+            }
+
+            for (size_t j = 0; j < matrix.cols(); ++j)
+            {
+                row[j] = matrix.data()[i * matrix.rowStride() + j * matrix.colStride()];
+            }
+
+            writer.write(row);
+        }
+
+        writer.close();
+    }
+
+    template <Coordinate coordinate>
+    MappedMatrix<coordinate>::MappedMatrix(const std::filesystem::path& path, bool verify_checksum)
+    {
+        using namespace ImplementationDetails;
+
+        MatrixFileHeader header;
+
+#ifdef LCNS_ALGEBRA_MMAP_AVAILABLE
+        const int descriptor = ::open(path.c_str(), O_RDONLY);
+
+        if (descriptor < 0)
+        {
+            throw std::runtime_error("Cannot open the matrix file " + path.string());
+        }
+
+        struct stat status;
+
+        if (::fstat(descriptor, &status) != 0 || static_cast<size_t>(status.st_size) < sizeof(MatrixFileHeader))
+        {
+            ::close(descriptor);
+            throw std::runtime_error("Not a complete matrix file");
+        }
+
+        _mapping_size = static_cast<size_t>(status.st_size);
+
+        // The descriptor is not needed once the file is mapped
+        void* mapping = ::mmap(nullptr, _mapping_size, PROT_READ, MAP_SHARED, descriptor, 0);
+        ::close(descriptor);
+
+        if (mapping == MAP_FAILED)
+        {
+            throw std::runtime_error("Cannot map the matrix file " + path.string());
+        }
+
+        _mapping = static_cast<const std::byte*>(mapping);
+        std::memcpy(&header, _mapping, sizeof(header));
+
+        try
+        {
+            check_matrix_file_header<coordinate>(header, _mapping_size);
+        }
+        catch (...)
+        {
+            _release();
+            throw;
+        }
+
+        const auto* coefficients = reinterpret_cast<const coordinate*>(_mapping + header.data_offset);
+#else
+        std::ifstream file(path, std::ios::binary);
+
+        if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)))
+        {
+            throw std::runtime_error("Cannot read the matrix file " + path.string());
+        }
+
+        const size_t extent = check_matrix_file_header<coordinate>(header, static_cast<size_t>(std::filesystem::file_size(path)));
+
+        // Aligned in memory as they are in the file
+        const size_t size = extent * sizeof(coordinate);
+        _copy.resize(size + header.alignment);
+
+        void*  aligned = _copy.data();
+        size_t space   = _copy.size();
+        std::align(header.alignment, size, aligned, space);
+
+        file.seekg(static_cast<std::streamoff>(header.data_offset));
+
+        if (!file.read(static_cast<char*>(aligned), static_cast<std::streamsize>(size)))
+        {
+            throw std::runtime_error("Cannot read the matrix file " + path.string());
+        }
+
+        const auto* coefficients = static_cast<const coordinate*>(aligned);
+#endif
+
+        _view     = MatrixView<const coordinate>(coefficients, header.rows, header.cols, header.row_stride, header.col_stride);
+        _checksum = header.checksum;
+
+        if (verify_checksum && !verifyChecksum())
+        {
+            _release();
+            throw std::runtime_error("The checksum of the matrix file does not match its coefficients");
+        }
+    }
+
+    template <Coordinate coordinate>
+    MappedMatrix<coordinate>::MappedMatrix(MappedMatrix&& other) noexcept
+    : _mapping(std::exchange(other._mapping, nullptr))
+    , _mapping_size(std::exchange(other._mapping_size, 0))
+    , _copy(std::move(other._copy))
+    , _view(std::exchange(other._view, {}))
+    , _checksum(other._checksum)
+    {
+    }
+
+    template <Coordinate coordinate>
+    MappedMatrix<coordinate>& MappedMatrix<coordinate>::operator=(MappedMatrix&& other) noexcept
+    {
+        if (this != &other)
+        {
+            _release();
+
+            _mapping      = std::exchange(other._mapping, nullptr);
+            _mapping_size = std::exchange(other._mapping_size, 0);
+            _copy         = std::move(other._copy);
+            _view         = std::exchange(other._view, {});
+            _checksum     = other._checksum;
+        }
+
+        return *this;
+    }
+
+    template <Coordinate coordinate>
+    MappedMatrix<coordinate>::~MappedMatrix()
+    {
+        _release();
+    }
+
+    template <Coordinate coordinate>
+    MatrixView<const coordinate> MappedMatrix<coordinate>::view() const
+    {
+        return _view;
+    }
+
+    template <Coordinate coordinate>
+    bool MappedMatrix<coordinate>::verifyChecksum() const
+    {
+        MatrixFileChecksum checksum;
+        checksum.update(std::as_bytes(std::span<const coordinate>(_view.data(), ImplementationDetails::view_extent(_view))));
+
+        return checksum.value() == _checksum;
+    }
+
+    template <Coordinate coordinate>
+    void MappedMatrix<coordinate>::_release() noexcept
+    {
+#ifdef LCNS_ALGEBRA_MMAP_AVAILABLE
+        if (_mapping != nullptr)
+        {
+            ::munmap(const_cast<std::byte*>(_mapping), _mapping_size);
+        }
+#endif
+
+        _mapping      = nullptr;
+        _mapping_size = 0;
+        _copy.clear();
+        _view = {};
+    }
+
+    // NOLINTEND(readability-identifier-length)
+}  // namespace LCNS::Algebra
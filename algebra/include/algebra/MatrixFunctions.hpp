@@ -0,0 +1,350 @@
+#pragma once
+
+#include "algebra/BlockedMultiplication.hpp"
+#include "algebra/Matrix.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+/*
+ * Functions of square matrices computed with matrix products:
+ * - pow(M, k) by binary exponentiation, squaring M and multiplying the result by the squares of the bits set in k:
+ *   floor(log2(k)) + popcount(k) - 1 products instead of k - 1. pow<k>(M) unrolls the same chain at compile time.
+ * - expm(M) by scaling and squaring (Higham, "The scaling and squaring method for the matrix exponential revisited",
+ *   2005): exp(M) = r(M / 2^s)^(2^s), r being the diagonal Pade approximant of degree 3, 5, 7, 9 or 13 (7 in single
+ *   precision), the lowest whose backward error is below the unit roundoff for |M|_1, s being null unless |M|_1 is
+ *   larger than the bound of the highest degree. r = (V - U)^-1 * (V + U), U and V being the odd and even parts of the
+ *   numerator, evaluated with as few products as possible: 6 for the degree 13.
+ *
+ * The products are those of operator* for small matrices, whose loops are unrolled and vectorized by the compiler,
+ * and those of the blocked and multithreaded kernel of BlockedMultiplication.hpp for large floating point matrices.
+ */
+
+namespace LCNS::Algebra
+{
+    /*!
+     * \brief Raise a square matrix to a power known at run time, see the introduction of MatrixFunctions.hpp
+     * @param matrix is the matrix M
+     * @param exponent is the power k, M^0 being the identity
+     * @return M^k
+     */
+    template <Coordinate coordinate, unsigned int size, StorageOrder order>
+    Matrix<coordinate, size, size, order> pow(const Matrix<coordinate, size, size, order>& matrix, unsigned int exponent);
+
+    /*!
+     * \brief Raise a square matrix to a power known at compile time, the chain of products being unrolled
+     * @return M^exponent
+     */
+    template <unsigned int exponent, Coordinate coordinate, unsigned int size, StorageOrder order>
+    Matrix<coordinate, size, size, order> pow(const Matrix<coordinate, size, size, order>& matrix);
+
+    /*!
+     * \brief Compute the exponential of a square matrix, exp(M) = I + M + M^2 / 2! + ..., by scaling and squaring,
+     *        see the introduction of MatrixFunctions.hpp
+     * @param matrix is the matrix M
+     * @return exp(M), accurate to a few epsilon * |exp(M)| for matrices which are not too far from normal
+     * @throw std::runtime_error if a coefficient of the matrix is not finite
+     */
+    template <Coordinate coordinate, unsigned int size, StorageOrder order>
+    Matrix<coordinate, size, size, order> expm(const Matrix<coordinate, size, size, order>& matrix) requires(std::is_floating_point_v<coordinate>);
+
+    namespace ImplementationDetails
+    {
+        // NOLINTBEGIN(readability-identifier-length)
+
+        /*!
+         * @brief Size from which the products of floating point matrices use the blocked kernel: below, the loops of
+         *        operator* unrolled by the compiler are as fast and do not pay for the tiling
+         */
+        constexpr unsigned int matrix_function_blocked_size = 32;
+
+        /*!
+         * @brief Coefficients b_0 ... b_m of the numerator of the diagonal Pade approximants of exp, the denominator
+         *        being the same polynomial of -x
+         */
+        constexpr std::array<double, 4>  pade3_coefficients  = { 120, 60, 12, 1 };
+        constexpr std::array<double, 6>  pade5_coefficients  = { 30240, 15120, 3360, 420, 30, 1 };
+        constexpr std::array<double, 8>  pade7_coefficients  = { 17297280, 8648640, 1995840, 277200, 25200, 1512, 56, 1 };
+        constexpr std::array<double, 10> pade9_coefficients  = { 17643225600, 8821612800, 2075673600, 302702400, 30270240,
+                                                                 2162160,     110880,     3960,       90,        1 };
+        constexpr std::array<double, 14> pade13_coefficients = { 64764752532480000, 32382376266240000, 7771770303897600,
+                                                                 1187353796428800,  129060195264000,   10559470521600,
+                                                                 670442572800,      33522128640,       1323241920,
+                                                                 40840800,          960960,            16380,
+                                                                 182,               1 };
+
+        /*!
+         * @brief Largest 1-norms for which the Pade approximants of degree 3, 5, 7, 9 and 13 are accurate to the unit
+         *        roundoff in double precision, and those of degree 3, 5 and 7 in single precision (Higham 2005)
+         */
+        constexpr std::array<double, 5> pade_double_bounds = { 1.495585217958292e-2, 2.539398330063230e-1, 9.504178996162932e-1,
+                                                               2.097847961257068,    5.371920351148152 };
+        constexpr std::array<double, 3> pade_single_bounds = { 4.258730016922831e-1, 1.880152677804762, 3.925724783138660 };
+
+        /*!
+         * @brief lhs * rhs with the fastest product for the size
+         */
+        template <Coordinate coordinate, unsigned int size, StorageOrder order>
+        Matrix<coordinate, size, size, order> matrix_product(const Matrix<coordinate, size, size, order>& lhs,
+                                                             const Matrix<coordinate, size, size, order>& rhs)
+        {
+            if constexpr (std::is_floating_point_v<coordinate> && size >= matrix_function_blocked_size)
+            {
+                Matrix<coordinate, size, size, order> result;
+
+                // Read row by row, the coefficients of matrices stored by columns are those of the transposes
+                if constexpr (order == StorageOrder::RowMajor)
+                {
+                    multiply_add_blocked<coordinate>(size, size, size, 1, lhs.data(), size, rhs.data(), size, result.data(), size);
+                }
+                else
+                {
+                    multiply_add_blocked<coordinate>(size, size, size, 1, rhs.data(), size, lhs.data(), size, result.data(), size);
+                }
+
+                return result;
+            }
+            else
+            {
+                return lhs * rhs;
+            }
+        }
+
+        /*!
+         * @brief M^exponent, unrolled at compile time
+         */
+        template <unsigned int exponent, Coordinate coordinate, unsigned int size, StorageOrder order>
+        Matrix<coordinate, size, size, order> pow_unrolled(const Matrix<coordinate, size, size, order>& matrix)
+        {
+            if constexpr (exponent == 0)
+            {
+                return Matrix<coordinate, size, size, order>(coordinate{1});
+            }
+            else if constexpr (exponent == 1)
+            {
+                return matrix;
+            }
+            else
+            {
+                const auto half   = pow_unrolled<exponent / 2>(matrix);
+                const auto square = matrix_product(half, half);
+
+                if constexpr (exponent % 2 == 1)
+                {
+                    return matrix_product(square, matrix);
+                }
+                else
+                {
+                    return square;
+                }
+            }
+        }
+
+        /*!
+         * @brief identity * I + sum of factors[j] * (*matrices[j])
+         */
+        template <Coordinate coordinate, unsigned int size, StorageOrder order, size_t count>
+        Matrix<coordinate, size, size, order> matrix_combination(double                                                                 identity,
+                                                                 const std::array<double, count>&                                       factors,
+                                                                 const std::array<const Matrix<coordinate, size, size, order>*, count>& matrices)
+        {
+            Matrix<coordinate, size, size, order> result(static_cast<coordinate>(identity));
+
+            for (size_t j = 0; j < count; ++j)
+            {
+                const coordinate  factor = static_cast<coordinate>(factors[j]);
+                const coordinate* source = matrices[j]->data();
+                coordinate*       sum    = result.data();
+
+                for (size_t i = 0; i < size_t{size} * size; ++i)
+                {
+                    sum[i] += factor * source[i];
+                }
+            }
+
+            return result;
+        }
+
+        /*!
+         * @brief Diagonal Pade approximant of exp(M) of degree 3, 5, 7 or 9, (V - U)^-1 * (V + U) with
+         *        U = M * (b1 * I + b3 * M^2 + ...) and V = b0 * I + b2 * M^2 + ...
+         */
+        template <size_t degree, Coordinate coordinate, unsigned int size, StorageOrder order>
+        Matrix<coordinate, size, size, order> pade_approximant(const Matrix<coordinate, size, size, order>& matrix,
+                                                               const std::array<double, degree + 1>&        b)
+        {
+            using matrix_type = Matrix<coordinate, size, size, order>;
+
+            constexpr size_t count = degree / 2;
+
+            // M^2, M^4, ... M^(degree - 1)
+            std::array<matrix_type, count>        even_powers;
+            std::array<const matrix_type*, count> powers;
+            std::array<double, count>             odd;
+            std::array<double, count>             even;
+
+            for (size_t j = 0; j < count; ++j)
+            {
+                even_powers[j] = j == 0 ? matrix_product(matrix, matrix) : matrix_product(even_powers[j - 1], even_powers[0]);
+                powers[j]      = &even_powers[j];
+                odd[j]         = b[2 * j + 3];
+                even[j]        = b[2 * j + 2];
+            }
+
+            const matrix_type u = matrix_product(matrix, matrix_combination(b[1], odd, powers));
+            const matrix_type v = matrix_combination(b[0], even, powers);
+
+            return (v - u).solve(v + u);
+        }
+
+        /*!
+         * @brief Diagonal Pade approximant of exp(M) of degree 13, the polynomials of degree 12 being evaluated from
+         *        M^2, M^4 and M^6 only: V = M^6 * (b12 * M^6 + b10 * M^4 + b8 * M^2) + b6 * M^6 + b4 * M^4 + b2 * M^2 +
+         *        b0 * I, and U the same with the odd coefficients, multiplied by M
+         */
+        template <Coordinate coordinate, unsigned int size, StorageOrder order>
+        Matrix<coordinate, size, size, order> pade13_approximant(const Matrix<coordinate, size, size, order>& matrix)
+        {
+            using matrix_type = Matrix<coordinate, size, size, order>;
+
+            const auto& b = pade13_coefficients;
+
+            const matrix_type m2 = matrix_product(matrix, matrix);
+            const matrix_type m4 = matrix_product(m2, m2);
+            const matrix_type m6 = matrix_product(m4, m2);
+
+            const std::array<const matrix_type*, 3> powers = { &m6, &m4, &m2 };
+
+            const matrix_type u_high = matrix_combination(0, std::array{ b[13], b[11], b[9] }, powers);
+            const matrix_type v_high = matrix_combination(0, std::array{ b[12], b[10], b[8] }, powers);
+
+            const matrix_type u_low  = matrix_combination(b[1], std::array{ b[7], b[5], b[3] }, powers);
+            const matrix_type v_low  = matrix_combination(b[0], std::array{ b[6], b[4], b[2] }, powers);
+
+            const matrix_type u = matrix_product(matrix, matrix_product(m6, u_high) + u_low);
+            const matrix_type v = matrix_product(m6, v_high) + v_low;
+
+            return (v - u).solve(v + u);
+        }
+
+        // NOLINTEND(readability-identifier-length)
+    }  // namespace ImplementationDetails
+
+    // NOLINTBEGIN(readability-identifier-length)
+    template <Coordinate coordinate, unsigned int size, StorageOrder order>
+    Matrix<coordinate, size, size, order> pow(const Matrix<coordinate, size, size, order>& matrix, unsigned int exponent)
+    {
+        using ImplementationDetails::matrix_product;
+
+        if (exponent == 0)
+        {
+            return Matrix<coordinate, size, size, order>(coordinate{1});
+        }
+
+        // The lowest bit set starts the result, the squares being multiplied in for each higher bit set
+        Matrix<coordinate, size, size, order> square = matrix;
+
+        for (; exponent % 2 == 0; exponent /= 2)
+        {
+            square = matrix_product(square, square);
+        }
+
+        Matrix<coordinate, size, size, order> result = square;
+
+        for (exponent /= 2; exponent != 0; exponent /= 2)
+        {
+            square = matrix_product(square, square);
+
+            if (exponent % 2 == 1)
+            {
+                result = matrix_product(result, square);
+            }
+        }
+
+        return result;
+    }
+
+    template <unsigned int exponent, Coordinate coordinate, unsigned int size, StorageOrder order>
+    Matrix<coordinate, size, size, order> pow(const Matrix<coordinate, size, size, order>& matrix)
+    {
+        return ImplementationDetails::pow_unrolled<exponent>(matrix);
+    }
+
+    template <Coordinate coordinate, unsigned int size, StorageOrder order>
+    Matrix<coordinate, size, size, order> expm(const Matrix<coordinate, size, size, order>& matrix) requires(std::is_floating_point_v<coordinate>)
+    {
+        using namespace ImplementationDetails;
+
+        // 1-norm, the largest sum of the magnitudes of a column
+        double norm = 0;
+
+        for (unsigned int j = 0; j < size; ++j)
+        {
+            double sum = 0;
+
+            for (unsigned int i = 0; i < size; ++i)
+            {
+                sum += std::abs(static_cast<double>(matrix(i, j)));
+            }
+
+            if (!std::isfinite(sum))
+            {
+                throw std::runtime_error("Cannot compute the exponential of a matrix with non finite coefficients");
+            }
+
+            norm = std::max(norm, sum);
+        }
+
+        // The lowest degree accurate for the norm, else the highest one after scaling M by 2^-squarings
+        int                                   squarings = 0;
+        Matrix<coordinate, size, size, order> result;
+
+        if constexpr (std::is_same_v<coordinate, float>)
+        {
+            if (norm <= pade_single_bounds[0])
+            {
+                return pade_approximant<3>(matrix, pade3_coefficients);
+            }
+            if (norm <= pade_single_bounds[1])
+            {
+                return pade_approximant<5>(matrix, pade5_coefficients);
+            }
+
+            squarings = std::max(0, static_cast<int>(std::ceil(std::log2(norm / pade_single_bounds[2]))));
+            result    = pade_approximant<7>(matrix * std::ldexp(1.0f, -squarings), pade7_coefficients);
+        }
+        else
+        {
+            if (norm <= pade_double_bounds[0])
+            {
+                return pade_approximant<3>(matrix, pade3_coefficients);
+            }
+            if (norm <= pade_double_bounds[1])
+            {
+                return pade_approximant<5>(matrix, pade5_coefficients);
+            }
+            if (norm <= pade_double_bounds[2])
+            {
+                return pade_approximant<7>(matrix, pade7_coefficients);
+            }
+            if (norm <= pade_double_bounds[3])
+            {
+                return pade_approximant<9>(matrix, pade9_coefficients);
+            }
+
+            squarings = std::max(0, static_cast<int>(std::ceil(std::log2(norm / pade_double_bounds[4]))));
+            result    = pade13_approximant(matrix * static_cast<coordinate>(std::ldexp(1.0, -squarings)));
+        }
+
+        for (int i = 0; i < squarings; ++i)
+        {
+            result = matrix_product(result, result);
+        }
+
+        return result;
+    }
+    // NOLINTEND(readability-identifier-length)
+}  // namespace LCNS::Algebra
@@ -0,0 +1,980 @@
+#pragma once
+
+#include "algebra/BlockedMultiplication.hpp"
+#include "algebra/CholeskyDecomposition.hpp"
+#include "algebra/EigenDecomposition.hpp"
+#include "algebra/Internal.hpp"
+#include "algebra/LUDecomposition.hpp"
+#include "algebra/Matrix.hpp"
+#include "algebra/QRDecomposition.hpp"
+#include "algebra/SingularValueDecomposition.hpp"
+#include "algebra/VectorKernels.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include <version>
+
+#ifdef __cpp_lib_mdspan
+#include <array>
+#include <mdspan>
+#endif
+
+/*
+ * Non-owning views on the coefficients of matrices: a pointer to coefficient (0, 0), the dimensions, and the distances
+ * in memory between two rows and between two columns. A Matrix stored by rows or by columns, one of its blocks, its
+ * transpose, or a buffer owned by another library are all views without copies: a block only moves the first
+ * coefficient, and the transpose swaps the dimensions and the strides.
+ *
+ * gemv and gemm read a view row by row when its column stride is 1, and as the transpose of a matrix stored row by row
+ * when its row stride is 1: these are the layouts read by the kernels of VectorKernels.hpp and BlockedMultiplication.hpp.
+ * Only views with other strides are copied row by row first. Where std::mdspan is available (C++23), the mdspans of
+ * rank 2 convert to views and views convert to mdspans with a strided layout.
+ *
+ * The LU, Cholesky, QR, symmetric eigen and randomized singular value decompositions, and the solvers using them, also
+ * take views. They work in place on the views whose rows are stored one after the other, with a row stride larger than
+ * the number of columns (a block of a larger matrix), and on a copy written back afterwards for the other views. Only
+ * eigen_symmetric_lanczos and randomized_svd, which do not write the matrix, read a view stored column by column as the
+ * transpose of a matrix stored row by row. The views given to one call must not overlap.
+ */
+
+namespace LCNS::Algebra
+{
+    /*!
+     * \brief Non-owning view on a rows x cols matrix, coefficient (i, j) being data[i * row_stride + j * col_stride]. The
+     *        views on const coordinates are read only.
+     */
+    template <typename element>
+    requires Coordinate<std::remove_const_t<element>>
+    class MatrixView
+    {
+    public:
+        using coordinate = std::remove_const_t<element>;
+
+        /*!
+         * \brief Default constructor, view on an empty matrix
+         */
+        constexpr MatrixView() = default;
+
+        /*!
+         * \brief Constructor on coefficients stored anywhere
+         * @param data points to coefficient (0, 0)
+         * @param rows is the number of rows of the matrix
+         * @param cols is the number of columns of the matrix
+         * @param row_stride is the distance between two rows, in coefficients
+         * @param col_stride is the distance between two columns, in coefficients
+         */
+        constexpr MatrixView(element* data, size_t rows, size_t cols, size_t row_stride, size_t col_stride = 1);
+
+        /*!
+         * \brief Constructor on all the coefficients of a matrix, stored row by row or column by column
+         */
+        template <unsigned int matrix_rows, unsigned int matrix_cols, StorageOrder order>
+        MatrixView(Matrix<coordinate, matrix_rows, matrix_cols, order>& matrix);
+
+        /*!
+         * \brief Constructor of a read only view on all the coefficients of a matrix
+         */
+        template <unsigned int matrix_rows, unsigned int matrix_cols, StorageOrder order>
+        MatrixView(const Matrix<coordinate, matrix_rows, matrix_cols, order>& matrix) requires(std::is_const_v<element>);
+
+        /*!
+         * \brief Conversion of a read/write view to a read only view
+         */
+        template <typename other>
+        constexpr MatrixView(const MatrixView<other>& view) requires(std::is_same_v<element, const other>);
+
+#ifdef __cpp_lib_mdspan
+        /*!
+         * \brief Constructor on the coefficients of an mdspan of rank 2, whatever its layout
+         */
+        template <typename extents, typename layout>
+        MatrixView(const std::mdspan<element, extents, layout>& view) requires(extents::rank() == 2);
+
+        /*!
+         * \brief Get an mdspan on the same coefficients
+         */
+        std::mdspan<element, std::dextents<size_t, 2>, std::layout_stride> toMdspan() const;
+#endif
+
+        /*!
+         * \brief Accessor, read/write unless element is const
+         * @param i is the index of the row where to find the coefficient to access
+         * @param j is the index of the column where to find the coefficient to access
+         * @return a reference to the corresponding coefficient
+         * @throw std::out_of_range if (i, j) is out of the matrix
+         */
+        constexpr element& operator()(size_t i, size_t j) const;
+
+        /*!
+         * \brief Get a view on a block of this matrix
+         * @param first_row is the index of the first row of the block
+         * @param first_col is the index of the first column of the block
+         * @param rows is the number of rows of the block
+         * @param cols is the number of columns of the block
+         * @return a view on the same coefficients, with the same strides
+         * @throw std::out_of_range if the block is not inside the matrix
+         */
+        constexpr MatrixView<element> block(size_t first_row, size_t first_col, size_t rows, size_t cols) const;
+
+        /*!
+         * \brief Get a view on the transpose of this matrix, without moving any coefficient
+         */
+        constexpr MatrixView<element> transposed() const;
+
+        /*!
+         * @brief Get a pointer to coefficient (0, 0)
+         */
+        constexpr element* data() const;
+
+        constexpr size_t rows() const;
+        constexpr size_t cols() const;
+
+        /*!
+         * @brief Distance between two rows, respectively two columns, in coefficients
+         */
+        constexpr size_t rowStride() const;
+        constexpr size_t colStride() const;
+
+    private:
+        element* _data       = nullptr;
+        size_t   _rows       = 0;
+        size_t   _cols       = 0;
+        size_t   _row_stride = 0;
+        size_t   _col_stride = 1;
+    };
+
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    MatrixView(Matrix<coordinate, rows, cols, order>&) -> MatrixView<coordinate>;
+
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+    MatrixView(const Matrix<coordinate, rows, cols, order>&) -> MatrixView<const coordinate>;
+
+    /*!
+     * \brief y = alpha * A * x + beta * y for a matrix A held by a view, see gemv in VectorKernels.hpp
+     * @throw std::invalid_argument if the sizes of x and y do not match the dimensions of A
+     */
+    template <Coordinate coordinate>
+    void gemv(coordinate                                        alpha,
+              std::type_identity_t<MatrixView<const coordinate>> a,
+              std::type_identity_t<std::span<const coordinate>>  x,
+              coordinate                                        beta,
+              std::type_identity_t<std::span<coordinate>>        y);
+
+    /*!
+     * \brief C = alpha * A * B + beta * C with the blocked and multithreaded multiplication of BlockedMultiplication.hpp,
+     *        C being a view which overlaps neither A nor B. C is not read when beta is zero.
+     * @throw std::invalid_argument if the dimensions of A, B and C do not match
+     */
+    template <Coordinate coordinate>
+    void gemm(coordinate                                        alpha,
+              std::type_identity_t<MatrixView<const coordinate>> a,
+              std::type_identity_t<MatrixView<const coordinate>> b,
+              coordinate                                        beta,
+              std::type_identity_t<MatrixView<coordinate>>       c)
+    requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief LU decomposition of a matrix held by a view, see lu_factorize in LUDecomposition.hpp
+     * @throw std::invalid_argument if the matrix does not have as many rows and columns as pivots
+     */
+    template <Coordinate coordinate>
+    bool lu_factorize(MatrixView<coordinate> matrix, std::span<unsigned int> pivots) requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief Solve A * X = B from the decomposition of A by lu_factorize, B and X being held by the view rhs
+     * @throw std::invalid_argument if lu or rhs do not have as many rows as pivots, or if lu is not square
+     */
+    template <Coordinate coordinate>
+    void lu_solve(std::type_identity_t<MatrixView<const coordinate>> lu, std::span<const unsigned int> pivots, MatrixView<coordinate> rhs)
+    requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief Solve T * X = B by substitution, T being a triangle of a square matrix, see solve_triangular in
+     *        LUDecomposition.hpp
+     * @throw std::invalid_argument if matrix is not square or does not have as many rows as rhs
+     */
+    template <Coordinate coordinate>
+    void solve_triangular(std::type_identity_t<MatrixView<const coordinate>> matrix, Triangle triangle, MatrixView<coordinate> rhs)
+    requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief Cholesky decomposition of a matrix held by a view, see cholesky_factorize in CholeskyDecomposition.hpp
+     * @throw std::invalid_argument if the matrix is not square
+     */
+    template <Coordinate coordinate>
+    bool cholesky_factorize(MatrixView<coordinate> matrix) requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief Solve A * X = B from the decomposition of A by cholesky_factorize, B and X being held by the view rhs
+     * @throw std::invalid_argument if factor is not square or does not have as many rows as rhs
+     */
+    template <Coordinate coordinate>
+    void cholesky_solve(std::type_identity_t<MatrixView<const coordinate>> factor, MatrixView<coordinate> rhs)
+    requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief Inverse in place of a symmetric positive definite matrix held by a view, see cholesky_inverse in
+     *        CholeskyDecomposition.hpp
+     * @throw std::invalid_argument if the matrix is not square
+     */
+    template <Coordinate coordinate>
+    bool cholesky_inverse(MatrixView<coordinate> matrix) requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief QR decomposition of a matrix held by a view, see qr_factorize in QRDecomposition.hpp
+     * @throw std::invalid_argument if the matrix has more columns than rows or if the size of tau is not its number of
+     *        columns
+     */
+    template <Coordinate coordinate>
+    void qr_factorize(MatrixView<coordinate> matrix, std::type_identity_t<std::span<coordinate>> tau) requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief Least squares solution from the decomposition of A by qr_factorize, B and X being held by the view rhs, see
+     *        qr_solve in QRDecomposition.hpp
+     * @throw std::invalid_argument if qr does not have as many columns as tau has coefficients and at least as many
+     *        rows, or if qr and rhs do not have as many rows
+     */
+    template <Coordinate coordinate>
+    bool qr_solve(std::type_identity_t<MatrixView<const coordinate>> qr,
+                  std::type_identity_t<std::span<const coordinate>>  tau,
+                  MatrixView<coordinate>                             rhs) requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief Least squares solution of a system held by views, see least_squares in QRDecomposition.hpp
+     * @throw std::invalid_argument if the matrix has more columns than rows or if matrix and rhs do not have as many rows
+     */
+    template <Coordinate coordinate>
+    bool least_squares(MatrixView<coordinate> matrix, MatrixView<coordinate> rhs) requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief Eigen decomposition of a symmetric matrix held by a view, see eigen_symmetric in EigenDecomposition.hpp
+     * @throw std::invalid_argument if the matrix does not have as many rows and columns as eigenvalues
+     */
+    template <Coordinate coordinate>
+    bool eigen_symmetric(MatrixView<coordinate> matrix, std::type_identity_t<std::span<coordinate>> eigenvalues)
+    requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief Eigenvalues of a symmetric matrix held by a view, see eigenvalues_symmetric in EigenDecomposition.hpp
+     * @throw std::invalid_argument if the matrix does not have as many rows and columns as eigenvalues
+     */
+    template <Coordinate coordinate>
+    bool eigenvalues_symmetric(MatrixView<coordinate> matrix, std::type_identity_t<std::span<coordinate>> eigenvalues)
+    requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief A few eigenpairs of a symmetric matrix held by a view, the eigenvectors being stored in the view
+     *        eigenvectors, see eigen_symmetric_lanczos in EigenDecomposition.hpp
+     * @throw std::invalid_argument if count, the size of eigenvalues, is null or is not the number of columns of
+     *        eigenvectors, or if the matrix is not square or does not have as many rows as eigenvectors
+     */
+    template <Coordinate coordinate>
+    bool eigen_symmetric_lanczos(std::type_identity_t<MatrixView<const coordinate>> matrix,
+                                 std::type_identity_t<std::span<coordinate>>        eigenvalues,
+                                 MatrixView<coordinate>                             eigenvectors,
+                                 Spectrum                                           spectrum = Spectrum::Largest)
+    requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief Randomized singular value decomposition of a matrix held by a view, the singular vectors being stored in
+     *        the views u and v, see randomized_svd in SingularValueDecomposition.hpp. A matrix stored column by column is
+     *        decomposed as its transpose, the roles of u and v being swapped: the columns of u of null singular values
+     *        are then null instead of those of v.
+     * @throw std::invalid_argument if k, the size of singular_values, is null or larger than the number of rows or
+     *        columns of the matrix, or if u and v do not have k columns and as many rows as the matrix has rows and
+     *        columns
+     */
+    template <Coordinate coordinate>
+    bool randomized_svd(std::type_identity_t<MatrixView<const coordinate>> matrix,
+                        MatrixView<coordinate>                             u,
+                        std::type_identity_t<std::span<coordinate>>        singular_values,
+                        MatrixView<coordinate>                             v,
+                        size_t                                             oversampling     = 10,
+                        unsigned int                                       power_iterations = 2)
+    requires(std::is_floating_point_v<coordinate>);
+
+    namespace ImplementationDetails
+    {
+        // NOLINTBEGIN(readability-identifier-length)
+
+        /*!
+         * @brief Number of coefficients between the first and one past the last coefficient of a view
+         */
+        template <typename element>
+        size_t view_extent(const MatrixView<element>& view)
+        {
+            if (view.rows() == 0 || view.cols() == 0)
+            {
+                return 0;
+            }
+
+            return (view.rows() - 1) * view.rowStride() + (view.cols() - 1) * view.colStride() + 1;
+        }
+
+        /*!
+         * @brief True if the rows of a view are stored one after the other, the coefficients of each row being contiguous
+         */
+        template <typename element>
+        bool is_row_major_view(const MatrixView<element>& view)
+        {
+            return view.colStride() == 1 && (view.rows() < 2 || view.rowStride() >= view.cols());
+        }
+
+        /*!
+         * @brief Copy of the coefficients of a view, stored row by row
+         */
+        template <Coordinate coordinate>
+        std::vector<coordinate> copy_rows(MatrixView<const coordinate> view)
+        {
+            std::vector<coordinate> result(view.rows() * view.cols());
+
+            for (size_t i = 0; i < view.rows(); ++i)
+            {
+                for (size_t j = 0; j < view.cols(); ++j)
+                {
+                    result[i * view.cols() + j] = view.data()[i * view.rowStride() + j * view.colStride()];
+                }
+            }
+
+            return result;
+        }
+
+        /*!
+         * @brief C += alpha * A * B, the rows of C being stored one after the other
+         */
+        template <Coordinate coordinate>
+        void multiply_add_rows(coordinate alpha, MatrixView<const coordinate> a, MatrixView<const coordinate> b, MatrixView<coordinate> c)
+        {
+            std::vector<coordinate> b_copy;
+            const coordinate*       b_data = b.data();
+            size_t                  ldb    = b.rowStride();
+
+            if (!is_row_major_view(b))
+            {
+                b_copy = copy_rows(b);
+                b_data = b_copy.data();
+                ldb    = b.cols();
+            }
+
+            if (is_row_major_view(a))
+            {
+                multiply_add_blocked<coordinate>(c.rows(), c.cols(), a.cols(), alpha, a.data(), a.rowStride(), b_data, ldb, c.data(), c.rowStride());
+            }
+            else if (is_row_major_view(a.transposed()))
+            {
+                // A(i, k) = a[k * lda + i], as read by the blocked kernel when transpose_a is true
+                const size_t lda = a.colStride();
+                multiply_add_blocked<coordinate, true>(c.rows(), c.cols(), a.cols(), alpha, a.data(), lda, b_data, ldb, c.data(), c.rowStride());
+            }
+            else
+            {
+                const std::vector<coordinate> a_copy = copy_rows(a);
+                multiply_add_blocked<coordinate>(c.rows(), c.cols(), a.cols(), alpha, a_copy.data(), a.cols(), b_data, ldb, c.data(), c.rowStride());
+            }
+        }
+
+        /*!
+         * @brief Coefficients of a view stored row by row, as read by the decompositions with a leading dimension: those
+         *        of the view itself if its rows are stored one after the other, else a copy which store writes back
+         */
+        template <typename element>
+        class RowMajorCoefficients
+        {
+        public:
+            using coordinate = std::remove_const_t<element>;
+
+            explicit RowMajorCoefficients(MatrixView<element> view)
+            : _view(view)
+            , _copied(!is_row_major_view(view))
+            {
+                if (_copied)
+                {
+                    _copy = copy_rows<coordinate>(view);
+                }
+            }
+
+            element* data() { return _copied ? _copy.data() : _view.data(); }
+
+            /*!
+             * @brief Distance between two rows of data()
+             */
+            size_t ld() const { return _copied || _view.rows() < 2 ? _view.cols() : _view.rowStride(); }
+
+            /*!
+             * @brief Write the copy, if any, back to the view
+             */
+            void store() const requires(!std::is_const_v<element>)
+            {
+                if (!_copied)
+                {
+                    return;
+                }
+
+                for (size_t i = 0; i < _view.rows(); ++i)
+                {
+                    for (size_t j = 0; j < _view.cols(); ++j)
+                    {
+                        _view.data()[i * _view.rowStride() + j * _view.colStride()] = _copy[i * _view.cols() + j];
+                    }
+                }
+            }
+
+        private:
+            MatrixView<element>     _view;
+            bool                    _copied;
+            std::vector<coordinate> _copy;
+        };
+
+        // NOLINTEND(readability-identifier-length)
+    }  // namespace ImplementationDetails
+
+    // NOLINTBEGIN(readability-identifier-length)
+    template <typename element>
+    requires Coordinate<std::remove_const_t<element>>
+    constexpr MatrixView<element>::MatrixView(element* data, size_t rows, size_t cols, size_t row_stride, size_t col_stride)
+    : _data(data)
+    , _rows(rows)
+    , _cols(cols)
+    , _row_stride(row_stride)
+    , _col_stride(col_stride)
+    {
+    }
+
+    template <typename element>
+    requires Coordinate<std::remove_const_t<element>>
+    template <unsigned int matrix_rows, unsigned int matrix_cols, StorageOrder order>
+    MatrixView<element>::MatrixView(Matrix<coordinate, matrix_rows, matrix_cols, order>& matrix)
+    : MatrixView(matrix.data(),
+             matrix_rows,
+             matrix_cols,
+             order == StorageOrder::RowMajor ? matrix_cols : 1,
+             order == StorageOrder::RowMajor ? 1 : matrix_rows)
+    {
+    }
+
+    template <typename element>
+    requires Coordinate<std::remove_const_t<element>>
+    template <unsigned int matrix_rows, unsigned int matrix_cols, StorageOrder order>
+    MatrixView<element>::MatrixView(const Matrix<coordinate, matrix_rows, matrix_cols, order>& matrix) requires(std::is_const_v<element>)
+    : MatrixView(matrix.data(),
+             matrix_rows,
+             matrix_cols,
+             order == StorageOrder::RowMajor ? matrix_cols : 1,
+             order == StorageOrder::RowMajor ? 1 : matrix_rows)
+    {
+    }
+
+    template <typename element>
+    requires Coordinate<std::remove_const_t<element>>
+    template <typename other>
+    constexpr MatrixView<element>::MatrixView(const MatrixView<other>& view) requires(std::is_same_v<element, const other>)
+    : MatrixView(view.data(), view.rows(), view.cols(), view.rowStride(), view.colStride())
+    {
+    }
+
+#ifdef __cpp_lib_mdspan
+    template <typename element>
+    requires Coordinate<std::remove_const_t<element>>
+    template <typename extents, typename layout>
+    MatrixView<element>::MatrixView(const std::mdspan<element, extents, layout>& view) requires(extents::rank() == 2)
+    : MatrixView(view.data_handle(), view.extent(0), view.extent(1), view.stride(0), view.stride(1))
+    {
+    }
+
+    template <typename element>
+    requires Coordinate<std::remove_const_t<element>>
+    std::mdspan<element, std::dextents<size_t, 2>, std::layout_stride> MatrixView<element>::toMdspan() const
+    {
+        const std::layout_stride::mapping<std::dextents<size_t, 2>> mapping(std::dextents<size_t, 2>(_rows, _cols),
+                                                                            std::array<size_t, 2>{ _row_stride, _col_stride });
+
+        return { _data, mapping };
+    }
+#endif
+
+    template <typename element>
+    requires Coordinate<std::remove_const_t<element>>
+    constexpr element& MatrixView<element>::operator()(size_t i, size_t j) const
+    {
+        if (_rows <= i || _cols <= j)
+        {
+            throw std::out_of_range("Index out of range to access matrix coefficient");
+        }
+
+        return _data[i * _row_stride + j * _col_stride];
+    }
+
+    template <typename element>
+    requires Coordinate<std::remove_const_t<element>>
+    constexpr MatrixView<element> MatrixView<element>::block(size_t first_row, size_t first_col, size_t rows, size_t cols) const
+    {
+        if (_rows < first_row || _rows - first_row < rows || _cols < first_col || _cols - first_col < cols)
+        {
+            throw std::out_of_range("The block must be inside the matrix");
+        }
+
+        return { _data + first_row * _row_stride + first_col * _col_stride, rows, cols, _row_stride, _col_stride };
+    }
+
+    template <typename element>
+    requires Coordinate<std::remove_const_t<element>>
+    constexpr MatrixView<element> MatrixView<element>::transposed() const
+    {
+        return { _data, _cols, _rows, _col_stride, _row_stride };
+    }
+
+    template <typename element>
+    requires Coordinate<std::remove_const_t<element>>
+    constexpr element* MatrixView<element>::data() const
+    {
+        return _data;
+    }
+
+    template <typename element>
+    requires Coordinate<std::remove_const_t<element>>
+    constexpr size_t MatrixView<element>::rows() const
+    {
+        return _rows;
+    }
+
+    template <typename element>
+    requires Coordinate<std::remove_const_t<element>>
+    constexpr size_t MatrixView<element>::cols() const
+    {
+        return _cols;
+    }
+
+    template <typename element>
+    requires Coordinate<std::remove_const_t<element>>
+    constexpr size_t MatrixView<element>::rowStride() const
+    {
+        return _row_stride;
+    }
+
+    template <typename element>
+    requires Coordinate<std::remove_const_t<element>>
+    constexpr size_t MatrixView<element>::colStride() const
+    {
+        return _col_stride;
+    }
+
+    template <Coordinate coordinate>
+    void gemv(coordinate                                        alpha,
+              std::type_identity_t<MatrixView<const coordinate>> a,
+              std::type_identity_t<std::span<const coordinate>>  x,
+              coordinate                                        beta,
+              std::type_identity_t<std::span<coordinate>>        y)
+    {
+        using namespace ImplementationDetails;
+
+        const std::span<const coordinate> coefficients(a.data(), view_extent(a));
+
+        if (is_row_major_view(a))
+        {
+            gemv(false, a.rows(), a.cols(), alpha, coefficients, a.rowStride(), x, beta, y);
+        }
+        else if (is_row_major_view(a.transposed()))
+        {
+            gemv(true, a.cols(), a.rows(), alpha, coefficients, a.colStride(), x, beta, y);
+        }
+        else
+        {
+            const std::vector<coordinate> copy = copy_rows(a);
+            gemv(false, a.rows(), a.cols(), alpha, std::span<const coordinate>(copy), a.cols(), x, beta, y);
+        }
+    }
+
+    template <Coordinate coordinate>
+    void gemm(coordinate                                        alpha,
+              std::type_identity_t<MatrixView<const coordinate>> a,
+              std::type_identity_t<MatrixView<const coordinate>> b,
+              coordinate                                        beta,
+              std::type_identity_t<MatrixView<coordinate>>       c)
+    requires(std::is_floating_point_v<coordinate>)
+    {
+        using namespace ImplementationDetails;
+
+        if (a.cols() != b.rows() || c.rows() != a.rows() || c.cols() != b.cols())
+        {
+            throw std::invalid_argument("The dimensions of the operands and of the result do not match the dimensions of the multiplication");
+        }
+
+        for (size_t i = 0; i < c.rows(); ++i)
+        {
+            for (size_t j = 0; j < c.cols(); ++j)
+            {
+                coordinate& coefficient = c.data()[i * c.rowStride() + j * c.colStride()];
+                coefficient             = beta == 0 ? coordinate{0} : beta * coefficient;
+            }
+        }
+
+        if (c.rows() == 0 || c.cols() == 0 || a.cols() == 0)
+        {
+            return;
+        }
+
+        if (is_row_major_view(c))
+        {
+            multiply_add_rows(alpha, a, b, c);
+        }
+        else if (is_row_major_view(c.transposed()))
+        {
+            // Read row by row, the coefficients are those of the transposes: C^T += alpha * B^T * A^T
+            multiply_add_rows(alpha, b.transposed(), a.transposed(), c.transposed());
+        }
+        else
+        {
+            std::vector<coordinate> product(c.rows() * c.cols());
+            multiply_add_rows(alpha, a, b, MatrixView<coordinate>(product.data(), c.rows(), c.cols(), c.cols()));
+
+            for (size_t i = 0; i < c.rows(); ++i)
+            {
+                for (size_t j = 0; j < c.cols(); ++j)
+                {
+                    c.data()[i * c.rowStride() + j * c.colStride()] += product[i * c.cols() + j];
+                }
+            }
+        }
+    }
+
+    template <Coordinate coordinate>
+    bool lu_factorize(MatrixView<coordinate> matrix, std::span<unsigned int> pivots) requires(std::is_floating_point_v<coordinate>)
+    {
+        const size_t n = pivots.size();
+
+        if (matrix.rows() != n || matrix.cols() != n)
+        {
+            throw std::invalid_argument("The matrix to decompose must have as many rows and columns as pivots");
+        }
+
+        ImplementationDetails::RowMajorCoefficients a(matrix);
+
+        const coordinate tolerance = ImplementationDetails::lu_relative_tolerance(a.data(), a.ld(), n);
+        const bool       regular   = ImplementationDetails::lu_blocked(a.data(), a.ld(), n, pivots.data(), tolerance) != 0;
+
+        a.store();
+
+        return regular;
+    }
+
+    template <Coordinate coordinate>
+    void lu_solve(std::type_identity_t<MatrixView<const coordinate>> lu, std::span<const unsigned int> pivots, MatrixView<coordinate> rhs)
+    requires(std::is_floating_point_v<coordinate>)
+    {
+        const size_t n = pivots.size();
+
+        if (lu.rows() != n || lu.cols() != n || rhs.rows() != n)
+        {
+            throw std::invalid_argument("The decomposition and the right hand sides must have as many rows as pivots");
+        }
+
+        ImplementationDetails::RowMajorCoefficients factors(lu);
+        ImplementationDetails::RowMajorCoefficients x(rhs);
+
+        ImplementationDetails::lu_permute(pivots.data(), n, x.data(), x.ld(), rhs.cols());
+        ImplementationDetails::solve_triangular_blocked<true, true>(n, rhs.cols(), factors.data(), factors.ld(), x.data(), x.ld());
+        ImplementationDetails::solve_triangular_blocked<false, false>(n, rhs.cols(), factors.data(), factors.ld(), x.data(), x.ld());
+
+        x.store();
+    }
+
+    template <Coordinate coordinate>
+    void solve_triangular(std::type_identity_t<MatrixView<const coordinate>> matrix, Triangle triangle, MatrixView<coordinate> rhs)
+    requires(std::is_floating_point_v<coordinate>)
+    {
+        if (matrix.rows() != rhs.rows() || matrix.cols() != rhs.rows())
+        {
+            throw std::invalid_argument("The matrix must have as many rows and columns as the right hand sides have rows");
+        }
+
+        ImplementationDetails::RowMajorCoefficients t(matrix);
+        ImplementationDetails::RowMajorCoefficients x(rhs);
+
+        ImplementationDetails::solve_triangle(triangle, rhs.rows(), rhs.cols(), t.data(), t.ld(), x.data(), x.ld());
+
+        x.store();
+    }
+
+    template <Coordinate coordinate>
+    bool cholesky_factorize(MatrixView<coordinate> matrix) requires(std::is_floating_point_v<coordinate>)
+    {
+        const size_t n = matrix.rows();
+
+        if (matrix.rows() != n || matrix.cols() != n)
+        {
+            throw std::invalid_argument("The matrix to decompose must have as many rows as columns");
+        }
+
+        ImplementationDetails::RowMajorCoefficients a(matrix);
+
+        const coordinate tolerance = ImplementationDetails::cholesky_tolerance(a.data(), a.ld(), n);
+        const bool       positive  = ImplementationDetails::cholesky_blocked(a.data(), a.ld(), n, tolerance);
+
+        a.store();
+
+        return positive;
+    }
+
+    template <Coordinate coordinate>
+    void cholesky_solve(std::type_identity_t<MatrixView<const coordinate>> factor, MatrixView<coordinate> rhs)
+    requires(std::is_floating_point_v<coordinate>)
+    {
+        const size_t n = rhs.rows();
+
+        if (factor.rows() != n || factor.cols() != n)
+        {
+            throw std::invalid_argument("The decomposition must have as many rows and columns as the right hand sides have rows");
+        }
+
+        ImplementationDetails::RowMajorCoefficients l(factor);
+        ImplementationDetails::RowMajorCoefficients x(rhs);
+
+        ImplementationDetails::solve_triangular_blocked<true, false>(n, rhs.cols(), l.data(), l.ld(), x.data(), x.ld());
+        ImplementationDetails::solve_triangular_blocked<false, false>(n, rhs.cols(), l.data(), l.ld(), x.data(), x.ld());
+
+        x.store();
+    }
+
+    template <Coordinate coordinate>
+    bool cholesky_inverse(MatrixView<coordinate> matrix) requires(std::is_floating_point_v<coordinate>)
+    {
+        const size_t n = matrix.rows();
+
+        if (matrix.rows() != n || matrix.cols() != n)
+        {
+            throw std::invalid_argument("The matrix to decompose must have as many rows as columns");
+        }
+
+        ImplementationDetails::RowMajorCoefficients a(matrix);
+
+        const coordinate tolerance = ImplementationDetails::cholesky_tolerance(a.data(), a.ld(), n);
+        const bool       positive  = ImplementationDetails::cholesky_blocked(a.data(), a.ld(), n, tolerance);
+
+        if (positive)
+        {
+            ImplementationDetails::cholesky_inverse_blocked(a.data(), a.ld(), n);
+        }
+
+        a.store();
+
+        return positive;
+    }
+
+    template <Coordinate coordinate>
+    void qr_factorize(MatrixView<coordinate> matrix, std::type_identity_t<std::span<coordinate>> tau) requires(std::is_floating_point_v<coordinate>)
+    {
+        if (matrix.cols() == 0 || matrix.rows() < matrix.cols())
+        {
+            throw std::invalid_argument("The matrix to decompose must have at least as many rows as columns");
+        }
+
+        if (tau.size() != matrix.cols())
+        {
+            throw std::invalid_argument("The matrix to decompose must have as many columns as scale factors");
+        }
+
+        ImplementationDetails::RowMajorCoefficients a(matrix);
+
+        ImplementationDetails::qr_blocked(a.data(), a.ld(), matrix.rows(), matrix.cols(), tau.data());
+
+        a.store();
+    }
+
+    template <Coordinate coordinate>
+    bool qr_solve(std::type_identity_t<MatrixView<const coordinate>> qr,
+                  std::type_identity_t<std::span<const coordinate>>  tau,
+                  MatrixView<coordinate>                             rhs) requires(std::is_floating_point_v<coordinate>)
+    {
+        if (qr.cols() != tau.size() || qr.cols() == 0 || qr.rows() < qr.cols())
+        {
+            throw std::invalid_argument("The decomposition must have as many columns as scale factors, and at least as many rows");
+        }
+
+        if (rhs.rows() != qr.rows())
+        {
+            throw std::invalid_argument("The decomposition and the right hand sides must have as many rows");
+        }
+
+        ImplementationDetails::RowMajorCoefficients factors(qr);
+        ImplementationDetails::RowMajorCoefficients x(rhs);
+
+        const bool solved = ImplementationDetails::qr_solve(factors.data(),
+                                                            factors.ld(),
+                                                            qr.rows(),
+                                                            qr.cols(),
+                                                            tau.data(),
+                                                            x.data(),
+                                                            x.ld(),
+                                                            rhs.cols(),
+                                                            true,
+                                                            qr.rows());
+
+        x.store();
+
+        return solved;
+    }
+
+    template <Coordinate coordinate>
+    bool least_squares(MatrixView<coordinate> matrix, MatrixView<coordinate> rhs) requires(std::is_floating_point_v<coordinate>)
+    {
+        if (matrix.cols() == 0 || matrix.rows() < matrix.cols())
+        {
+            throw std::invalid_argument("The matrix to decompose must have at least as many rows as columns");
+        }
+
+        if (rhs.rows() != matrix.rows())
+        {
+            throw std::invalid_argument("The matrix and the right hand sides must have as many rows");
+        }
+
+        ImplementationDetails::RowMajorCoefficients a(matrix);
+        ImplementationDetails::RowMajorCoefficients x(rhs);
+
+        const bool solved = ImplementationDetails::least_squares_tsqr(a.data(),
+                                                                      a.ld(),
+                                                                      matrix.rows(),
+                                                                      matrix.cols(),
+                                                                      x.data(),
+                                                                      x.ld(),
+                                                                      rhs.cols(),
+                                                                      matrix.rows());
+
+        a.store();
+        x.store();
+
+        return solved;
+    }
+
+    template <Coordinate coordinate>
+    bool eigen_symmetric(MatrixView<coordinate> matrix, std::type_identity_t<std::span<coordinate>> eigenvalues)
+    requires(std::is_floating_point_v<coordinate>)
+    {
+        const size_t n = eigenvalues.size();
+
+        if (matrix.rows() != n || matrix.cols() != n)
+        {
+            throw std::invalid_argument("The matrix to decompose must have as many rows and columns as the eigenvectors have coefficients");
+        }
+
+        ImplementationDetails::RowMajorCoefficients a(matrix);
+
+        const bool finite = ImplementationDetails::symmetric_eigen(a.data(), a.ld(), n, eigenvalues.data(), true);
+
+        a.store();
+
+        return finite;
+    }
+
+    template <Coordinate coordinate>
+    bool eigenvalues_symmetric(MatrixView<coordinate> matrix, std::type_identity_t<std::span<coordinate>> eigenvalues)
+    requires(std::is_floating_point_v<coordinate>)
+    {
+        const size_t n = eigenvalues.size();
+
+        if (matrix.rows() != n || matrix.cols() != n)
+        {
+            throw std::invalid_argument("The matrix to decompose must have as many rows and columns as the eigenvectors have coefficients");
+        }
+
+        ImplementationDetails::RowMajorCoefficients a(matrix);
+
+        const bool finite = ImplementationDetails::symmetric_eigen(a.data(), a.ld(), n, eigenvalues.data(), false);
+
+        a.store();
+
+        return finite;
+    }
+
+    template <Coordinate coordinate>
+    bool eigen_symmetric_lanczos(std::type_identity_t<MatrixView<const coordinate>> matrix,
+                                 std::type_identity_t<std::span<coordinate>>        eigenvalues,
+                                 MatrixView<coordinate>                             eigenvectors,
+                                 Spectrum                                           spectrum)
+    requires(std::is_floating_point_v<coordinate>)
+    {
+        const size_t count = eigenvalues.size();
+        const size_t n     = eigenvectors.rows();
+
+        if (count == 0 || count > n || eigenvectors.cols() != count)
+        {
+            throw std::invalid_argument("The eigenvectors must have between 1 and as many columns as rows, one per eigenvalue");
+        }
+
+        if (matrix.rows() != n || matrix.cols() != n)
+        {
+            throw std::invalid_argument("The matrix to decompose must have as many rows and columns as the eigenvectors have coefficients");
+        }
+
+        // The whole matrix being read, a symmetric matrix stored column by column is read as its transpose
+        ImplementationDetails::RowMajorCoefficients a(ImplementationDetails::is_row_major_view(matrix) ? matrix : matrix.transposed());
+        ImplementationDetails::RowMajorCoefficients vectors(eigenvectors);
+
+        const bool converged = ImplementationDetails::lanczos(a.data(),
+                                                              a.ld(),
+                                                              n,
+                                                              count,
+                                                              eigenvalues.data(),
+                                                              vectors.data(),
+                                                              vectors.ld(),
+                                                              spectrum == Spectrum::Largest);
+
+        vectors.store();
+
+        return converged;
+    }
+
+    template <Coordinate coordinate>
+    bool randomized_svd(std::type_identity_t<MatrixView<const coordinate>> matrix,
+                        MatrixView<coordinate>                             u,
+                        std::type_identity_t<std::span<coordinate>>        singular_values,
+                        MatrixView<coordinate>                             v,
+                        size_t                                             oversampling,
+                        unsigned int                                       power_iterations)
+    requires(std::is_floating_point_v<coordinate>)
+    {
+        const size_t k = singular_values.size();
+
+        if (k == 0 || k > std::min(matrix.rows(), matrix.cols()))
+        {
+            throw std::invalid_argument("The number of singular values must be between 1 and the number of rows and of columns");
+        }
+
+        if (u.rows() != matrix.rows() || u.cols() != k || v.rows() != matrix.cols() || v.cols() != k)
+        {
+            throw std::invalid_argument("The singular vectors must have one column per singular value");
+        }
+
+        // A^T = V * diag(sigma) * U^T, the transpose of a matrix stored column by column being stored row by row
+        if (!ImplementationDetails::is_row_major_view(matrix) && ImplementationDetails::is_row_major_view(matrix.transposed()))
+        {
+            return randomized_svd<coordinate>(matrix.transposed(), v, singular_values, u, oversampling, power_iterations);
+        }
+
+        ImplementationDetails::RowMajorCoefficients a(matrix);
+        ImplementationDetails::RowMajorCoefficients left(u);
+        ImplementationDetails::RowMajorCoefficients right(v);
+
+        const bool finite = ImplementationDetails::randomized_svd(a.data(),
+                                                                  a.ld(),
+                                                                  matrix.rows(),
+                                                                  matrix.cols(),
+                                                                  k,
+                                                                  left.data(),
+                                                                  left.ld(),
+                                                                  singular_values.data(),
+                                                                  right.data(),
+                                                                  right.ld(),
+                                                                  oversampling,
+                                                                  power_iterations);
+
+        left.store();
+        right.store();
+
+        return finite;
+    }
+    // NOLINTEND(readability-identifier-length)
+}  // namespace LCNS::Algebra
@@ -1,12 +1,15 @@
 #pragma once
 
+#include "algebra/BlockedMultiplication.hpp"
 #include "algebra/Matrix.hpp"
+#include "algebra/MatrixView.hpp"
 
 #ifdef AVX_ENABLED_ON_CPU
 #include <immintrin.h>
 #include <numeric>
 #endif
 
+#include <algorithm>
 #include <cstdlib>
 #include <span>
 #include <thread>
@@ -35,23 +38,53 @@ namespace LCNS::Algebra
             return result;
         }
 
-        template <Coordinate coordinate, unsigned int lhs_rows, unsigned int lhs_cols, unsigned int rhs_rows, unsigned int rhs_cols>
-        void process_rows(size_t                                        thread_index,
-                          int                                           count,
-                          const Matrix<coordinate, lhs_rows, lhs_cols>& lhs,
-                          const Matrix<coordinate, rhs_cols, rhs_rows>& rhs_transposed,
-                          Matrix<coordinate, lhs_rows, rhs_cols>&       result)
+        /*!
+         * @brief Get the coefficients of a matrix stored row by row, only copies the matrix if it is stored column by column
+         */
+        template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+        decltype(auto) as_row_major(const Matrix<coordinate, rows, cols, order>& mat)
+        {
+            if constexpr (order == StorageOrder::RowMajor)
+            {
+                return (mat);
+            }
+            else
+            {
+                return Matrix<coordinate, rows, cols, StorageOrder::RowMajor>(mat);
+            }
+        }
+
+        /*!
+         * @brief Get the coefficients of a matrix stored column by column, only copies the matrix if it is stored row by row
+         */
+        template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order>
+        decltype(auto) as_column_major(const Matrix<coordinate, rows, cols, order>& mat)
+        {
+            if constexpr (order == StorageOrder::ColumnMajor)
+            {
+                return (mat);
+            }
+            else
+            {
+                return Matrix<coordinate, rows, cols, StorageOrder::ColumnMajor>(mat);
+            }
+        }
+
+        template <Coordinate coordinate, unsigned int lhs_rows, unsigned int lhs_cols, unsigned int rhs_rows, unsigned int rhs_cols, StorageOrder order>
+        void process_rows(size_t                                         thread_index,
+                          int                                            count,
+                          const coordinate*                              lhs_row_major,
+                          const coordinate*                              rhs_column_major,
+                          Matrix<coordinate, lhs_rows, rhs_cols, order>& result)
         {
             const auto row_end = thread_index + count;
             for (size_t i = thread_index; i < row_end; ++i)
             {
-                // Note, because rhs is transposed, rhs_cols is "rhs_transposed row count"
-                // and rhs_rows is "rhs_transposed col count"
+                // Note, the rows of lhs and the columns of rhs are contiguous in memory
                 for (size_t j = 0; j < rhs_cols; j++)
                 {
-                    result(i, j)
-                    = dot_product_concurrently(std::span(lhs.data() + i * lhs_cols, lhs.data() + (i + 1) * lhs_cols),
-                                               std::span(rhs_transposed.data() + j * rhs_rows, rhs_transposed.data() + (j + 1) * rhs_rows));
+                    result(i, j) = dot_product_concurrently(std::span(lhs_row_major + i * lhs_cols, lhs_cols),
+                                                            std::span(rhs_column_major + j * rhs_rows, rhs_rows));
                 }
             }
         }
@@ -67,13 +100,11 @@ namespace LCNS::Algebra
 #endif
         }
 
-        template <Coordinate coordinate, unsigned int lhs_rows, unsigned int lhs_cols, unsigned int rhs_tr_rows, unsigned int rhs_tr_cols>
-        coordinate dot_product_simd(const Matrix<coordinate, lhs_rows, lhs_cols>&       lhs,
-                                    const Matrix<coordinate, rhs_tr_rows, rhs_tr_cols>& rhs_transposed,
-                                    std::div_t                                          division,
-                                    int                                                 dppi,
-                                    unsigned int                                        i,
-                                    unsigned int                                        j)
+        template <Coordinate coordinate>
+        coordinate dot_product_simd(const coordinate* lhs_row,
+                                    const coordinate* rhs_col,
+                                    std::div_t        division,
+                                    int               dppi)
         {
             coordinate dot_product{};
 
@@ -82,12 +113,12 @@ namespace LCNS::Algebra
                 if constexpr (std::is_same_v<coordinate, double>)
                 {
 #if defined(AVX512_ENABLED)
-                    __m512d lhs_chunk       = _mm512_loadu_pd(lhs.data() + i * lhs_cols + dppi * k);
-                    __m512d rhs_chunk       = _mm512_loadu_pd(rhs_transposed.data() + j * rhs_tr_cols + dppi * k);
+                    __m512d lhs_chunk       = _mm512_loadu_pd(lhs_row + dppi * k);
+                    __m512d rhs_chunk       = _mm512_loadu_pd(rhs_col + dppi * k);
                     __m512d multiplications = _mm512_mul_pd(lhs_chunk, rhs_chunk);
 #elif defined(AVX2_ENABLED)
-                    __m256d lhs_chunk       = _mm256_loadu_pd(lhs.data() + i * lhs_cols + dppi * k);
-                    __m256d rhs_chunk       = _mm256_loadu_pd(rhs_transposed.data() + j * rhs_tr_cols + dppi * k);
+                    __m256d lhs_chunk       = _mm256_loadu_pd(lhs_row + dppi * k);
+                    __m256d rhs_chunk       = _mm256_loadu_pd(rhs_col + dppi * k);
                     __m256d multiplications = _mm256_mul_pd(lhs_chunk, rhs_chunk);
 #endif
                     auto* tmp = reinterpret_cast<double*>(&multiplications);
@@ -96,12 +127,12 @@ namespace LCNS::Algebra
                 else if constexpr (std::is_same_v<coordinate, float>)
                 {
 #if defined(AVX512_ENABLED)
-                    __m512 lhs_chunk       = _mm512_loadu_ps(lhs.data() + i * lhs_cols + dppi * k);
-                    __m512 rhs_chunk       = _mm512_loadu_ps(rhs_transposed.data() + j * rhs_tr_cols + dppi * k);
+                    __m512 lhs_chunk       = _mm512_loadu_ps(lhs_row + dppi * k);
+                    __m512 rhs_chunk       = _mm512_loadu_ps(rhs_col + dppi * k);
                     __m512 multiplications = _mm512_mul_ps(lhs_chunk, rhs_chunk);
 #elif defined(AVX2_ENABLED)
-                    __m256 lhs_chunk       = _mm256_loadu_ps(lhs.data() + i * lhs_cols + dppi * k);
-                    __m256 rhs_chunk       = _mm256_loadu_ps(rhs_transposed.data() + j * rhs_tr_cols + dppi * k);
+                    __m256 lhs_chunk       = _mm256_loadu_ps(lhs_row + dppi * k);
+                    __m256 rhs_chunk       = _mm256_loadu_ps(rhs_col + dppi * k);
                     __m256 multiplications = _mm256_mul_ps(lhs_chunk, rhs_chunk);
 #endif
                     auto* tmp = reinterpret_cast<float*>(&multiplications);
@@ -110,15 +141,15 @@ namespace LCNS::Algebra
                 else if constexpr (std::is_same_v<std::make_signed_t<coordinate>, int64_t>)
                 {
 #if defined(AVX512_ENABLED)
-                    __m512i lhs_chunk       = _mm512_loadu_epi64(lhs.data() + i * lhs_cols + dppi * k);
-                    __m512i rhs_chunk       = _mm512_loadu_epi64(rhs_transposed.data() + j * rhs_tr_cols + dppi * k);
+                    __m512i lhs_chunk       = _mm512_loadu_epi64(lhs_row + dppi * k);
+                    __m512i rhs_chunk       = _mm512_loadu_epi64(rhs_col + dppi * k);
                     __m512i multiplications = _mm512_mullo_epi64(lhs_chunk, rhs_chunk);
 
                     int64_t tmp[8] = {};
                     _mm512_storeu_epi64(tmp, multiplications);
 #elif defined(AVX2_ENABLED)
-                    __m256i lhs_chunk       = _mm256_loadu_epi64(lhs.data() + i * lhs_cols + dppi * k);
-                    __m256i rhs_chunk       = _mm256_loadu_epi64(rhs_transposed.data() + j * rhs_tr_cols + dppi * k);
+                    __m256i lhs_chunk       = _mm256_loadu_epi64(lhs_row + dppi * k);
+                    __m256i rhs_chunk       = _mm256_loadu_epi64(rhs_col + dppi * k);
                     __m256i multiplications = _mm256_mullo_epi64(lhs_chunk, rhs_chunk);
 
                     int64_t tmp[4] = {};
@@ -129,15 +160,15 @@ namespace LCNS::Algebra
                 else if constexpr (std::is_same_v<std::make_signed_t<coordinate>, int32_t>)
                 {
 #if defined(AVX512_ENABLED)
-                    __m512i lhs_chunk       = _mm512_loadu_epi32(lhs.data() + i * lhs_cols + dppi * k);
-                    __m512i rhs_chunk       = _mm512_loadu_epi32(rhs_transposed.data() + j * rhs_tr_cols + dppi * k);
+                    __m512i lhs_chunk       = _mm512_loadu_epi32(lhs_row + dppi * k);
+                    __m512i rhs_chunk       = _mm512_loadu_epi32(rhs_col + dppi * k);
                     __m512i multiplications = _mm512_mullo_epi32(lhs_chunk, rhs_chunk);
 
                     int32_t tmp[16] = {};
                     _mm512_storeu_epi32(tmp, multiplications);
 #elif defined(AVX2_ENABLED)
-                    __m256i lhs_chunk       = _mm256_loadu_epi32(lhs.data() + i * lhs_cols + dppi * k);
-                    __m256i rhs_chunk       = _mm256_loadu_epi32(rhs_transposed.data() + j * rhs_tr_cols + dppi * k);
+                    __m256i lhs_chunk       = _mm256_loadu_epi32(lhs_row + dppi * k);
+                    __m256i rhs_chunk       = _mm256_loadu_epi32(rhs_col + dppi * k);
                     __m256i multiplications = _mm256_mullo_epi32(lhs_chunk, rhs_chunk);
 
                     int32_t tmp[8] = {};
@@ -148,15 +179,15 @@ namespace LCNS::Algebra
                 else if constexpr (std::is_same_v<std::make_signed_t<coordinate>, int16_t>)
                 {
 #if defined(AVX512_ENABLED)
-                    __m512i lhs_chunk       = _mm512_loadu_epi16(lhs.data() + i * lhs_cols + dppi * k);
-                    __m512i rhs_chunk       = _mm512_loadu_epi16(rhs_transposed.data() + j * rhs_tr_cols + dppi * k);
+                    __m512i lhs_chunk       = _mm512_loadu_epi16(lhs_row + dppi * k);
+                    __m512i rhs_chunk       = _mm512_loadu_epi16(rhs_col + dppi * k);
                     __m512i multiplications = _mm512_mullo_epi16(lhs_chunk, rhs_chunk);
 
                     int16_t tmp[32] = {};
                     _mm512_storeu_epi16(tmp, multiplications);
 #elif defined(AVX2_ENABLED)
-                    __m256i lhs_chunk       = _mm256_loadu_epi16(lhs.data() + i * lhs_cols + dppi * k);
-                    __m256i rhs_chunk       = _mm256_loadu_epi16(rhs_transposed.data() + j * rhs_tr_cols + dppi * k);
+                    __m256i lhs_chunk       = _mm256_loadu_epi16(lhs_row + dppi * k);
+                    __m256i rhs_chunk       = _mm256_loadu_epi16(rhs_col + dppi * k);
                     __m256i multiplications = _mm256_mullo_epi16(lhs_chunk, rhs_chunk);
 
                     int16_t tmp[16] = {};
@@ -174,23 +205,21 @@ namespace LCNS::Algebra
         }
 
 
-        template <Coordinate coordinate, unsigned int lhs_rows, unsigned int lhs_cols, unsigned int rhs_tr_rows, unsigned int rhs_tr_cols>
-        coordinate dot_product_simd_last_chunk(const Matrix<coordinate, lhs_rows, lhs_cols>&       lhs,
-                                               const Matrix<coordinate, rhs_tr_rows, rhs_tr_cols>& rhs_transposed,
-                                               std::div_t                                          division,
-                                               int                                                 dppi,
-                                               unsigned int                                        i,
-                                               unsigned int                                        j)
+        template <Coordinate coordinate>
+        coordinate dot_product_simd_last_chunk(const coordinate* lhs_row,
+                                               const coordinate* rhs_col,
+                                               std::div_t        division,
+                                               int               dppi)
         {
             if constexpr (std::is_same_v<coordinate, double>)
             {
 #if defined(AVX512_ENABLED)
-                __m512d lhs_chunk       = _mm512_loadu_pd(lhs.data() + i * lhs_cols + dppi * division.quot);
-                __m512d rhs_chunk       = _mm512_loadu_pd(rhs_transposed.data() + j * rhs_tr_cols + dppi * division.quot);
+                __m512d lhs_chunk       = _mm512_loadu_pd(lhs_row + dppi * division.quot);
+                __m512d rhs_chunk       = _mm512_loadu_pd(rhs_col + dppi * division.quot);
                 __m512d multiplications = _mm512_mul_pd(lhs_chunk, rhs_chunk);
 #elif defined(AVX2_ENABLED)
-                __m256d lhs_chunk       = _mm256_loadu_pd(lhs.data() + i * lhs_cols + dppi * division.quot);
-                __m256d rhs_chunk       = _mm256_loadu_pd(rhs_transposed.data() + j * rhs_tr_cols + dppi * division.quot);
+                __m256d lhs_chunk       = _mm256_loadu_pd(lhs_row + dppi * division.quot);
+                __m256d rhs_chunk       = _mm256_loadu_pd(rhs_col + dppi * division.quot);
                 __m256d multiplications = _mm256_mul_pd(lhs_chunk, rhs_chunk);
 #endif
                 auto* tmp = reinterpret_cast<double*>(&multiplications);
@@ -199,12 +228,12 @@ namespace LCNS::Algebra
             else if constexpr (std::is_same_v<coordinate, float>)
             {
 #if defined(AVX512_ENABLED)
-                __m512 lhs_chunk       = _mm512_loadu_ps(lhs.data() + i * lhs_cols + dppi * division.quot);
-                __m512 rhs_chunk       = _mm512_loadu_ps(rhs_transposed.data() + j * rhs_tr_cols + dppi * division.quot);
+                __m512 lhs_chunk       = _mm512_loadu_ps(lhs_row + dppi * division.quot);
+                __m512 rhs_chunk       = _mm512_loadu_ps(rhs_col + dppi * division.quot);
                 __m512 multiplications = _mm512_mul_ps(lhs_chunk, rhs_chunk);
 #elif defined(AVX2_ENABLED)
-                __m256 lhs_chunk       = _mm256_loadu_ps(lhs.data() + i * lhs_cols + dppi * division.quot);
-                __m256 rhs_chunk       = _mm256_loadu_ps(rhs_transposed.data() + j * rhs_tr_cols + dppi * division.quot);
+                __m256 lhs_chunk       = _mm256_loadu_ps(lhs_row + dppi * division.quot);
+                __m256 rhs_chunk       = _mm256_loadu_ps(rhs_col + dppi * division.quot);
                 __m256 multiplications = _mm256_mul_ps(lhs_chunk, rhs_chunk);
 #endif
                 auto* tmp = reinterpret_cast<float*>(&multiplications);
@@ -213,15 +242,15 @@ namespace LCNS::Algebra
             else if constexpr (std::is_same_v<std::make_signed_t<coordinate>, int64_t>)
             {
 #if defined(AVX512_ENABLED)
-                __m512i lhs_chunk       = _mm512_loadu_epi64(lhs.data() + i * lhs_cols + dppi * division.quot);
-                __m512i rhs_chunk       = _mm512_loadu_epi64(rhs_transposed.data() + j * rhs_tr_cols + dppi * division.quot);
+                __m512i lhs_chunk       = _mm512_loadu_epi64(lhs_row + dppi * division.quot);
+                __m512i rhs_chunk       = _mm512_loadu_epi64(rhs_col + dppi * division.quot);
                 __m512i multiplications = _mm512_mullo_epi64(lhs_chunk, rhs_chunk);
 
                 int64_t tmp[8] = {};
                 _mm512_storeu_epi64(tmp, multiplications);
 #elif defined(AVX2_ENABLED)
-                __m256i lhs_chunk       = _mm256_loadu_epi64(lhs.data() + i * lhs_cols + dppi * division.quot);
-                __m256i rhs_chunk       = _mm256_loadu_epi64(rhs_transposed.data() + j * rhs_tr_cols + dppi * division.quot);
+                __m256i lhs_chunk       = _mm256_loadu_epi64(lhs_row + dppi * division.quot);
+                __m256i rhs_chunk       = _mm256_loadu_epi64(rhs_col + dppi * division.quot);
                 __m256i multiplications = _mm256_mullo_epi64(lhs_chunk, rhs_chunk);
 
                 int64_t tmp[4] = {};
@@ -233,15 +262,15 @@ namespace LCNS::Algebra
             else if constexpr (std::is_same_v<std::make_signed_t<coordinate>, int32_t>)
             {
 #if defined(AVX512_ENABLED)
-                __m512i lhs_chunk       = _mm512_loadu_epi32(lhs.data() + i * lhs_cols + dppi * division.quot);
-                __m512i rhs_chunk       = _mm512_loadu_epi32(rhs_transposed.data() + j * rhs_tr_cols + dppi * division.quot);
+                __m512i lhs_chunk       = _mm512_loadu_epi32(lhs_row + dppi * division.quot);
+                __m512i rhs_chunk       = _mm512_loadu_epi32(rhs_col + dppi * division.quot);
                 __m512i multiplications = _mm512_mullo_epi32(lhs_chunk, rhs_chunk);
 
                 int32_t tmp[16] = {};
                 _mm512_storeu_epi32(tmp, multiplications);
 #elif defined(AVX2_ENABLED)
-                __m256i lhs_chunk       = _mm256_loadu_epi32(lhs.data() + i * lhs_cols + dppi * division.quot);
-                __m256i rhs_chunk       = _mm256_loadu_epi32(rhs_transposed.data() + j * rhs_tr_cols + dppi * division.quot);
+                __m256i lhs_chunk       = _mm256_loadu_epi32(lhs_row + dppi * division.quot);
+                __m256i rhs_chunk       = _mm256_loadu_epi32(rhs_col + dppi * division.quot);
                 __m256i multiplications = _mm256_mullo_epi32(lhs_chunk, rhs_chunk);
 
                 int32_t tmp[8] = {};
@@ -253,15 +282,15 @@ namespace LCNS::Algebra
             else if constexpr (std::is_same_v<std::make_signed_t<coordinate>, int16_t>)
             {
 #if defined(AVX512_ENABLED)
-                __m512i lhs_chunk       = _mm512_loadu_epi16(lhs.data() + i * lhs_cols + dppi * division.quot);
-                __m512i rhs_chunk       = _mm512_loadu_epi16(rhs_transposed.data() + j * rhs_tr_cols + dppi * division.quot);
+                __m512i lhs_chunk       = _mm512_loadu_epi16(lhs_row + dppi * division.quot);
+                __m512i rhs_chunk       = _mm512_loadu_epi16(rhs_col + dppi * division.quot);
                 __m512i multiplications = _mm512_mullo_epi16(lhs_chunk, rhs_chunk);
 
                 int16_t tmp[32] = {};
                 _mm512_storeu_epi32(tmp, multiplications);
 #elif defined(AVX2_ENABLED)
-                __m256i lhs_chunk       = _mm256_loadu_epi16(lhs.data() + i * lhs_cols + dppi * division.quot);
-                __m256i rhs_chunk       = _mm256_loadu_epi16(rhs_transposed.data() + j * rhs_tr_cols + dppi * division.quot);
+                __m256i lhs_chunk       = _mm256_loadu_epi16(lhs_row + dppi * division.quot);
+                __m256i rhs_chunk       = _mm256_loadu_epi16(rhs_col + dppi * division.quot);
                 __m256i multiplications = _mm256_mullo_epi16(lhs_chunk, rhs_chunk);
 
                 int16_t tmp[16] = {};
@@ -278,12 +307,12 @@ namespace LCNS::Algebra
         }
 
 
-        template <Coordinate coordinate, unsigned int lhs_rows, unsigned int lhs_cols, unsigned int rhs_rows, unsigned int rhs_cols>
-        void process_rows_simd(size_t                                        thread_index,
-                               int                                           count,
-                               const Matrix<coordinate, lhs_rows, lhs_cols>& lhs,
-                               const Matrix<coordinate, rhs_cols, rhs_rows>& rhs_transposed,
-                               Matrix<coordinate, lhs_rows, rhs_cols>&       result)
+        template <Coordinate coordinate, unsigned int lhs_rows, unsigned int lhs_cols, unsigned int rhs_rows, unsigned int rhs_cols, StorageOrder order>
+        void process_rows_simd(size_t                                         thread_index,
+                               int                                            count,
+                               const coordinate*                              lhs_row_major,
+                               const coordinate*                              rhs_column_major,
+                               Matrix<coordinate, lhs_rows, rhs_cols, order>& result)
         {
             const auto dppi     = ImplementationDetails::data_points_per_instruction<coordinate>();
             const auto division = std::div(lhs_cols, dppi);
@@ -291,15 +320,14 @@ namespace LCNS::Algebra
 
             for (size_t i = thread_index; i < row_end; ++i)
             {
-                // Note, because rhs is transposed, rhs_cols is "rhs_transposed row count"
-                // and rhs_rows is "rhs_transposed col count"
+                // Note, the rows of lhs and the columns of rhs are contiguous in memory
                 for (size_t j = 0; j < rhs_cols; j++)
                 {
-                    coordinate dot_product = ImplementationDetails::dot_product_simd(lhs, rhs_transposed, division, dppi, i, j);
+                    coordinate dot_product = ImplementationDetails::dot_product_simd(lhs_row_major + i * lhs_cols, rhs_column_major + j * rhs_rows, division, dppi);
 
                     if (division.rem != 0)
                     {
-                        dot_product += ImplementationDetails::dot_product_simd_last_chunk(lhs, rhs_transposed, division, dppi, i, j);
+                        dot_product += ImplementationDetails::dot_product_simd_last_chunk(lhs_row_major + i * lhs_cols, rhs_column_major + j * rhs_rows, division, dppi);
                     }
 
                     result(i, j) = dot_product;
@@ -307,28 +335,127 @@ namespace LCNS::Algebra
             }
         }
 #endif
+
+        /*!
+         * @brief Dot products of the rows of lhs and the columns of rhs for the rows [row_begin, row_end) of result, the
+         *        coefficients of each row of lhs and of each column of rhs being contiguous, ld coefficients apart
+         */
+        template <Coordinate coordinate, bool simd>
+        void process_view_rows(size_t                 row_begin,
+                               size_t                 row_end,
+                               const coordinate*      lhs_rows,
+                               size_t                 lhs_ld,
+                               const coordinate*      rhs_cols,
+                               size_t                 rhs_ld,
+                               size_t                 depth,
+                               MatrixView<coordinate> result)
+        {
+            for (size_t i = row_begin; i < row_end; ++i)
+            {
+                for (size_t j = 0; j < result.cols(); ++j)
+                {
+                    if constexpr (simd)
+                    {
+#ifdef AVX_ENABLED_ON_CPU
+                        const auto dppi     = data_points_per_instruction<coordinate>();
+                        const auto division = std::div(static_cast<int>(depth), dppi);
+
+                        coordinate dot_product = dot_product_simd(lhs_rows + i * lhs_ld, rhs_cols + j * rhs_ld, division, dppi);
+
+                        if (division.rem != 0)
+                        {
+                            dot_product += dot_product_simd_last_chunk(lhs_rows + i * lhs_ld, rhs_cols + j * rhs_ld, division, dppi);
+                        }
+
+                        result(i, j) = dot_product;
+#endif
+                    }
+                    else
+                    {
+                        result(i, j) = dot_product_concurrently(std::span(lhs_rows + i * lhs_ld, depth), std::span(rhs_cols + j * rhs_ld, depth));
+                    }
+                }
+            }
+        }
+
+        /*!
+         * @brief result = lhs * rhs with the dot products of process_view_rows, the rows of result being split between
+         *        threads if concurrently. The rows of lhs and the columns of rhs are only copied when not contiguous.
+         * @throw std::invalid_argument if the dimensions of the views do not match the dimensions of the multiplication
+         */
+        template <Coordinate coordinate, bool simd>
+        void multiply_views(MatrixView<const coordinate> lhs, MatrixView<const coordinate> rhs, MatrixView<coordinate> result, bool concurrently)
+        {
+            if (lhs.cols() != rhs.rows() || result.rows() != lhs.rows() || result.cols() != rhs.cols())
+            {
+                throw std::invalid_argument("The dimensions of the operands and of the result do not match the dimensions of the multiplication");
+            }
+
+            // The columns of rhs are the rows of its transpose
+            RowMajorCoefficients lhs_by_rows(lhs);
+            RowMajorCoefficients rhs_by_cols(rhs.transposed());
+
+            const coordinate* lhs_rows = lhs_by_rows.data();
+            const coordinate* rhs_cols = rhs_by_cols.data();
+            const size_t      lhs_ld   = lhs_by_rows.ld();
+            const size_t      rhs_ld   = rhs_by_cols.ld();
+
+            if (!concurrently)
+            {
+                process_view_rows<coordinate, simd>(0, result.rows(), lhs_rows, lhs_ld, rhs_cols, rhs_ld, lhs.cols(), result);
+                return;
+            }
+
+            const size_t thread_count    = std::clamp<size_t>(std::thread::hardware_concurrency(), 1, std::max<size_t>(result.rows(), 1));
+            const size_t rows_per_thread = (result.rows() + thread_count - 1) / thread_count;
+
+            std::vector<std::thread> row_threads;
+            row_threads.reserve(thread_count);
+
+            for (size_t row_begin = 0; row_begin < result.rows(); row_begin += rows_per_thread)
+            {
+                row_threads.emplace_back(process_view_rows<coordinate, simd>,
+                                         row_begin,
+                                         std::min(row_begin + rows_per_thread, result.rows()),
+                                         lhs_rows,
+                                         lhs_ld,
+                                         rhs_cols,
+                                         rhs_ld,
+                                         lhs.cols(),
+                                         result);
+            }
+
+            for (auto& thread : row_threads)
+            {
+                thread.join();
+            }
+        }
     }  // namespace ImplementationDetails
 
 #ifdef AVX_ENABLED_ON_CPU
-    template <Coordinate coordinate, unsigned int lhs_rows, unsigned int lhs_cols, unsigned int rhs_rows, unsigned int rhs_cols>
-    Matrix<coordinate, lhs_rows, rhs_cols> multiply_simd(const Matrix<coordinate, lhs_rows, lhs_cols>& lhs,
-                                                         const Matrix<coordinate, rhs_rows, rhs_cols>& rhs)
+    template <Coordinate coordinate, unsigned int lhs_rows, unsigned int lhs_cols, unsigned int rhs_rows, unsigned int rhs_cols, StorageOrder order>
+    Matrix<coordinate, lhs_rows, rhs_cols, order> multiply_simd(const Matrix<coordinate, lhs_rows, lhs_cols, order>& lhs,
+                                                                const Matrix<coordinate, rhs_rows, rhs_cols, order>& rhs)
     {
-        const auto rhs_transposed = rhs.transposed();
+        // The kernels read the rows of lhs and the columns of rhs, only the operand stored in the other order is copied
+        const auto&       lhs_by_rows      = ImplementationDetails::as_row_major(lhs);
+        const auto&       rhs_by_cols      = ImplementationDetails::as_column_major(rhs);
+        const coordinate* lhs_row_major    = lhs_by_rows.data();
+        const coordinate* rhs_column_major = rhs_by_cols.data();
 
         const auto dppi     = ImplementationDetails::data_points_per_instruction<coordinate>();
         const auto division = std::div(lhs_cols, dppi);
 
-        Matrix<coordinate, lhs_rows, rhs_cols> result;
+        Matrix<coordinate, lhs_rows, rhs_cols, order> result;
         for (unsigned int i = 0; i < lhs_rows; ++i)
         {
             for (unsigned int j = 0; j < rhs_cols; ++j)
             {
-                coordinate dot_product = ImplementationDetails::dot_product_simd(lhs, rhs_transposed, division, dppi, i, j);
+                coordinate dot_product = ImplementationDetails::dot_product_simd(lhs_row_major + i * lhs_cols, rhs_column_major + j * rhs_rows, division, dppi);
 
                 if (division.rem != 0)
                 {
-                    dot_product += ImplementationDetails::dot_product_simd_last_chunk(lhs, rhs_transposed, division, dppi, i, j);
+                    dot_product += ImplementationDetails::dot_product_simd_last_chunk(lhs_row_major + i * lhs_cols, rhs_column_major + j * rhs_rows, division, dppi);
                 }
 
                 result(i, j) = dot_product;
@@ -339,28 +466,33 @@ namespace LCNS::Algebra
     }
 
 
-    template <Coordinate coordinate, unsigned int lhs_rows, unsigned int lhs_cols, unsigned int rhs_rows, unsigned int rhs_cols>
-    Matrix<coordinate, lhs_rows, rhs_cols> multiply_concurrently_simd(const Matrix<coordinate, lhs_rows, lhs_cols>& lhs,
-                                                                      const Matrix<coordinate, rhs_rows, rhs_cols>& rhs)
+    template <Coordinate coordinate, unsigned int lhs_rows, unsigned int lhs_cols, unsigned int rhs_rows, unsigned int rhs_cols, StorageOrder order>
+    Matrix<coordinate, lhs_rows, rhs_cols, order> multiply_concurrently_simd(const Matrix<coordinate, lhs_rows, lhs_cols, order>& lhs,
+                                                                             const Matrix<coordinate, rhs_rows, rhs_cols, order>& rhs)
     {
-        const auto rhs_transposed = rhs.transposed();
-        const auto thread_count   = std::thread::hardware_concurrency();
-        const auto repartition    = std::div(static_cast<int>(lhs_rows), static_cast<int>(thread_count));
+        // The kernels read the rows of lhs and the columns of rhs, only the operand stored in the other order is copied
+        const auto&       lhs_by_rows      = ImplementationDetails::as_row_major(lhs);
+        const auto&       rhs_by_cols      = ImplementationDetails::as_column_major(rhs);
+        const coordinate* lhs_row_major    = lhs_by_rows.data();
+        const coordinate* rhs_column_major = rhs_by_cols.data();
+
+        const auto thread_count = std::thread::hardware_concurrency();
+        const auto repartition  = std::div(static_cast<int>(lhs_rows), static_cast<int>(thread_count));
 
         const size_t real_thread_count    = lhs_rows < thread_count ? lhs_rows : thread_count;
         const auto   row_per_thread_count = repartition.quot == 0 ? 1u : static_cast<size_t>(repartition.quot);
 
         std::vector<std::thread> row_threads;
         row_threads.reserve(real_thread_count);
-        Matrix<coordinate, lhs_rows, rhs_cols> result;
+        Matrix<coordinate, lhs_rows, rhs_cols, order> result;
 
         for (size_t i = 0; i < real_thread_count; ++i)
         {
-            row_threads.emplace_back(ImplementationDetails::process_rows_simd<coordinate, lhs_rows, lhs_cols, rhs_rows, rhs_cols>,
+            row_threads.emplace_back(ImplementationDetails::process_rows_simd<coordinate, lhs_rows, lhs_cols, rhs_rows, rhs_cols, order>,
                                      i * row_per_thread_count,
                                      row_per_thread_count,
-                                     std::ref(lhs),
-                                     std::ref(rhs_transposed),
+                                     lhs_row_major,
+                                     rhs_column_major,
                                      std::ref(result));
         }
 
@@ -368,11 +500,11 @@ namespace LCNS::Algebra
         {
             for (size_t i = 0; i < static_cast<size_t>(repartition.rem); ++i)
             {
-                row_threads.emplace_back(ImplementationDetails::process_rows_simd<coordinate, lhs_rows, lhs_cols, rhs_rows, rhs_cols>,
+                row_threads.emplace_back(ImplementationDetails::process_rows_simd<coordinate, lhs_rows, lhs_cols, rhs_rows, rhs_cols, order>,
                                          row_per_thread_count * real_thread_count + i,
                                          1,
-                                         std::ref(lhs),
-                                         std::ref(rhs_transposed),
+                                         lhs_row_major,
+                                         rhs_column_major,
                                          std::ref(result));
             }
         }
@@ -384,30 +516,63 @@ namespace LCNS::Algebra
 
         return result;
     }
+
+    /*!
+     * \brief Multiply two matrices held by views with the SIMD dot products of multiply_simd above: the rows of lhs and
+     *        the columns of rhs are only copied when their coefficients are not contiguous
+     * @param result receives the product, and must overlap neither lhs nor rhs
+     * @throw std::invalid_argument if the dimensions of the views do not match the dimensions of the multiplication
+     */
+    template <Coordinate coordinate>
+    void multiply_simd(std::type_identity_t<MatrixView<const coordinate>> lhs,
+                       std::type_identity_t<MatrixView<const coordinate>> rhs,
+                       MatrixView<coordinate>                            result)
+    {
+        ImplementationDetails::multiply_views<coordinate, true>(lhs, rhs, result, false);
+    }
+
+    /*!
+     * \brief Multiply two matrices held by views like multiply_simd above, the rows of the result being split between
+     *        threads
+     * @param result receives the product, and must overlap neither lhs nor rhs
+     * @throw std::invalid_argument if the dimensions of the views do not match the dimensions of the multiplication
+     */
+    template <Coordinate coordinate>
+    void multiply_concurrently_simd(std::type_identity_t<MatrixView<const coordinate>> lhs,
+                                    std::type_identity_t<MatrixView<const coordinate>> rhs,
+                                    MatrixView<coordinate>                            result)
+    {
+        ImplementationDetails::multiply_views<coordinate, true>(lhs, rhs, result, true);
+    }
 #endif
 
-    template <Coordinate coordinate, unsigned int lhs_rows, unsigned int lhs_cols, unsigned int rhs_rows, unsigned int rhs_cols>
-    Matrix<coordinate, lhs_rows, rhs_cols> multiply_concurrently(const Matrix<coordinate, lhs_rows, lhs_cols>& lhs,
-                                                                 const Matrix<coordinate, rhs_rows, rhs_cols>& rhs)
+    template <Coordinate coordinate, unsigned int lhs_rows, unsigned int lhs_cols, unsigned int rhs_rows, unsigned int rhs_cols, StorageOrder order>
+    Matrix<coordinate, lhs_rows, rhs_cols, order> multiply_concurrently(const Matrix<coordinate, lhs_rows, lhs_cols, order>& lhs,
+                                                                        const Matrix<coordinate, rhs_rows, rhs_cols, order>& rhs)
     {
-        const auto rhs_transposed = rhs.transposed();
-        const auto thread_count   = std::thread::hardware_concurrency();
-        const auto repartition    = std::div(static_cast<int>(lhs_rows), static_cast<int>(thread_count));
+        // The kernels read the rows of lhs and the columns of rhs, only the operand stored in the other order is copied
+        const auto&       lhs_by_rows      = ImplementationDetails::as_row_major(lhs);
+        const auto&       rhs_by_cols      = ImplementationDetails::as_column_major(rhs);
+        const coordinate* lhs_row_major    = lhs_by_rows.data();
+        const coordinate* rhs_column_major = rhs_by_cols.data();
+
+        const auto thread_count = std::thread::hardware_concurrency();
+        const auto repartition  = std::div(static_cast<int>(lhs_rows), static_cast<int>(thread_count));
 
         const size_t real_thread_count    = lhs_rows < thread_count ? lhs_rows : thread_count;
         const auto   row_per_thread_count = repartition.quot == 0 ? 1u : static_cast<size_t>(repartition.quot);
 
         std::vector<std::thread> row_threads;
         row_threads.reserve(real_thread_count);
-        Matrix<coordinate, lhs_rows, rhs_cols> result;
+        Matrix<coordinate, lhs_rows, rhs_cols, order> result;
 
         for (size_t i = 0; i < real_thread_count; ++i)
         {
-            row_threads.emplace_back(ImplementationDetails::process_rows<coordinate, lhs_rows, lhs_cols, rhs_rows, rhs_cols>,
+            row_threads.emplace_back(ImplementationDetails::process_rows<coordinate, lhs_rows, lhs_cols, rhs_rows, rhs_cols, order>,
                                      i * row_per_thread_count,
                                      row_per_thread_count,
-                                     std::ref(lhs),
-                                     std::ref(rhs_transposed),
+                                     lhs_row_major,
+                                     rhs_column_major,
                                      std::ref(result));
         }
 
@@ -415,11 +580,11 @@ namespace LCNS::Algebra
         {
             for (size_t i = 0; i < static_cast<size_t>(repartition.rem); ++i)
             {
-                row_threads.emplace_back(ImplementationDetails::process_rows<coordinate, lhs_rows, lhs_cols, rhs_rows, rhs_cols>,
+                row_threads.emplace_back(ImplementationDetails::process_rows<coordinate, lhs_rows, lhs_cols, rhs_rows, rhs_cols, order>,
                                          row_per_thread_count * real_thread_count + i,
                                          1,
-                                         std::ref(lhs),
-                                         std::ref(rhs_transposed),
+                                         lhs_row_major,
+                                         rhs_column_major,
                                          std::ref(result));
             }
         }
@@ -431,4 +596,84 @@ namespace LCNS::Algebra
 
         return result;
     }
+
+    /*!
+     * \brief Multiply two matrices held by views, the rows of the result being split between threads: the rows of lhs
+     *        and the columns of rhs are only copied when their coefficients are not contiguous
+     * @param result receives the product, and must overlap neither lhs nor rhs
+     * @throw std::invalid_argument if the dimensions of the views do not match the dimensions of the multiplication
+     */
+    template <Coordinate coordinate>
+    void multiply_concurrently(std::type_identity_t<MatrixView<const coordinate>> lhs,
+                               std::type_identity_t<MatrixView<const coordinate>> rhs,
+                               MatrixView<coordinate>                            result)
+    {
+        ImplementationDetails::multiply_views<coordinate, false>(lhs, rhs, result, true);
+    }
+
+    /*!
+     * \brief Multiply two matrices with the blocked kernel of the LU decomposition (see BlockedMultiplication.hpp): the
+     *        result is split in tiles distributed between threads, and the operands are read by cache-sized blocks
+     *        instead of whole rows and columns. Neither operand is copied, whatever the storage order.
+     */
+    template <Coordinate coordinate, unsigned int lhs_rows, unsigned int lhs_cols, unsigned int rhs_cols, StorageOrder order>
+    Matrix<coordinate, lhs_rows, rhs_cols, order> multiply_blocked(const Matrix<coordinate, lhs_rows, lhs_cols, order>& lhs,
+                                                                   const Matrix<coordinate, lhs_cols, rhs_cols, order>& rhs)
+    requires(std::is_floating_point_v<coordinate>)
+    {
+        Matrix<coordinate, lhs_rows, rhs_cols, order> result;
+
+        if constexpr (order == StorageOrder::RowMajor)
+        {
+            ImplementationDetails::multiply_add_blocked<coordinate>(lhs_rows, rhs_cols, lhs_cols, 1, lhs.data(), lhs_cols, rhs.data(), rhs_cols, result.data(), rhs_cols);
+        }
+        else
+        {
+            // Read row by row, the coefficients are those of the transposes: result^T = rhs^T * lhs^T
+            ImplementationDetails::multiply_add_blocked<coordinate>(rhs_cols, lhs_rows, lhs_cols, 1, rhs.data(), lhs_cols, lhs.data(), lhs_rows, result.data(), lhs_rows);
+        }
+
+        return result;
+    }
+
+    /*!
+     * \brief Multiply two matrices stored row by row whose sizes are only known at run time, see multiply_blocked above
+     * @param lhs holds the rows x depth left operand
+     * @param rhs holds the depth x cols right operand
+     * @param result receives the rows x cols product
+     * @throw std::invalid_argument if the sizes of the spans do not match the dimensions
+     */
+    template <Coordinate coordinate>
+    void multiply_blocked(size_t                      rows,
+                          size_t                      depth,
+                          size_t                      cols,
+                          std::span<const coordinate> lhs,
+                          std::span<const coordinate> rhs,
+                          std::span<coordinate>       result)
+    requires(std::is_floating_point_v<coordinate>)
+    {
+        if (lhs.size() != rows * depth || rhs.size() != depth * cols || result.size() != rows * cols)
+        {
+            throw std::invalid_argument("The sizes of the operands and of the result do not match the dimensions of the multiplication");
+        }
+
+        std::fill(result.begin(), result.end(), coordinate{0});
+
+        ImplementationDetails::multiply_add_blocked<coordinate>(rows, cols, depth, 1, lhs.data(), depth, rhs.data(), cols, result.data(), cols);
+    }
+
+    /*!
+     * \brief Multiply two matrices held by views, for instance blocks of larger matrices or external buffers, see gemm in
+     *        MatrixView.hpp: the views are only copied when neither their row stride nor their column stride is 1
+     * @param result receives the product, and must overlap neither lhs nor rhs
+     * @throw std::invalid_argument if the dimensions of the views do not match the dimensions of the multiplication
+     */
+    template <Coordinate coordinate>
+    void multiply_blocked(std::type_identity_t<MatrixView<const coordinate>> lhs,
+                          std::type_identity_t<MatrixView<const coordinate>> rhs,
+                          MatrixView<coordinate>                            result)
+    requires(std::is_floating_point_v<coordinate>)
+    {
+        gemm<coordinate>(1, lhs, rhs, 0, result);
+    }
 }  // namespace LCNS::Large
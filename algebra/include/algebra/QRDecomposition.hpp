@@ -0,0 +1,557 @@
+#pragma once
+
+#include "algebra/BlockedMultiplication.hpp"
+#include "algebra/Concurrency.hpp"
+#include "algebra/Internal.hpp"
+#include "algebra/LUDecomposition.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+/*
+ * Householder QR decomposition A = Q * R of m x n matrices (m >= n) stored row by row, and linear least squares
+ * solutions of A * x = b, which unlike the normal equations A^T * A * x = A^T * b do not square the condition number.
+ * As in LAPACK, R overwrites the upper triangle of A, and each reflector H_k = I - tau_k * v_k * v_k^T is stored below
+ * the diagonal, the first coefficient of v_k being an implied 1, so that Q = H_0 * H_1 * ... * H_(n-1).
+ *
+ * The columns are decomposed by panels of qr_block_size. The reflectors of a panel are accumulated in the compact WY
+ * form I - V * T * V^T, T being a small upper triangular matrix, and applied to the rest of the matrix with two blocked
+ * multiplications (the first one reading V transposed) instead of one rank-1 update per column.
+ *
+ * least_squares uses the tall skinny QR (TSQR) instead: the rows are split in blocks that fit in the cache, decomposed
+ * in parallel, each block applying its own Q^T to its rows of b. The R factors of the blocks, stacked with the first n
+ * rows of their Q^T * b, form a least squares problem of the same solution with far fewer rows, solved the same way
+ * until a single block remains. A is read once, by one thread per block.
+ */
+
+namespace LCNS::Algebra
+{
+    /*!
+     * \brief Householder QR decomposition A = Q * R of a matrix with at least as many rows as columns, whose size is
+     *        known at run time. The reflectors are applied by panels in the compact WY form, with blocked
+     *        multiplications split between threads.
+     * @param matrix holds the m x n matrix A row by row on input, and R on and above the diagonal, the reflectors
+     *        below, on output
+     * @param cols is the number of columns n of A
+     * @param tau receives the n scale factors of the reflectors
+     * @throw std::invalid_argument if A has more columns than rows or if the size of tau is not n
+     */
+    template <Coordinate coordinate>
+    void qr_factorize(std::span<coordinate> matrix, size_t cols, std::span<coordinate> tau) requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief Least squares solution X minimizing |A * X - B| for each column of B, from the decomposition of A by
+     *        qr_factorize
+     * @param qr and tau are the results of qr_factorize, the number of columns n of A being the size of tau
+     * @param rhs holds the m rows of B on input, row by row. On output, its first n rows hold X, the other rows hold
+     *        the components of Q^T * B orthogonal to the columns of A, whose norm is the residual.
+     * @param rhs_cols is the number of columns of B, one per system
+     * @return false if A does not have full column rank, one of the diagonal coefficients of R being not larger than
+     *         m * epsilon * max|diagonal|. X is then not computed.
+     * @throw std::invalid_argument if the sizes of qr and rhs do not match
+     */
+    template <Coordinate coordinate>
+    bool qr_solve(std::span<const coordinate> qr, std::span<const coordinate> tau, std::span<coordinate> rhs, size_t rhs_cols = 1)
+    requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief Least squares solution X minimizing |A * X - B| for each column of B, by tall skinny QR: the rows are
+     *        split in blocks decomposed in parallel, see the introduction of QRDecomposition.hpp. Meant for matrices
+     *        with many more rows than columns, such as overdetermined fits. When the blocks could not fit in the cache
+     *        (n above 128), or for fewer than two blocks, the whole matrix is decomposed by panels as by qr_factorize.
+     * @param matrix holds the m x n matrix A row by row, overwritten by the decompositions of its blocks
+     * @param cols is the number of columns n of A
+     * @param rhs holds the m rows of B on input, row by row, and X in its first n rows on output, the other rows being
+     *        overwritten
+     * @param rhs_cols is the number of columns of B, one per system
+     * @return false if A does not have full column rank, see qr_solve
+     * @throw std::invalid_argument if A has more columns than rows or if the sizes of matrix and rhs do not match
+     */
+    template <Coordinate coordinate>
+    bool least_squares(std::span<coordinate> matrix, size_t cols, std::span<coordinate> rhs, size_t rhs_cols = 1)
+    requires(std::is_floating_point_v<coordinate>);
+
+    namespace ImplementationDetails
+    {
+        // NOLINTBEGIN(readability-identifier-length)
+
+        /*!
+         * @brief Number of columns of the panels whose reflectors are applied at once
+         */
+        constexpr size_t qr_block_size = 32;
+
+        /*!
+         * @brief Number of coefficients of the blocks of rows decomposed by each thread in least_squares, which fit in
+         *        the L2 cache
+         */
+        constexpr size_t tsqr_block_size = size_t{1} << 16;
+
+        /*!
+         * @brief C = H * C for the m rows of C, H = I - tau * v * v^T being a reflector
+         * @param v points to v, v[i * ldv] being its coefficient i, except the first which is an implied 1
+         * @param w is a buffer of cols coefficients
+         */
+        template <Coordinate coordinate>
+        void qr_reflect(size_t m, const coordinate* v, size_t ldv, coordinate tau, coordinate* c, size_t ldc, size_t cols, coordinate* w)
+        {
+            if (tau == 0 || cols == 0)
+            {
+                return;
+            }
+
+            // w = v^T * C, then C -= tau * v * w, both row by row
+            std::copy(c, c + cols, w);
+
+            for (size_t i = 1; i < m; ++i)
+            {
+                const coordinate  factor = v[i * ldv];
+                const coordinate* row    = c + i * ldc;
+
+                for (size_t j = 0; j < cols; ++j)
+                {
+                    w[j] += factor * row[j];
+                }
+            }
+
+            for (size_t j = 0; j < cols; ++j)
+            {
+                c[j] -= tau * w[j];
+            }
+
+            for (size_t i = 1; i < m; ++i)
+            {
+                const coordinate factor = tau * v[i * ldv];
+                coordinate*      row    = c + i * ldc;
+
+                for (size_t j = 0; j < cols; ++j)
+                {
+                    row[j] -= factor * w[j];
+                }
+            }
+        }
+
+        /*!
+         * @brief Decomposition of a m x n block (m >= n) with one reflector applied at a time
+         * @param w is a buffer of n coefficients
+         */
+        template <Coordinate coordinate>
+        void qr_unblocked(coordinate* a, size_t lda, size_t m, size_t n, coordinate* tau, coordinate* w)
+        {
+            for (size_t k = 0; k < n; ++k)
+            {
+                coordinate* column = a + k * lda + k;
+
+                const coordinate alpha = column[0];
+                coordinate       sigma = 0;
+
+                for (size_t i = 1; i < m - k; ++i)
+                {
+                    sigma += column[i * lda] * column[i * lda];
+                }
+
+                // H * (alpha, x) = (beta, 0), beta having the opposite sign of alpha to avoid a cancellation
+                if (sigma == 0)
+                {
+                    tau[k] = 0;
+                    continue;
+                }
+
+                const coordinate beta  = -std::copysign(std::sqrt(alpha * alpha + sigma), alpha);
+                const coordinate scale = coordinate{1} / (alpha - beta);
+
+                tau[k] = (beta - alpha) / beta;
+
+                for (size_t i = 1; i < m - k; ++i)
+                {
+                    column[i * lda] *= scale;
+                }
+
+                column[0] = beta;
+
+                qr_reflect(m - k, column, lda, tau[k], column + 1, lda, n - k - 1, w);
+            }
+        }
+
+        /*!
+         * @brief C = Q^T * C for the m rows of C, Q = H_0 * ... * H_(b-1) = I - V * T * V^T being the product of the
+         *        reflectors of a panel. V is the unit lower trapezoidal m x b matrix stored below the diagonal of v, its
+         *        top b x b triangle V1 being applied coefficient by coefficient, and the m - b rows below, V2, in place by
+         *        multiply_add_blocked: W = T^T * (V1^T * C1 + V2^T * C2), then C1 -= V1 * W and C2 -= V2 * W.
+         *        C = Q * C if transpose is false, W being multiplied by T instead of T^T.
+         */
+        template <Coordinate coordinate, bool transpose = true>
+        void qr_apply_panel(size_t m, size_t b, const coordinate* v, size_t ldv, const coordinate* tau, size_t cols, coordinate* c, size_t ldc)
+        {
+            const auto v1 = [=](size_t i, size_t j) { return i == j ? coordinate{1} : (i > j ? v[i * ldv + j] : coordinate{0}); };
+
+            const coordinate* v2 = v + b * ldv;
+            coordinate*       c2 = c + b * ldc;
+
+            // T(j, j) = tau_j and T(:j, j) = -tau_j * T(:j, :j) * V(:, :j)^T * v_j, from the Gram matrix G = V^T * V
+            std::vector<coordinate> g(b * b);
+            std::vector<coordinate> t(b * b);
+
+            multiply_add_blocked<coordinate, true>(b, b, m - b, coordinate{1}, v2, ldv, v2, ldv, g.data(), b);
+
+            for (size_t i = 0; i < b; ++i)
+            {
+                for (size_t j = i + 1; j < b; ++j)
+                {
+                    for (size_t k = j; k < b; ++k)
+                    {
+                        g[i * b + j] += v1(k, i) * v1(k, j);
+                    }
+                }
+            }
+
+            for (size_t j = 0; j < b; ++j)
+            {
+                for (size_t i = 0; i < j; ++i)
+                {
+                    coordinate value = 0;
+
+                    for (size_t l = i; l < j; ++l)
+                    {
+                        value += t[i * b + l] * g[l * b + j];
+                    }
+
+                    t[i * b + j] = -tau[j] * value;
+                }
+
+                t[j * b + j] = tau[j];
+            }
+
+            // W = V^T * C
+            std::vector<coordinate> w(b * cols);
+
+            for (size_t i = 0; i < b; ++i)
+            {
+                for (size_t k = i; k < b; ++k)
+                {
+                    const coordinate  factor = v1(k, i);
+                    const coordinate* row    = c + k * ldc;
+
+                    for (size_t j = 0; j < cols; ++j)
+                    {
+                        w[i * cols + j] += factor * row[j];
+                    }
+                }
+            }
+
+            multiply_add_blocked<coordinate, true>(b, cols, m - b, coordinate{1}, v2, ldv, c2, ldc, w.data(), cols);
+
+            // W = T^T * W, from the last row since T^T is lower triangular, or W = T * W from the first row
+            if constexpr (transpose)
+            {
+                for (size_t i = b; i-- > 0;)
+                {
+                    for (size_t j = 0; j < cols; ++j)
+                    {
+                        w[i * cols + j] *= t[i * b + i];
+                    }
+
+                    for (size_t l = 0; l < i; ++l)
+                    {
+                        const coordinate factor = t[l * b + i];
+
+                        for (size_t j = 0; j < cols; ++j)
+                        {
+                            w[i * cols + j] += factor * w[l * cols + j];
+                        }
+                    }
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < b; ++i)
+                {
+                    for (size_t j = 0; j < cols; ++j)
+                    {
+                        w[i * cols + j] *= t[i * b + i];
+                    }
+
+                    for (size_t l = i + 1; l < b; ++l)
+                    {
+                        const coordinate factor = t[i * b + l];
+
+                        for (size_t j = 0; j < cols; ++j)
+                        {
+                            w[i * cols + j] += factor * w[l * cols + j];
+                        }
+                    }
+                }
+            }
+
+            // C -= V * W
+            for (size_t i = 0; i < b; ++i)
+            {
+                coordinate* row = c + i * ldc;
+
+                for (size_t l = 0; l <= i; ++l)
+                {
+                    const coordinate factor = v1(i, l);
+
+                    for (size_t j = 0; j < cols; ++j)
+                    {
+                        row[j] -= factor * w[l * cols + j];
+                    }
+                }
+            }
+
+            multiply_add_blocked(m - b, cols, b, coordinate{-1}, v2, ldv, w.data(), cols, c2, ldc);
+        }
+
+        /*!
+         * @brief Decomposition of a m x n matrix (m >= n) of leading dimension lda by panels of qr_block_size columns
+         */
+        template <Coordinate coordinate>
+        void qr_blocked(coordinate* a, size_t lda, size_t m, size_t n, coordinate* tau)
+        {
+            std::vector<coordinate> w(n);
+
+            for (size_t k0 = 0; k0 < n; k0 += qr_block_size)
+            {
+                const size_t k1 = std::min(k0 + qr_block_size, n);
+
+                qr_unblocked(a + k0 * lda + k0, lda, m - k0, k1 - k0, tau + k0, w.data());
+
+                if (k1 < n)
+                {
+                    qr_apply_panel(m - k0, k1 - k0, a + k0 * lda + k0, lda, tau + k0, n - k1, a + k0 * lda + k1, lda);
+                }
+            }
+        }
+
+        /*!
+         * @brief Replace a m x n matrix (m >= n) by an orthonormal basis of its columns: the first n columns of Q, formed
+         *        by applying the panels of Q to the first n columns of the identity, from the last one
+         */
+        template <Coordinate coordinate>
+        void qr_orthonormal_basis(coordinate* a, size_t m, size_t n)
+        {
+            std::vector<coordinate> tau(n);
+            std::vector<coordinate> q(m * n);
+
+            qr_blocked(a, n, m, n, tau.data());
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                q[i * n + i] = 1;
+            }
+
+            for (size_t k0 = (n - 1) / qr_block_size * qr_block_size;; k0 -= qr_block_size)
+            {
+                const size_t k1 = std::min(k0 + qr_block_size, n);
+
+                // The columns before k0 of the rows from k0 are still null
+                qr_apply_panel<coordinate, false>(m - k0, k1 - k0, a + k0 * n + k0, n, tau.data() + k0, n - k0, q.data() + k0 * n + k0, n);
+
+                if (k0 == 0)
+                {
+                    break;
+                }
+            }
+
+            std::copy(q.begin(), q.end(), a);
+        }
+
+        /*!
+         * @brief X = R^-1 * (Q^T * B)[:n] from the decomposition of a m x n matrix of leading dimension ldqr, see qr_solve
+         * @param x holds B on input, m rows of cols coefficients with a leading dimension ldx
+         * @param blocked tells whether Q^T is applied by panels or one reflector at a time
+         * @param rank_rows is the number of rows of the original matrix, scaling the singularity tolerance
+         * @return false if R is singular
+         */
+        template <Coordinate coordinate>
+        bool qr_solve(const coordinate* qr,
+                      size_t            ldqr,
+                      size_t            m,
+                      size_t            n,
+                      const coordinate* tau,
+                      coordinate*       x,
+                      size_t            ldx,
+                      size_t            cols,
+                      bool              blocked,
+                      size_t            rank_rows)
+        {
+            if (blocked)
+            {
+                for (size_t k0 = 0; k0 < n; k0 += qr_block_size)
+                {
+                    const size_t k1 = std::min(k0 + qr_block_size, n);
+
+                    qr_apply_panel(m - k0, k1 - k0, qr + k0 * ldqr + k0, ldqr, tau + k0, cols, x + k0 * ldx, ldx);
+                }
+            }
+            else
+            {
+                std::vector<coordinate> w(cols);
+
+                for (size_t k = 0; k < n; ++k)
+                {
+                    qr_reflect(m - k, qr + k * ldqr + k, ldqr, tau[k], x + k * ldx, ldx, cols, w.data());
+                }
+            }
+
+            coordinate largest = 0;
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                largest = std::max(largest, std::abs(qr[i * ldqr + i]));
+            }
+
+            const coordinate tolerance = static_cast<coordinate>(rank_rows) * std::numeric_limits<coordinate>::epsilon() * largest;
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                if (!(std::abs(qr[i * ldqr + i]) > tolerance))
+                {
+                    return false;
+                }
+            }
+
+            solve_triangular_blocked<false, false>(n, cols, qr, ldqr, x, ldx);
+
+            return true;
+        }
+
+        /*!
+         * @brief Tall skinny QR least squares solution of a m x n system, a and x having the leading dimensions lda and ldx,
+         *        see least_squares
+         * @param rank_rows is the number of rows of the original matrix, see qr_solve
+         */
+        template <Coordinate coordinate>
+        bool least_squares_tsqr(coordinate* a, size_t lda, size_t m, size_t n, coordinate* x, size_t ldx, size_t cols, size_t rank_rows)
+        {
+            const size_t block_rows = tsqr_block_size / n;
+
+            // Without two blocks of at least 2 * n rows fitting in the cache, the whole matrix is decomposed by panels
+            if (block_rows < 2 * n || m < 2 * block_rows)
+            {
+                std::vector<coordinate> tau(n);
+
+                qr_blocked(a, lda, m, n, tau.data());
+
+                return qr_solve(a, lda, m, n, tau.data(), x, ldx, cols, true, rank_rows);
+            }
+
+            // Blocks of block_rows to 2 * block_rows rows, each being decomposed on one thread
+            const size_t block_count = m / block_rows;
+
+            std::vector<coordinate> stacked(block_count * n * n);
+            std::vector<coordinate> stacked_rhs(block_count * n * cols);
+
+            for_each_chunk_concurrently(
+            block_count,
+            1,
+            [&](size_t begin, size_t end)
+            {
+                std::vector<coordinate> tau(n);
+                std::vector<coordinate> w(std::max(n, cols));
+
+                for (size_t block = begin; block < end; ++block)
+                {
+                    const size_t row_begin = block * m / block_count;
+                    const size_t rows      = (block + 1) * m / block_count - row_begin;
+
+                    coordinate* block_a = a + row_begin * lda;
+                    coordinate* block_x = x + row_begin * ldx;
+
+                    qr_unblocked(block_a, lda, rows, n, tau.data(), w.data());
+
+                    for (size_t k = 0; k < n; ++k)
+                    {
+                        qr_reflect(rows - k, block_a + k * lda + k, lda, tau[k], block_x + k * ldx, ldx, cols, w.data());
+                    }
+
+                    // R, without the reflectors below its diagonal, and the matching rows of Q^T * B
+                    for (size_t i = 0; i < n; ++i)
+                    {
+                        std::copy(block_a + i * lda + i, block_a + i * lda + n, stacked.data() + (block * n + i) * n + i);
+                        std::copy(block_x + i * ldx, block_x + i * ldx + cols, stacked_rhs.data() + (block * n + i) * cols);
+                    }
+                }
+            },
+            concurrency_threshold_for_work(block_count, m * n * n));
+
+            // |A * X - B|^2 = sum of |R_i * X - (Q_i^T * B_i)[:n]|^2 + terms not depending on X
+            if (!least_squares_tsqr(stacked.data(), n, block_count * n, n, stacked_rhs.data(), cols, cols, rank_rows))
+            {
+                return false;
+            }
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                std::copy(stacked_rhs.data() + i * cols, stacked_rhs.data() + (i + 1) * cols, x + i * ldx);
+            }
+
+            return true;
+        }
+
+        /*!
+         * @brief Number of rows of a matrix of size coefficients with cols columns
+         * @throw std::invalid_argument if size is not a multiple of cols or if there are fewer rows than columns
+         */
+        inline size_t qr_matrix_rows(size_t size, size_t cols)
+        {
+            const size_t rows = cols == 0 ? 0 : size / cols;
+
+            if (cols == 0 || rows * cols != size || rows < cols)
+            {
+                throw std::invalid_argument("The matrix to decompose must have at least as many rows as columns");
+            }
+
+            return rows;
+        }
+
+        // NOLINTEND(readability-identifier-length)
+    }  // namespace ImplementationDetails
+
+    template <Coordinate coordinate>
+    void qr_factorize(std::span<coordinate> matrix, size_t cols, std::span<coordinate> tau) requires(std::is_floating_point_v<coordinate>)
+    {
+        const size_t rows = ImplementationDetails::qr_matrix_rows(matrix.size(), cols);
+
+        if (tau.size() != cols)
+        {
+            throw std::invalid_argument("The matrix to decompose must have as many columns as scale factors");
+        }
+
+        ImplementationDetails::qr_blocked(matrix.data(), cols, rows, cols, tau.data());
+    }
+
+    template <Coordinate coordinate>
+    bool qr_solve(std::span<const coordinate> qr, std::span<const coordinate> tau, std::span<coordinate> rhs, size_t rhs_cols)
+    requires(std::is_floating_point_v<coordinate>)
+    {
+        const size_t cols = tau.size();
+        const size_t rows = ImplementationDetails::qr_matrix_rows(qr.size(), cols);
+
+        if (rhs.size() != rows * rhs_cols)
+        {
+            throw std::invalid_argument("The decomposition and the right hand sides must have as many rows");
+        }
+
+        return ImplementationDetails::qr_solve(qr.data(), cols, rows, cols, tau.data(), rhs.data(), rhs_cols, rhs_cols, true, rows);
+    }
+
+    template <Coordinate coordinate>
+    bool least_squares(std::span<coordinate> matrix, size_t cols, std::span<coordinate> rhs, size_t rhs_cols)
+    requires(std::is_floating_point_v<coordinate>)
+    {
+        const size_t rows = ImplementationDetails::qr_matrix_rows(matrix.size(), cols);
+
+        if (rhs.size() != rows * rhs_cols)
+        {
+            throw std::invalid_argument("The matrix and the right hand sides must have as many rows");
+        }
+
+        return ImplementationDetails::least_squares_tsqr(matrix.data(), cols, rows, cols, rhs.data(), rhs_cols, rhs_cols, rows);
+    }
+}  // namespace LCNS::Algebra
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "algebra/Internal.hpp"
+#include "algebra/QuaternionSimd.hpp"
+#include "algebra/Vector.hpp"
 
 #include <cmath>
 #include <array>
@@ -169,28 +171,31 @@ namespace LCNS::Algebra
         coordinate& w() noexcept;
 
         /*!
-         * \brief Compute the square length of the quaternion
+         * \brief Compute the square length of the quaternion, in the coordinate type for floating point coordinates
          * @return the length of the quaternion squared
          */
-        constexpr double sqrLength() const noexcept;
+        constexpr LengthType<coordinate> sqrLength() const noexcept;
 
         /*!
-         * \brief Compute the length of the quaternion
+         * \brief Compute the length of the quaternion, in the coordinate type for floating point coordinates
          * @return the length of the quaternion
          */
-        double length() const;
+        LengthType<coordinate> length() const;
 
         /*!
-         * \brief Normalize this quaternion
+         * \brief Normalize this quaternion, a null quaternion is left unchanged
+         * @param precision is Precision::Exact to divide by the length, or Precision::Fast to multiply by the hardware
+         *        estimate of 1 / length refined by one Newton-Raphson step (relative error below 2^-22)
          */
-        void normalize() requires(std::is_floating_point_v<coordinate>);
+        void normalize(Precision precision = Precision::Exact) requires(std::is_floating_point_v<coordinate>);
 
         /*!
          * \brief Create a new quaternion which corresponds to the normalized version of this quaternion.
          *        Does not modify this object.
+         * @param precision is the precision of the normalization, see normalize
          * @return a quaternion of length 1 with the same direction
          */
-        Quaternion<coordinate> normalized() const requires(std::is_floating_point_v<coordinate>);
+        Quaternion<coordinate> normalized(Precision precision = Precision::Exact) const requires(std::is_floating_point_v<coordinate>);
 
         /*!
          * @brief Check if this quaternion is the null quaternion
@@ -210,10 +215,41 @@ namespace LCNS::Algebra
          */
         constexpr Quaternion<coordinate> conjugated() const noexcept;
 
+        /*!
+         * \brief Rotate a vector by this quaternion, which must be of length 1. Same result as q * (v, 0) * q.conjugated()
+         *        with a fraction of the operations.
+         * @param vec is the vector to rotate
+         * @return the rotated vector
+         */
+        constexpr Vector<coordinate, 3> rotate(const Vector<coordinate, 3>& vec) const noexcept;
+
     private:
         std::array<coordinate, 4> _coords = {};
     };  // class Quaternion
 
+    /*!
+     * \brief Spherical linear interpolation between two quaternions of length 1, along the shortest path
+     * @param from is the quaternion for t = 0
+     * @param to is the quaternion for t = 1
+     * @param t is the interpolation parameter, usually in [0, 1]
+     * @return a quaternion of length 1 rotating at constant angular velocity from "from" to "to" when t goes from 0 to 1
+     */
+    template <Coordinate coordinate>
+    Quaternion<coordinate> slerp(const Quaternion<coordinate>& from, const Quaternion<coordinate>& to, coordinate t)
+    requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief Normalized linear interpolation between two quaternions of length 1, along the shortest path. Cheaper than
+     *        slerp, same path but the angular velocity is not constant.
+     * @param from is the quaternion for t = 0
+     * @param to is the quaternion for t = 1
+     * @param t is the interpolation parameter, usually in [0, 1]
+     * @return a quaternion of length 1
+     */
+    template <Coordinate coordinate>
+    Quaternion<coordinate> nlerp(const Quaternion<coordinate>& from, const Quaternion<coordinate>& to, coordinate t)
+    requires(std::is_floating_point_v<coordinate>);
+
     template <Coordinate coordinate>
     constexpr Quaternion<coordinate>::Quaternion(auto x, auto y, auto z, auto w)
     {
@@ -277,6 +313,18 @@ namespace LCNS::Algebra
     template <Coordinate coordinate>
     constexpr Quaternion<coordinate> Quaternion<coordinate>::operator*(const Quaternion<coordinate>& rhs) const noexcept
     {
+#ifdef AVX_ENABLED_ON_CPU
+        if constexpr (std::is_same_v<coordinate, float> || std::is_same_v<coordinate, double>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                Quaternion<coordinate> result;
+                ImplementationDetails::hamilton_product_simd(_coords.data(), rhs._coords.data(), result._coords.data());
+                return result;
+            }
+        }
+#endif
+
         const coordinate x = _coords[3] * rhs._coords[0] + _coords[0] * rhs._coords[3] + _coords[1] * rhs._coords[2] - _coords[2] * rhs._coords[1];
         const coordinate y = _coords[3] * rhs._coords[1] - _coords[0] * rhs._coords[2] + _coords[1] * rhs._coords[3] + _coords[2] * rhs._coords[0];
         const coordinate z = _coords[3] * rhs._coords[2] + _coords[0] * rhs._coords[1] - _coords[1] * rhs._coords[0] + _coords[2] * rhs._coords[3];
@@ -418,31 +466,47 @@ namespace LCNS::Algebra
     }
 
     template <Coordinate coordinate>
-    constexpr double Quaternion<coordinate>::sqrLength() const noexcept
+    constexpr LengthType<coordinate> Quaternion<coordinate>::sqrLength() const noexcept
     {
-        double length_square = 0.0;
+        LengthType<coordinate> length_square = 0;
 
         for (const auto coord : _coords)
         {
-            length_square += coord * coord;
+            length_square += static_cast<LengthType<coordinate>>(coord) * static_cast<LengthType<coordinate>>(coord);
         }
 
         return length_square;
     }
 
     template <Coordinate coordinate>
-    double Quaternion<coordinate>::length() const
+    LengthType<coordinate> Quaternion<coordinate>::length() const
     {
         return std::sqrt(sqrLength());
     }
 
     template <Coordinate coordinate>
-    void Quaternion<coordinate>::normalize() requires(std::is_floating_point_v<coordinate>)
+    void Quaternion<coordinate>::normalize(Precision precision) requires(std::is_floating_point_v<coordinate>)
     {
-        const auto len = length();
+        const auto length_square = sqrLength();
 
-        if (len != 0.0)
+        if (length_square == 0)
         {
+            return;
+        }
+
+        if (precision == Precision::Fast)
+        {
+            const auto factor = ImplementationDetails::rsqrt_fast(length_square);
+
+            for (auto& coord : _coords)
+            {
+                coord *= factor;
+            }
+        }
+        else
+        {
+            const auto len = std::sqrt(length_square);
+
             for (auto& coord : _coords)
             {
                 coord /= len;
@@ -451,11 +515,11 @@ namespace LCNS::Algebra
     }
 
     template <Coordinate coordinate>
-    Quaternion<coordinate> Quaternion<coordinate>::normalized() const requires(std::is_floating_point_v<coordinate>)
+    Quaternion<coordinate> Quaternion<coordinate>::normalized(Precision precision) const requires(std::is_floating_point_v<coordinate>)
     {
         Quaternion<coordinate> result(*this);
 
-        result.normalize();
+        result.normalize(precision);
 
         return result;
     }
@@ -494,4 +558,69 @@ namespace LCNS::Algebra
         // clang-format on
     }
 
+    // NOLINTBEGIN(readability-identifier-length)
+    template <Coordinate coordinate>
+    constexpr Vector<coordinate, 3> Quaternion<coordinate>::rotate(const Vector<coordinate, 3>& vec) const noexcept
+    {
+        // With u the imaginary part of the quaternion: t = 2 * (u ^ v) and v' = v + w * t + u ^ t
+        const auto [x, y, z, w] = _coords;
+
+        const coordinate tx = static_cast<coordinate>(2 * (y * vec.z() - z * vec.y()));
+        const coordinate ty = static_cast<coordinate>(2 * (z * vec.x() - x * vec.z()));
+        const coordinate tz = static_cast<coordinate>(2 * (x * vec.y() - y * vec.x()));
+
+        const coordinate rx = static_cast<coordinate>(vec.x() + w * tx + (y * tz - z * ty));
+        const coordinate ry = static_cast<coordinate>(vec.y() + w * ty + (z * tx - x * tz));
+        const coordinate rz = static_cast<coordinate>(vec.z() + w * tz + (x * ty - y * tx));
+
+        return Vector<coordinate, 3>(rx, ry, rz);
+    }
+    // NOLINTEND(readability-identifier-length)
+
+    namespace ImplementationDetails
+    {
+        /*!
+         * @brief Above this cosine of the angle between two quaternions, slerp falls back to nlerp: sin(theta) is too
+         *        close to 0 to divide by it and both interpolations are equal up to the rounding errors
+         */
+        constexpr double slerp_nlerp_threshold = 0.9995;
+
+        template <Coordinate coordinate>
+        constexpr coordinate quaternion_dot(const Quaternion<coordinate>& lhs, const Quaternion<coordinate>& rhs) noexcept
+        {
+            return lhs.x() * rhs.x() + lhs.y() * rhs.y() + lhs.z() * rhs.z() + lhs.w() * rhs.w();
+        }
+    }  // namespace ImplementationDetails
+
+    template <Coordinate coordinate>
+    Quaternion<coordinate> slerp(const Quaternion<coordinate>& from, const Quaternion<coordinate>& to, coordinate t)
+    requires(std::is_floating_point_v<coordinate>)
+    {
+        // q and -q are the same rotation, take the one on the same hemisphere as from for the shortest path
+        coordinate       cos_theta = ImplementationDetails::quaternion_dot(from, to);
+        const coordinate sign      = cos_theta < 0 ? coordinate{-1} : coordinate{1};
+        cos_theta *= sign;
+
+        if (cos_theta > ImplementationDetails::slerp_nlerp_threshold)
+        {
+            return nlerp(from, to, t);
+        }
+
+        const coordinate theta     = std::acos(cos_theta);
+        const coordinate sin_theta = std::sqrt(1 - cos_theta * cos_theta);
+        const coordinate weight0   = std::sin((1 - t) * theta) / sin_theta;
+        const coordinate weight1   = sign * std::sin(t * theta) / sin_theta;
+
+        return from * weight0 + to * weight1;
+    }
+
+    template <Coordinate coordinate>
+    Quaternion<coordinate> nlerp(const Quaternion<coordinate>& from, const Quaternion<coordinate>& to, coordinate t)
+    requires(std::is_floating_point_v<coordinate>)
+    {
+        const coordinate weight0 = 1 - t;
+        const coordinate weight1 = ImplementationDetails::quaternion_dot(from, to) < 0 ? -t : t;
+
+        return (from * weight0 + to * weight1).normalized();
+    }
 }  // namespace LCNS::Algebra
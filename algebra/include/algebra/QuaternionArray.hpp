@@ -0,0 +1,707 @@
+#pragma once
+
+#include "algebra/MappingFunctions.hpp"
+#include "algebra/Quaternion.hpp"
+#include "algebra/Simd.hpp"
+#include "algebra/SimdMath.hpp"
+#include "algebra/Transform.hpp"
+#include "algebra/Vector.hpp"
+#include "algebra/VectorArray.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace LCNS::Algebra
+{
+    /*!
+     *  \brief Array of quaternions stored as a structure of arrays: all the x coordinates are contiguous, then all the y
+     *         coordinates, etc. Same layout as VectorArray, used by the batched quaternion kernels below.
+     */
+    template <Coordinate coordinate>
+    class QuaternionArray
+    {
+    public:
+        /*!
+         * \brief Default constructor, the array is empty
+         */
+        QuaternionArray() = default;
+
+        /*!
+         * \brief Create an array of count null quaternions
+         * @param count is the number of quaternions in the array
+         */
+        explicit QuaternionArray(size_t count);
+
+        /*!
+         * \brief Create an array from quaternions stored one after the other (array of structures)
+         * @param quaternions are the quaternions to copy
+         */
+        explicit QuaternionArray(std::span<const Quaternion<coordinate>> quaternions);
+
+        /*!
+         * \brief Get the number of quaternions in the array
+         * @return the number of quaternions
+         */
+        size_t count() const noexcept;
+
+        /*!
+         * \brief Change the number of quaternions in the array, new quaternions are null
+         * @param count is the new number of quaternions
+         */
+        void resize(size_t count);
+
+        /*!
+         * \brief Accessor (read only)
+         * @param index is the index of the quaternion to access
+         * @return a copy of the corresponding quaternion
+         */
+        Quaternion<coordinate> operator[](size_t index) const;
+
+        /*!
+         * \brief Replace a quaternion of the array
+         * @param index is the index of the quaternion to replace
+         * @param quaternion is the new value
+         */
+        void set(size_t index, const Quaternion<coordinate>& quaternion);
+
+        /*!
+         * \brief Get the values of one coordinate for all the quaternions
+         * @param index is the index of the coordinate, 3 being the scalar coordinate
+         * @return a pointer on count() contiguous values
+         */
+        coordinate* lane(unsigned int index);
+
+        /*!
+         * \brief Get the values of one coordinate for all the quaternions (read only)
+         * @param index is the index of the coordinate, 3 being the scalar coordinate
+         * @return a pointer on count() contiguous values
+         */
+        const coordinate* lane(unsigned int index) const;
+
+        /*!
+         * \brief Copy the quaternions one after the other (array of structures)
+         * @return a new std::vector with the count() quaternions
+         */
+        std::vector<Quaternion<coordinate>> toQuaternions() const;
+
+    private:
+        VectorArray<coordinate, 4> _coords;
+    };
+
+    /*!
+     * \brief Rotate vectors by the same quaternion, which must be of length 1. The quaternion is converted once to a
+     *        rotation matrix, cheaper than Quaternion::rotate for each vector.
+     * @param rotation is the rotation to apply
+     * @param vectors are the vectors to rotate
+     * @param result is the destination, it can be vectors
+     */
+    template <Coordinate coordinate>
+    void rotate(const Quaternion<coordinate>&                                                rotation,
+                std::type_identity_t<std::span<const Vector<coordinate, 3>>> vectors,
+                std::type_identity_t<std::span<Vector<coordinate, 3>>>       result) requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief Rotate vectors stored as a structure of arrays by the same quaternion, see above
+     */
+    template <Coordinate coordinate>
+    void rotate(const Quaternion<coordinate>& rotation, const VectorArray<coordinate, 3>& vectors, VectorArray<coordinate, 3>& result)
+    requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief Rotate each vector by its own quaternion, which must be of length 1
+     * @param rotations are the rotations to apply, result[i] = rotations[i].rotate(vectors[i])
+     * @param vectors are the vectors to rotate
+     * @param result is the destination, it can be vectors
+     */
+    template <Coordinate coordinate>
+    void rotate(const QuaternionArray<coordinate>& rotations, const VectorArray<coordinate, 3>& vectors, VectorArray<coordinate, 3>& result)
+    requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief Compute the Hamilton product of each pair of quaternions
+     * @param result is the destination, result[i] = lhs[i] * rhs[i]. It can be lhs or rhs.
+     */
+    template <Coordinate coordinate>
+    void multiply(const QuaternionArray<coordinate>& lhs, const QuaternionArray<coordinate>& rhs, QuaternionArray<coordinate>& result);
+
+    /*!
+     * \brief Compute the square length of each quaternion
+     * @param result is the destination, result[i] = quaternions[i].sqrLength()
+     */
+    template <Coordinate coordinate>
+    void sqrLength(const QuaternionArray<coordinate>& quaternions, std::span<coordinate> result) requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief Compute the length of each quaternion
+     * @param result is the destination, result[i] = quaternions[i].length()
+     */
+    template <Coordinate coordinate>
+    void length(const QuaternionArray<coordinate>& quaternions, std::span<coordinate> result) requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief Normalize each quaternion, null quaternions are left unchanged
+     * @param precision is Precision::Exact to divide by the lengths, or Precision::Fast to multiply by the hardware
+     *        estimates of 1 / length refined by one Newton-Raphson step, see rsqrt_fast_simd in SimdMath.hpp
+     */
+    template <Coordinate coordinate>
+    void normalize(QuaternionArray<coordinate>& quaternions, Precision precision = Precision::Exact) requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief Spherical linear interpolation of each pair of quaternions, see slerp in Quaternion.hpp.
+     *        In Precision::Fast mode, acos and sin are the vectorized functions of SimdMath.hpp (a few ulps, see the
+     *        table there) and the result is renormalized.
+     * @param from are the quaternions for t = 0, of length 1
+     * @param to are the quaternions for t = 1, of length 1
+     * @param weights are the interpolation parameters, in [0, 1]
+     * @param result is the destination, it can be from or to
+     * @param precision selects the polynomial approximations or the standard library functions
+     */
+    template <Coordinate coordinate>
+    void slerp(const QuaternionArray<coordinate>&                         from,
+               const QuaternionArray<coordinate>&                         to,
+               std::type_identity_t<std::span<const coordinate>> weights,
+               QuaternionArray<coordinate>&                               result,
+               Precision precision = Precision::Fast) requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief Normalized linear interpolation of each pair of quaternions, see nlerp in Quaternion.hpp
+     * @param from are the quaternions for t = 0, of length 1
+     * @param to are the quaternions for t = 1, of length 1
+     * @param weights are the interpolation parameters, in [0, 1]
+     * @param result is the destination, it can be from or to
+     */
+    template <Coordinate coordinate>
+    void nlerp(const QuaternionArray<coordinate>&                         from,
+               const QuaternionArray<coordinate>&                         to,
+               std::type_identity_t<std::span<const coordinate>> weights,
+               QuaternionArray<coordinate>&                               result) requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief Convert rotation matrices to quaternions with Shepperd's method, see RotationMatrixAsQuaternion. Several
+     *        matrices are converted at once with SIMD instructions, large arrays are split between threads.
+     * @param matrices are the rotation matrices to convert, the null matrix is not handled as a special case
+     * @param result is the destination, its count must be matrices.size()
+     */
+    template <Coordinate coordinate, StorageOrder order = StorageOrder::RowMajor>
+    void RotationMatricesAsQuaternions(std::type_identity_t<std::span<const Matrix<coordinate, 3, 3, order>>> matrices,
+                                       QuaternionArray<coordinate>& result) requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief Convert quaternions to rotation matrices, see QuaternionAsRotationMatrix. The quaternions do not need to be
+     *        of length 1, null quaternions give null matrices.
+     * @param quaternions are the quaternions to convert
+     * @param result is the destination, its size must be quaternions.count()
+     */
+    template <Coordinate coordinate, StorageOrder order = StorageOrder::RowMajor>
+    void QuaternionsAsRotationMatrices(const QuaternionArray<coordinate>&                                   quaternions,
+                                       std::type_identity_t<std::span<Matrix<coordinate, 3, 3, order>>> result)
+    requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief Convert Euler angles to quaternions, see EulerAnglesAsQuaternion. Several angles are converted at once with
+     *        sincos_simd of SimdMath.hpp, large arrays are split between threads.
+     * @param angles are the (psi, theta, phi) angles to convert
+     * @param result is the destination, its count must be angles.count()
+     */
+    template <Coordinate coordinate>
+    void EulerAnglesAsQuaternions(const VectorArray<coordinate, 3>& angles, QuaternionArray<coordinate>& result)
+    requires(std::is_floating_point_v<coordinate>);
+
+    template <Coordinate coordinate>
+    QuaternionArray<coordinate>::QuaternionArray(size_t count)
+    : _coords(count)
+    {
+    }
+
+    template <Coordinate coordinate>
+    QuaternionArray<coordinate>::QuaternionArray(std::span<const Quaternion<coordinate>> quaternions)
+    : _coords(quaternions.size())
+    {
+        for (size_t i = 0; i < quaternions.size(); ++i)
+        {
+            set(i, quaternions[i]);
+        }
+    }
+
+    template <Coordinate coordinate>
+    size_t QuaternionArray<coordinate>::count() const noexcept
+    {
+        return _coords.count();
+    }
+
+    template <Coordinate coordinate>
+    void QuaternionArray<coordinate>::resize(size_t count)
+    {
+        _coords.resize(count);
+    }
+
+    template <Coordinate coordinate>
+    Quaternion<coordinate> QuaternionArray<coordinate>::operator[](size_t index) const
+    {
+        const auto coords = _coords[index];
+
+        return { coords.x(), coords.y(), coords.z(), coords.w() };
+    }
+
+    template <Coordinate coordinate>
+    void QuaternionArray<coordinate>::set(size_t index, const Quaternion<coordinate>& quaternion)
+    {
+        _coords.set(index, Vector<coordinate, 4>(quaternion.x(), quaternion.y(), quaternion.z(), quaternion.w()));
+    }
+
+    template <Coordinate coordinate>
+    coordinate* QuaternionArray<coordinate>::lane(unsigned int index)
+    {
+        return _coords.lane(index);
+    }
+
+    template <Coordinate coordinate>
+    const coordinate* QuaternionArray<coordinate>::lane(unsigned int index) const
+    {
+        return _coords.lane(index);
+    }
+
+    template <Coordinate coordinate>
+    std::vector<Quaternion<coordinate>> QuaternionArray<coordinate>::toQuaternions() const
+    {
+        std::vector<Quaternion<coordinate>> result(count());
+
+        for (size_t i = 0; i < result.size(); ++i)
+        {
+            result[i] = (*this)[i];
+        }
+
+        return result;
+    }
+
+    namespace ImplementationDetails
+    {
+        template <Coordinate coordinate>
+        void check_same_count(const QuaternionArray<coordinate>& lhs, size_t count)
+        {
+            if (lhs.count() != count)
+            {
+                throw std::invalid_argument("The arrays must have the same number of quaternions");
+            }
+        }
+
+        template <Coordinate coordinate>
+        std::array<const coordinate*, 4> lanes_of(const QuaternionArray<coordinate>& quaternions)
+        {
+            return { quaternions.lane(0), quaternions.lane(1), quaternions.lane(2), quaternions.lane(3) };
+        }
+
+        template <Coordinate coordinate>
+        std::array<coordinate*, 4> lanes_of(QuaternionArray<coordinate>& quaternions)
+        {
+            return { quaternions.lane(0), quaternions.lane(1), quaternions.lane(2), quaternions.lane(3) };
+        }
+    }  // namespace ImplementationDetails
+
+    template <Coordinate coordinate>
+    void rotate(const Quaternion<coordinate>&                                                rotation,
+                std::type_identity_t<std::span<const Vector<coordinate, 3>>> vectors,
+                std::type_identity_t<std::span<Vector<coordinate, 3>>>       result) requires(std::is_floating_point_v<coordinate>)
+    {
+        transform_directions(QuaternionAsRotationMatrix(rotation), vectors, result);
+    }
+
+    template <Coordinate coordinate>
+    void rotate(const Quaternion<coordinate>& rotation, const VectorArray<coordinate, 3>& vectors, VectorArray<coordinate, 3>& result)
+    requires(std::is_floating_point_v<coordinate>)
+    {
+        transform_directions(QuaternionAsRotationMatrix(rotation), vectors, result);
+    }
+
+    // NOLINTBEGIN(readability-identifier-length)
+    template <Coordinate coordinate>
+    void rotate(const QuaternionArray<coordinate>& rotations, const VectorArray<coordinate, 3>& vectors, VectorArray<coordinate, 3>& result)
+    requires(std::is_floating_point_v<coordinate>)
+    {
+        ImplementationDetails::check_same_count(vectors, rotations.count());
+        ImplementationDetails::check_same_count(vectors, result.count());
+
+        const auto q   = ImplementationDetails::lanes_of(rotations);
+        const auto v   = ImplementationDetails::lanes_of(vectors);
+        const auto dst = ImplementationDetails::lanes_of(result);
+
+        ImplementationDetails::for_each_pack_concurrently<coordinate>(vectors.count(),
+                                                                      [q, v, dst](auto pack, size_t i)
+                                                                      {
+                                                                          using simd = decltype(pack);
+
+                                                                          const auto qx = simd::load(q[0] + i);
+                                                                          const auto qy = simd::load(q[1] + i);
+                                                                          const auto qz = simd::load(q[2] + i);
+                                                                          const auto qw = simd::load(q[3] + i);
+                                                                          const auto vx = simd::load(v[0] + i);
+                                                                          const auto vy = simd::load(v[1] + i);
+                                                                          const auto vz = simd::load(v[2] + i);
+
+                                                                          // Same computation as Quaternion::rotate: t = 2 * (u ^ v) and v' = v + w * t + u ^ t
+                                                                          const auto two = simd::broadcast(coordinate{2});
+
+                                                                          const auto tx = simd::mul(two, simd::sub(simd::mul(qy, vz), simd::mul(qz, vy)));
+                                                                          const auto ty = simd::mul(two, simd::sub(simd::mul(qz, vx), simd::mul(qx, vz)));
+                                                                          const auto tz = simd::mul(two, simd::sub(simd::mul(qx, vy), simd::mul(qy, vx)));
+
+                                                                          const auto rx = simd::fmadd(qw, tx, simd::add(vx, simd::sub(simd::mul(qy, tz), simd::mul(qz, ty))));
+                                                                          const auto ry = simd::fmadd(qw, ty, simd::add(vy, simd::sub(simd::mul(qz, tx), simd::mul(qx, tz))));
+                                                                          const auto rz = simd::fmadd(qw, tz, simd::add(vz, simd::sub(simd::mul(qx, ty), simd::mul(qy, tx))));
+
+                                                                          simd::store(dst[0] + i, rx);
+                                                                          simd::store(dst[1] + i, ry);
+                                                                          simd::store(dst[2] + i, rz);
+                                                                      });
+    }
+    // NOLINTEND(readability-identifier-length)
+
+    // NOLINTBEGIN(readability-identifier-length)
+    template <Coordinate coordinate>
+    void multiply(const QuaternionArray<coordinate>& lhs, const QuaternionArray<coordinate>& rhs, QuaternionArray<coordinate>& result)
+    {
+        ImplementationDetails::check_same_count(lhs, rhs.count());
+        ImplementationDetails::check_same_count(lhs, result.count());
+
+        const auto a   = ImplementationDetails::lanes_of(lhs);
+        const auto b   = ImplementationDetails::lanes_of(rhs);
+        const auto dst = ImplementationDetails::lanes_of(result);
+
+        ImplementationDetails::for_each_pack_concurrently<coordinate>(lhs.count(),
+                                                                      [a, b, dst](auto pack, size_t i)
+                                                                      {
+                                                                          using simd = decltype(pack);
+
+                                                                          const auto ax = simd::load(a[0] + i);
+                                                                          const auto ay = simd::load(a[1] + i);
+                                                                          const auto az = simd::load(a[2] + i);
+                                                                          const auto aw = simd::load(a[3] + i);
+                                                                          const auto bx = simd::load(b[0] + i);
+                                                                          const auto by = simd::load(b[1] + i);
+                                                                          const auto bz = simd::load(b[2] + i);
+                                                                          const auto bw = simd::load(b[3] + i);
+
+                                                                          // Same formulas as Quaternion::operator*, one quaternion per SIMD lane
+                                                                          const auto x = simd::fmadd(aw, bx, simd::fmadd(ax, bw, simd::sub(simd::mul(ay, bz), simd::mul(az, by))));
+                                                                          const auto y = simd::fmadd(aw, by, simd::fmadd(ay, bw, simd::sub(simd::mul(az, bx), simd::mul(ax, bz))));
+                                                                          const auto z = simd::fmadd(aw, bz, simd::fmadd(az, bw, simd::sub(simd::mul(ax, by), simd::mul(ay, bx))));
+                                                                          const auto w = simd::sub(simd::mul(aw, bw), simd::fmadd(ax, bx, simd::fmadd(ay, by, simd::mul(az, bz))));
+
+                                                                          simd::store(dst[0] + i, x);
+                                                                          simd::store(dst[1] + i, y);
+                                                                          simd::store(dst[2] + i, z);
+                                                                          simd::store(dst[3] + i, w);
+                                                                      });
+    }
+
+    template <Coordinate coordinate>
+    void sqrLength(const QuaternionArray<coordinate>& quaternions, std::span<coordinate> result) requires(std::is_floating_point_v<coordinate>)
+    {
+        ImplementationDetails::check_same_count(quaternions, result.size());
+
+        ImplementationDetails::lengths_of_lanes<false>(ImplementationDetails::lanes_of(quaternions), quaternions.count(), result.data());
+    }
+
+    template <Coordinate coordinate>
+    void length(const QuaternionArray<coordinate>& quaternions, std::span<coordinate> result) requires(std::is_floating_point_v<coordinate>)
+    {
+        ImplementationDetails::check_same_count(quaternions, result.size());
+
+        ImplementationDetails::lengths_of_lanes<true>(ImplementationDetails::lanes_of(quaternions), quaternions.count(), result.data());
+    }
+
+    template <Coordinate coordinate>
+    void normalize(QuaternionArray<coordinate>& quaternions, Precision precision) requires(std::is_floating_point_v<coordinate>)
+    {
+        ImplementationDetails::normalize_lanes(ImplementationDetails::lanes_of(quaternions), quaternions.count(), precision);
+    }
+    // NOLINTEND(readability-identifier-length)
+
+    namespace ImplementationDetails
+    {
+        /*!
+         * @brief Interpolate each pair of quaternions: result = normalize(w0 * from + w1 * to) where weights_of(pack,
+         *        cos_theta, t, w0, w1) sets w0 and w1, cos_theta being the dot product of from and to after flipping to
+         */
+        template <Coordinate coordinate, typename Weights>
+        void interpolate(const QuaternionArray<coordinate>& from,
+                         const QuaternionArray<coordinate>& to,
+                         std::span<const coordinate>        weights,
+                         QuaternionArray<coordinate>&       result,
+                         const Weights&                     weights_of)
+        {
+            check_same_count(from, to.count());
+            check_same_count(from, weights.size());
+            check_same_count(from, result.count());
+
+            const auto        a   = lanes_of(from);
+            const auto        b   = lanes_of(to);
+            const coordinate* t   = weights.data();
+            const auto        dst = lanes_of(result);
+
+            for_each_pack_concurrently<coordinate>(from.count(),
+                                                   [a, b, t, dst, &weights_of](auto pack, size_t i)
+                                                   {
+                                                       using simd = decltype(pack);
+
+                                                       const auto ax = simd::load(a[0] + i);
+                                                       const auto ay = simd::load(a[1] + i);
+                                                       const auto az = simd::load(a[2] + i);
+                                                       const auto aw = simd::load(a[3] + i);
+                                                       const auto bx = simd::load(b[0] + i);
+                                                       const auto by = simd::load(b[1] + i);
+                                                       const auto bz = simd::load(b[2] + i);
+                                                       const auto bw = simd::load(b[3] + i);
+
+                                                       auto cos_theta = simd::fmadd(ax, bx, simd::fmadd(ay, by, simd::fmadd(az, bz, simd::mul(aw, bw))));
+
+                                                       // q and -q are the same rotation, take the one on the same hemisphere as from
+                                                       const auto one  = simd::broadcast(coordinate{1});
+                                                       const auto sign = simd::select_greater(simd::broadcast(coordinate{0}), cos_theta, simd::broadcast(coordinate{-1}), one);
+                                                       cos_theta       = simd::min(simd::abs(cos_theta), one);
+
+                                                       auto weight0 = one;
+                                                       auto weight1 = one;
+                                                       weights_of(pack, cos_theta, simd::load(t + i), weight0, weight1);
+                                                       weight1 = simd::mul(sign, weight1);
+
+                                                       const auto x = simd::fmadd(weight0, ax, simd::mul(weight1, bx));
+                                                       const auto y = simd::fmadd(weight0, ay, simd::mul(weight1, by));
+                                                       const auto z = simd::fmadd(weight0, az, simd::mul(weight1, bz));
+                                                       const auto w = simd::fmadd(weight0, aw, simd::mul(weight1, bw));
+
+                                                       const auto len = simd::sqrt(simd::fmadd(x, x, simd::fmadd(y, y, simd::fmadd(z, z, simd::mul(w, w)))));
+
+                                                       simd::store(dst[0] + i, simd::div(x, len));
+                                                       simd::store(dst[1] + i, simd::div(y, len));
+                                                       simd::store(dst[2] + i, simd::div(z, len));
+                                                       simd::store(dst[3] + i, simd::div(w, len));
+                                                   });
+        }
+    }  // namespace ImplementationDetails
+
+    template <Coordinate coordinate>
+    void slerp(const QuaternionArray<coordinate>&                         from,
+               const QuaternionArray<coordinate>&                         to,
+               std::type_identity_t<std::span<const coordinate>> weights,
+               QuaternionArray<coordinate>&                               result,
+               Precision precision) requires(std::is_floating_point_v<coordinate>)
+    {
+        if (precision == Precision::Exact)
+        {
+            ImplementationDetails::check_same_count(from, to.count());
+            ImplementationDetails::check_same_count(from, weights.size());
+            ImplementationDetails::check_same_count(from, result.count());
+
+            ImplementationDetails::for_each_chunk_concurrently(from.count(),
+                                                               1,
+                                                               [&from, &to, weights, &result](size_t begin, size_t end)
+                                                               {
+                                                                   for (size_t i = begin; i < end; ++i)
+                                                                   {
+                                                                       result.set(i, slerp(from[i], to[i], weights[i]));
+                                                                   }
+                                                               });
+            return;
+        }
+
+        ImplementationDetails::interpolate(from,
+                                           to,
+                                           weights,
+                                           result,
+                                           [](auto pack, auto cos_theta, auto t, auto& weight0, auto& weight1)
+                                           {
+                                               using simd = decltype(pack);
+
+                                               const auto one       = simd::broadcast(coordinate{1});
+                                               const auto one_min_t = simd::sub(one, t);
+
+                                               const auto theta     = ImplementationDetails::acos_simd<coordinate, simd>(cos_theta);
+                                               const auto sin_theta = simd::sqrt(simd::sub(one, simd::mul(cos_theta, cos_theta)));
+
+                                               // Where sin(theta) is too small, the weights of nlerp are used instead, see slerp
+                                               const auto threshold = simd::broadcast(static_cast<coordinate>(ImplementationDetails::slerp_nlerp_threshold));
+                                               const auto divisor   = simd::select_greater(cos_theta, threshold, one, sin_theta);
+
+                                               const auto slerp0 = simd::div(ImplementationDetails::sin_simd<coordinate, simd>(simd::mul(one_min_t, theta)), divisor);
+                                               const auto slerp1 = simd::div(ImplementationDetails::sin_simd<coordinate, simd>(simd::mul(t, theta)), divisor);
+
+                                               weight0 = simd::select_greater(cos_theta, threshold, one_min_t, slerp0);
+                                               weight1 = simd::select_greater(cos_theta, threshold, t, slerp1);
+                                           });
+    }
+
+    template <Coordinate coordinate>
+    void nlerp(const QuaternionArray<coordinate>&                         from,
+               const QuaternionArray<coordinate>&                         to,
+               std::type_identity_t<std::span<const coordinate>> weights,
+               QuaternionArray<coordinate>&                               result) requires(std::is_floating_point_v<coordinate>)
+    {
+        ImplementationDetails::interpolate(from,
+                                           to,
+                                           weights,
+                                           result,
+                                           [](auto pack, auto /*cos_theta*/, auto t, auto& weight0, auto& weight1)
+                                           {
+                                               using simd = decltype(pack);
+
+                                               weight0 = simd::sub(simd::broadcast(coordinate{1}), t);
+                                               weight1 = t;
+                                           });
+    }
+
+    // NOLINTBEGIN(readability-identifier-length)
+    template <Coordinate coordinate, StorageOrder order>
+    void RotationMatricesAsQuaternions(std::type_identity_t<std::span<const Matrix<coordinate, 3, 3, order>>> matrices,
+                                       QuaternionArray<coordinate>& result) requires(std::is_floating_point_v<coordinate>)
+    {
+        ImplementationDetails::check_same_count(result, matrices.size());
+
+        const auto dst = ImplementationDetails::lanes_of(result);
+
+        ImplementationDetails::for_each_matrix_pack(matrices,
+                                                    [dst](auto pack, const auto& lanes, size_t i, size_t index)
+                                                    {
+                                                        using simd = decltype(pack);
+
+                                                        const auto load = [&lanes, i](unsigned int k) { return simd::load(lanes[k].data() + i); };
+
+                                                        auto x = simd::broadcast(coordinate{0});
+                                                        auto y = x;
+                                                        auto z = x;
+                                                        auto w = x;
+
+                                                        ImplementationDetails::shepperd<coordinate, simd>(load(0), load(1), load(2), load(3), load(4), load(5), load(6), load(7), load(8), x, y, z, w);
+
+                                                        simd::store(dst[0] + index, x);
+                                                        simd::store(dst[1] + index, y);
+                                                        simd::store(dst[2] + index, z);
+                                                        simd::store(dst[3] + index, w);
+                                                    });
+    }
+
+    template <Coordinate coordinate, StorageOrder order>
+    void QuaternionsAsRotationMatrices(const QuaternionArray<coordinate>&                                   quaternions,
+                                       std::type_identity_t<std::span<Matrix<coordinate, 3, 3, order>>> result)
+    requires(std::is_floating_point_v<coordinate>)
+    {
+        using ImplementationDetails::matrix_block_size;
+
+        ImplementationDetails::check_same_count(quaternions, result.size());
+
+        const auto q = ImplementationDetails::lanes_of(quaternions);
+
+        ImplementationDetails::for_each_chunk_concurrently(
+        quaternions.count(),
+        matrix_block_size,
+        [q, result](size_t begin, size_t end)
+        {
+            std::array<std::array<coordinate, matrix_block_size>, 9> m;
+
+            for (size_t block_begin = begin; block_begin < end; block_begin += matrix_block_size)
+            {
+                const size_t count = std::min(matrix_block_size, end - block_begin);
+
+                ImplementationDetails::for_each_pack<coordinate>(0,
+                                                                 count,
+                                                                 [&m, q, block_begin](auto pack, size_t i)
+                                                                 {
+                                                                     using simd = decltype(pack);
+
+                                                                     const auto x = simd::load(q[0] + block_begin + i);
+                                                                     const auto y = simd::load(q[1] + block_begin + i);
+                                                                     const auto z = simd::load(q[2] + block_begin + i);
+                                                                     const auto w = simd::load(q[3] + block_begin + i);
+
+                                                                     const auto xs = simd::mul(x, x);
+                                                                     const auto ys = simd::mul(y, y);
+                                                                     const auto zs = simd::mul(z, z);
+                                                                     const auto ws = simd::mul(w, w);
+
+                                                                     const auto xy = simd::mul(x, y);
+                                                                     const auto xz = simd::mul(x, z);
+                                                                     const auto yz = simd::mul(y, z);
+                                                                     const auto wx = simd::mul(w, x);
+                                                                     const auto wy = simd::mul(w, y);
+                                                                     const auto wz = simd::mul(w, z);
+
+                                                                     // Same formulas as QuaternionAsRotationMatrix, divided by the squared length
+                                                                     // instead of normalizing the quaternion first
+                                                                     const auto zero    = simd::broadcast(coordinate{0});
+                                                                     const auto one     = simd::broadcast(coordinate{1});
+                                                                     const auto norm    = simd::add(simd::add(xs, ys), simd::add(zs, ws));
+                                                                     const auto inv     = simd::select_non_zero(norm, simd::div(one, simd::select_non_zero(norm, norm, one)), zero);
+                                                                     const auto two_inv = simd::add(inv, inv);
+
+                                                                     const auto store = [&m, i](unsigned int k, auto value) { simd::store(m[k].data() + i, value); };
+
+                                                                     store(0, simd::mul(inv, simd::sub(simd::add(ws, xs), simd::add(ys, zs))));
+                                                                     store(1, simd::mul(two_inv, simd::sub(xy, wz)));
+                                                                     store(2, simd::mul(two_inv, simd::add(wy, xz)));
+                                                                     store(3, simd::mul(two_inv, simd::add(xy, wz)));
+                                                                     store(4, simd::mul(inv, simd::sub(simd::add(ws, ys), simd::add(xs, zs))));
+                                                                     store(5, simd::mul(two_inv, simd::sub(yz, wx)));
+                                                                     store(6, simd::mul(two_inv, simd::sub(xz, wy)));
+                                                                     store(7, simd::mul(two_inv, simd::add(wx, yz)));
+                                                                     store(8, simd::mul(inv, simd::sub(simd::add(ws, zs), simd::add(xs, ys))));
+                                                                 });
+
+                for (size_t i = 0; i < count; ++i)
+                {
+                    auto& matrix = result[block_begin + i];
+
+                    for (unsigned int k = 0; k < 9; ++k)
+                    {
+                        matrix(k / 3, k % 3) = m[k][i];
+                    }
+                }
+            }
+        });
+    }
+    // NOLINTEND(readability-identifier-length)
+
+    template <Coordinate coordinate>
+    void EulerAnglesAsQuaternions(const VectorArray<coordinate, 3>& angles, QuaternionArray<coordinate>& result)
+    requires(std::is_floating_point_v<coordinate>)
+    {
+        ImplementationDetails::check_same_count(angles, result.count());
+
+        const auto src = ImplementationDetails::lanes_of(angles);
+        const auto dst = ImplementationDetails::lanes_of(result);
+
+        ImplementationDetails::for_each_pack_concurrently<coordinate>(angles.count(),
+                                                                      [src, dst](auto pack, size_t i)
+                                                                      {
+                                                                          using simd = decltype(pack);
+
+                                                                          const auto half = simd::broadcast(coordinate{0.5});
+
+                                                                          auto sin_psi   = half;
+                                                                          auto cos_psi   = half;
+                                                                          auto sin_theta = half;
+                                                                          auto cos_theta = half;
+                                                                          auto sin_phi   = half;
+                                                                          auto cos_phi   = half;
+
+                                                                          ImplementationDetails::sincos_simd<coordinate, simd>(simd::mul(half, simd::load(src[0] + i)), sin_psi, cos_psi);
+                                                                          ImplementationDetails::sincos_simd<coordinate, simd>(simd::mul(half, simd::load(src[1] + i)), sin_theta, cos_theta);
+                                                                          ImplementationDetails::sincos_simd<coordinate, simd>(simd::mul(half, simd::load(src[2] + i)), sin_phi, cos_phi);
+
+                                                                          // Same formulas as EulerAnglesAsQuaternion
+                                                                          const auto cc = simd::mul(cos_psi, cos_theta);
+                                                                          const auto ss = simd::mul(sin_psi, sin_theta);
+                                                                          const auto sc = simd::mul(sin_psi, cos_theta);
+                                                                          const auto cs = simd::mul(cos_psi, sin_theta);
+
+                                                                          simd::store(dst[0] + i, simd::sub(simd::mul(sc, cos_phi), simd::mul(cs, sin_phi)));
+                                                                          simd::store(dst[1] + i, simd::add(simd::mul(cs, cos_phi), simd::mul(sc, sin_phi)));
+                                                                          simd::store(dst[2] + i, simd::sub(simd::mul(cc, sin_phi), simd::mul(ss, cos_phi)));
+                                                                          simd::store(dst[3] + i, simd::add(simd::mul(cc, cos_phi), simd::mul(ss, sin_phi)));
+                                                                      });
+    }
+}  // namespace LCNS::Algebra
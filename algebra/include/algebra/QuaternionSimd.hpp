@@ -0,0 +1,65 @@
+#pragma once
+
+#include "algebra/Matrix4x4Simd.hpp"
+
+#ifdef AVX_ENABLED_ON_CPU
+#include <immintrin.h>
+#endif
+
+namespace LCNS::Algebra
+{
+    namespace ImplementationDetails
+    {
+#ifdef AVX_ENABLED_ON_CPU
+        /*!
+         * @brief Negate the lanes of vec for which the corresponding template parameter is true
+         */
+        template <bool x, bool y, bool z, bool w>
+        inline __m128 negate(__m128 vec)
+        {
+            return _mm_xor_ps(vec, _mm_setr_ps(x ? -0.0f : 0.0f, y ? -0.0f : 0.0f, z ? -0.0f : 0.0f, w ? -0.0f : 0.0f));
+        }
+
+        template <bool x, bool y, bool z, bool w>
+        inline __m256d negate(__m256d vec)
+        {
+            return _mm256_xor_pd(vec, _mm256_setr_pd(x ? -0.0 : 0.0, y ? -0.0 : 0.0, z ? -0.0 : 0.0, w ? -0.0 : 0.0));
+        }
+
+        // NOLINTBEGIN(readability-identifier-length)
+        /*!
+         * @brief Hamilton product of two quaternions stored (x, y, z, w) in one register each. Each coordinate of lhs
+         *        multiplies a permutation of rhs with some signs flipped:
+         *            lhs * rhs = w * (x, y, z, w) + x * (w, -z, y, -x) + y * (z, w, -x, -y) + z * (-y, x, w, -z)
+         *        where (x, y, z, w) on the right are the coordinates of rhs.
+         */
+        template <typename simd_type>
+        inline simd_type hamilton_product(simd_type lhs, simd_type rhs)
+        {
+            const simd_type x = simd_mul(swizzle<0, 0, 0, 0>(lhs), negate<false, true, false, true>(swizzle<3, 2, 1, 0>(rhs)));
+            const simd_type y = simd_mul(swizzle<1, 1, 1, 1>(lhs), negate<false, false, true, true>(swizzle<2, 3, 0, 1>(rhs)));
+            const simd_type z = simd_mul(swizzle<2, 2, 2, 2>(lhs), negate<true, false, false, true>(swizzle<1, 0, 3, 2>(rhs)));
+            const simd_type w = simd_mul(swizzle<3, 3, 3, 3>(lhs), rhs);
+
+            return simd_add(simd_add(x, y), simd_add(z, w));
+        }
+        // NOLINTEND(readability-identifier-length)
+
+        /*!
+         * @brief Hamilton product of quaternions stored as 4 contiguous floats, dst can be lhs or rhs
+         */
+        inline void hamilton_product_simd(const float* lhs, const float* rhs, float* dst)
+        {
+            _mm_storeu_ps(dst, hamilton_product(_mm_loadu_ps(lhs), _mm_loadu_ps(rhs)));
+        }
+
+        /*!
+         * @brief Hamilton product of quaternions stored as 4 contiguous doubles, dst can be lhs or rhs
+         */
+        inline void hamilton_product_simd(const double* lhs, const double* rhs, double* dst)
+        {
+            _mm256_storeu_pd(dst, hamilton_product(_mm256_loadu_pd(lhs), _mm256_loadu_pd(rhs)));
+        }
+#endif
+    }  // namespace ImplementationDetails
+}  // namespace LCNS::Algebra
@@ -0,0 +1,278 @@
+#pragma once
+
+#include "algebra/Concurrency.hpp"
+#include "algebra/Internal.hpp"
+
+#ifdef AVX_ENABLED_ON_CPU
+#include <immintrin.h>
+#endif
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace LCNS::Algebra
+{
+    namespace ImplementationDetails
+    {
+        /*!
+         * @brief Scalar "pack" of a single coordinate. Same interface as SimdPack so that a kernel written once
+         *        can process the bulk of an array with SimdPack and the remaining elements with ScalarPack.
+         */
+        template <Coordinate coordinate>
+        struct ScalarPack
+        {
+            using type = coordinate;
+
+            static constexpr size_t width = 1;
+
+            // Number of correct bits of rsqrt_estimate
+            static constexpr int rsqrt_estimate_bits = std::numeric_limits<coordinate>::digits;
+
+            // clang-format off
+            static type load(const coordinate* src)                 { return *src; }
+            static void store(coordinate* dst, type value)          { *dst = value; }
+            static type broadcast(coordinate value)                 { return value; }
+            static type add(type lhs, type rhs)                     { return lhs + rhs; }
+            static type sub(type lhs, type rhs)                     { return lhs - rhs; }
+            static type mul(type lhs, type rhs)                     { return lhs * rhs; }
+            static type div(type lhs, type rhs)                     { return lhs / rhs; }
+            static type fmadd(type lhs, type rhs, type acc)         { return lhs * rhs + acc; }
+            static type sqrt(type value)                            { return static_cast<coordinate>(std::sqrt(value)); }
+            static type min(type lhs, type rhs)                     { return lhs < rhs ? lhs : rhs; }
+            static type max(type lhs, type rhs)                     { return lhs < rhs ? rhs : lhs; }
+            static type abs(type value)                             { return value < 0 ? -value : value; }
+            static type select_non_zero(type cond, type lhs, type rhs) { return cond != 0 ? lhs : rhs; }
+            static type select_greater(type lhs, type rhs, type if_greater, type otherwise) { return lhs > rhs ? if_greater : otherwise; }
+            static type round(type value)                           { return std::nearbyint(value); }
+            static type floor(type value)                           { return std::floor(value); }
+            static type exp2i(type exponent)                        { return std::ldexp(coordinate{1}, static_cast<int>(exponent)); }
+            static type rsqrt_estimate(type value)                  { return coordinate{1} / std::sqrt(value); }
+            static bool all_less_equal(type lhs, type rhs)          { return lhs <= rhs; }
+            // clang-format on
+        };
+
+        /*!
+         * @brief Tells if a SIMD pack is available for this coordinate type
+         */
+        template <Coordinate coordinate>
+        constexpr bool has_simd_pack =
+#ifdef AVX_ENABLED_ON_CPU
+        std::is_same_v<coordinate, float> || std::is_same_v<coordinate, double>;
+#else
+        false;
+#endif
+
+#ifdef AVX_ENABLED_ON_CPU
+        /*!
+         * @brief Widest SIMD register available for float or double coordinates, see data_points_per_instruction
+         */
+        template <Coordinate coordinate>
+        struct SimdPack;
+
+        // clang-format off
+#if defined(AVX512_ENABLED)
+        template <>
+        struct SimdPack<float>
+        {
+            using type = __m512;
+
+            static constexpr size_t width = 16;
+
+            static constexpr int rsqrt_estimate_bits = 14;
+
+            static type load(const float* src)                  { return _mm512_loadu_ps(src); }
+            static void store(float* dst, type value)           { _mm512_storeu_ps(dst, value); }
+            static type broadcast(float value)                  { return _mm512_set1_ps(value); }
+            static type add(type lhs, type rhs)                 { return _mm512_add_ps(lhs, rhs); }
+            static type sub(type lhs, type rhs)                 { return _mm512_sub_ps(lhs, rhs); }
+            static type mul(type lhs, type rhs)                 { return _mm512_mul_ps(lhs, rhs); }
+            static type div(type lhs, type rhs)                 { return _mm512_div_ps(lhs, rhs); }
+            static type fmadd(type lhs, type rhs, type acc)     { return _mm512_fmadd_ps(lhs, rhs, acc); }
+            static type sqrt(type value)                        { return _mm512_maskz_sqrt_ps(0xFFFF, value); }  // GCC 12 warns on _mm512_sqrt_ps
+            static type min(type lhs, type rhs)                 { return _mm512_maskz_min_ps(0xFFFF, lhs, rhs); }
+            static type max(type lhs, type rhs)                 { return _mm512_maskz_max_ps(0xFFFF, lhs, rhs); }
+            static type abs(type value)                         { return _mm512_abs_ps(value); }
+            static type select_non_zero(type cond, type lhs, type rhs)
+            {
+                return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(cond, _mm512_setzero_ps(), _CMP_NEQ_UQ), rhs, lhs);
+            }
+            static type select_greater(type lhs, type rhs, type if_greater, type otherwise)
+            {
+                return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(lhs, rhs, _CMP_GT_OQ), otherwise, if_greater);
+            }
+            static type round(type value)                       { return _mm512_maskz_roundscale_ps(0xFFFF, value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+            static type floor(type value)                       { return _mm512_maskz_roundscale_ps(0xFFFF, value, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+            static type exp2i(type exponent)                    { return _mm512_maskz_scalef_ps(0xFFFF, _mm512_set1_ps(1.0f), exponent); }
+            static type rsqrt_estimate(type value)              { return _mm512_maskz_rsqrt14_ps(0xFFFF, value); }
+            static bool all_less_equal(type lhs, type rhs)      { return _mm512_cmp_ps_mask(lhs, rhs, _CMP_LE_OQ) == 0xFFFF; }
+        };
+
+        template <>
+        struct SimdPack<double>
+        {
+            using type = __m512d;
+
+            static constexpr size_t width = 8;
+
+            static constexpr int rsqrt_estimate_bits = 14;
+
+            static type load(const double* src)                 { return _mm512_loadu_pd(src); }
+            static void store(double* dst, type value)          { _mm512_storeu_pd(dst, value); }
+            static type broadcast(double value)                 { return _mm512_set1_pd(value); }
+            static type add(type lhs, type rhs)                 { return _mm512_add_pd(lhs, rhs); }
+            static type sub(type lhs, type rhs)                 { return _mm512_sub_pd(lhs, rhs); }
+            static type mul(type lhs, type rhs)                 { return _mm512_mul_pd(lhs, rhs); }
+            static type div(type lhs, type rhs)                 { return _mm512_div_pd(lhs, rhs); }
+            static type fmadd(type lhs, type rhs, type acc)     { return _mm512_fmadd_pd(lhs, rhs, acc); }
+            static type sqrt(type value)                        { return _mm512_maskz_sqrt_pd(0xFF, value); }
+            static type min(type lhs, type rhs)                 { return _mm512_maskz_min_pd(0xFF, lhs, rhs); }
+            static type max(type lhs, type rhs)                 { return _mm512_maskz_max_pd(0xFF, lhs, rhs); }
+            static type abs(type value)                         { return _mm512_abs_pd(value); }
+            static type select_non_zero(type cond, type lhs, type rhs)
+            {
+                return _mm512_mask_blend_pd(_mm512_cmp_pd_mask(cond, _mm512_setzero_pd(), _CMP_NEQ_UQ), rhs, lhs);
+            }
+            static type select_greater(type lhs, type rhs, type if_greater, type otherwise)
+            {
+                return _mm512_mask_blend_pd(_mm512_cmp_pd_mask(lhs, rhs, _CMP_GT_OQ), otherwise, if_greater);
+            }
+            static type round(type value)                       { return _mm512_maskz_roundscale_pd(0xFF, value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+            static type floor(type value)                       { return _mm512_maskz_roundscale_pd(0xFF, value, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+            static type exp2i(type exponent)                    { return _mm512_maskz_scalef_pd(0xFF, _mm512_set1_pd(1.0), exponent); }
+            static type rsqrt_estimate(type value)              { return _mm512_maskz_rsqrt14_pd(0xFF, value); }
+            static bool all_less_equal(type lhs, type rhs)      { return _mm512_cmp_pd_mask(lhs, rhs, _CMP_LE_OQ) == 0xFF; }
+        };
+#elif defined(AVX2_ENABLED)
+        template <>
+        struct SimdPack<float>
+        {
+            using type = __m256;
+
+            static constexpr size_t width = 8;
+
+            static constexpr int rsqrt_estimate_bits = 12;
+
+            static type load(const float* src)                  { return _mm256_loadu_ps(src); }
+            static void store(float* dst, type value)           { _mm256_storeu_ps(dst, value); }
+            static type broadcast(float value)                  { return _mm256_set1_ps(value); }
+            static type add(type lhs, type rhs)                 { return _mm256_add_ps(lhs, rhs); }
+            static type sub(type lhs, type rhs)                 { return _mm256_sub_ps(lhs, rhs); }
+            static type mul(type lhs, type rhs)                 { return _mm256_mul_ps(lhs, rhs); }
+            static type div(type lhs, type rhs)                 { return _mm256_div_ps(lhs, rhs); }
+#ifdef __FMA__
+            static type fmadd(type lhs, type rhs, type acc)     { return _mm256_fmadd_ps(lhs, rhs, acc); }
+#else
+            static type fmadd(type lhs, type rhs, type acc)     { return _mm256_add_ps(_mm256_mul_ps(lhs, rhs), acc); }
+#endif
+            static type sqrt(type value)                        { return _mm256_sqrt_ps(value); }
+            static type min(type lhs, type rhs)                 { return _mm256_min_ps(lhs, rhs); }
+            static type max(type lhs, type rhs)                 { return _mm256_max_ps(lhs, rhs); }
+            static type abs(type value)                         { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), value); }
+            static type select_non_zero(type cond, type lhs, type rhs)
+            {
+                return _mm256_blendv_ps(lhs, rhs, _mm256_cmp_ps(cond, _mm256_setzero_ps(), _CMP_EQ_OQ));
+            }
+            static type select_greater(type lhs, type rhs, type if_greater, type otherwise)
+            {
+                return _mm256_blendv_ps(otherwise, if_greater, _mm256_cmp_ps(lhs, rhs, _CMP_GT_OQ));
+            }
+            static type round(type value)                       { return _mm256_round_ps(value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+            static type floor(type value)                       { return _mm256_floor_ps(value); }
+            static type exp2i(type exponent)                    // Builds the exponent bits, exponent must be in [-126, 127]
+            {
+                return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(_mm256_cvtps_epi32(exponent), _mm256_set1_epi32(127)), 23));
+            }
+            static type rsqrt_estimate(type value)              { return _mm256_rsqrt_ps(value); }
+            static bool all_less_equal(type lhs, type rhs)      { return _mm256_movemask_ps(_mm256_cmp_ps(lhs, rhs, _CMP_LE_OQ)) == 0xFF; }
+        };
+
+        template <>
+        struct SimdPack<double>
+        {
+            using type = __m256d;
+
+            static constexpr size_t width = 4;
+
+            static constexpr int rsqrt_estimate_bits = 53;
+
+            static type load(const double* src)                 { return _mm256_loadu_pd(src); }
+            static void store(double* dst, type value)          { _mm256_storeu_pd(dst, value); }
+            static type broadcast(double value)                 { return _mm256_set1_pd(value); }
+            static type add(type lhs, type rhs)                 { return _mm256_add_pd(lhs, rhs); }
+            static type sub(type lhs, type rhs)                 { return _mm256_sub_pd(lhs, rhs); }
+            static type mul(type lhs, type rhs)                 { return _mm256_mul_pd(lhs, rhs); }
+            static type div(type lhs, type rhs)                 { return _mm256_div_pd(lhs, rhs); }
+#ifdef __FMA__
+            static type fmadd(type lhs, type rhs, type acc)     { return _mm256_fmadd_pd(lhs, rhs, acc); }
+#else
+            static type fmadd(type lhs, type rhs, type acc)     { return _mm256_add_pd(_mm256_mul_pd(lhs, rhs), acc); }
+#endif
+            static type sqrt(type value)                        { return _mm256_sqrt_pd(value); }
+            static type min(type lhs, type rhs)                 { return _mm256_min_pd(lhs, rhs); }
+            static type max(type lhs, type rhs)                 { return _mm256_max_pd(lhs, rhs); }
+            static type abs(type value)                         { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), value); }
+            static type select_non_zero(type cond, type lhs, type rhs)
+            {
+                return _mm256_blendv_pd(lhs, rhs, _mm256_cmp_pd(cond, _mm256_setzero_pd(), _CMP_EQ_OQ));
+            }
+            static type select_greater(type lhs, type rhs, type if_greater, type otherwise)
+            {
+                return _mm256_blendv_pd(otherwise, if_greater, _mm256_cmp_pd(lhs, rhs, _CMP_GT_OQ));
+            }
+            static type round(type value)                       { return _mm256_round_pd(value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+            static type floor(type value)                       { return _mm256_floor_pd(value); }
+            static type exp2i(type exponent)                    // Builds the exponent bits, exponent must be in [-1022, 1023]
+            {
+                const __m256i exponent64 = _mm256_cvtepi32_epi64(_mm256_cvtpd_epi32(exponent));
+
+                return _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_add_epi64(exponent64, _mm256_set1_epi64x(1023)), 52));
+            }
+            static type rsqrt_estimate(type value)              { return _mm256_div_pd(_mm256_set1_pd(1.0), _mm256_sqrt_pd(value)); }  // No rsqrt for double before AVX-512
+            static bool all_less_equal(type lhs, type rhs)      { return _mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_LE_OQ)) == 0xF; }
+        };
+#endif
+        // clang-format on
+#endif
+
+        /*!
+         * @brief Call kernel(pack, i) for i in [begin, end[, by steps of SimdPack<coordinate>::width when available,
+         *        then one element at a time with ScalarPack<coordinate> for the remaining elements.
+         * @param kernel is a callable taking a pack (ScalarPack or SimdPack) and the index of the first element to process
+         */
+        template <Coordinate coordinate, typename Kernel>
+        void for_each_pack(size_t begin, size_t end, Kernel&& kernel)
+        {
+            size_t i = begin;
+
+#ifdef AVX_ENABLED_ON_CPU
+            if constexpr (has_simd_pack<coordinate>)
+            {
+                using pack = SimdPack<coordinate>;
+
+                for (; i + pack::width <= end; i += pack::width)
+                {
+                    kernel(pack{}, i);
+                }
+            }
+#endif
+
+            for (; i < end; ++i)
+            {
+                kernel(ScalarPack<coordinate>{}, i);
+            }
+        }
+
+        /*!
+         * @brief Run kernel(pack, i) over all the elements of [0, count[, split between threads for large counts
+         */
+        template <Coordinate coordinate, typename Kernel>
+        void for_each_pack_concurrently(size_t count, const Kernel& kernel)
+        {
+            constexpr size_t granularity = 64;  // Multiple of all the SIMD widths
+
+            for_each_chunk_concurrently(count, granularity, [&kernel](size_t begin, size_t end) { for_each_pack<coordinate>(begin, end, kernel); });
+        }
+    }  // namespace ImplementationDetails
+}  // namespace LCNS::Algebra
@@ -0,0 +1,384 @@
+#pragma once
+
+#include "algebra/Internal.hpp"
+#include "algebra/Simd.hpp"
+
+#include <limits>
+#include <numbers>
+#include <type_traits>
+
+/*
+ * Elementary functions written against the pack interface of Simd.hpp: the same code runs one value at a time with
+ * ScalarPack, or on a full AVX2 / AVX-512 register with SimdPack, in float or double. They are meant for the batched
+ * kernels, which would otherwise call the standard library one value at a time.
+ *
+ * Maximum errors measured against the standard library evaluated in a wider type (double for float, long double for
+ * double), in units in the last place (ulps) of the coordinate type, see TestSimdMath.cpp:
+ *
+ *  | Function         | Domain                  | Max error | Without FMA |
+ *  |------------------|-------------------------|-----------|-------------|
+ *  | sin, cos, sincos | [-1e4, 1e4]             |     2     |      4      |
+ *  | atan2            | finite y and x          |     4     |      4      |
+ *  | asin, acos       | [-1, 1]                 |     4     |      4      |
+ *  | exp              | normal results          |     1     |      2      |
+ *  | rsqrt            | positive normal numbers |     2     |      2      |
+ *
+ * The bounds are the same for float and double, except rsqrt in float with AVX2: 4 ulps, the hardware estimate
+ * having 12 correct bits instead of 14 with AVX-512. rsqrt_fast trades precision for speed with a single
+ * Newton-Raphson step, see its documentation.
+ *
+ * Signed zeros, infinite and NaN inputs are not handled as special cases.
+ */
+
+namespace LCNS::Algebra
+{
+    /*!
+     * \brief Precision of the functions which have a fast approximated mode
+     */
+    enum class Precision
+    {
+        Fast,  // Vectorized approximations of this file, see the documentation of each function for the error bounds
+        Exact  // Standard library functions, correctly rounded operations
+    };
+
+    namespace ImplementationDetails
+    {
+        // NOLINTBEGIN(readability-magic-numbers, readability-identifier-length)
+
+        /*!
+         * @brief Evaluate a polynomial with the Horner scheme, coefficients from the highest degree to the constant term
+         */
+        template <Coordinate coordinate, typename simd, typename... Coefficients>
+        typename simd::type polynomial_simd(typename simd::type x, double highest, Coefficients... coefficients)
+        {
+            auto result = simd::broadcast(static_cast<coordinate>(highest));
+
+            ((result = simd::fmadd(result, x, simd::broadcast(static_cast<coordinate>(coefficients)))), ...);
+
+            return result;
+        }
+
+        /*!
+         * @brief Sine and cosine of x. The argument is reduced to [-pi/4, pi/4] by a multiple of pi/2 split in several
+         *        parts (Cody and Waite), then minimax polynomials from Cephes are used. Accurate for |x| up to 1e4.
+         */
+        template <Coordinate coordinate, typename simd>
+        void sincos_simd(typename simd::type x, typename simd::type& sin, typename simd::type& cos)
+        {
+            const auto c = [](double value) { return simd::broadcast(static_cast<coordinate>(value)); };
+
+            const auto quadrant = simd::round(simd::mul(x, c(2.0 / std::numbers::pi)));
+
+            auto r = x;
+            auto z = x;
+
+            if constexpr (std::is_same_v<coordinate, float>)
+            {
+                r = simd::fmadd(quadrant, c(-1.5703125), r);
+                r = simd::fmadd(quadrant, c(-4.837512969970703125e-4), r);
+                r = simd::fmadd(quadrant, c(-7.549790126404332e-8), r);
+                r = simd::fmadd(quadrant, c(1.7151244994428828e-15), r);  // What the third part misses in float
+                z = simd::mul(r, r);
+
+                sin = simd::fmadd(simd::mul(r, z), polynomial_simd<coordinate, simd>(z, -1.9515295891e-4, 8.3321608736e-3, -1.6666654611e-1), r);
+                cos = simd::fmadd(simd::mul(z, z),
+                                  polynomial_simd<coordinate, simd>(z, 2.443315711809948e-5, -1.388731625493765e-3, 4.166664568298827e-2),
+                                  simd::fmadd(c(-0.5), z, c(1.0)));
+            }
+            else
+            {
+                r = simd::fmadd(quadrant, c(-1.57079625129699707031), r);
+                r = simd::fmadd(quadrant, c(-7.54978941586159635336e-8), r);
+                r = simd::fmadd(quadrant, c(-5.39030285815811905290e-15), r);
+                z = simd::mul(r, r);
+
+                sin = simd::fmadd(simd::mul(r, z),
+                                  polynomial_simd<coordinate, simd>(z,
+                                                                    1.58962301576546568060e-10,
+                                                                    -2.50507477628578072866e-8,
+                                                                    2.75573136213857245213e-6,
+                                                                    -1.98412698295895385996e-4,
+                                                                    8.33333333332211858878e-3,
+                                                                    -1.66666666666666307295e-1),
+                                  r);
+                cos = simd::fmadd(simd::mul(z, z),
+                                  polynomial_simd<coordinate, simd>(z,
+                                                                    -1.13585365213876817300e-11,
+                                                                    2.08757008419747316778e-9,
+                                                                    -2.75573141792967388112e-7,
+                                                                    2.48015872888517045348e-5,
+                                                                    -1.38888888888730564116e-3,
+                                                                    4.16666666666665929218e-2),
+                                  simd::fmadd(c(-0.5), z, c(1.0)));
+            }
+
+            // x = r + quadrant * pi/2: the quadrant modulo 4 tells which polynomial to use and the sign of the result
+            const auto q      = simd::sub(quadrant, simd::mul(c(4.0), simd::floor(simd::mul(quadrant, c(0.25)))));
+            const auto is_odd = simd::sub(q, simd::mul(c(2.0), simd::floor(simd::mul(q, c(0.5)))));
+
+            const auto sin_base = simd::select_non_zero(is_odd, cos, sin);
+            const auto cos_base = simd::select_non_zero(is_odd, sin, cos);
+            const auto zero     = c(0.0);
+
+            // sin is negative in the quadrants 2 and 3, cos in the quadrants 1 and 2
+            sin = simd::select_greater(q, c(1.5), simd::sub(zero, sin_base), sin_base);
+            cos = simd::select_greater(simd::abs(simd::sub(q, c(1.5))), c(1.0), cos_base, simd::sub(zero, cos_base));
+        }
+
+        /*!
+         * @brief Sine of x, see sincos_simd
+         */
+        template <Coordinate coordinate, typename simd>
+        typename simd::type sin_simd(typename simd::type x)
+        {
+            auto sin = x;
+            auto cos = x;
+            sincos_simd<coordinate, simd>(x, sin, cos);
+
+            return sin;
+        }
+
+        /*!
+         * @brief Cosine of x, see sincos_simd
+         */
+        template <Coordinate coordinate, typename simd>
+        typename simd::type cos_simd(typename simd::type x)
+        {
+            auto sin = x;
+            auto cos = x;
+            sincos_simd<coordinate, simd>(x, sin, cos);
+
+            return cos;
+        }
+
+        /*!
+         * @brief Arc tangent of x for |x| <= tan(pi/8): minimax polynomial for float, rational approximation for double,
+         *        both from Cephes
+         */
+        template <Coordinate coordinate, typename simd>
+        typename simd::type atan_reduced_simd(typename simd::type x)
+        {
+            const auto z = simd::mul(x, x);
+
+            if constexpr (std::is_same_v<coordinate, float>)
+            {
+                const auto poly = polynomial_simd<coordinate, simd>(z, 8.05374449538e-2, -1.38776856032e-1, 1.99777106478e-1, -3.33329491539e-1);
+
+                return simd::fmadd(simd::mul(poly, z), x, x);
+            }
+            else
+            {
+                const auto num = polynomial_simd<coordinate, simd>(z,
+                                                                   -8.750608600031904122785e-1,
+                                                                   -1.615753718733365076637e1,
+                                                                   -7.500855792314704667340e1,
+                                                                   -1.228866684490136173410e2,
+                                                                   -6.485021904942025371773e1);
+                const auto den = polynomial_simd<coordinate, simd>(z,
+                                                                   1.0,
+                                                                   2.485846490142306297962e1,
+                                                                   1.650270098316988542046e2,
+                                                                   4.328810604912902668951e2,
+                                                                   4.853903996359136964868e2,
+                                                                   1.945506571482613964425e2);
+
+                return simd::fmadd(simd::div(simd::mul(z, num), den), x, x);
+            }
+        }
+
+        /*!
+         * @brief Arc tangent of y/x in [-pi, pi], using the signs of both arguments to find the quadrant. atan2(0, 0) = 0.
+         */
+        template <Coordinate coordinate, typename simd>
+        typename simd::type atan2_simd(typename simd::type y, typename simd::type x)
+        {
+            const auto c = [](double value) { return simd::broadcast(static_cast<coordinate>(value)); };
+
+            const auto zero  = c(0.0);
+            const auto one   = c(1.0);
+            const auto abs_y = simd::abs(y);
+            const auto abs_x = simd::abs(x);
+
+            // Reduce to t = min / max in [0, 1], then to [0, tan(pi/8)] with atan(t) = pi/4 + atan((t - 1) / (t + 1))
+            const auto largest  = simd::max(abs_x, abs_y);
+            const auto t        = simd::div(simd::min(abs_x, abs_y), simd::select_non_zero(largest, largest, one));
+            const auto tan_pi_8 = c(0.41421356237309504880);
+            const auto reduced  = simd::select_greater(t, tan_pi_8, simd::div(simd::sub(t, one), simd::add(t, one)), t);
+            const auto offset   = simd::select_greater(t, tan_pi_8, c(std::numbers::pi / 4.0), zero);
+
+            auto result = simd::add(offset, atan_reduced_simd<coordinate, simd>(reduced));
+
+            result = simd::select_greater(abs_y, abs_x, simd::sub(c(std::numbers::pi / 2.0), result), result);
+            result = simd::select_greater(zero, x, simd::sub(c(std::numbers::pi), result), result);
+
+            return simd::select_greater(zero, y, simd::sub(zero, result), result);
+        }
+
+        /*!
+         * @brief Arc sine of x in [-1, 1], as atan2(x, sqrt((1 - x) * (1 + x))) which stays accurate close to -1 and 1
+         */
+        template <Coordinate coordinate, typename simd>
+        typename simd::type asin_simd(typename simd::type x)
+        {
+            const auto one = simd::broadcast(coordinate{1});
+
+            return atan2_simd<coordinate, simd>(x, simd::sqrt(simd::mul(simd::sub(one, x), simd::add(one, x))));
+        }
+
+        /*!
+         * @brief Arc cosine of x in [-1, 1], see asin_simd
+         */
+        template <Coordinate coordinate, typename simd>
+        typename simd::type acos_simd(typename simd::type x)
+        {
+            const auto one = simd::broadcast(coordinate{1});
+
+            return atan2_simd<coordinate, simd>(simd::sqrt(simd::mul(simd::sub(one, x), simd::add(one, x))), x);
+        }
+
+        /*!
+         * @brief Exponential of x: x = r + n * ln(2) with |r| <= ln(2) / 2 and ln(2) split in two parts, exp(r) by its
+         *        Taylor polynomial (degree 7 for float, 13 for double, the truncation error is below 0.05 ulp), then the
+         *        result is multiplied by 2^n. Overflows give +infinity, results below the smallest normal number give 0.
+         */
+        template <Coordinate coordinate, typename simd>
+        typename simd::type exp_simd(typename simd::type x)
+        {
+            const auto c = [](double value) { return simd::broadcast(static_cast<coordinate>(value)); };
+
+            constexpr double max_log = std::is_same_v<coordinate, float> ? 88.72283905206835 : 709.782712893384;
+            constexpr double min_log = std::is_same_v<coordinate, float> ? -87.33654475055310 : -708.3964185322641;
+
+            const auto clamped = simd::min(simd::max(x, c(min_log)), c(max_log));
+            const auto n       = simd::round(simd::mul(clamped, c(std::numbers::log2e)));
+
+            auto r = clamped;
+            auto p = clamped;
+
+            if constexpr (std::is_same_v<coordinate, float>)
+            {
+                r = simd::fmadd(n, c(-0.693359375), r);
+                r = simd::fmadd(n, c(2.12194440e-4), r);
+                p = polynomial_simd<coordinate, simd>(r, 1.0 / 5040.0, 1.0 / 720.0, 1.0 / 120.0, 1.0 / 24.0, 1.0 / 6.0, 0.5, 1.0, 1.0);
+            }
+            else
+            {
+                r = simd::fmadd(n, c(-6.93145751953125e-1), r);
+                r = simd::fmadd(n, c(-1.42860682030941723212e-6), r);
+                p = polynomial_simd<coordinate, simd>(r,
+                                                      1.0 / 6227020800.0,
+                                                      1.0 / 479001600.0,
+                                                      1.0 / 39916800.0,
+                                                      1.0 / 3628800.0,
+                                                      1.0 / 362880.0,
+                                                      1.0 / 40320.0,
+                                                      1.0 / 5040.0,
+                                                      1.0 / 720.0,
+                                                      1.0 / 120.0,
+                                                      1.0 / 24.0,
+                                                      1.0 / 6.0,
+                                                      0.5,
+                                                      1.0,
+                                                      1.0);
+            }
+
+            // 2^n in two factors so that each of them stays a normal number, n being in [-126, 128] for float
+            const auto half_n = simd::floor(simd::mul(n, c(0.5)));
+            const auto result = simd::mul(simd::mul(p, simd::exp2i(half_n)), simd::exp2i(simd::sub(n, half_n)));
+
+            const auto overflow = simd::select_greater(x, c(max_log), c(std::numeric_limits<coordinate>::infinity()), result);
+
+            return simd::select_greater(c(min_log), x, c(0.0), overflow);
+        }
+
+        /*!
+         * @brief One Newton-Raphson step refining estimate, an approximation of 1 / sqrt(x): it roughly doubles the
+         *        number of correct bits
+         */
+        template <Coordinate coordinate, typename simd>
+        typename simd::type rsqrt_newton_step(typename simd::type x, typename simd::type estimate)
+        {
+            const auto half_x = simd::mul(simd::broadcast(coordinate{0.5}), x);
+
+            return simd::mul(estimate, simd::sub(simd::broadcast(coordinate{1.5}), simd::mul(half_x, simd::mul(estimate, estimate))));
+        }
+
+        /*!
+         * @brief 1 / sqrt(x) for x > 0: the hardware estimate refined by as many Newton-Raphson steps as needed to reach the
+         *        precision of the coordinate type (none for the packs computing 1 / sqrt(x) directly)
+         */
+        template <Coordinate coordinate, typename simd>
+        typename simd::type rsqrt_simd(typename simd::type x)
+        {
+            constexpr int steps = []
+            {
+                int bits  = simd::rsqrt_estimate_bits;
+                int count = 0;
+
+                // Each step roughly doubles the number of correct bits
+                for (; bits < std::numeric_limits<coordinate>::digits - 1; ++count)
+                {
+                    bits = 2 * bits - 1;
+                }
+
+                return count;
+            }();
+
+            auto result = simd::rsqrt_estimate(x);
+
+            for (int i = 0; i < steps; ++i)
+            {
+                result = rsqrt_newton_step<coordinate, simd>(x, result);
+            }
+
+            return result;
+        }
+
+        /*!
+         * @brief 1 / sqrt(x) for x > 0: the hardware estimate refined by a single Newton-Raphson step, whatever the
+         *        precision of the coordinate type. The relative error is below 2^-22 with a 12 bits estimate (AVX2 float)
+         *        and 2^-26 with a 14 bits estimate (AVX-512), the packs computing 1 / sqrt(x) directly being exact.
+         */
+        template <Coordinate coordinate, typename simd>
+        typename simd::type rsqrt_fast_simd(typename simd::type x)
+        {
+            if constexpr (simd::rsqrt_estimate_bits >= std::numeric_limits<coordinate>::digits - 1)
+            {
+                return simd::rsqrt_estimate(x);
+            }
+            else
+            {
+                return rsqrt_newton_step<coordinate, simd>(x, simd::rsqrt_estimate(x));
+            }
+        }
+
+        /*!
+         * @brief rsqrt_fast_simd for a single value, from the scalar hardware estimate: rsqrtss for float, vrsqrt14sd for
+         *        double with AVX-512, 1 / sqrt(x) otherwise
+         */
+        template <Coordinate coordinate>
+        coordinate rsqrt_fast(coordinate x) requires(std::is_floating_point_v<coordinate>)
+        {
+            using simd = ScalarPack<coordinate>;
+
+#ifdef AVX_ENABLED_ON_CPU
+            if constexpr (std::is_same_v<coordinate, float>)
+            {
+                return rsqrt_newton_step<coordinate, simd>(x, _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x))));
+            }
+#if defined(AVX512_ENABLED)
+            else if constexpr (std::is_same_v<coordinate, double>)
+            {
+                return rsqrt_newton_step<coordinate, simd>(x, _mm_cvtsd_f64(_mm_maskz_rsqrt14_sd(0x1, _mm_setzero_pd(), _mm_set_sd(x))));
+            }
+#endif
+            else
+#endif
+            {
+                return rsqrt_fast_simd<coordinate, simd>(x);
+            }
+        }
+
+        // NOLINTEND(readability-magic-numbers, readability-identifier-length)
+    }  // namespace ImplementationDetails
+}  // namespace LCNS::Algebra
@@ -0,0 +1,842 @@
+#pragma once
+
+#include "algebra/BlockedMultiplication.hpp"
+#include "algebra/EigenDecomposition.hpp"
+#include "algebra/Internal.hpp"
+#include "algebra/MappingFunctions.hpp"
+#include "algebra/Matrix.hpp"
+#include "algebra/QRDecomposition.hpp"
+#include "algebra/Simd.hpp"
+#include "algebra/Vector.hpp"
+#include "algebra/VectorArray.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+/*
+ * Singular value decomposition A = U * diag(sigma) * V^T of 3x3 matrices as described by McAdams et al., "Computing
+ * the singular value decomposition of 3x3 matrices with minimal branching and elementary floating point operations":
+ * - V diagonalizes the symmetric matrix A^T * A, by the same branch-free Jacobi sweeps as eigenSymmetric.
+ * - The columns of B = A * V are orthogonal, of lengths sigma. They are sorted by decreasing length, since the small
+ *   eigenvalues of A^T * A, the squares of the singular values, may come in the wrong order.
+ * - The QR decomposition of B by three Givens rotations gives U, and R is diagonal up to rounding errors.
+ * Computing A^T * A squares the condition number, so that the columns of B are orthogonal to epsilon * sigma[0]^2 /
+ * (sigma[i]^2 - sigma[j]^2) only, which is far from the working precision for close small singular values. Before
+ * being sorted, they are made orthogonal by one sweep of one-sided Jacobi rotations (Hestenes), each rotation
+ * converging quadratically from the nearly orthogonal columns.
+ * U and V are rotations rather than any orthogonal matrices, the sign of det(A) being carried by the last singular
+ * value: sigma[0] >= sigma[1] >= |sigma[2]|. The rotation of the polar decomposition A = R * S is then R = U * V^T,
+ * with S = V * diag(sigma) * V^T, also when A is a reflection, as needed by shape matching and rigid registration.
+ *
+ * The singular values are accurate to epsilon * sigma[0], U * diag(sigma) * V^T giving back A to the working
+ * precision. The kernel has no branches and a fixed maximum number of sweeps, so that arrays of matrices are
+ * decomposed one per SIMD lane.
+ *
+ * The largest singular triplets of large m x n matrices are computed by the randomized range finder of Halko,
+ * Martinsson and Tropp, "Finding structure with randomness":
+ * - Y = A * Omega for a Gaussian random n x l matrix Omega, l = k + oversampling, whose orthonormal basis Q, from a
+ *   Householder QR decomposition, spans the dominant column space of A with a high probability.
+ * - Each power iteration replaces Q by the orthonormal basis of A * A^T * Q, orthonormalized in between, which
+ *   raises the decay of the singular values to the power 2q + 1 for a slowly decaying spectrum.
+ * - The l x n matrix B = Q^T * A has the singular values of A restricted to Q. Its rows are made orthogonal by
+ *   one-sided Jacobi sweeps, B = J * diag(sigma) * V^T, which are accurate also for the small singular values, and
+ *   U = Q * J.
+ * All the products by A are blocked multiplications split between threads, A being read once per product in
+ * panels of rows, from the first to the last, so that it may be mapped from a file. Besides A, the memory used is in
+ * O((m + n) * l).
+ */
+
+namespace LCNS::Algebra
+{
+    /*!
+     * \brief Singular value decomposition of a 3x3 matrix, see singularValueDecomposition
+     */
+    template <Coordinate coordinate, StorageOrder order = StorageOrder::RowMajor>
+    struct SingularValueDecomposition
+    {
+        Matrix<coordinate, 3, 3, order> u;               // Rotation whose columns are the left singular vectors
+        Vector<coordinate, 3>           singularValues;  // sigma[0] >= sigma[1] >= |sigma[2]|, sigma[2] < 0 if det(A) < 0
+        Matrix<coordinate, 3, 3, order> v;               // Rotation whose columns are the right singular vectors
+    };
+
+    /*!
+     * \brief Polar decomposition of a 3x3 matrix, see polarDecomposition
+     */
+    template <Coordinate coordinate, StorageOrder order = StorageOrder::RowMajor>
+    struct PolarDecomposition
+    {
+        Matrix<coordinate, 3, 3, order> rotation;  // Closest rotation to the matrix
+        Matrix<coordinate, 3, 3, order> stretch;   // Symmetric matrix, positive semi-definite if det(A) >= 0
+    };
+
+    /*!
+     * \brief Singular value decomposition matrix = u * diag(singularValues) * v^T of a 3x3 matrix, computed without
+     *        branches and with a fixed maximum number of Jacobi sweeps, see the introduction of
+     *        SingularValueDecomposition.hpp
+     * @param matrix is the matrix to decompose
+     * @return the rotations u and v and the singular values, in decreasing order, the last one being negative if the
+     *         determinant of the matrix is negative
+     */
+    template <Coordinate coordinate, StorageOrder order>
+    SingularValueDecomposition<coordinate, order> singularValueDecomposition(const Matrix<coordinate, 3, 3, order>& matrix)
+    requires std::is_floating_point_v<coordinate>;
+
+    /*!
+     * \brief Singular value decomposition of each 3x3 matrix, see above. Several matrices are decomposed at once with
+     *        SIMD instructions, one per lane, large arrays are split between threads.
+     * @param matrices are the matrices to decompose
+     * @param u is the destination of the rotations u. Its size must be matrices.size().
+     * @param singularValues is the destination of the singular values. Its count must be matrices.size().
+     * @param v is the destination of the rotations v. Its size must be matrices.size().
+     */
+    template <Coordinate coordinate, StorageOrder order = StorageOrder::RowMajor>
+    void singularValueDecomposition(std::type_identity_t<std::span<const Matrix<coordinate, 3, 3, order>>> matrices,
+                                    std::type_identity_t<std::span<Matrix<coordinate, 3, 3, order>>>       u,
+                                    VectorArray<coordinate, 3>&                                           singularValues,
+                                    std::type_identity_t<std::span<Matrix<coordinate, 3, 3, order>>>       v)
+    requires std::is_floating_point_v<coordinate>;
+
+    /*!
+     * \brief Polar decomposition matrix = rotation * stretch of a 3x3 matrix, from its singular value decomposition:
+     *        rotation = u * v^T and stretch = v * diag(singularValues) * v^T
+     * @param matrix is the matrix to decompose, such as a deformation gradient or a covariance of point sets
+     * @return the rotation, closest to the matrix in the Frobenius norm, and the symmetric stretch
+     */
+    template <Coordinate coordinate, StorageOrder order>
+    PolarDecomposition<coordinate, order> polarDecomposition(const Matrix<coordinate, 3, 3, order>& matrix)
+    requires std::is_floating_point_v<coordinate>;
+
+    /*!
+     * \brief Polar decomposition of each 3x3 matrix, see above, batched as singularValueDecomposition
+     * @param matrices are the matrices to decompose
+     * @param rotations is the destination of the rotations. Its size must be matrices.size().
+     * @param stretches is the destination of the symmetric stretches. Its size must be matrices.size().
+     */
+    template <Coordinate coordinate, StorageOrder order = StorageOrder::RowMajor>
+    void polarDecomposition(std::type_identity_t<std::span<const Matrix<coordinate, 3, 3, order>>> matrices,
+                            std::type_identity_t<std::span<Matrix<coordinate, 3, 3, order>>>       rotations,
+                            std::type_identity_t<std::span<Matrix<coordinate, 3, 3, order>>>       stretches)
+    requires std::is_floating_point_v<coordinate>;
+
+    /*!
+     * \brief Rotation of the polar decomposition of each 3x3 matrix, for rotation extraction without the stretches
+     * @param matrices are the matrices to decompose
+     * @param rotations is the destination of the rotations. Its size must be matrices.size().
+     */
+    template <Coordinate coordinate, StorageOrder order = StorageOrder::RowMajor>
+    void polarDecomposition(std::type_identity_t<std::span<const Matrix<coordinate, 3, 3, order>>> matrices,
+                            std::type_identity_t<std::span<Matrix<coordinate, 3, 3, order>>>       rotations)
+    requires std::is_floating_point_v<coordinate>;
+
+    /*!
+     * \brief The k largest singular values of a large matrix whose size is known at run time and their singular
+     *        vectors, A ~ U * diag(sigma) * V^T, by the randomized range finder with power iterations, see the
+     *        introduction of SingularValueDecomposition.hpp. Much faster than a full decomposition when k is small
+     *        compared to the size of A, most of the work being done by blocked multiplications split between threads.
+     * @param matrix holds the m x n matrix A row by row
+     * @param cols is the number of columns n of A
+     * @param u receives the orthonormal left singular vectors, m rows of k coefficients, column i being the singular
+     *        vector of singular_values[i]
+     * @param singular_values receives the k largest singular values in decreasing order
+     * @param v receives the right singular vectors, n rows of k coefficients. They are orthonormal, except that the
+     *        columns of null singular values, if A has a rank below k, are null.
+     * @param oversampling is the number of random vectors in addition to k, which makes the probability of missing a
+     *        direction of the k largest singular values negligible
+     * @param power_iterations is the number of multiplications by A * A^T of the basis, each one costing two passes on
+     *        A, for the accuracy of matrices whose singular values decay slowly
+     * @return false if A has coefficients which are not finite, the results being then unspecified
+     * @throw std::invalid_argument if k, the size of singular_values, is null or larger than the number of rows or
+     *        columns of A, or if the sizes of matrix, u and v do not match
+     */
+    template <Coordinate coordinate>
+    bool randomized_svd(std::span<const coordinate> matrix,
+                        size_t                      cols,
+                        std::span<coordinate>       u,
+                        std::span<coordinate>       singular_values,
+                        std::span<coordinate>       v,
+                        size_t                      oversampling     = 10,
+                        unsigned int                power_iterations = 2) requires(std::is_floating_point_v<coordinate>);
+
+    namespace ImplementationDetails
+    {
+        // NOLINTBEGIN(readability-identifier-length)
+
+        /*!
+         * @brief One-sided Jacobi rotation of the columns i < j of b making them orthogonal, accumulated in the columns
+         *        of v, with the angle of jacobi_rotate for the 2x2 matrix of their dot products
+         */
+        template <Coordinate coordinate, typename simd, size_t i, size_t j>
+        void svd_orthogonalize(typename simd::type (&b)[3][3], typename simd::type (&v)[3][3])
+        {
+            const auto zero       = simd::broadcast(coordinate{0});
+            const auto one        = simd::broadcast(coordinate{1});
+            const auto negligible = simd::broadcast(std::numeric_limits<coordinate>::epsilon() * std::numeric_limits<coordinate>::epsilon());
+
+            const auto alpha = simd::fmadd(b[0][i], b[0][i], simd::fmadd(b[1][i], b[1][i], simd::mul(b[2][i], b[2][i])));
+            const auto beta  = simd::fmadd(b[0][j], b[0][j], simd::fmadd(b[1][j], b[1][j], simd::mul(b[2][j], b[2][j])));
+            const auto dot   = simd::fmadd(b[0][i], b[0][j], simd::fmadd(b[1][i], b[1][j], simd::mul(b[2][i], b[2][j])));
+
+            const auto gamma       = simd::select_greater(simd::abs(dot), negligible, dot, zero);
+            const auto d           = simd::sub(beta, alpha);
+            const auto two_gamma   = simd::add(gamma, gamma);
+            const auto r           = simd::sqrt(simd::fmadd(d, d, simd::mul(two_gamma, two_gamma)));
+            const auto denominator = simd::add(simd::abs(d), r);
+            const auto non_null    = simd::select_non_zero(denominator, denominator, one);
+
+            const auto t = simd::div(simd::select_greater(zero, d, simd::sub(zero, two_gamma), two_gamma), non_null);
+            const auto c = simd::select_non_zero(gamma, simd::sqrt(simd::div(non_null, simd::select_non_zero(r, simd::add(r, r), one))), one);
+            const auto s = simd::mul(t, c);
+
+            unroll<3>(
+            [&](auto k)
+            {
+                const auto bki = b[k][i];
+                const auto vki = v[k][i];
+
+                b[k][i] = simd::sub(simd::mul(c, bki), simd::mul(s, b[k][j]));
+                b[k][j] = simd::fmadd(s, bki, simd::mul(c, b[k][j]));
+                v[k][i] = simd::sub(simd::mul(c, vki), simd::mul(s, v[k][j]));
+                v[k][j] = simd::fmadd(s, vki, simd::mul(c, v[k][j]));
+            });
+        }
+
+        /*!
+         * @brief Exchange the columns i < j of b and v if the column i of b is shorter, without branches. The new column
+         *        j is the opposite of the former column i, so that v stays a rotation.
+         */
+        template <Coordinate coordinate, typename simd, size_t i, size_t j>
+        void svd_sort(typename simd::type (&b)[3][3], typename simd::type (&v)[3][3], typename simd::type (&lengths)[3])
+        {
+            const auto zero = simd::broadcast(coordinate{0});
+
+            unroll<3>(
+            [&](auto k)
+            {
+                const auto bki = b[k][i];
+                const auto vki = v[k][i];
+
+                b[k][i] = simd::select_greater(lengths[j], lengths[i], b[k][j], bki);
+                b[k][j] = simd::select_greater(lengths[j], lengths[i], simd::sub(zero, bki), b[k][j]);
+                v[k][i] = simd::select_greater(lengths[j], lengths[i], v[k][j], vki);
+                v[k][j] = simd::select_greater(lengths[j], lengths[i], simd::sub(zero, vki), v[k][j]);
+            });
+
+            const auto li = lengths[i];
+
+            lengths[i] = simd::max(li, lengths[j]);
+            lengths[j] = simd::min(li, lengths[j]);
+        }
+
+        /*!
+         * @brief Givens rotation of the rows i < j of b cancelling b[j][i], accumulated in the columns of u. A null
+         *        column gives the identity.
+         */
+        template <Coordinate coordinate, typename simd, size_t i, size_t j>
+        void svd_givens(typename simd::type (&b)[3][3], typename simd::type (&u)[3][3])
+        {
+            const auto one = simd::broadcast(coordinate{1});
+
+            const auto rho      = simd::sqrt(simd::fmadd(b[i][i], b[i][i], simd::mul(b[j][i], b[j][i])));
+            const auto non_null = simd::select_non_zero(rho, rho, one);
+
+            const auto c = simd::select_non_zero(rho, simd::div(b[i][i], non_null), one);
+            const auto s = simd::div(b[j][i], non_null);
+
+            unroll<3>(
+            [&](auto k)
+            {
+                const auto bik = b[i][k];
+                const auto uki = u[k][i];
+
+                b[i][k] = simd::fmadd(c, bik, simd::mul(s, b[j][k]));
+                b[j][k] = simd::sub(simd::mul(c, b[j][k]), simd::mul(s, bik));
+                u[k][i] = simd::fmadd(c, uki, simd::mul(s, u[k][j]));
+                u[k][j] = simd::sub(simd::mul(c, u[k][j]), simd::mul(s, uki));
+            });
+        }
+
+        /*!
+         * @brief Singular value decomposition of a 3x3 matrix, see the introduction of SingularValueDecomposition.hpp
+         * @param a is the matrix to decompose, a[row][col]
+         * @param u is the destination of the rotation u
+         * @param sigma is the destination of the singular values
+         * @param v is the destination of the rotation v
+         */
+        template <Coordinate coordinate, typename simd>
+        void svd3x3(const typename simd::type (&a)[3][3],
+                    typename simd::type (&u)[3][3],
+                    typename simd::type (&sigma)[3],
+                    typename simd::type (&v)[3][3])
+        {
+            const auto zero = simd::broadcast(coordinate{0});
+            const auto one  = simd::broadcast(coordinate{1});
+
+            // Scaled to max|a| = 1 so that A^T * A can neither overflow nor underflow
+            auto scale = zero;
+
+            unroll<3>([&](auto p) { unroll<3>([&](auto q) { scale = simd::max(scale, simd::abs(a[p][q])); }); });
+
+            const auto inverse_scale = simd::div(one, simd::select_non_zero(scale, scale, one));
+
+            typename simd::type b[3][3];
+            typename simd::type s[3][3];
+
+            unroll<3>([&](auto p) { unroll<3>([&](auto q) { b[p][q] = simd::mul(a[p][q], inverse_scale); }); });
+
+            unroll<3>(
+            [&](auto p)
+            {
+                unroll<3>(
+                [&](auto q)
+                {
+                    if constexpr (p <= q)
+                    {
+                        s[p][q] = simd::fmadd(b[0][p], b[0][q], simd::fmadd(b[1][p], b[1][q], simd::mul(b[2][p], b[2][q])));
+                    }
+                });
+            });
+
+            typename simd::type w[3][3];
+            jacobi_eigen<coordinate, 3, simd>(s, w);
+
+            // Eigenvalues in decreasing order: exchanging the first and last eigenvectors, the second one being negated
+            // to keep the orientation. v is then a rotation if w was one, otherwise its last column is negated.
+            unroll<3>(
+            [&](auto k)
+            {
+                v[k][0] = w[k][2];
+                v[k][1] = simd::sub(zero, w[k][1]);
+                v[k][2] = w[k][0];
+            });
+
+            const auto cofactor0   = simd::sub(simd::mul(v[1][1], v[2][2]), simd::mul(v[2][1], v[1][2]));
+            const auto cofactor1   = simd::sub(simd::mul(v[2][1], v[0][2]), simd::mul(v[0][1], v[2][2]));
+            const auto cofactor2   = simd::sub(simd::mul(v[0][1], v[1][2]), simd::mul(v[1][1], v[0][2]));
+            const auto determinant = simd::fmadd(v[0][0], cofactor0, simd::fmadd(v[1][0], cofactor1, simd::mul(v[2][0], cofactor2)));
+            const auto orientation = simd::select_greater(zero, determinant, simd::sub(zero, one), one);
+
+            unroll<3>([&](auto k) { v[k][2] = simd::mul(v[k][2], orientation); });
+
+            // B = A * V, whose columns are made orthogonal to the working precision, then sorted by decreasing length
+            typename simd::type av[3][3];
+            typename simd::type lengths[3];
+
+            unroll<3>(
+            [&](auto p)
+            {
+                unroll<3>([&](auto q) { av[p][q] = simd::fmadd(b[p][0], v[0][q], simd::fmadd(b[p][1], v[1][q], simd::mul(b[p][2], v[2][q]))); });
+            });
+
+            svd_orthogonalize<coordinate, simd, 0, 1>(av, v);
+            svd_orthogonalize<coordinate, simd, 0, 2>(av, v);
+            svd_orthogonalize<coordinate, simd, 1, 2>(av, v);
+
+            unroll<3>([&](auto q) { lengths[q] = simd::fmadd(av[0][q], av[0][q], simd::fmadd(av[1][q], av[1][q], simd::mul(av[2][q], av[2][q]))); });
+
+            svd_sort<coordinate, simd, 0, 1>(av, v, lengths);
+            svd_sort<coordinate, simd, 1, 2>(av, v, lengths);
+            svd_sort<coordinate, simd, 0, 1>(av, v, lengths);
+
+            // B = U * R
+            unroll<3>([&](auto p) { unroll<3>([&](auto q) { u[p][q] = p == q ? one : zero; }); });
+
+            svd_givens<coordinate, simd, 0, 1>(av, u);
+            svd_givens<coordinate, simd, 0, 2>(av, u);
+            svd_givens<coordinate, simd, 1, 2>(av, u);
+
+            unroll<3>([&](auto p) { sigma[p] = simd::mul(av[p][p], scale); });
+        }
+
+        /*!
+         * @brief rotation = u * v^T and stretch = v * diag(sigma) * v^T
+         */
+        template <Coordinate coordinate, typename simd>
+        void polar3x3(const typename simd::type (&u)[3][3],
+                      const typename simd::type (&sigma)[3],
+                      const typename simd::type (&v)[3][3],
+                      typename simd::type (&rotation)[3][3],
+                      typename simd::type (&stretch)[3][3])
+        {
+            unroll<3>(
+            [&](auto p)
+            {
+                unroll<3>(
+                [&](auto q)
+                {
+                    rotation[p][q] = simd::fmadd(u[p][0], v[q][0], simd::fmadd(u[p][1], v[q][1], simd::mul(u[p][2], v[q][2])));
+                    stretch[p][q]  = simd::fmadd(simd::mul(v[p][0], sigma[0]),
+                                                v[q][0],
+                                                simd::fmadd(simd::mul(v[p][1], sigma[1]), v[q][1], simd::mul(simd::mul(v[p][2], sigma[2]), v[q][2])));
+                });
+            });
+        }
+
+        /*!
+         * @brief Store the lanes of m into matrices[index + lane]
+         */
+        template <Coordinate coordinate, typename simd, StorageOrder order>
+        void store_matrix_lanes(const typename simd::type (&m)[3][3], std::span<Matrix<coordinate, 3, 3, order>> matrices, size_t index)
+        {
+            coordinate values[simd::width];
+
+            for (unsigned int p = 0; p < 3; ++p)
+            {
+                for (unsigned int q = 0; q < 3; ++q)
+                {
+                    simd::store(values, m[p][q]);
+
+                    for (size_t lane = 0; lane < simd::width; ++lane)
+                    {
+                        matrices[index + lane](p, q) = values[lane];
+                    }
+                }
+            }
+        }
+
+        /*!
+         * @brief Polar decompositions of the batched polarDecomposition overloads, the stretches being stored if not
+         *        empty
+         */
+        template <Coordinate coordinate, StorageOrder order>
+        void polar_decompositions(std::span<const Matrix<coordinate, 3, 3, order>> matrices,
+                                  std::span<Matrix<coordinate, 3, 3, order>>       rotations,
+                                  std::span<Matrix<coordinate, 3, 3, order>>       stretches)
+        {
+            for_each_matrix_pack(matrices,
+                                 [rotations, stretches](auto pack, const auto& lanes, size_t i, size_t index)
+                                 {
+                                     using simd = decltype(pack);
+
+                                     typename simd::type a[3][3];
+                                     typename simd::type u[3][3];
+                                     typename simd::type sigma[3];
+                                     typename simd::type v[3][3];
+                                     typename simd::type rotation[3][3];
+                                     typename simd::type stretch[3][3];
+
+                                     unroll<3>([&](auto p) { unroll<3>([&](auto q) { a[p][q] = simd::load(lanes[p * 3 + q].data() + i); }); });
+
+                                     svd3x3<coordinate, simd>(a, u, sigma, v);
+                                     polar3x3<coordinate, simd>(u, sigma, v, rotation, stretch);
+
+                                     store_matrix_lanes<coordinate, simd>(rotation, rotations, index);
+
+                                     if (!stretches.empty())
+                                     {
+                                         store_matrix_lanes<coordinate, simd>(stretch, stretches, index);
+                                     }
+                                 });
+        }
+
+        /*!
+         * @brief Throw if a destination of a batched decomposition does not have the same number of matrices
+         */
+        inline void check_same_size(size_t destination, size_t count)
+        {
+            if (destination != count)
+            {
+                throw std::invalid_argument("The destination must have the same number of matrices");
+            }
+        }
+
+        /*!
+         * @brief Number of rows of A per product by A^T in randomized_svd, and largest number of one-sided Jacobi sweeps
+         */
+        constexpr size_t       randomized_svd_panel_rows = 1024;
+        constexpr unsigned int svd_jacobi_sweeps         = 30;
+
+        /*!
+         * @brief Z = A^T * Q for the m x n matrix A of leading dimension lda and the m x l matrix Q, by panels of rows of A
+         */
+        template <Coordinate coordinate>
+        void svd_multiply_transposed(const coordinate* a, size_t lda, size_t m, size_t n, const coordinate* q, size_t l, coordinate* z)
+        {
+            std::fill(z, z + n * l, coordinate{0});
+
+            for (size_t row = 0; row < m; row += randomized_svd_panel_rows)
+            {
+                const size_t rows = std::min(randomized_svd_panel_rows, m - row);
+
+                multiply_add_blocked<coordinate, true>(n, l, rows, coordinate{1}, a + row * lda, lda, q + row * l, l, z, l);
+            }
+        }
+
+        /*!
+         * @brief Make the l rows of n coefficients of b orthogonal by one-sided Jacobi rotations, accumulated in the l x l
+         *        matrix j: b = j * b' on output, b being the input. Each pair of rows is rotated as by svd_orthogonalize,
+         *        until all the pairs are orthogonal to epsilon * sqrt(n) relatively to their lengths.
+         */
+        template <Coordinate coordinate>
+        void svd_jacobi_rows(coordinate* b, size_t l, size_t n, coordinate* j)
+        {
+            const coordinate tolerance = std::numeric_limits<coordinate>::epsilon() * std::sqrt(static_cast<coordinate>(n));
+
+            std::fill(j, j + l * l, coordinate{0});
+
+            for (size_t i = 0; i < l; ++i)
+            {
+                j[i * l + i] = 1;
+            }
+
+            // The rotations of the rows of b are applied to the rows of j^T, transposed at the end
+            const auto rotate = [](coordinate* x, coordinate* y, size_t count, coordinate c, coordinate s)
+            {
+                for_each_pack<coordinate>(0,
+                                          count,
+                                          [=](auto pack, size_t i)
+                                          {
+                                              using simd = decltype(pack);
+
+                                              const auto xi = simd::load(x + i);
+                                              const auto yi = simd::load(y + i);
+
+                                              simd::store(x + i, simd::sub(simd::mul(simd::broadcast(c), xi), simd::mul(simd::broadcast(s), yi)));
+                                              simd::store(y + i, simd::fmadd(simd::broadcast(s), xi, simd::mul(simd::broadcast(c), yi)));
+                                          });
+            };
+
+            for (unsigned int sweep = 0; sweep < svd_jacobi_sweeps; ++sweep)
+            {
+                bool rotated = false;
+
+                for (size_t p = 0; p + 1 < l; ++p)
+                {
+                    for (size_t q = p + 1; q < l; ++q)
+                    {
+                        coordinate* bp = b + p * n;
+                        coordinate* bq = b + q * n;
+
+                        const coordinate alpha = dot_product(bp, bp, n);
+                        const coordinate beta  = dot_product(bq, bq, n);
+                        const coordinate gamma = dot_product(bp, bq, n);
+
+                        if (!(std::abs(gamma) > tolerance * std::sqrt(alpha * beta)))
+                        {
+                            continue;
+                        }
+
+                        const coordinate d = beta - alpha;
+                        const coordinate t = (d < 0 ? -2 * gamma : 2 * gamma) / (std::abs(d) + std::hypot(d, 2 * gamma));
+                        const coordinate c = 1 / std::sqrt(1 + t * t);
+
+                        rotate(bp, bq, n, c, t * c);
+                        rotate(j + p * l, j + q * l, l, c, t * c);
+
+                        rotated = true;
+                    }
+                }
+
+                if (!rotated)
+                {
+                    break;
+                }
+            }
+
+            for (size_t p = 0; p < l; ++p)
+            {
+                for (size_t q = p + 1; q < l; ++q)
+                {
+                    std::swap(j[p * l + q], j[q * l + p]);
+                }
+            }
+        }
+
+        /*!
+         * @brief Randomized singular value decomposition of the m x n matrix a, see randomized_svd. a, u and v have the
+         *        leading dimensions lda, ldu and ldv.
+         */
+        template <Coordinate coordinate>
+        bool randomized_svd(const coordinate* a,
+                            size_t            lda,
+                            size_t            m,
+                            size_t            n,
+                            size_t            k,
+                            coordinate*       u,
+                            size_t            ldu,
+                            coordinate*       sigma,
+                            coordinate*       v,
+                            size_t            ldv,
+                            size_t            oversampling,
+                            unsigned int      power_iterations)
+        {
+            const size_t l = std::min(k + oversampling, std::min(m, n));
+
+            std::vector<coordinate> omega(n * l);
+            std::vector<coordinate> q(m * l);
+
+            // The same random matrix for each call, so that the results are reproducible
+            std::mt19937                         gen;
+            std::normal_distribution<coordinate> dis;
+
+            std::generate(omega.begin(), omega.end(), [&]() { return dis(gen); });
+
+            multiply_add_blocked(m, l, n, coordinate{1}, a, lda, omega.data(), l, q.data(), l);
+            qr_orthonormal_basis(q.data(), m, l);
+
+            for (unsigned int iteration = 0; iteration < power_iterations; ++iteration)
+            {
+                svd_multiply_transposed(a, lda, m, n, q.data(), l, omega.data());
+                qr_orthonormal_basis(omega.data(), n, l);
+
+                std::fill(q.begin(), q.end(), coordinate{0});
+                multiply_add_blocked(m, l, n, coordinate{1}, a, lda, omega.data(), l, q.data(), l);
+                qr_orthonormal_basis(q.data(), m, l);
+            }
+
+            // B^T = A^T * Q, transposed so that the rows of B are contiguous
+            std::vector<coordinate> b(l * n);
+            std::vector<coordinate> j(l * l);
+
+            svd_multiply_transposed(a, lda, m, n, q.data(), l, omega.data());
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                for (size_t p = 0; p < l; ++p)
+                {
+                    b[p * n + i] = omega[i * l + p];
+                }
+            }
+
+            svd_jacobi_rows(b.data(), l, n, j.data());
+
+            // The rows of B' are sigma * v^T, the k longest ones being kept
+            std::vector<coordinate> lengths(l);
+            std::vector<size_t>     order(l);
+
+            for (size_t p = 0; p < l; ++p)
+            {
+                lengths[p] = std::sqrt(dot_product(b.data() + p * n, b.data() + p * n, n));
+            }
+
+            std::iota(order.begin(), order.end(), size_t{0});
+            std::stable_sort(order.begin(), order.end(), [&lengths](size_t lhs, size_t rhs) { return lengths[lhs] > lengths[rhs]; });
+
+            std::vector<coordinate> kept(l * k);
+
+            for (size_t i = 0; i < k; ++i)
+            {
+                const size_t     p       = order[i];
+                const coordinate inverse = lengths[p] > 0 ? 1 / lengths[p] : coordinate{0};
+
+                sigma[i] = lengths[p];
+
+                for (size_t r = 0; r < n; ++r)
+                {
+                    v[r * ldv + i] = b[p * n + r] * inverse;
+                }
+
+                for (size_t r = 0; r < l; ++r)
+                {
+                    kept[r * k + i] = j[r * l + p];
+                }
+
+                if (!std::isfinite(sigma[i]))
+                {
+                    return false;
+                }
+            }
+
+            for (size_t i = 0; i < m; ++i)
+            {
+                std::fill(u + i * ldu, u + i * ldu + k, coordinate{0});
+            }
+
+            multiply_add_blocked(m, k, l, coordinate{1}, q.data(), l, kept.data(), k, u, ldu);
+
+            return true;
+        }
+
+        // NOLINTEND(readability-identifier-length)
+    }  // namespace ImplementationDetails
+
+    // NOLINTBEGIN(readability-identifier-length)
+    template <Coordinate coordinate, StorageOrder order>
+    SingularValueDecomposition<coordinate, order> singularValueDecomposition(const Matrix<coordinate, 3, 3, order>& matrix)
+    requires std::is_floating_point_v<coordinate>
+    {
+        using simd = ImplementationDetails::ScalarPack<coordinate>;
+
+        coordinate a[3][3];
+        coordinate u[3][3];
+        coordinate sigma[3];
+        coordinate v[3][3];
+
+        for (unsigned int p = 0; p < 3; ++p)
+        {
+            for (unsigned int q = 0; q < 3; ++q)
+            {
+                a[p][q] = matrix(p, q);
+            }
+        }
+
+        ImplementationDetails::svd3x3<coordinate, simd>(a, u, sigma, v);
+
+        SingularValueDecomposition<coordinate, order> result;
+
+        for (unsigned int p = 0; p < 3; ++p)
+        {
+            result.singularValues[p] = sigma[p];
+
+            for (unsigned int q = 0; q < 3; ++q)
+            {
+                result.u(p, q) = u[p][q];
+                result.v(p, q) = v[p][q];
+            }
+        }
+
+        return result;
+    }
+
+    template <Coordinate coordinate, StorageOrder order>
+    void singularValueDecomposition(std::type_identity_t<std::span<const Matrix<coordinate, 3, 3, order>>> matrices,
+                                    std::type_identity_t<std::span<Matrix<coordinate, 3, 3, order>>>       u,
+                                    VectorArray<coordinate, 3>&                                           singularValues,
+                                    std::type_identity_t<std::span<Matrix<coordinate, 3, 3, order>>>       v)
+    requires std::is_floating_point_v<coordinate>
+    {
+        ImplementationDetails::check_same_count(singularValues, matrices.size());
+        ImplementationDetails::check_same_size(u.size(), matrices.size());
+        ImplementationDetails::check_same_size(v.size(), matrices.size());
+
+        const auto dst = ImplementationDetails::lanes_of(singularValues);
+
+        ImplementationDetails::for_each_matrix_pack(matrices,
+                                                    [u, dst, v](auto pack, const auto& lanes, size_t i, size_t index)
+                                                    {
+                                                        using simd = decltype(pack);
+
+                                                        typename simd::type a[3][3];
+                                                        typename simd::type left[3][3];
+                                                        typename simd::type sigma[3];
+                                                        typename simd::type right[3][3];
+
+                                                        for (unsigned int p = 0; p < 3; ++p)
+                                                        {
+                                                            for (unsigned int q = 0; q < 3; ++q)
+                                                            {
+                                                                a[p][q] = simd::load(lanes[p * 3 + q].data() + i);
+                                                            }
+                                                        }
+
+                                                        ImplementationDetails::svd3x3<coordinate, simd>(a, left, sigma, right);
+
+                                                        for (unsigned int p = 0; p < 3; ++p)
+                                                        {
+                                                            simd::store(dst[p] + index, sigma[p]);
+                                                        }
+
+                                                        ImplementationDetails::store_matrix_lanes<coordinate, simd>(left, u, index);
+                                                        ImplementationDetails::store_matrix_lanes<coordinate, simd>(right, v, index);
+                                                    });
+    }
+
+    template <Coordinate coordinate, StorageOrder order>
+    PolarDecomposition<coordinate, order> polarDecomposition(const Matrix<coordinate, 3, 3, order>& matrix)
+    requires std::is_floating_point_v<coordinate>
+    {
+        using simd = ImplementationDetails::ScalarPack<coordinate>;
+
+        coordinate a[3][3];
+        coordinate u[3][3];
+        coordinate sigma[3];
+        coordinate v[3][3];
+        coordinate rotation[3][3];
+        coordinate stretch[3][3];
+
+        for (unsigned int p = 0; p < 3; ++p)
+        {
+            for (unsigned int q = 0; q < 3; ++q)
+            {
+                a[p][q] = matrix(p, q);
+            }
+        }
+
+        ImplementationDetails::svd3x3<coordinate, simd>(a, u, sigma, v);
+        ImplementationDetails::polar3x3<coordinate, simd>(u, sigma, v, rotation, stretch);
+
+        PolarDecomposition<coordinate, order> result;
+
+        for (unsigned int p = 0; p < 3; ++p)
+        {
+            for (unsigned int q = 0; q < 3; ++q)
+            {
+                result.rotation(p, q) = rotation[p][q];
+                result.stretch(p, q)  = stretch[p][q];
+            }
+        }
+
+        return result;
+    }
+
+    template <Coordinate coordinate, StorageOrder order>
+    void polarDecomposition(std::type_identity_t<std::span<const Matrix<coordinate, 3, 3, order>>> matrices,
+                            std::type_identity_t<std::span<Matrix<coordinate, 3, 3, order>>>       rotations,
+                            std::type_identity_t<std::span<Matrix<coordinate, 3, 3, order>>>       stretches)
+    requires std::is_floating_point_v<coordinate>
+    {
+        ImplementationDetails::check_same_size(rotations.size(), matrices.size());
+        ImplementationDetails::check_same_size(stretches.size(), matrices.size());
+
+        ImplementationDetails::polar_decompositions(matrices, rotations, stretches);
+    }
+
+    template <Coordinate coordinate, StorageOrder order>
+    void polarDecomposition(std::type_identity_t<std::span<const Matrix<coordinate, 3, 3, order>>> matrices,
+                            std::type_identity_t<std::span<Matrix<coordinate, 3, 3, order>>>       rotations)
+    requires std::is_floating_point_v<coordinate>
+    {
+        ImplementationDetails::check_same_size(rotations.size(), matrices.size());
+
+        ImplementationDetails::polar_decompositions(matrices, rotations, std::span<Matrix<coordinate, 3, 3, order>>());
+    }
+
+    template <Coordinate coordinate>
+    bool randomized_svd(std::span<const coordinate> matrix,
+                        size_t                      cols,
+                        std::span<coordinate>       u,
+                        std::span<coordinate>       singular_values,
+                        std::span<coordinate>       v,
+                        size_t                      oversampling,
+                        unsigned int                power_iterations) requires(std::is_floating_point_v<coordinate>)
+    {
+        const size_t rows = cols == 0 ? 0 : matrix.size() / cols;
+        const size_t k    = singular_values.size();
+
+        if (cols == 0 || rows * cols != matrix.size())
+        {
+            throw std::invalid_argument("The size of the matrix to decompose must be a multiple of its number of columns");
+        }
+
+        if (k == 0 || k > std::min(rows, cols))
+        {
+            throw std::invalid_argument("The number of singular values must be between 1 and the number of rows and of columns");
+        }
+
+        if (u.size() != rows * k || v.size() != cols * k)
+        {
+            throw std::invalid_argument("The singular vectors must have one column per singular value");
+        }
+
+        return ImplementationDetails::randomized_svd(matrix.data(),
+                                                     cols,
+                                                     rows,
+                                                     cols,
+                                                     k,
+                                                     u.data(),
+                                                     k,
+                                                     singular_values.data(),
+                                                     v.data(),
+                                                     k,
+                                                     oversampling,
+                                                     power_iterations);
+    }
+    // NOLINTEND(readability-identifier-length)
+}  // namespace LCNS::Algebra
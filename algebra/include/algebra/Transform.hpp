@@ -0,0 +1,333 @@
+#pragma once
+
+#include "algebra/Matrix.hpp"
+#include "algebra/Simd.hpp"
+#include "algebra/Vector.hpp"
+#include "algebra/VectorArray.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+namespace LCNS::Algebra
+{
+    /*!
+     * \brief Transform points by a 4x4 matrix (w = 1, divided by the transformed w if the last row of the matrix is not
+     *        (0, 0, 0, 1)) or by a 3x3 matrix. Large arrays are split between threads.
+     * @param matrix is the transformation
+     * @param points are the points to transform
+     * @param result is the destination, it can be points
+     */
+    template <Coordinate coordinate, unsigned int dim, StorageOrder order>
+    void transform_points(const Matrix<coordinate, dim, dim, order>&            matrix,
+                          std::type_identity_t<std::span<const Vector<coordinate, 3>>> points,
+                          std::type_identity_t<std::span<Vector<coordinate, 3>>>       result) requires(dim == 3 || dim == 4);
+
+    /*!
+     * \brief Transform points in place, see above
+     */
+    template <Coordinate coordinate, unsigned int dim, StorageOrder order>
+    void transform_points(const Matrix<coordinate, dim, dim, order>& matrix, std::type_identity_t<std::span<Vector<coordinate, 3>>> points)
+    requires(dim == 3 || dim == 4);
+
+    /*!
+     * \brief Transform points stored as a structure of arrays, see above
+     */
+    template <Coordinate coordinate, unsigned int dim, StorageOrder order>
+    void transform_points(const Matrix<coordinate, dim, dim, order>& matrix, const VectorArray<coordinate, 3>& points, VectorArray<coordinate, 3>& result)
+    requires(dim == 3 || dim == 4);
+
+    /*!
+     * \brief Transform points stored as a structure of arrays in place, see above
+     */
+    template <Coordinate coordinate, unsigned int dim, StorageOrder order>
+    void transform_points(const Matrix<coordinate, dim, dim, order>& matrix, VectorArray<coordinate, 3>& points) requires(dim == 3 || dim == 4);
+
+    /*!
+     * \brief Transform directions by a 4x4 matrix (w = 0, the translation is ignored) or by a 3x3 matrix. Large arrays
+     *        are split between threads.
+     * @param matrix is the transformation
+     * @param directions are the directions to transform
+     * @param result is the destination, it can be directions
+     */
+    template <Coordinate coordinate, unsigned int dim, StorageOrder order>
+    void transform_directions(const Matrix<coordinate, dim, dim, order>&            matrix,
+                              std::type_identity_t<std::span<const Vector<coordinate, 3>>> directions,
+                              std::type_identity_t<std::span<Vector<coordinate, 3>>>       result) requires(dim == 3 || dim == 4);
+
+    /*!
+     * \brief Transform directions in place, see above
+     */
+    template <Coordinate coordinate, unsigned int dim, StorageOrder order>
+    void transform_directions(const Matrix<coordinate, dim, dim, order>& matrix, std::type_identity_t<std::span<Vector<coordinate, 3>>> directions)
+    requires(dim == 3 || dim == 4);
+
+    /*!
+     * \brief Transform directions stored as a structure of arrays, see above
+     */
+    template <Coordinate coordinate, unsigned int dim, StorageOrder order>
+    void transform_directions(const Matrix<coordinate, dim, dim, order>& matrix,
+                              const VectorArray<coordinate, 3>&          directions,
+                              VectorArray<coordinate, 3>&                result) requires(dim == 3 || dim == 4);
+
+    /*!
+     * \brief Transform directions stored as a structure of arrays in place, see above
+     */
+    template <Coordinate coordinate, unsigned int dim, StorageOrder order>
+    void transform_directions(const Matrix<coordinate, dim, dim, order>& matrix, VectorArray<coordinate, 3>& directions)
+    requires(dim == 3 || dim == 4);
+
+    namespace ImplementationDetails
+    {
+        enum class TransformKind
+        {
+            Linear,     // Upper left 3x3 block only
+            Affine,     // Upper left 3x3 block and translation
+            Projective  // Full 4x4 matrix followed by the division by w
+        };
+
+        /*!
+         * @brief Coefficients of a transformation stored row by row as a 4x4 matrix, and the cheapest kind able to apply it
+         */
+        template <Coordinate coordinate>
+        struct Transformation
+        {
+            std::array<coordinate, 16> coeff = {};
+            TransformKind              kind  = TransformKind::Linear;
+        };
+
+        template <Coordinate coordinate, unsigned int dim, StorageOrder order>
+        Transformation<coordinate> make_transformation(const Matrix<coordinate, dim, dim, order>& matrix, bool is_point)
+        {
+            Transformation<coordinate> result;
+
+            for (unsigned int i = 0; i < dim; ++i)
+            {
+                for (unsigned int j = 0; j < dim; ++j)
+                {
+                    result.coeff[i * 4 + j] = matrix(i, j);
+                }
+            }
+
+            if constexpr (dim == 4)
+            {
+                if (is_point)
+                {
+                    const bool is_affine = matrix(3, 0) == 0 && matrix(3, 1) == 0 && matrix(3, 2) == 0 && matrix(3, 3) == 1;
+
+                    result.kind = is_affine ? TransformKind::Affine : TransformKind::Projective;
+                }
+            }
+
+            return result;
+        }
+
+        // NOLINTBEGIN(readability-identifier-length)
+        /*!
+         * @brief Transform the vectors of [begin, end[ from the src lanes to the dst lanes, dst can be src
+         */
+        template <Coordinate coordinate, TransformKind kind>
+        void transform_lanes(const std::array<coordinate, 16>&    m,
+                             std::array<const coordinate*, 3> src,
+                             std::array<coordinate*, 3>       dst,
+                             size_t                           begin,
+                             size_t                           end)
+        {
+            for_each_pack<coordinate>(begin,
+                                      end,
+                                      [&m, src, dst](auto pack, size_t i)
+                                      {
+                                          using simd = decltype(pack);
+
+                                          const auto x = simd::load(src[0] + i);
+                                          const auto y = simd::load(src[1] + i);
+                                          const auto z = simd::load(src[2] + i);
+
+                                          const auto row = [&](unsigned int r)
+                                          {
+                                              auto acc = kind == TransformKind::Linear ? simd::mul(simd::broadcast(m[r * 4 + 2]), z)
+                                                                                       : simd::fmadd(simd::broadcast(m[r * 4 + 2]), z, simd::broadcast(m[r * 4 + 3]));
+                                              acc      = simd::fmadd(simd::broadcast(m[r * 4 + 1]), y, acc);
+                                              return simd::fmadd(simd::broadcast(m[r * 4]), x, acc);
+                                          };
+
+                                          auto rx = row(0);
+                                          auto ry = row(1);
+                                          auto rz = row(2);
+
+                                          if constexpr (kind == TransformKind::Projective)
+                                          {
+                                              const auto rw = row(3);
+
+                                              rx = simd::div(rx, rw);
+                                              ry = simd::div(ry, rw);
+                                              rz = simd::div(rz, rw);
+                                          }
+
+                                          simd::store(dst[0] + i, rx);
+                                          simd::store(dst[1] + i, ry);
+                                          simd::store(dst[2] + i, rz);
+                                      });
+        }
+        // NOLINTEND(readability-identifier-length)
+
+        /*!
+         * @brief Transform vectors stored one after the other. They are copied by blocks into lanes on the stack, so that
+         *        the same SIMD kernel as for structures of arrays can be used.
+         */
+        template <Coordinate coordinate, TransformKind kind>
+        void transform_vectors(const std::array<coordinate, 16>& m, std::span<const Vector<coordinate, 3>> src, std::span<Vector<coordinate, 3>> dst)
+        {
+            static constexpr size_t block_size = 256;
+
+            for_each_chunk_concurrently(src.size(),
+                                        block_size,
+                                        [&m, src, dst](size_t begin, size_t end)
+                                        {
+                                            std::array<std::array<coordinate, block_size>, 3> lanes;
+
+                                            const std::array<const coordinate*, 3> in  = {lanes[0].data(), lanes[1].data(), lanes[2].data()};
+                                            const std::array<coordinate*, 3>       out = {lanes[0].data(), lanes[1].data(), lanes[2].data()};
+
+                                            for (size_t block_begin = begin; block_begin < end; block_begin += block_size)
+                                            {
+                                                const size_t count = std::min(block_size, end - block_begin);
+
+                                                for (size_t i = 0; i < count; ++i)
+                                                {
+                                                    const auto& vector = src[block_begin + i];
+
+                                                    lanes[0][i] = vector[0];
+                                                    lanes[1][i] = vector[1];
+                                                    lanes[2][i] = vector[2];
+                                                }
+
+                                                transform_lanes<coordinate, kind>(m, in, out, 0, count);
+
+                                                for (size_t i = 0; i < count; ++i)
+                                                {
+                                                    auto& vector = dst[block_begin + i];
+
+                                                    vector[0] = lanes[0][i];
+                                                    vector[1] = lanes[1][i];
+                                                    vector[2] = lanes[2][i];
+                                                }
+                                            }
+                                        });
+        }
+
+        template <Coordinate coordinate>
+        void transform(const Transformation<coordinate>& transformation, std::span<const Vector<coordinate, 3>> src, std::span<Vector<coordinate, 3>> dst)
+        {
+            if (src.size() != dst.size())
+            {
+                throw std::invalid_argument("The destination must have the same number of vectors");
+            }
+
+            switch (transformation.kind)
+            {
+                case TransformKind::Linear:
+                    transform_vectors<coordinate, TransformKind::Linear>(transformation.coeff, src, dst);
+                    break;
+                case TransformKind::Affine:
+                    transform_vectors<coordinate, TransformKind::Affine>(transformation.coeff, src, dst);
+                    break;
+                case TransformKind::Projective:
+                    transform_vectors<coordinate, TransformKind::Projective>(transformation.coeff, src, dst);
+                    break;
+            }
+        }
+
+        template <Coordinate coordinate>
+        void transform(const Transformation<coordinate>& transformation, const VectorArray<coordinate, 3>& src, VectorArray<coordinate, 3>& dst)
+        {
+            check_same_count(src, dst.count());
+
+            const auto in  = lanes_of(src);
+            const auto out = lanes_of(dst);
+
+            const auto task = [&transformation, in, out](size_t begin, size_t end)
+            {
+                switch (transformation.kind)
+                {
+                    case TransformKind::Linear:
+                        transform_lanes<coordinate, TransformKind::Linear>(transformation.coeff, in, out, begin, end);
+                        break;
+                    case TransformKind::Affine:
+                        transform_lanes<coordinate, TransformKind::Affine>(transformation.coeff, in, out, begin, end);
+                        break;
+                    case TransformKind::Projective:
+                        transform_lanes<coordinate, TransformKind::Projective>(transformation.coeff, in, out, begin, end);
+                        break;
+                }
+            };
+
+            constexpr size_t granularity = 64;
+
+            for_each_chunk_concurrently(src.count(), granularity, task);
+        }
+    }  // namespace ImplementationDetails
+
+    template <Coordinate coordinate, unsigned int dim, StorageOrder order>
+    void transform_points(const Matrix<coordinate, dim, dim, order>&            matrix,
+                          std::type_identity_t<std::span<const Vector<coordinate, 3>>> points,
+                          std::type_identity_t<std::span<Vector<coordinate, 3>>>       result) requires(dim == 3 || dim == 4)
+    {
+        ImplementationDetails::transform(ImplementationDetails::make_transformation(matrix, true), points, result);
+    }
+
+    template <Coordinate coordinate, unsigned int dim, StorageOrder order>
+    void transform_points(const Matrix<coordinate, dim, dim, order>& matrix, std::type_identity_t<std::span<Vector<coordinate, 3>>> points)
+    requires(dim == 3 || dim == 4)
+    {
+        ImplementationDetails::transform(ImplementationDetails::make_transformation(matrix, true), std::span<const Vector<coordinate, 3>>(points), points);
+    }
+
+    template <Coordinate coordinate, unsigned int dim, StorageOrder order>
+    void transform_points(const Matrix<coordinate, dim, dim, order>& matrix, const VectorArray<coordinate, 3>& points, VectorArray<coordinate, 3>& result)
+    requires(dim == 3 || dim == 4)
+    {
+        ImplementationDetails::transform(ImplementationDetails::make_transformation(matrix, true), points, result);
+    }
+
+    template <Coordinate coordinate, unsigned int dim, StorageOrder order>
+    void transform_points(const Matrix<coordinate, dim, dim, order>& matrix, VectorArray<coordinate, 3>& points) requires(dim == 3 || dim == 4)
+    {
+        ImplementationDetails::transform(ImplementationDetails::make_transformation(matrix, true), points, points);
+    }
+
+    template <Coordinate coordinate, unsigned int dim, StorageOrder order>
+    void transform_directions(const Matrix<coordinate, dim, dim, order>&            matrix,
+                              std::type_identity_t<std::span<const Vector<coordinate, 3>>> directions,
+                              std::type_identity_t<std::span<Vector<coordinate, 3>>>       result) requires(dim == 3 || dim == 4)
+    {
+        ImplementationDetails::transform(ImplementationDetails::make_transformation(matrix, false), directions, result);
+    }
+
+    template <Coordinate coordinate, unsigned int dim, StorageOrder order>
+    void transform_directions(const Matrix<coordinate, dim, dim, order>& matrix, std::type_identity_t<std::span<Vector<coordinate, 3>>> directions)
+    requires(dim == 3 || dim == 4)
+    {
+        ImplementationDetails::transform(ImplementationDetails::make_transformation(matrix, false),
+                                         std::span<const Vector<coordinate, 3>>(directions),
+                                         directions);
+    }
+
+    template <Coordinate coordinate, unsigned int dim, StorageOrder order>
+    void transform_directions(const Matrix<coordinate, dim, dim, order>& matrix,
+                              const VectorArray<coordinate, 3>&          directions,
+                              VectorArray<coordinate, 3>&                result) requires(dim == 3 || dim == 4)
+    {
+        ImplementationDetails::transform(ImplementationDetails::make_transformation(matrix, false), directions, result);
+    }
+
+    template <Coordinate coordinate, unsigned int dim, StorageOrder order>
+    void transform_directions(const Matrix<coordinate, dim, dim, order>& matrix, VectorArray<coordinate, 3>& directions)
+    requires(dim == 3 || dim == 4)
+    {
+        ImplementationDetails::transform(ImplementationDetails::make_transformation(matrix, false), directions, directions);
+    }
+}  // namespace LCNS::Algebra
@@ -1,13 +1,22 @@
 #pragma once
 
 #include "algebra/Internal.hpp"
+#include "algebra/SimdMath.hpp"
 
 #include <cmath>
 #include <array>
 #include <stdexcept>
+#include <type_traits>
 
 namespace LCNS::Algebra
 {
+    /*!
+     *  \brief Type of the lengths of vectors and quaternions: the coordinate type for floating point coordinates, so that
+     *         float computations stay in float, and double for integer coordinates, whose lengths are not integers
+     */
+    template <Coordinate coordinate>
+    using LengthType = std::conditional_t<std::is_floating_point_v<coordinate>, coordinate, double>;
+
     /*!
      *  \brief This class is the template class for vectors of different sizes
      */
@@ -197,28 +206,31 @@ namespace LCNS::Algebra
         coordinate& w() noexcept requires(size > 3);
 
         /*!
-         * \brief Compute the square length of the vector
+         * \brief Compute the square length of the vector, in the coordinate type for floating point coordinates
          * @return the length of the vector squared
          */
-        constexpr double sqrLength() const noexcept;
+        constexpr LengthType<coordinate> sqrLength() const noexcept;
 
         /*!
-         * \brief Compute the length of the vector
+         * \brief Compute the length of the vector, in the coordinate type for floating point coordinates
          * @return the length of the vector
          */
-        double length() const;
+        LengthType<coordinate> length() const;
 
         /*!
-         * \brief Normalize this vector
+         * \brief Normalize this vector, a null vector is left unchanged
+         * @param precision is Precision::Exact to divide by the length, or Precision::Fast to multiply by the hardware
+         *        estimate of 1 / length refined by one Newton-Raphson step (relative error below 2^-22)
          */
-        void normalize() requires(std::is_floating_point_v<coordinate>);
+        void normalize(Precision precision = Precision::Exact) requires(std::is_floating_point_v<coordinate>);
 
         /*!
          * \brief Create a new vector which corresponds to the normalized version of this vector.
          *        Does not modify this object.
+         * @param precision is the precision of the normalization, see normalize
          * @return a vector of length 1 with the same direction
          */
-        Vector<coordinate, size> normalized() const requires(std::is_floating_point_v<coordinate>);
+        Vector<coordinate, size> normalized(Precision precision = Precision::Exact) const requires(std::is_floating_point_v<coordinate>);
 
         /*!
          * @brief Check if this vector is the null vector
@@ -226,6 +238,18 @@ namespace LCNS::Algebra
          */
         [[nodiscard]] constexpr bool isNull() const noexcept;
 
+        /*!
+         * @brief Get a pointer to the internal coordinates (read/write)
+         * @return a pointer to the first element of _coords
+         */
+        coordinate* data();
+
+        /*!
+         * @brief Get a pointer to the internal coordinates (read only)
+         * @return a pointer to the first element of _coords
+         */
+        const coordinate* data() const;
+
     private:
         std::array<coordinate, size> _coords = {};
     };  // class Vector
@@ -482,31 +506,47 @@ namespace LCNS::Algebra
     }
 
     template <Coordinate coordinate, unsigned int size>
-    constexpr double Vector<coordinate, size>::sqrLength() const noexcept
+    constexpr LengthType<coordinate> Vector<coordinate, size>::sqrLength() const noexcept
     {
-        double length_square = 0.0;
+        LengthType<coordinate> length_square = 0;
 
         for (const auto coord : _coords)
         {
-            length_square += coord * coord;
+            length_square += static_cast<LengthType<coordinate>>(coord) * static_cast<LengthType<coordinate>>(coord);
         }
 
         return length_square;
     }
 
     template <Coordinate coordinate, unsigned int size>
-    double Vector<coordinate, size>::length() const
+    LengthType<coordinate> Vector<coordinate, size>::length() const
     {
         return std::sqrt(sqrLength());
     }
 
     template <Coordinate coordinate, unsigned int size>
-    void Vector<coordinate, size>::normalize() requires(std::is_floating_point_v<coordinate>)
+    void Vector<coordinate, size>::normalize(Precision precision) requires(std::is_floating_point_v<coordinate>)
     {
-        const auto len = length();
+        const auto length_square = sqrLength();
 
-        if (len != 0.0)
+        if (length_square == 0)
         {
+            return;
+        }
+
+        if (precision == Precision::Fast)
+        {
+            const auto factor = ImplementationDetails::rsqrt_fast(length_square);
+
+            for (auto& coord : _coords)
+            {
+                coord *= factor;
+            }
+        }
+        else
+        {
+            const auto len = std::sqrt(length_square);
+
             for (auto& coord : _coords)
             {
                 coord /= len;
@@ -515,11 +555,11 @@ namespace LCNS::Algebra
     }
 
     template <Coordinate coordinate, unsigned int size>
-    Vector<coordinate, size> Vector<coordinate, size>::normalized() const requires(std::is_floating_point_v<coordinate>)
+    Vector<coordinate, size> Vector<coordinate, size>::normalized(Precision precision) const requires(std::is_floating_point_v<coordinate>)
     {
         Vector<coordinate, size> result(*this);
 
-        result.normalize();
+        result.normalize(precision);
 
         return result;
     }
@@ -537,4 +577,16 @@ namespace LCNS::Algebra
 
         return true;
     }
+
+    template <Coordinate coordinate, unsigned int size>
+    coordinate* Vector<coordinate, size>::data()
+    {
+        return _coords.data();
+    }
+
+    template <Coordinate coordinate, unsigned int size>
+    const coordinate* Vector<coordinate, size>::data() const
+    {
+        return _coords.data();
+    }
 }  // namespace LCNS::Algebra
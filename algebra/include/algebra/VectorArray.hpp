@@ -0,0 +1,520 @@
+#pragma once
+
+#include "algebra/Simd.hpp"
+#include "algebra/SimdMath.hpp"
+#include "algebra/Vector.hpp"
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace LCNS::Algebra
+{
+    /*!
+     *  \brief Array of vectors stored as a structure of arrays: all the x coordinates are contiguous, then all the y
+     *         coordinates, etc. This is the layout the batched kernels below work on, one SIMD register holds the same
+     *         coordinate of several consecutive vectors.
+     */
+    template <Coordinate coordinate, unsigned int size>
+    class VectorArray
+    {
+    public:
+        /*!
+         * \brief Default constructor, the array is empty
+         */
+        VectorArray() = default;
+
+        /*!
+         * \brief Create an array of count null vectors
+         * @param count is the number of vectors in the array
+         */
+        explicit VectorArray(size_t count);
+
+        /*!
+         * \brief Create an array from vectors stored one after the other (array of structures)
+         * @param vectors are the vectors to copy
+         */
+        explicit VectorArray(std::span<const Vector<coordinate, size>> vectors);
+
+        /*!
+         * \brief Get the number of vectors in the array
+         * @return the number of vectors
+         */
+        size_t count() const noexcept;
+
+        /*!
+         * \brief Change the number of vectors in the array, new vectors are null
+         * @param count is the new number of vectors
+         */
+        void resize(size_t count);
+
+        /*!
+         * \brief Accessor (read only)
+         * @param index is the index of the vector to access
+         * @return a copy of the corresponding vector
+         */
+        Vector<coordinate, size> operator[](size_t index) const;
+
+        /*!
+         * \brief Replace a vector of the array
+         * @param index is the index of the vector to replace
+         * @param vector is the new value
+         */
+        void set(size_t index, const Vector<coordinate, size>& vector);
+
+        /*!
+         * \brief Get the values of one coordinate for all the vectors
+         * @param index is the index of the coordinate
+         * @return a pointer on count() contiguous values
+         */
+        coordinate* lane(unsigned int index);
+
+        /*!
+         * \brief Get the values of one coordinate for all the vectors (read only)
+         * @param index is the index of the coordinate
+         * @return a pointer on count() contiguous values
+         */
+        const coordinate* lane(unsigned int index) const;
+
+        // clang-format off
+        coordinate*       x() noexcept                            { return _lanes[0].data(); }
+        const coordinate* x() const noexcept                      { return _lanes[0].data(); }
+        coordinate*       y() noexcept       requires(size > 1)   { return _lanes[1].data(); }
+        const coordinate* y() const noexcept requires(size > 1)   { return _lanes[1].data(); }
+        coordinate*       z() noexcept       requires(size > 2)   { return _lanes[2].data(); }
+        const coordinate* z() const noexcept requires(size > 2)   { return _lanes[2].data(); }
+        coordinate*       w() noexcept       requires(size > 3)   { return _lanes[3].data(); }
+        const coordinate* w() const noexcept requires(size > 3)   { return _lanes[3].data(); }
+        // clang-format on
+
+        /*!
+         * \brief Copy the vectors one after the other (array of structures)
+         * @param vectors is the destination, its size must be count()
+         */
+        void toVectors(std::span<Vector<coordinate, size>> vectors) const;
+
+        /*!
+         * \brief Copy the vectors one after the other (array of structures)
+         * @return a new std::vector with the count() vectors
+         */
+        std::vector<Vector<coordinate, size>> toVectors() const;
+
+    private:
+        std::array<std::vector<coordinate>, size> _lanes;
+    };
+
+    /*!
+     * \brief Compute the dot product of each pair of vectors
+     * @param result is the destination, result[i] = lhs[i] * rhs[i]
+     */
+    template <Coordinate coordinate, unsigned int size>
+    void dot(const VectorArray<coordinate, size>& lhs, const VectorArray<coordinate, size>& rhs, std::span<coordinate> result);
+
+    /*!
+     * \brief Compute the cross product of each pair of vectors
+     * @param result is the destination, result[i] = lhs[i] ^ rhs[i]. It can be lhs or rhs.
+     */
+    template <Coordinate coordinate>
+    void cross(const VectorArray<coordinate, 3>& lhs, const VectorArray<coordinate, 3>& rhs, VectorArray<coordinate, 3>& result);
+
+    /*!
+     * \brief Add each pair of vectors
+     * @param result is the destination, result[i] = lhs[i] + rhs[i]. It can be lhs or rhs.
+     */
+    template <Coordinate coordinate, unsigned int size>
+    void add(const VectorArray<coordinate, size>& lhs, const VectorArray<coordinate, size>& rhs, VectorArray<coordinate, size>& result);
+
+    /*!
+     * \brief Multiply each vector by a scalar
+     * @param result is the destination, result[i] = vectors[i] * scalar. It can be vectors.
+     */
+    template <Coordinate coordinate, unsigned int size>
+    void scale(const VectorArray<coordinate, size>& vectors, coordinate scalar, VectorArray<coordinate, size>& result);
+
+    /*!
+     * \brief Compute the square length of each vector
+     * @param result is the destination, result[i] = vectors[i].sqrLength()
+     */
+    template <Coordinate coordinate, unsigned int size>
+    void sqrLength(const VectorArray<coordinate, size>& vectors, std::span<coordinate> result) requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief Compute the length of each vector
+     * @param result is the destination, result[i] = vectors[i].length()
+     */
+    template <Coordinate coordinate, unsigned int size>
+    void length(const VectorArray<coordinate, size>& vectors, std::span<coordinate> result) requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief Normalize each vector, null vectors are left unchanged
+     * @param precision is Precision::Exact to divide by the lengths, or Precision::Fast to multiply by the hardware
+     *        estimates of 1 / length refined by one Newton-Raphson step, see rsqrt_fast_simd in SimdMath.hpp
+     */
+    template <Coordinate coordinate, unsigned int size>
+    void normalize(VectorArray<coordinate, size>& vectors, Precision precision = Precision::Exact) requires(std::is_floating_point_v<coordinate>);
+
+    namespace ImplementationDetails
+    {
+        template <Coordinate coordinate, unsigned int size>
+        void check_same_count(const VectorArray<coordinate, size>& lhs, size_t count)
+        {
+            if (lhs.count() != count)
+            {
+                throw std::invalid_argument("The arrays must have the same number of vectors");
+            }
+        }
+
+        /*!
+         * @brief Get the pointers on the lanes of an array once, so that the kernels do not check the lane index per element
+         */
+        template <Coordinate coordinate, unsigned int size>
+        std::array<const coordinate*, size> lanes_of(const VectorArray<coordinate, size>& vectors)
+        {
+            std::array<const coordinate*, size> result = {};
+
+            for (unsigned int k = 0; k < size; ++k)
+            {
+                result[k] = vectors.lane(k);
+            }
+
+            return result;
+        }
+
+        template <Coordinate coordinate, unsigned int size>
+        std::array<coordinate*, size> lanes_of(VectorArray<coordinate, size>& vectors)
+        {
+            std::array<coordinate*, size> result = {};
+
+            for (unsigned int k = 0; k < size; ++k)
+            {
+                result[k] = vectors.lane(k);
+            }
+
+            return result;
+        }
+
+        /*!
+         * @brief Compute the square length, or the length when square_root is true, of count vectors given by their lanes
+         */
+        template <bool square_root, Coordinate coordinate, size_t size>
+        void lengths_of_lanes(std::array<const coordinate*, size> lanes, size_t count, coordinate* dst)
+        {
+            for_each_pack_concurrently<coordinate>(count,
+                                                   [lanes, dst](auto pack, size_t i)
+                                                   {
+                                                       using simd = decltype(pack);
+
+                                                       auto sqr_length = simd::broadcast(coordinate{0});
+
+                                                       for (size_t k = 0; k < size; ++k)
+                                                       {
+                                                           const auto coord = simd::load(lanes[k] + i);
+                                                           sqr_length       = simd::fmadd(coord, coord, sqr_length);
+                                                       }
+
+                                                       if constexpr (square_root)
+                                                       {
+                                                           simd::store(dst + i, simd::sqrt(sqr_length));
+                                                       }
+                                                       else
+                                                       {
+                                                           simd::store(dst + i, sqr_length);
+                                                       }
+                                                   });
+        }
+
+        /*!
+         * @brief Normalize count vectors given by their lanes, null vectors are left unchanged
+         */
+        template <Coordinate coordinate, size_t size>
+        void normalize_lanes(std::array<coordinate*, size> lanes, size_t count, Precision precision)
+        {
+            for_each_pack_concurrently<coordinate>(count,
+                                                   [lanes, precision](auto pack, size_t i)
+                                                   {
+                                                       using simd = decltype(pack);
+
+                                                       auto sqr_length = simd::broadcast(coordinate{0});
+
+                                                       for (size_t k = 0; k < size; ++k)
+                                                       {
+                                                           const auto coord = simd::load(lanes[k] + i);
+                                                           sqr_length       = simd::fmadd(coord, coord, sqr_length);
+                                                       }
+
+                                                       const auto one = simd::broadcast(coordinate{1});
+
+                                                       // The second loads hit the L1 cache, it is cheaper than keeping size registers alive
+                                                       if (precision == Precision::Fast)
+                                                       {
+                                                           // Null vectors are multiplied by 1 to leave them unchanged, like Vector::normalize
+                                                           const auto factor = simd::select_non_zero(sqr_length, rsqrt_fast_simd<coordinate, simd>(sqr_length), one);
+
+                                                           for (size_t k = 0; k < size; ++k)
+                                                           {
+                                                               simd::store(lanes[k] + i, simd::mul(simd::load(lanes[k] + i), factor));
+                                                           }
+                                                       }
+                                                       else
+                                                       {
+                                                           // Null vectors are divided by 1 to leave them unchanged, like Vector::normalize
+                                                           const auto len     = simd::sqrt(sqr_length);
+                                                           const auto divisor = simd::select_non_zero(len, len, one);
+
+                                                           for (size_t k = 0; k < size; ++k)
+                                                           {
+                                                               simd::store(lanes[k] + i, simd::div(simd::load(lanes[k] + i), divisor));
+                                                           }
+                                                       }
+                                                   });
+        }
+    }  // namespace ImplementationDetails
+
+    template <Coordinate coordinate, unsigned int size>
+    VectorArray<coordinate, size>::VectorArray(size_t count)
+    {
+        resize(count);
+    }
+
+    template <Coordinate coordinate, unsigned int size>
+    VectorArray<coordinate, size>::VectorArray(std::span<const Vector<coordinate, size>> vectors)
+    {
+        resize(vectors.size());
+
+        ImplementationDetails::for_each_chunk_concurrently(vectors.size(),
+                                                           1,
+                                                           [this, vectors](size_t begin, size_t end)
+                                                           {
+                                                               for (size_t i = begin; i < end; ++i)
+                                                               {
+                                                                   set(i, vectors[i]);
+                                                               }
+                                                           });
+    }
+
+    template <Coordinate coordinate, unsigned int size>
+    size_t VectorArray<coordinate, size>::count() const noexcept
+    {
+        return _lanes[0].size();
+    }
+
+    template <Coordinate coordinate, unsigned int size>
+    void VectorArray<coordinate, size>::resize(size_t count)
+    {
+        for (auto& lane : _lanes)
+        {
+            lane.resize(count);
+        }
+    }
+
+    template <Coordinate coordinate, unsigned int size>
+    Vector<coordinate, size> VectorArray<coordinate, size>::operator[](size_t index) const
+    {
+        if (index >= count())
+        {
+            throw std::out_of_range("Index out of range");
+        }
+
+        Vector<coordinate, size> result;
+
+        for (unsigned int k = 0; k < size; ++k)
+        {
+            result[k] = _lanes[k][index];
+        }
+
+        return result;
+    }
+
+    template <Coordinate coordinate, unsigned int size>
+    void VectorArray<coordinate, size>::set(size_t index, const Vector<coordinate, size>& vector)
+    {
+        if (index >= count())
+        {
+            throw std::out_of_range("Index out of range");
+        }
+
+        for (unsigned int k = 0; k < size; ++k)
+        {
+            _lanes[k][index] = vector[k];
+        }
+    }
+
+    template <Coordinate coordinate, unsigned int size>
+    coordinate* VectorArray<coordinate, size>::lane(unsigned int index)
+    {
+        if (index >= size)
+        {
+            throw std::out_of_range("Index out of range");
+        }
+
+        return _lanes[index].data();
+    }
+
+    template <Coordinate coordinate, unsigned int size>
+    const coordinate* VectorArray<coordinate, size>::lane(unsigned int index) const
+    {
+        if (index >= size)
+        {
+            throw std::out_of_range("Index out of range");
+        }
+
+        return _lanes[index].data();
+    }
+
+    template <Coordinate coordinate, unsigned int size>
+    void VectorArray<coordinate, size>::toVectors(std::span<Vector<coordinate, size>> vectors) const
+    {
+        if (vectors.size() != count())
+        {
+            throw std::invalid_argument("The destination must have the same number of vectors");
+        }
+
+        ImplementationDetails::for_each_chunk_concurrently(vectors.size(),
+                                                           1,
+                                                           [this, vectors](size_t begin, size_t end)
+                                                           {
+                                                               for (size_t i = begin; i < end; ++i)
+                                                               {
+                                                                   for (unsigned int k = 0; k < size; ++k)
+                                                                   {
+                                                                       vectors[i][k] = _lanes[k][i];
+                                                                   }
+                                                               }
+                                                           });
+    }
+
+    template <Coordinate coordinate, unsigned int size>
+    std::vector<Vector<coordinate, size>> VectorArray<coordinate, size>::toVectors() const
+    {
+        std::vector<Vector<coordinate, size>> result(count());
+
+        toVectors(result);
+
+        return result;
+    }
+
+    template <Coordinate coordinate, unsigned int size>
+    void dot(const VectorArray<coordinate, size>& lhs, const VectorArray<coordinate, size>& rhs, std::span<coordinate> result)
+    {
+        ImplementationDetails::check_same_count(lhs, rhs.count());
+        ImplementationDetails::check_same_count(lhs, result.size());
+
+        const auto  a   = ImplementationDetails::lanes_of(lhs);
+        const auto  b   = ImplementationDetails::lanes_of(rhs);
+        coordinate* dst = result.data();
+
+        ImplementationDetails::for_each_pack_concurrently<coordinate>(lhs.count(),
+                                                                      [a, b, dst](auto pack, size_t i)
+                                                                      {
+                                                                          using simd = decltype(pack);
+
+                                                                          auto acc = simd::mul(simd::load(a[0] + i), simd::load(b[0] + i));
+
+                                                                          for (unsigned int k = 1; k < size; ++k)
+                                                                          {
+                                                                              acc = simd::fmadd(simd::load(a[k] + i), simd::load(b[k] + i), acc);
+                                                                          }
+
+                                                                          simd::store(dst + i, acc);
+                                                                      });
+    }
+
+    // NOLINTBEGIN(readability-identifier-length)
+    template <Coordinate coordinate>
+    void cross(const VectorArray<coordinate, 3>& lhs, const VectorArray<coordinate, 3>& rhs, VectorArray<coordinate, 3>& result)
+    {
+        ImplementationDetails::check_same_count(lhs, rhs.count());
+        ImplementationDetails::check_same_count(lhs, result.count());
+
+        const auto a   = ImplementationDetails::lanes_of(lhs);
+        const auto b   = ImplementationDetails::lanes_of(rhs);
+        const auto dst = ImplementationDetails::lanes_of(result);
+
+        ImplementationDetails::for_each_pack_concurrently<coordinate>(lhs.count(),
+                                                                      [a, b, dst](auto pack, size_t i)
+                                                                      {
+                                                                          using simd = decltype(pack);
+
+                                                                          // All the inputs are loaded before the first store so that result can alias lhs or rhs
+                                                                          const auto ax = simd::load(a[0] + i);
+                                                                          const auto ay = simd::load(a[1] + i);
+                                                                          const auto az = simd::load(a[2] + i);
+                                                                          const auto bx = simd::load(b[0] + i);
+                                                                          const auto by = simd::load(b[1] + i);
+                                                                          const auto bz = simd::load(b[2] + i);
+
+                                                                          simd::store(dst[0] + i, simd::sub(simd::mul(ay, bz), simd::mul(az, by)));
+                                                                          simd::store(dst[1] + i, simd::sub(simd::mul(az, bx), simd::mul(ax, bz)));
+                                                                          simd::store(dst[2] + i, simd::sub(simd::mul(ax, by), simd::mul(ay, bx)));
+                                                                      });
+    }
+    // NOLINTEND(readability-identifier-length)
+
+    template <Coordinate coordinate, unsigned int size>
+    void add(const VectorArray<coordinate, size>& lhs, const VectorArray<coordinate, size>& rhs, VectorArray<coordinate, size>& result)
+    {
+        ImplementationDetails::check_same_count(lhs, rhs.count());
+        ImplementationDetails::check_same_count(lhs, result.count());
+
+        const auto a   = ImplementationDetails::lanes_of(lhs);
+        const auto b   = ImplementationDetails::lanes_of(rhs);
+        const auto dst = ImplementationDetails::lanes_of(result);
+
+        ImplementationDetails::for_each_pack_concurrently<coordinate>(lhs.count(),
+                                                                      [a, b, dst](auto pack, size_t i)
+                                                                      {
+                                                                          using simd = decltype(pack);
+
+                                                                          for (unsigned int k = 0; k < size; ++k)
+                                                                          {
+                                                                              simd::store(dst[k] + i, simd::add(simd::load(a[k] + i), simd::load(b[k] + i)));
+                                                                          }
+                                                                      });
+    }
+
+    template <Coordinate coordinate, unsigned int size>
+    void scale(const VectorArray<coordinate, size>& vectors, coordinate scalar, VectorArray<coordinate, size>& result)
+    {
+        ImplementationDetails::check_same_count(vectors, result.count());
+
+        const auto src = ImplementationDetails::lanes_of(vectors);
+        const auto dst = ImplementationDetails::lanes_of(result);
+
+        ImplementationDetails::for_each_pack_concurrently<coordinate>(vectors.count(),
+                                                                      [src, scalar, dst](auto pack, size_t i)
+                                                                      {
+                                                                          using simd = decltype(pack);
+
+                                                                          const auto factor = simd::broadcast(scalar);
+
+                                                                          for (unsigned int k = 0; k < size; ++k)
+                                                                          {
+                                                                              simd::store(dst[k] + i, simd::mul(simd::load(src[k] + i), factor));
+                                                                          }
+                                                                      });
+    }
+
+    template <Coordinate coordinate, unsigned int size>
+    void sqrLength(const VectorArray<coordinate, size>& vectors, std::span<coordinate> result) requires(std::is_floating_point_v<coordinate>)
+    {
+        ImplementationDetails::check_same_count(vectors, result.size());
+
+        ImplementationDetails::lengths_of_lanes<false>(ImplementationDetails::lanes_of(vectors), vectors.count(), result.data());
+    }
+
+    template <Coordinate coordinate, unsigned int size>
+    void length(const VectorArray<coordinate, size>& vectors, std::span<coordinate> result) requires(std::is_floating_point_v<coordinate>)
+    {
+        ImplementationDetails::check_same_count(vectors, result.size());
+
+        ImplementationDetails::lengths_of_lanes<true>(ImplementationDetails::lanes_of(vectors), vectors.count(), result.data());
+    }
+
+    template <Coordinate coordinate, unsigned int size>
+    void normalize(VectorArray<coordinate, size>& vectors, Precision precision) requires(std::is_floating_point_v<coordinate>)
+    {
+        ImplementationDetails::normalize_lanes(ImplementationDetails::lanes_of(vectors), vectors.count(), precision);
+    }
+}  // namespace LCNS::Algebra
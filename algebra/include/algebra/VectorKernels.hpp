@@ -0,0 +1,791 @@
+#pragma once
+
+#include "algebra/Concurrency.hpp"
+#include "algebra/Internal.hpp"
+#include "algebra/Simd.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/*
+ * Level 1 BLAS kernels on vectors of any length held by spans, for instance in std::vector or in the columns of a
+ * matrix stored by columns: axpy, scal, dot, nrm2, asum, iamax, copy and swap, and the level 2 matrix-vector product
+ * gemv, used by operator*(Matrix, Vector) for large matrices.
+ *
+ * These kernels stream their operands once and do one or two operations per coefficient read, so they are bound by
+ * the memory bandwidth rather than by the arithmetic. They use the widest SIMD registers available, several
+ * accumulators hiding the latency of the additions, and are split between threads from
+ * vector_kernel_concurrency_threshold coefficients: a single core cannot saturate the memory bus.
+ *
+ * The reductions (dot, nrm2, asum) sum the partial results of at most vector_reduction_parts parts of the vectors,
+ * whose bounds only depend on the length: the result does not depend on the number of threads. nrm2 does not overflow
+ * nor underflow when the squares of the coefficients do: it then scales the vector by its largest magnitude.
+ *
+ * gemv reads the matrix once, row by row. Each row of A * x is the scalar product of a row of A with x, computed for
+ * gemv_row_block rows at a time so that each SIMD load of x feeds as many fused multiply-adds, the rows being split
+ * between threads. A^T * x is a sum of rows of A scaled by the coefficients of x: gemv_row_block rows at a time are
+ * added to a block of gemv_column_block coefficients of y, which stays in the L1 cache while the rows stream through
+ * it, the columns being split between threads.
+ */
+
+namespace LCNS::Algebra
+{
+    /*!
+     * \brief y = alpha * x + y
+     * @throw std::invalid_argument if x and y do not have the same size
+     */
+    template <Coordinate coordinate>
+    void axpy(coordinate alpha, std::span<const coordinate> x, std::span<coordinate> y);
+
+    /*!
+     * \brief x = alpha * x
+     */
+    template <Coordinate coordinate>
+    void scal(coordinate alpha, std::span<coordinate> x);
+
+    /*!
+     * \brief Scalar product of x and y
+     * @throw std::invalid_argument if x and y do not have the same size
+     */
+    template <Coordinate coordinate>
+    coordinate dot(std::span<const coordinate> x, std::span<const coordinate> y);
+
+    /*!
+     * \brief Euclidean norm of x, without overflow nor underflow of the intermediate squares
+     */
+    template <Coordinate coordinate>
+    coordinate nrm2(std::span<const coordinate> x) requires(std::is_floating_point_v<coordinate>);
+
+    /*!
+     * \brief Sum of the magnitudes of the coefficients of x
+     */
+    template <Coordinate coordinate>
+    coordinate asum(std::span<const coordinate> x);
+
+    /*!
+     * \brief Index of the first coefficient of x of largest magnitude, NaN coefficients being ignored
+     * @return the index, x.size() if x is empty or only holds NaN
+     */
+    template <Coordinate coordinate>
+    size_t iamax(std::span<const coordinate> x);
+
+    /*!
+     * \brief y = x
+     * @throw std::invalid_argument if x and y do not have the same size
+     */
+    template <Coordinate coordinate>
+    void copy(std::span<const coordinate> x, std::span<coordinate> y);
+
+    /*!
+     * \brief Exchange the coefficients of x and y
+     * @throw std::invalid_argument if x and y do not have the same size
+     */
+    template <Coordinate coordinate>
+    void swap(std::span<coordinate> x, std::span<coordinate> y);
+
+    /*!
+     * \brief y = alpha * A * x + beta * y, or y = alpha * A^T * x + beta * y if transpose is true, A being a rows x cols
+     *        matrix stored row by row with a leading dimension (the distance between two rows) lda. y is not read
+     *        when beta is zero.
+     * @param transpose is true to multiply x by the transpose of A
+     * @param a holds the coefficients of A, A(i, j) being a[i * lda + j]
+     * @throw std::invalid_argument if lda < cols, if a is too small, or if the sizes of x and y do not match the
+     *        dimensions of A, or of A^T if transpose is true
+     */
+    template <Coordinate coordinate>
+    void gemv(bool                        transpose,
+              size_t                      rows,
+              size_t                      cols,
+              coordinate                  alpha,
+              std::span<const coordinate> a,
+              size_t                      lda,
+              std::span<const coordinate> x,
+              coordinate                  beta,
+              std::span<coordinate>       y);
+
+    namespace ImplementationDetails
+    {
+        // NOLINTBEGIN(readability-identifier-length)
+
+        /*!
+         * @brief Number of coefficients under which the vector kernels stay on the calling thread: below, the threads
+         *        cost more than the time they save on a memory bound kernel
+         */
+        constexpr size_t vector_kernel_concurrency_threshold = 1 << 18;
+
+        /*!
+         * @brief Largest number of partial results of a reduction, and multiple of their lengths
+         */
+        constexpr size_t vector_reduction_parts       = 64;
+        constexpr size_t vector_reduction_granularity = 64;
+
+        /*!
+         * @brief Number of coefficients whose largest magnitude iamax computes before looking for its index, small
+         *        enough for them to be read again from the L1 cache
+         */
+        constexpr size_t iamax_block_size = 1024;
+
+        /*!
+         * @brief Number of rows of A read at once by gemv, sharing the loads of x, or of y if A is transposed
+         */
+        constexpr size_t gemv_row_block = 4;
+
+        /*!
+         * @brief Number of coefficients of y updated by each pass over the rows of A when A is transposed
+         */
+        constexpr size_t gemv_column_block = 1024;
+
+        /*!
+         * @brief Number of coefficients from which operator*(Matrix, Vector) calls gemv rather than its scalar loop
+         */
+        constexpr size_t matrix_vector_kernel_size = 256;
+
+        /*!
+         * @brief Sum of x[i] * y[i] for i in [0, count[
+         */
+        template <Coordinate coordinate>
+        coordinate dot_product(const coordinate* x, const coordinate* y, size_t count)
+        {
+            coordinate result = 0;
+            size_t     i      = 0;
+
+#ifdef AVX_ENABLED_ON_CPU
+            if constexpr (has_simd_pack<coordinate>)
+            {
+                using simd = SimdPack<coordinate>;
+
+                // Two accumulators to hide the latency of the fused multiply-adds
+                auto first  = simd::broadcast(coordinate{0});
+                auto second = simd::broadcast(coordinate{0});
+
+                for (; i + 2 * simd::width <= count; i += 2 * simd::width)
+                {
+                    first  = simd::fmadd(simd::load(x + i), simd::load(y + i), first);
+                    second = simd::fmadd(simd::load(x + i + simd::width), simd::load(y + i + simd::width), second);
+                }
+
+                for (; i + simd::width <= count; i += simd::width)
+                {
+                    first = simd::fmadd(simd::load(x + i), simd::load(y + i), first);
+                }
+
+                coordinate lanes[simd::width];
+                simd::store(lanes, simd::add(first, second));
+
+                for (const coordinate lane : lanes)
+                {
+                    result += lane;
+                }
+            }
+#endif
+
+            for (; i < count; ++i)
+            {
+                result += x[i] * y[i];
+            }
+
+            return result;
+        }
+
+        /*!
+         * @brief y[i] += alpha * x[i] for i in [0, count[
+         */
+        template <Coordinate coordinate>
+        void add_scaled(size_t count, coordinate alpha, const coordinate* x, coordinate* y)
+        {
+            for_each_pack<coordinate>(0,
+                                      count,
+                                      [=](auto pack, size_t i)
+                                      {
+                                          using simd = decltype(pack);
+                                          simd::store(y + i, simd::fmadd(simd::broadcast(alpha), simd::load(x + i), simd::load(y + i)));
+                                      });
+        }
+
+        /*!
+         * @brief Reduce the combination of accumulate(pack, i, accumulator) for i in [0, count[ by steps of the pack
+         *        widths, the accumulators of the lanes being merged with combine(pack, lhs, rhs)
+         * @param initial is the neutral element of combine
+         */
+        template <Coordinate coordinate, typename Accumulate, typename Combine>
+        coordinate reduce_packs(size_t count, coordinate initial, const Accumulate& accumulate, const Combine& combine)
+        {
+            coordinate result = initial;
+            size_t     i      = 0;
+
+#ifdef AVX_ENABLED_ON_CPU
+            if constexpr (has_simd_pack<coordinate>)
+            {
+                using simd = SimdPack<coordinate>;
+
+                // Two accumulators to hide the latency of the operations
+                auto first  = simd::broadcast(initial);
+                auto second = simd::broadcast(initial);
+
+                for (; i + 2 * simd::width <= count; i += 2 * simd::width)
+                {
+                    first  = accumulate(simd{}, i, first);
+                    second = accumulate(simd{}, i + simd::width, second);
+                }
+
+                for (; i + simd::width <= count; i += simd::width)
+                {
+                    first = accumulate(simd{}, i, first);
+                }
+
+                coordinate lanes[simd::width];
+                simd::store(lanes, combine(simd{}, first, second));
+
+                for (const coordinate lane : lanes)
+                {
+                    result = combine(ScalarPack<coordinate>{}, result, lane);
+                }
+            }
+#endif
+
+            coordinate tail = initial;
+
+            for (; i < count; ++i)
+            {
+                tail = accumulate(ScalarPack<coordinate>{}, i, tail);
+            }
+
+            return combine(ScalarPack<coordinate>{}, result, tail);
+        }
+
+        /*!
+         * @brief Combine the results of partial(begin, end) over parts of [0, count[, computed by several threads for
+         *        long vectors. The bounds of the parts only depend on count, and their results are combined in order.
+         */
+        template <Coordinate coordinate, typename Partial, typename Combine>
+        coordinate reduce_concurrently(size_t count, const Partial& partial, const Combine& combine)
+        {
+            if (count < vector_kernel_concurrency_threshold)
+            {
+                return partial(size_t{0}, count);
+            }
+
+            std::array<coordinate, vector_reduction_parts> results = {};
+
+            size_t part_size = (count + vector_reduction_parts - 1) / vector_reduction_parts;
+            part_size        = (part_size + vector_reduction_granularity - 1) / vector_reduction_granularity * vector_reduction_granularity;
+
+            const size_t part_count = (count + part_size - 1) / part_size;
+
+            for_each_chunk_concurrently(
+            part_count,
+            1,
+            [&](size_t begin, size_t end)
+            {
+                for (size_t part = begin; part < end; ++part)
+                {
+                    results[part] = partial(part * part_size, std::min(count, (part + 1) * part_size));
+                }
+            },
+            0);
+
+            coordinate result = results[0];
+
+            for (size_t part = 1; part < part_count; ++part)
+            {
+                result = combine(result, results[part]);
+            }
+
+            return result;
+        }
+
+        /*!
+         * @brief Sum of the partial results, see reduce_concurrently
+         */
+        template <Coordinate coordinate, typename Partial>
+        coordinate sum_concurrently(size_t count, const Partial& partial)
+        {
+            return reduce_concurrently<coordinate>(count, partial, [](coordinate lhs, coordinate rhs) { return lhs + rhs; });
+        }
+
+        /*!
+         * @brief Largest magnitude of x[i] for i in [0, count[, NaN coefficients being ignored
+         */
+        template <Coordinate coordinate>
+        coordinate max_magnitude(const coordinate* x, size_t count)
+        {
+            return reduce_packs<coordinate>(
+            count,
+            coordinate{0},
+            [x](auto pack, size_t i, auto accumulator)
+            {
+                using simd = decltype(pack);
+
+                // The comparisons with NaN are false, keeping the accumulator
+                const auto magnitude = simd::abs(simd::load(x + i));
+                return simd::select_greater(magnitude, accumulator, magnitude, accumulator);
+            },
+            [](auto pack, auto lhs, auto rhs) { return decltype(pack)::max(lhs, rhs); });
+        }
+
+        /*!
+         * @brief Index and magnitude of the first coefficient of x[begin, end[ of largest magnitude, end and -1 if
+         *        there is none. The largest magnitude of each block is computed with SIMD instructions, the block being
+         *        only searched for its index when it is larger than those of the previous blocks.
+         */
+        template <Coordinate coordinate>
+        std::pair<size_t, coordinate> index_of_max_magnitude(const coordinate* x, size_t begin, size_t end)
+        {
+            std::pair<size_t, coordinate> result = { end, coordinate{-1} };
+
+            for (size_t block = begin; block < end; block += iamax_block_size)
+            {
+                const size_t     block_end = std::min(end, block + iamax_block_size);
+                const coordinate magnitude = max_magnitude(x + block, block_end - block);
+
+                if (!(magnitude > result.second))
+                {
+                    continue;
+                }
+
+                // Not found if the block only holds NaN
+                for (size_t i = block; i < block_end; ++i)
+                {
+                    if (std::abs(x[i]) == magnitude)
+                    {
+                        result = { i, magnitude };
+                        break;
+                    }
+                }
+            }
+
+            return result;
+        }
+
+        /*!
+         * @brief products[r] = sum of a[r * lda + j] * x[j] for j in [0, count[ and r in [0, row_count[, each load of x
+         *        being shared by the row_count rows
+         */
+        template <size_t row_count, Coordinate coordinate>
+        void dot_products(const coordinate* a, size_t lda, const coordinate* x, size_t count, coordinate* products)
+        {
+            for (size_t r = 0; r < row_count; ++r)
+            {
+                products[r] = 0;
+            }
+
+            size_t j = 0;
+
+#ifdef AVX_ENABLED_ON_CPU
+            if constexpr (has_simd_pack<coordinate>)
+            {
+                using simd = SimdPack<coordinate>;
+
+                // Plain array: the alignment of the SIMD types would be dropped as template arguments of std::array
+                typename simd::type acc[row_count];
+
+                for (size_t r = 0; r < row_count; ++r)
+                {
+                    acc[r] = simd::broadcast(coordinate{0});
+                }
+
+                for (; j + simd::width <= count; j += simd::width)
+                {
+                    const auto values = simd::load(x + j);
+
+                    for (size_t r = 0; r < row_count; ++r)
+                    {
+                        acc[r] = simd::fmadd(simd::load(a + r * lda + j), values, acc[r]);
+                    }
+                }
+
+                for (size_t r = 0; r < row_count; ++r)
+                {
+                    coordinate lanes[simd::width];
+                    simd::store(lanes, acc[r]);
+
+                    for (const coordinate lane : lanes)
+                    {
+                        products[r] += lane;
+                    }
+                }
+            }
+#endif
+
+            for (; j < count; ++j)
+            {
+                for (size_t r = 0; r < row_count; ++r)
+                {
+                    products[r] += a[r * lda + j] * x[j];
+                }
+            }
+        }
+
+        /*!
+         * @brief y[i] = alpha * (A * x)[i] + beta * y[i] for i in [begin, end[
+         */
+        template <Coordinate coordinate>
+        void multiply_rows(size_t            begin,
+                           size_t            end,
+                           size_t            cols,
+                           coordinate        alpha,
+                           const coordinate* a,
+                           size_t            lda,
+                           const coordinate* x,
+                           coordinate        beta,
+                           coordinate*       y)
+        {
+            coordinate products[gemv_row_block];
+
+            for (size_t i = begin; i < end; i += gemv_row_block)
+            {
+                const size_t count = std::min(gemv_row_block, end - i);
+
+                if (count == gemv_row_block)
+                {
+                    dot_products<gemv_row_block>(a + i * lda, lda, x, cols, products);
+                }
+                else
+                {
+                    for (size_t r = 0; r < count; ++r)
+                    {
+                        dot_products<1>(a + (i + r) * lda, lda, x, cols, products + r);
+                    }
+                }
+
+                for (size_t r = 0; r < count; ++r)
+                {
+                    y[i + r] = beta == 0 ? alpha * products[r] : alpha * products[r] + beta * y[i + r];
+                }
+            }
+        }
+
+        /*!
+         * @brief y[j] = alpha * (A^T * x)[j] + beta * y[j] for j in [begin, end[, A having rows rows
+         */
+        template <Coordinate coordinate>
+        void multiply_transposed_columns(size_t            begin,
+                                         size_t            end,
+                                         size_t            rows,
+                                         coordinate        alpha,
+                                         const coordinate* a,
+                                         size_t            lda,
+                                         const coordinate* x,
+                                         coordinate        beta,
+                                         coordinate*       y)
+        {
+            for (size_t block = begin; block < end; block += gemv_column_block)
+            {
+                const size_t block_end = std::min(end, block + gemv_column_block);
+
+                if (beta == 0)
+                {
+                    std::fill(y + block, y + block_end, coordinate{0});
+                }
+                else if (beta != 1)
+                {
+                    for_each_pack<coordinate>(block,
+                                              block_end,
+                                              [beta, y](auto pack, size_t j)
+                                              {
+                                                  using simd = decltype(pack);
+                                                  simd::store(y + j, simd::mul(simd::broadcast(beta), simd::load(y + j)));
+                                              });
+                }
+
+                size_t i = 0;
+
+                for (; i + gemv_row_block <= rows; i += gemv_row_block)
+                {
+                    const coordinate* row = a + i * lda;
+
+                    coordinate factors[gemv_row_block];
+
+                    for (size_t r = 0; r < gemv_row_block; ++r)
+                    {
+                        factors[r] = alpha * x[i + r];
+                    }
+
+                    for_each_pack<coordinate>(block,
+                                              block_end,
+                                              [&factors, row, lda, y](auto pack, size_t j)
+                                              {
+                                                  using simd = decltype(pack);
+
+                                                  auto sum = simd::load(y + j);
+
+                                                  for (size_t r = 0; r < gemv_row_block; ++r)
+                                                  {
+                                                      sum = simd::fmadd(simd::broadcast(factors[r]), simd::load(row + r * lda + j), sum);
+                                                  }
+
+                                                  simd::store(y + j, sum);
+                                              });
+                }
+
+                for (; i < rows; ++i)
+                {
+                    add_scaled<coordinate>(block_end - block, alpha * x[i], a + i * lda + block, y + block);
+                }
+            }
+        }
+
+        /*!
+         * @brief Throw if the sizes of the operands of gemv do not match
+         */
+        inline void check_matrix_vector_sizes(bool transpose, size_t rows, size_t cols, size_t a, size_t lda, size_t x, size_t y)
+        {
+            if (lda < cols || (rows > 0 && a < (rows - 1) * lda + cols))
+            {
+                throw std::invalid_argument("The matrix must hold rows rows of cols coefficients, lda coefficients apart");
+            }
+
+            if (x != (transpose ? rows : cols) || y != (transpose ? cols : rows))
+            {
+                throw std::invalid_argument("The sizes of the vectors must match the dimensions of the matrix");
+            }
+        }
+
+        /*!
+         * @brief Throw if two vectors do not have the same size
+         */
+        inline void check_same_length(size_t x, size_t y)
+        {
+            if (x != y)
+            {
+                throw std::invalid_argument("The vectors must have the same number of coefficients");
+            }
+        }
+
+        // NOLINTEND(readability-identifier-length)
+    }  // namespace ImplementationDetails
+
+    // NOLINTBEGIN(readability-identifier-length)
+    template <Coordinate coordinate>
+    void axpy(coordinate alpha, std::span<const coordinate> x, std::span<coordinate> y)
+    {
+        using namespace ImplementationDetails;
+
+        check_same_length(x.size(), y.size());
+
+        for_each_chunk_concurrently(
+        x.size(),
+        vector_reduction_granularity,
+        [alpha, x, y](size_t begin, size_t end) { add_scaled(end - begin, alpha, x.data() + begin, y.data() + begin); },
+        vector_kernel_concurrency_threshold);
+    }
+
+    template <Coordinate coordinate>
+    void scal(coordinate alpha, std::span<coordinate> x)
+    {
+        using namespace ImplementationDetails;
+
+        for_each_chunk_concurrently(
+        x.size(),
+        vector_reduction_granularity,
+        [alpha, x](size_t begin, size_t end)
+        {
+            for_each_pack<coordinate>(begin,
+                                      end,
+                                      [alpha, x](auto pack, size_t i)
+                                      {
+                                          using simd = decltype(pack);
+                                          simd::store(x.data() + i, simd::mul(simd::broadcast(alpha), simd::load(x.data() + i)));
+                                      });
+        },
+        vector_kernel_concurrency_threshold);
+    }
+
+    template <Coordinate coordinate>
+    coordinate dot(std::span<const coordinate> x, std::span<const coordinate> y)
+    {
+        using namespace ImplementationDetails;
+
+        check_same_length(x.size(), y.size());
+
+        return sum_concurrently<coordinate>(x.size(),
+                                            [x, y](size_t begin, size_t end)
+                                            { return dot_product(x.data() + begin, y.data() + begin, end - begin); });
+    }
+
+    template <Coordinate coordinate>
+    coordinate nrm2(std::span<const coordinate> x) requires(std::is_floating_point_v<coordinate>)
+    {
+        using namespace ImplementationDetails;
+
+        const coordinate squares = sum_concurrently<coordinate>(x.size(),
+                                                                [x](size_t begin, size_t end)
+                                                                { return dot_product(x.data() + begin, x.data() + begin, end - begin); });
+
+        // Squares of the magnitudes which may have been rounded to zero, or overflowed
+        constexpr coordinate smallest = std::numeric_limits<coordinate>::min() / std::numeric_limits<coordinate>::epsilon();
+
+        if (squares >= smallest && squares <= std::numeric_limits<coordinate>::max())
+        {
+            return std::sqrt(squares);
+        }
+
+        const coordinate scale = reduce_concurrently<coordinate>(
+        x.size(),
+        [x](size_t begin, size_t end) { return max_magnitude(x.data() + begin, end - begin); },
+        [](coordinate lhs, coordinate rhs) { return std::max(lhs, rhs); });
+
+        if (scale == 0 || !std::isfinite(scale))
+        {
+            return std::isnan(squares) ? squares : scale;
+        }
+
+        const coordinate scaled_squares = sum_concurrently<coordinate>(
+        x.size(),
+        [x, scale](size_t begin, size_t end)
+        {
+            const coordinate* data = x.data() + begin;
+
+            return reduce_packs<coordinate>(
+            end - begin,
+            coordinate{0},
+            [data, scale](auto pack, size_t i, auto accumulator)
+            {
+                using simd = decltype(pack);
+
+                const auto value = simd::div(simd::load(data + i), simd::broadcast(scale));
+                return simd::fmadd(value, value, accumulator);
+            },
+            [](auto pack, auto lhs, auto rhs) { return decltype(pack)::add(lhs, rhs); });
+        });
+
+        return scale * std::sqrt(scaled_squares);
+    }
+
+    template <Coordinate coordinate>
+    coordinate asum(std::span<const coordinate> x)
+    {
+        using namespace ImplementationDetails;
+
+        return sum_concurrently<coordinate>(x.size(),
+                                            [x](size_t begin, size_t end)
+                                            {
+                                                const coordinate* data = x.data() + begin;
+
+                                                return reduce_packs<coordinate>(
+                                                end - begin,
+                                                coordinate{0},
+                                                [data](auto pack, size_t i, auto accumulator)
+                                                {
+                                                    using simd = decltype(pack);
+                                                    return simd::add(simd::abs(simd::load(data + i)), accumulator);
+                                                },
+                                                [](auto pack, auto lhs, auto rhs) { return decltype(pack)::add(lhs, rhs); });
+                                            });
+    }
+
+    template <Coordinate coordinate>
+    size_t iamax(std::span<const coordinate> x)
+    {
+        using namespace ImplementationDetails;
+
+        if (x.size() < vector_kernel_concurrency_threshold)
+        {
+            return index_of_max_magnitude(x.data(), 0, x.size()).first;
+        }
+
+        // One candidate per part, the first part holding the largest magnitude winning
+        std::array<std::pair<size_t, coordinate>, vector_reduction_parts> candidates;
+
+        const size_t part_size  = (x.size() + vector_reduction_parts - 1) / vector_reduction_parts;
+        const size_t part_count = (x.size() + part_size - 1) / part_size;
+
+        for_each_chunk_concurrently(
+        part_count,
+        1,
+        [&](size_t begin, size_t end)
+        {
+            for (size_t part = begin; part < end; ++part)
+            {
+                candidates[part] = index_of_max_magnitude(x.data(), part * part_size, std::min(x.size(), (part + 1) * part_size));
+            }
+        },
+        0);
+
+        std::pair<size_t, coordinate> result = { x.size(), coordinate{-1} };
+
+        for (size_t part = 0; part < part_count; ++part)
+        {
+            if (candidates[part].second > result.second)
+            {
+                result = candidates[part];
+            }
+        }
+
+        return result.first;
+    }
+
+    template <Coordinate coordinate>
+    void copy(std::span<const coordinate> x, std::span<coordinate> y)
+    {
+        using namespace ImplementationDetails;
+
+        check_same_length(x.size(), y.size());
+
+        for_each_chunk_concurrently(
+        x.size(),
+        vector_reduction_granularity,
+        [x, y](size_t begin, size_t end) { std::copy(x.begin() + begin, x.begin() + end, y.begin() + begin); },
+        vector_kernel_concurrency_threshold);
+    }
+
+    template <Coordinate coordinate>
+    void swap(std::span<coordinate> x, std::span<coordinate> y)
+    {
+        using namespace ImplementationDetails;
+
+        check_same_length(x.size(), y.size());
+
+        for_each_chunk_concurrently(
+        x.size(),
+        vector_reduction_granularity,
+        [x, y](size_t begin, size_t end) { std::swap_ranges(x.begin() + begin, x.begin() + end, y.begin() + begin); },
+        vector_kernel_concurrency_threshold);
+    }
+
+    template <Coordinate coordinate>
+    void gemv(bool                        transpose,
+              size_t                      rows,
+              size_t                      cols,
+              coordinate                  alpha,
+              std::span<const coordinate> a,
+              size_t                      lda,
+              std::span<const coordinate> x,
+              coordinate                  beta,
+              std::span<coordinate>       y)
+    {
+        using namespace ImplementationDetails;
+
+        check_matrix_vector_sizes(transpose, rows, cols, a.size(), lda, x.size(), y.size());
+
+        // Memory bound like the level 1 kernels: worth the threads from the same number of coefficients of A
+        const bool   concurrent = rows * cols >= vector_kernel_concurrency_threshold;
+        const size_t count      = transpose ? cols : rows;
+        const size_t threshold  = concurrent ? 0 : count + 1;
+
+        if (transpose)
+        {
+            for_each_chunk_concurrently(
+            cols,
+            gemv_column_block,
+            [=](size_t begin, size_t end) { multiply_transposed_columns(begin, end, rows, alpha, a.data(), lda, x.data(), beta, y.data()); },
+            threshold);
+        }
+        else
+        {
+            for_each_chunk_concurrently(
+            rows,
+            gemv_row_block,
+            [=](size_t begin, size_t end) { multiply_rows(begin, end, cols, alpha, a.data(), lda, x.data(), beta, y.data()); },
+            threshold);
+        }
+    }
+    // NOLINTEND(readability-identifier-length)
+}  // namespace LCNS::Algebra
@@ -9,7 +9,7 @@ namespace LCNS
         {
             return 1e-3f;
         }
-        else if (std::is_same_v<T, double>)
+        else
         {
             return 1e-5;
         }
@@ -22,7 +22,7 @@ namespace LCNS
         {
             return 1e-3f;
         }
-        else if (std::is_same_v<T, double>)
+        else
         {
             return 1e-6;
         }
@@ -35,7 +35,7 @@ namespace LCNS
         {
             return 1e-6f;
         }
-        else if (std::is_same_v<T, double>)
+        else
         {
             return 1e-9;
         }
@@ -0,0 +1,61 @@
+#include "algebra/Algebra.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <span>
+#include <vector>
+
+/*
+ * Built from the header including all the others, so that the names declared by one header do not hide the names the
+ * templates of another one use
+ */
+
+using FloatingTypes = std::tuple<float, double>;
+
+TEMPLATE_LIST_TEST_CASE("Algebra header", "[algebra][matrix][header]", FloatingTypes)
+{
+    using LCNS::Algebra::SparseMatrix;
+
+    // Tridiagonal symmetric positive definite matrix
+    SparseMatrix<TestType> matrix;
+    matrix.size = 50;
+    matrix.row_offsets.assign(1, 0);
+
+    for (size_t row = 0; row < matrix.size; ++row)
+    {
+        if (row > 0)
+        {
+            matrix.columns.push_back(row - 1);
+            matrix.values.push_back(-1);
+        }
+
+        matrix.columns.push_back(row);
+        matrix.values.push_back(3);
+
+        if (row + 1 < matrix.size)
+        {
+            matrix.columns.push_back(row + 1);
+            matrix.values.push_back(-1);
+        }
+
+        matrix.row_offsets.push_back(matrix.columns.size());
+    }
+
+    const std::vector<TestType> b(matrix.size, TestType{1});
+    std::vector<TestType>       x(matrix.size);
+    std::vector<TestType>       workspace(LCNS::Algebra::gmres_workspace_size(matrix.size, 10));
+
+    const std::span<const TestType> rhs(b);
+    const std::span<TestType>       solution(x);
+    const std::span<TestType>       work(workspace);
+    const TestType                  tolerance = TestType{1e-5};
+
+    CHECK(LCNS::Algebra::conjugate_gradient(matrix, rhs, solution, work, tolerance, 100).converged);
+
+    x.assign(matrix.size, TestType{0});
+    CHECK(LCNS::Algebra::bicgstab(matrix, rhs, solution, work, tolerance, 100).converged);
+
+    x.assign(matrix.size, TestType{0});
+    CHECK(LCNS::Algebra::gmres(matrix, rhs, solution, work, tolerance, 100, 10).converged);
+}
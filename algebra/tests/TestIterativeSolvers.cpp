@@ -0,0 +1,319 @@
+#include "algebra/IterativeSolvers.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+using LCNS::Algebra::bicgstab;
+using LCNS::Algebra::bicgstab_workspace_size;
+using LCNS::Algebra::conjugate_gradient;
+using LCNS::Algebra::conjugate_gradient_workspace_size;
+using LCNS::Algebra::gmres;
+using LCNS::Algebra::gmres_workspace_size;
+using LCNS::Algebra::IncompleteCholeskyPreconditioner;
+using LCNS::Algebra::JacobiPreconditioner;
+using LCNS::Algebra::Matrix;
+using LCNS::Algebra::SparseMatrix;
+
+using FloatingTypes = std::tuple<float, double>;
+
+namespace
+{
+    /*
+     * Five point finite difference operator on a grid x grid square, scaled by the coefficients of the rows so that
+     * the diagonal is not constant. The convection term makes it nonsymmetric.
+     */
+    template <typename T>
+    SparseMatrix<T> diffusion_operator(size_t grid, T convection = 0)
+    {
+        SparseMatrix<T> matrix;
+        matrix.size = grid * grid;
+        matrix.row_offsets.assign(1, 0);
+
+        for (size_t i = 0; i < grid; ++i)
+        {
+            for (size_t j = 0; j < grid; ++j)
+            {
+                const size_t row   = i * grid + j;
+                const T      scale = static_cast<T>(1 + 9 * (row % 7) / 6.0);
+
+                const auto add = [&](size_t column, T value)
+                {
+                    matrix.columns.push_back(column);
+                    matrix.values.push_back(scale * value);
+                };
+
+                if (i > 0)
+                {
+                    add(row - grid, -1 - convection);
+                }
+                if (j > 0)
+                {
+                    add(row - 1, -1 - convection);
+                }
+                add(row, 4);
+                if (j + 1 < grid)
+                {
+                    add(row + 1, -1 + convection);
+                }
+                if (i + 1 < grid)
+                {
+                    add(row + grid, -1 + convection);
+                }
+
+                matrix.row_offsets.push_back(matrix.columns.size());
+            }
+        }
+
+        return matrix;
+    }
+
+    /*
+     * Same scaling on both sides, the matrix staying symmetric positive definite
+     */
+    template <typename T>
+    SparseMatrix<T> symmetric_diffusion_operator(size_t grid)
+    {
+        SparseMatrix<T> matrix = diffusion_operator<T>(grid);
+
+        std::vector<T> scales(matrix.size);
+
+        for (size_t row = 0; row < matrix.size; ++row)
+        {
+            scales[row] = std::sqrt(static_cast<T>(1 + 9 * (row % 7) / 6.0));
+        }
+
+        for (size_t row = 0; row < matrix.size; ++row)
+        {
+            for (size_t k = matrix.row_offsets[row]; k < matrix.row_offsets[row + 1]; ++k)
+            {
+                matrix.values[k] = matrix.values[k] / scales[row] * scales[matrix.columns[k]];
+            }
+        }
+
+        return matrix;
+    }
+
+    template <typename T>
+    std::vector<T> random_vector(size_t size)
+    {
+        std::mt19937                      generator;
+        std::uniform_real_distribution<T> distribution(-1, 1);
+
+        std::vector<T> result(size);
+
+        for (T& value : result)
+        {
+            value = distribution(generator);
+        }
+
+        return result;
+    }
+
+    template <typename T, typename Operator>
+    double relative_residual(const Operator& op, const std::vector<T>& b, const std::vector<T>& x)
+    {
+        std::vector<T> product(b.size());
+        op(std::span<const T>(x), std::span<T>(product));
+
+        double residual = 0;
+        double norm     = 0;
+
+        for (size_t i = 0; i < b.size(); ++i)
+        {
+            residual += std::pow(static_cast<double>(b[i]) - product[i], 2);
+            norm += std::pow(static_cast<double>(b[i]), 2);
+        }
+
+        return std::sqrt(residual / norm);
+    }
+}  // namespace
+
+TEMPLATE_LIST_TEST_CASE("Krylov solvers", "[algebra][matrix][krylov]", FloatingTypes)
+{
+    const TestType tolerance = std::is_same_v<TestType, float> ? TestType{1e-5} : TestType{1e-10};
+
+    SECTION("Conjugate gradient")
+    {
+        const SparseMatrix<TestType> matrix = symmetric_diffusion_operator<TestType>(30);
+        const std::vector<TestType>  b      = random_vector<TestType>(matrix.size);
+
+        std::vector<TestType> workspace(conjugate_gradient_workspace_size(matrix.size));
+        std::vector<TestType> x(matrix.size);
+
+        const std::span<const TestType> rhs(b);
+        const std::span<TestType>       solution(x);
+        const std::span<TestType>       work(workspace);
+
+        const auto plain = conjugate_gradient(matrix, rhs, solution, work, tolerance, 1000);
+        CHECK(plain.converged);
+        CHECK(plain.residual < 10 * tolerance);
+        CHECK(relative_residual(matrix, b, x) < 10 * tolerance);
+
+        std::fill(x.begin(), x.end(), TestType{0});
+        const JacobiPreconditioner<TestType> jacobi(matrix);
+        const auto jacobi_result = conjugate_gradient(matrix, rhs, solution, work, tolerance, 1000, jacobi);
+        CHECK(jacobi_result.converged);
+        CHECK(jacobi_result.residual < 10 * tolerance);
+        CHECK(jacobi_result.iterations < plain.iterations);
+
+        std::fill(x.begin(), x.end(), TestType{0});
+        const IncompleteCholeskyPreconditioner<TestType> cholesky(matrix);
+        const auto cholesky_result = conjugate_gradient(matrix, rhs, solution, work, tolerance, 1000, cholesky);
+        CHECK(cholesky.shift() == 0);
+        CHECK(cholesky_result.converged);
+        CHECK(cholesky_result.residual < 10 * tolerance);
+        CHECK(cholesky_result.iterations < jacobi_result.iterations);
+        CHECK(relative_residual(matrix, b, x) < 10 * tolerance);
+
+        // Already solved, from the solution as initial guess
+        const auto solved = conjugate_gradient(matrix, rhs, solution, work, tolerance, 1000, cholesky);
+        CHECK(solved.converged);
+        CHECK(solved.iterations <= 1);
+
+        // Too few iterations
+        std::fill(x.begin(), x.end(), TestType{0});
+        const auto stopped = conjugate_gradient(matrix, rhs, solution, work, tolerance, 5);
+        CHECK_FALSE(stopped.converged);
+        CHECK(stopped.iterations == 5);
+        CHECK(stopped.residual < 1);
+    }
+
+    SECTION("Nonsymmetric operators")
+    {
+        const SparseMatrix<TestType> matrix = diffusion_operator<TestType>(30, TestType{0.4});
+        const std::vector<TestType>  b      = random_vector<TestType>(matrix.size);
+
+        const JacobiPreconditioner<TestType> jacobi(matrix);
+
+        std::vector<TestType> x(matrix.size);
+        std::vector<TestType> workspace(gmres_workspace_size(matrix.size, 40));
+
+        const std::span<const TestType> rhs(b);
+        const std::span<TestType>       solution(x);
+        const std::span<TestType>       work(workspace);
+
+        const auto bicgstab_result = bicgstab(matrix, rhs, solution, work, tolerance, 1000, jacobi);
+        CHECK(bicgstab_result.converged);
+        CHECK(bicgstab_result.residual < 10 * tolerance);
+        CHECK(relative_residual(matrix, b, x) < 10 * tolerance);
+
+        std::fill(x.begin(), x.end(), TestType{0});
+
+        const auto gmres_result = gmres(matrix, rhs, solution, work, tolerance, 2000, 40, jacobi);
+        CHECK(gmres_result.converged);
+        CHECK(gmres_result.residual < 10 * tolerance);
+        CHECK(relative_residual(matrix, b, x) < 10 * tolerance);
+
+        // Without preconditioner, restarting more often
+        std::fill(x.begin(), x.end(), TestType{0});
+        const auto restarted = gmres(matrix, rhs, solution, work, tolerance, 4000, 20);
+        CHECK(restarted.converged);
+        CHECK(restarted.residual < 10 * tolerance);
+        CHECK(restarted.iterations > 20);
+    }
+
+    SECTION("Dense matrices and callables")
+    {
+        // Diagonally dominant, symmetric positive definite
+        Matrix<TestType, 12, 12> matrix;
+        const std::vector<TestType> values = random_vector<TestType>(144);
+
+        for (unsigned int i = 0; i < 12; ++i)
+        {
+            for (unsigned int j = 0; j <= i; ++j)
+            {
+                matrix(i, j) = values[i * 12 + j];
+                matrix(j, i) = values[i * 12 + j];
+            }
+
+            matrix(i, i) = static_cast<TestType>(12 + i);
+        }
+
+        const std::vector<TestType> b = random_vector<TestType>(12);
+
+        const auto op = [&matrix](std::span<const TestType> x, std::span<TestType> y)
+        {
+            for (unsigned int i = 0; i < 12; ++i)
+            {
+                y[i] = 0;
+
+                for (unsigned int j = 0; j < 12; ++j)
+                {
+                    y[i] += matrix(i, j) * x[j];
+                }
+            }
+        };
+
+        std::vector<TestType> workspace(gmres_workspace_size(12, 12));
+        std::vector<TestType> dense(12);
+        std::vector<TestType> callable(12);
+
+        const std::span<const TestType> rhs(b);
+        const std::span<TestType>       work(workspace);
+
+        const JacobiPreconditioner<TestType> jacobi(matrix);
+
+        const auto dense_result = conjugate_gradient(matrix, rhs, std::span<TestType>(dense), work, tolerance, 100, jacobi);
+        CHECK(dense_result.converged);
+        CHECK(relative_residual(op, b, dense) < 10 * tolerance);
+
+        const auto callable_result = bicgstab(op, rhs, std::span<TestType>(callable), work, tolerance, 100);
+        CHECK(callable_result.converged);
+        CHECK(relative_residual(op, b, callable) < 10 * tolerance);
+
+        // At most n iterations for GMRES without restart, in exact arithmetic
+        std::fill(callable.begin(), callable.end(), TestType{0});
+        const auto gmres_result = gmres(op, rhs, std::span<TestType>(callable), work, tolerance, 100, 12);
+        CHECK(gmres_result.converged);
+        CHECK(gmres_result.iterations <= 12);
+
+        for (size_t i = 0; i < 12; ++i)
+        {
+            CHECK(callable[i] == Catch::Approx(dense[i]).margin(100 * tolerance));
+        }
+
+        // Null right hand side
+        const std::vector<TestType> zeros(12);
+        const auto null = bicgstab(matrix, std::span<const TestType>(zeros), std::span<TestType>(callable), work, tolerance, 100);
+        CHECK(null.converged);
+        CHECK(null.iterations == 0);
+        CHECK(callable == zeros);
+    }
+
+    SECTION("Invalid inputs")
+    {
+        const SparseMatrix<TestType> matrix = symmetric_diffusion_operator<TestType>(4);
+
+        std::vector<TestType> b(16);
+        std::vector<TestType> x(16);
+        std::vector<TestType> small(15);
+        std::vector<TestType> workspace(gmres_workspace_size(16, 10));
+
+        const std::span<const TestType> rhs(b);
+        const std::span<TestType>       solution(x);
+        const std::span<TestType>       work(workspace);
+
+        CHECK_THROWS_AS(conjugate_gradient(matrix, rhs, std::span<TestType>(small), work, tolerance, 10),
+                        std::invalid_argument);
+        CHECK_THROWS_AS(conjugate_gradient(matrix, rhs, solution, std::span<TestType>(small), tolerance, 10),
+                        std::invalid_argument);
+        CHECK_THROWS_AS(bicgstab(matrix, rhs, solution, std::span<TestType>(small), tolerance, 10), std::invalid_argument);
+        CHECK_THROWS_AS(gmres(matrix, rhs, solution, work, tolerance, 10, 11), std::invalid_argument);
+        CHECK_THROWS_AS(gmres(matrix, rhs, solution, work, tolerance, 10, 0), std::invalid_argument);
+
+        CHECK_THROWS_AS(JacobiPreconditioner<TestType>(rhs), std::invalid_argument);
+
+        SparseMatrix<TestType> missing_diagonal = matrix;
+        missing_diagonal.values[0]              = 0;
+        CHECK_THROWS_AS(IncompleteCholeskyPreconditioner<TestType>(missing_diagonal), std::invalid_argument);
+    }
+}
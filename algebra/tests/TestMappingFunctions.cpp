@@ -12,6 +12,7 @@ using LCNS::epsilonHighPrecision;
 using LCNS::epsilonLowPrecision;
 using LCNS::epsilonVeryLowPrecision;
 using LCNS::Algebra::Matrix;
+using LCNS::Algebra::EulerAnglesAsQuaternion;
 using LCNS::Algebra::Quaternion;
 
 using IntegerTypes  = std::tuple<short, int, long>;
@@ -27,7 +28,8 @@ void CheckMatricesAreEqual(const auto& lhs, const auto& rhs, const auto precisio
     {
         for (size_t j = 0; j < 3; ++j)
         {
-            CHECK(lhs(i, j) == Catch::Approx(rhs(i, j)).epsilon(precision));
+            // The reference matrices are given with 7 decimals, hence the margin for the coefficients close to 0
+            CHECK(lhs(i, j) == Catch::Approx(rhs(i, j)).epsilon(precision).margin(1e-7));
         }
     }
 }
@@ -234,3 +236,72 @@ TEMPLATE_LIST_TEST_CASE("3x3 matrix to quaternion to 3x3 matrix", "[algebra][map
         CheckMatricesAreEqual(original, reconstructed, evlp);
     }
 }
+
+TEMPLATE_LIST_TEST_CASE("Quaternion to 3x3 matrix to quaternion", "[algebra][mapping]", FloatingTypes)
+{
+    const auto elp = epsilonLowPrecision<TestType>();
+
+    const auto make = [](double x, double y, double z, double w)
+    { return Quaternion<TestType>(static_cast<TestType>(x), static_cast<TestType>(y), static_cast<TestType>(z), static_cast<TestType>(w)).normalized(); };
+
+    const auto check_round_trip = [elp](const Quaternion<TestType>& original)
+    {
+        const auto reconstructed = RotationMatrixAsQuaternion(QuaternionAsRotationMatrix(original));
+
+        // q and -q are the same rotation, the conversion returns the one with w >= 0 (either of them when w = 0)
+        const TestType dot  = reconstructed.x() * original.x() + reconstructed.y() * original.y() + reconstructed.z() * original.z() + reconstructed.w() * original.w();
+        const TestType sign = dot < 0 ? -1 : 1;
+
+        CHECK(reconstructed.w() >= 0);
+        CHECK(reconstructed.x() == Catch::Approx(sign * original.x()).margin(elp));
+        CHECK(reconstructed.y() == Catch::Approx(sign * original.y()).margin(elp));
+        CHECK(reconstructed.z() == Catch::Approx(sign * original.z()).margin(elp));
+        CHECK(reconstructed.w() == Catch::Approx(sign * original.w()).margin(elp));
+    };
+
+    SECTION("Each pivot of Shepperd's method")
+    {
+        // Largest coordinate w, then x, y and z: the last three are rotations close to pi where w is almost 0
+        check_round_trip(make(0.1, -0.2, 0.3, 0.9));
+        check_round_trip(make(0.95, 0.1, -0.2, 0.01));
+        check_round_trip(make(-0.1, 0.95, 0.2, -0.01));
+        check_round_trip(make(0.2, 0.1, -0.95, 0.0));
+    }
+
+    SECTION("Rotations of pi around each axis")
+    {
+        check_round_trip(make(1.0, 0.0, 0.0, 0.0));
+        check_round_trip(make(0.0, 1.0, 0.0, 0.0));
+        check_round_trip(make(0.0, 0.0, 1.0, 0.0));
+    }
+
+    SECTION("Negative w")
+    {
+        check_round_trip(make(0.464072, 0.7441422, 0.3107339, -0.366516));
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Quaternion from Euler angles", "[algebra][mapping]", FloatingTypes)
+{
+    const auto elp = epsilonLowPrecision<TestType>();
+
+    SECTION("Example 1: (Rz,Ry,Rx)=(20, 15, 30)")
+    {
+        const auto quat = EulerAnglesAsQuaternion<TestType>(DegToRad(30.0), DegToRad(15.0), DegToRad(20.0));
+
+        CHECK(quat.x() == Catch::Approx(0.2308131).epsilon(elp));
+        CHECK(quat.y() == Catch::Approx(0.1687222).epsilon(elp));
+        CHECK(quat.z() == Catch::Approx(0.1330269).epsilon(elp));
+        CHECK(quat.w() == Catch::Approx(0.9489795).epsilon(elp));
+    }
+
+    SECTION("Example 2: (Rz,Ry,Rx)=(-17, 81.5, -1.3)")
+    {
+        const auto quat = EulerAnglesAsQuaternion<TestType>(DegToRad(-17.0), DegToRad(81.5), DegToRad(-1.3));
+
+        CHECK(quat.x() == Catch::Approx(-0.1046442).epsilon(elp));
+        CHECK(quat.y() == Catch::Approx(0.6468185).epsilon(elp));
+        CHECK(quat.z() == Catch::Approx(0.0879781).epsilon(elp));
+        CHECK(quat.w() == Catch::Approx(0.7502901).epsilon(elp));
+    }
+}
@@ -8,6 +8,8 @@
 #include <catch2/generators/catch_generators_random.hpp>
 
 #include <iostream>
+#include <array>
+#include <cstring>
 
 using LCNS::epsilonHighPrecision;
 using LCNS::epsilonLowPrecision;
@@ -16,6 +18,7 @@ using LCNS::Algebra::Vector;
 
 using IntegerTypes  = std::tuple<short, int, long>;
 using FloatingTypes = std::tuple<float, double>;
+using InverseTypes  = std::tuple<float, double, long double>;
 
 TEMPLATE_LIST_TEST_CASE("Accessor operator", "[algebra][matrix][dim4][operator]", IntegerTypes)
 {
@@ -1592,6 +1595,92 @@ TEMPLATE_LIST_TEST_CASE("Internal data access", "[algebra][matrix][dim4][method]
     CHECK(data2[15] == 16.0);
 }
 
+TEMPLATE_LIST_TEST_CASE("Memory layout", "[algebra][matrix][dim4][method]", FloatingTypes)
+{
+    STATIC_CHECK(sizeof(Matrix<TestType, 4, 4>) == 16 * sizeof(TestType));
+    STATIC_CHECK(std::is_standard_layout_v<Matrix<TestType, 4, 4>>);
+    STATIC_CHECK(std::is_trivially_copyable_v<Matrix<TestType, 4, 4>>);
+
+    // clang-format off
+    const std::array<Matrix<TestType, 4, 4>, 2> mats = { Matrix<TestType, 4, 4>(static_cast<TestType>(2.0)),
+                                                         Matrix<TestType, 4, 4>{  1.0,  2.0,  3.0,  4.0,
+                                                                                  5.0,  6.0,  7.0,  8.0,
+                                                                                  9.0, 10.0, 11.0, 12.0,
+                                                                                 13.0, 14.0, 15.0, 16.0 } };
+    // clang-format on
+
+    std::array<TestType, 32> packed = {};
+    std::memcpy(packed.data(), mats.data(), sizeof(mats));
+
+    CHECK(packed[0] == 2.0);
+    CHECK(packed[5] == 2.0);
+    CHECK(packed[16] == 1.0);
+    CHECK(packed[31] == 16.0);
+
+    std::array<Matrix<TestType, 4, 4>, 2> copies;
+    std::memcpy(static_cast<void*>(copies.data()), packed.data(), sizeof(packed));
+
+    CHECK(copies == mats);
+}
+
+TEMPLATE_LIST_TEST_CASE("Column major storage", "[algebra][matrix][dim4][method]", FloatingTypes)
+{
+    using LCNS::Algebra::StorageOrder;
+
+    // clang-format off
+    constexpr Matrix<TestType, 4, 4> row_major = {  4.0, -5.1, -9.9,  5.5,
+                                                   -8.3,  4.2, -1.1, -9.8,
+                                                    6.4,  3.2,  7.0,  7.5,
+                                                   -9.1,  7.2,  8.7,  5.5 };
+
+    constexpr Matrix<TestType, 4, 4, StorageOrder::ColumnMajor> col_major = {  4.0, -5.1, -9.9,  5.5,
+                                                                              -8.3,  4.2, -1.1, -9.8,
+                                                                               6.4,  3.2,  7.0,  7.5,
+                                                                              -9.1,  7.2,  8.7,  5.5 };
+    // clang-format on
+
+    STATIC_CHECK(col_major(0, 1) == row_major(0, 1));
+    STATIC_CHECK(col_major(3, 2) == row_major(3, 2));
+
+    // The coefficients are stored column by column
+    CHECK(col_major.data()[1] == row_major(1, 0));
+    CHECK(col_major.data()[4] == row_major(0, 1));
+    CHECK(col_major.data()[14] == row_major(2, 3));
+
+    CHECK(Matrix<TestType, 4, 4, StorageOrder::ColumnMajor>(row_major) == col_major);
+    CHECK(Matrix<TestType, 4, 4>(col_major) == row_major);
+
+    const auto transposed = col_major.transposed();
+    const auto product    = col_major * transposed;
+    const auto reference  = row_major * row_major.transposed();
+    const auto inverse    = col_major.inversed();
+    const auto ref_inv    = row_major.inversed();
+    const auto ehp        = epsilonHighPrecision<TestType>();
+    const auto elp        = epsilonLowPrecision<TestType>();
+
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        for (unsigned int j = 0; j < 4; ++j)
+        {
+            CHECK(transposed(i, j) == row_major(j, i));
+            CHECK(product(i, j) == Catch::Approx(reference(i, j)).epsilon(ehp));
+            CHECK(inverse(i, j) == Catch::Approx(ref_inv(i, j)).epsilon(elp));
+        }
+    }
+
+    CHECK(col_major.determinant() == Catch::Approx(row_major.determinant()).epsilon(ehp));
+
+    constexpr TestType        x = 1.0, y = 2.0, z = 3.0, w = 4.0;
+    const Vector<TestType, 4> vec(x, y, z, w);
+    const auto                col_major_vec = col_major * vec;
+    const auto                row_major_vec = row_major * vec;
+
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        CHECK(col_major_vec[i] == Catch::Approx(row_major_vec[i]).epsilon(ehp));
+    }
+}
+
 TEMPLATE_LIST_TEST_CASE("Transpose", "[algebra][matrix][dim4][method]", IntegerTypes)
 {
     // clang-format off
@@ -1796,6 +1885,47 @@ TEMPLATE_LIST_TEST_CASE("Determinant", "[algebra][matrix][dim4][method]", Floati
     CHECK(det == Catch::Approx(6810.0026).epsilon(ehp));
 }
 
+TEMPLATE_LIST_TEST_CASE("Determinant at run time matches the closed form", "[algebra][matrix][dim4][method]", FloatingTypes)
+{
+    using LCNS::Algebra::StorageOrder;
+
+    // clang-format off
+    constexpr Matrix<TestType, 4, 4> mat = {  4.0, -5.1, -9.9,  5.5,
+                                             -8.3,  4.2, -1.1, -9.8,
+                                              6.4,  3.2,  7.0,  7.5,
+                                             -9.1,  7.2,  8.7,  5.5 };
+
+    constexpr Matrix<TestType, 4, 4> block_singular = { 1.0, 2.0, 0.5, -3.0,
+                                                        2.0, 4.0, 1.5,  7.0,
+                                                       -1.0, 0.2, 3.0,  3.0,
+                                                        5.0, 1.0, 6.0, 12.0 };
+
+    constexpr Matrix<TestType, 4, 4> singular = { 1.0, 2.0, 3.0,  4.0,
+                                                  5.0, 6.0, 7.0,  8.0,
+                                                  2.0, 4.0, 6.0,  8.0,
+                                                  0.0, 1.0, 0.0, -1.0 };
+
+    constexpr Matrix<TestType, 4, 4, StorageOrder::ColumnMajor> col_major(mat);
+    // clang-format on
+
+    // The constexpr determinants come from the scalar closed form, the run time ones from the SIMD path when available
+    constexpr TestType det                = mat.determinant();
+    constexpr TestType det_block_singular = block_singular.determinant();
+    constexpr TestType det_col_major      = col_major.determinant();
+
+    const auto mat_rt            = mat;
+    const auto block_singular_rt = block_singular;
+    const auto singular_rt       = singular;
+    const auto col_major_rt      = col_major;
+
+    const auto ehp = epsilonHighPrecision<TestType>();
+
+    CHECK(mat_rt.determinant() == Catch::Approx(det).epsilon(ehp));
+    CHECK(block_singular_rt.determinant() == Catch::Approx(det_block_singular).epsilon(ehp));
+    CHECK(col_major_rt.determinant() == Catch::Approx(det_col_major).epsilon(ehp));
+    CHECK(singular_rt.determinant() == 0);
+}
+
 TEMPLATE_LIST_TEST_CASE("Trace", "[algebra][matrix][dim4][method]", IntegerTypes)
 {
     constexpr TestType diagonalValue = 28;
@@ -1824,7 +1954,7 @@ TEMPLATE_LIST_TEST_CASE("Trace", "[algebra][matrix][dim4][method]", FloatingType
     CHECK(trace == Catch::Approx(-10.64).epsilon(ehp));
 }
 
-TEMPLATE_LIST_TEST_CASE("Inverse", "[algebra][matrix][dim4][method]", FloatingTypes)
+TEMPLATE_LIST_TEST_CASE("Inverse", "[algebra][matrix][dim4][method]", InverseTypes)
 {
     // clang-format off
     constexpr TestType mat_00 =  4.0, mat_01 = -5.1, mat_02 = -9.9, mat_03 =  5.5,
@@ -1913,6 +2043,81 @@ TEMPLATE_LIST_TEST_CASE("Inverse", "[algebra][matrix][dim4][method]", FloatingTy
     CHECK(inv(3, 3) == Catch::Approx(0.0587855869541078).epsilon(ehp));
 }
 
+TEMPLATE_LIST_TEST_CASE("Inverse of a singular matrix", "[algebra][matrix][dim4][method]", InverseTypes)
+{
+    // clang-format off
+    const Matrix<TestType, 4, 4> singular = { 1.0, 2.0, 3.0, 4.0,
+                                              2.0, 4.0, 6.0, 8.0,
+                                              0.5, 1.5, 2.5, 3.5,
+                                              4.0, 3.0, 2.0, 1.0 };
+    // clang-format on
+
+    CHECK(singular.inversed().isNull());
+
+    auto mat = singular;
+    mat.inverse();
+
+    CHECK(mat == singular);
+}
+
+TEMPLATE_LIST_TEST_CASE("Inverse times matrix is identity", "[algebra][matrix][dim4][method]", InverseTypes)
+{
+    // clang-format off
+    const Matrix<TestType, 4, 4> mat = {  2.5, -1.0,  0.3,  7.1,
+                                          0.0,  3.2, -4.4,  1.9,
+                                         -6.3,  0.8,  1.0, -2.2,
+                                          1.7,  5.5, -0.9,  0.4 };
+    // clang-format on
+
+    const auto product = mat * mat.inversed();
+    const auto elp     = epsilonLowPrecision<TestType>();
+
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        for (unsigned int j = 0; j < 4; ++j)
+        {
+            CHECK(product(i, j) == Catch::Approx(i == j ? 1.0 : 0.0).margin(elp));
+        }
+    }
+}
+
+TEST_CASE("Inverse fast", "[algebra][matrix][dim4][method]")
+{
+    // clang-format off
+    Matrix<float, 4, 4> mat = {  4.0f, -5.1f, -9.9f,  5.5f,
+                                -8.3f,  4.2f, -1.1f, -9.8f,
+                                 6.4f,  3.2f,  7.0f,  7.5f,
+                                -9.1f,  7.2f,  8.7f,  5.5f };
+    // clang-format on
+
+    const auto inv = mat.inversedFast();
+    mat.inverseFast();
+
+    CHECK(mat == inv);
+
+    const auto elp = epsilonLowPrecision<float>();
+
+    CHECK(inv(0, 0) == Catch::Approx(0.0100878081896768).epsilon(elp));
+    CHECK(inv(1, 0) == Catch::Approx(0.122482185249092).epsilon(elp));
+    CHECK(inv(2, 0) == Catch::Approx(-0.127654870498875).epsilon(elp));
+    CHECK(inv(3, 0) == Catch::Approx(0.0582772171041462).epsilon(elp));
+
+    CHECK(inv(0, 1) == Catch::Approx(0.051103504718192).epsilon(elp));
+    CHECK(inv(1, 1) == Catch::Approx(0.231093156998207).epsilon(elp));
+    CHECK(inv(2, 1) == Catch::Approx(-0.116827415014496).epsilon(elp));
+    CHECK(inv(3, 1) == Catch::Approx(-0.0331691503318956).epsilon(elp));
+
+    CHECK(inv(0, 2) == Catch::Approx(0.112744890875666).epsilon(elp));
+    CHECK(inv(1, 2) == Catch::Approx(0.215886408031621).epsilon(elp));
+    CHECK(inv(2, 2) == Catch::Approx(-0.0633572445332106).epsilon(elp));
+    CHECK(inv(3, 2) == Catch::Approx(0.00414625392360348).epsilon(elp));
+
+    CHECK(inv(0, 3) == Catch::Approx(-0.0727736873404424).epsilon(elp));
+    CHECK(inv(1, 3) == Catch::Approx(-0.00510675282267879).epsilon(elp));
+    CHECK(inv(2, 3) == Catch::Approx(0.00588590083651362).epsilon(elp));
+    CHECK(inv(3, 3) == Catch::Approx(0.0587855869541078).epsilon(elp));
+}
+
 TEMPLATE_LIST_TEST_CASE("Is null?", "[algebra][matrix][dim4][method]", IntegerTypes)
 {
     // clang-format off
@@ -0,0 +1,360 @@
+#include "algebra/Matrix.hpp"
+
+#include "Helper.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+using LCNS::epsilonLowPrecision;
+using LCNS::Algebra::Matrix;
+using LCNS::Algebra::StorageOrder;
+using LCNS::Algebra::Vector;
+
+using FloatingTypes = std::tuple<float, double>;
+
+namespace
+{
+    /*
+     * Symmetric positive definite matrix B * B^T / n + I, B being random, written row by row in coefficients
+     */
+    template <typename T>
+    std::vector<T> random_spd(size_t n)
+    {
+        std::mt19937                           gen(static_cast<unsigned int>(n));
+        std::uniform_real_distribution<double> dis(-1, 1);
+
+        std::vector<double> b(n * n);
+        std::generate(b.begin(), b.end(), [&]() { return dis(gen); });
+
+        std::vector<T> result(n * n);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            for (size_t j = 0; j <= i; ++j)
+            {
+                double value = i == j ? 1.0 : 0.0;
+
+                for (size_t k = 0; k < n; ++k)
+                {
+                    value += b[i * n + k] * b[j * n + k] / static_cast<double>(n);
+                }
+
+                result[i * n + j] = static_cast<T>(value);
+                result[j * n + i] = static_cast<T>(value);
+            }
+        }
+
+        return result;
+    }
+
+    /*
+     * Largest coefficient of |lhs * rhs - expected|, the product being computed in double precision
+     */
+    template <typename T, unsigned int n, unsigned int m, StorageOrder order>
+    double max_residual(const Matrix<T, n, n, order>& lhs, const Matrix<T, n, m, order>& rhs, const Matrix<T, n, m, order>& expected)
+    {
+        double result = 0.0;
+
+        for (unsigned int i = 0; i < n; ++i)
+        {
+            for (unsigned int j = 0; j < m; ++j)
+            {
+                double value = 0.0;
+
+                for (unsigned int k = 0; k < n; ++k)
+                {
+                    value += static_cast<double>(lhs(i, k)) * static_cast<double>(rhs(k, j));
+                }
+
+                result = std::max(result, std::abs(value - static_cast<double>(expected(i, j))));
+            }
+        }
+
+        return result;
+    }
+
+    /*
+     * Decomposition, inverse and solves of a random n x n symmetric positive definite matrix
+     */
+    template <typename T, unsigned int n, StorageOrder order>
+    void check_cholesky(double tolerance)
+    {
+        constexpr unsigned int rhs_cols = 3;
+
+        const auto mat      = std::make_unique<Matrix<T, n, n, order>>();
+        const auto identity = std::make_unique<Matrix<T, n, n, order>>(T{1});
+        const auto rhs      = std::make_unique<Matrix<T, n, rhs_cols, order>>();
+
+        const auto coefficients = random_spd<T>(n);
+
+        for (unsigned int i = 0; i < n; ++i)
+        {
+            for (unsigned int j = 0; j < n; ++j)
+            {
+                (*mat)(i, j) = coefficients[(i * n) + j];
+            }
+
+            for (unsigned int j = 0; j < rhs_cols; ++j)
+            {
+                (*rhs)(i, j) = static_cast<T>(i + 1) / static_cast<T>(j + 1);
+            }
+        }
+
+        // L * L^T = A, L being lower triangular
+        const auto factor     = std::make_unique<Matrix<T, n, n, order>>(mat->choleskyFactor());
+        const auto transposed = std::make_unique<Matrix<T, n, n, order>>(factor->transposed());
+
+        for (unsigned int i = 0; i < n; ++i)
+        {
+            for (unsigned int j = i + 1; j < n; ++j)
+            {
+                CHECK((*factor)(i, j) == 0);
+            }
+        }
+
+        CHECK(max_residual(*factor, *transposed, *mat) < tolerance);
+
+        auto in_place = std::make_unique<Matrix<T, n, n, order>>(*mat);
+        in_place->decomposeCholesky();
+        CHECK(*in_place == *factor);
+
+        // Inverse, the same as the LU one up to rounding errors
+        const auto inverse = std::make_unique<Matrix<T, n, n, order>>(mat->inversedCholesky());
+        CHECK(max_residual(*mat, *inverse, *identity) < tolerance);
+
+        *in_place = *mat;
+        in_place->inverseCholesky();
+        CHECK(*in_place == *inverse);
+
+        const auto lu_inverse = std::make_unique<Matrix<T, n, n, order>>(mat->inversed());
+
+        for (unsigned int i = 0; i < n; ++i)
+        {
+            for (unsigned int j = 0; j < n; ++j)
+            {
+                CHECK((*inverse)(i, j) == (*inverse)(j, i));
+                CHECK((*inverse)(i, j) == Catch::Approx((*lu_inverse)(i, j)).margin(tolerance));
+            }
+        }
+
+        // Solves
+        const auto solution = std::make_unique<Matrix<T, n, rhs_cols, order>>(mat->solveCholesky(*rhs));
+        CHECK(max_residual(*mat, *solution, *rhs) < tolerance * n);
+
+        Vector<T, n> vec;
+        for (unsigned int i = 0; i < n; ++i)
+        {
+            vec[i] = (*rhs)(i, 1);
+        }
+
+        const auto vec_solution = mat->solveCholesky(vec);
+        for (unsigned int i = 0; i < n; ++i)
+        {
+            CHECK(vec_solution[i] == Catch::Approx((*solution)(i, 1)).margin(tolerance));
+        }
+    }
+}  // namespace
+
+TEMPLATE_LIST_TEST_CASE("Cholesky decomposition", "[algebra][matrix][cholesky]", FloatingTypes)
+{
+    constexpr double epsilon = std::numeric_limits<TestType>::epsilon();
+
+    SECTION("Known values")
+    {
+        // clang-format off
+        const Matrix<TestType, 3, 3> mat = {   4,  12, -16,
+                                              12,  37, -43,
+                                             -16, -43,  98 };
+
+        const Matrix<TestType, 3, 3> factor = {  2, 0, 0,
+                                                 6, 1, 0,
+                                                -8, 5, 3 };
+        // clang-format on
+
+        CHECK(mat.choleskyFactor() == factor);
+        CHECK(Matrix<TestType, 3, 3, StorageOrder::ColumnMajor>(mat).choleskyFactor() == Matrix<TestType, 3, 3, StorageOrder::ColumnMajor>(factor));
+
+        // Only the lower triangle is read
+        Matrix<TestType, 3, 3> lower = mat;
+        lower(0, 1)                  = 100;
+        lower(0, 2)                  = -100;
+        lower(1, 2)                  = 0;
+        CHECK(lower.decomposeCholesky() == factor);
+
+        const Vector<TestType, 3> solution = mat.solveCholesky(Vector<TestType, 3>(TestType{-16}, TestType{-43}, TestType{98}));
+        CHECK(solution.x() == Catch::Approx(0).margin(epsilonLowPrecision<TestType>()));
+        CHECK(solution.y() == Catch::Approx(0).margin(epsilonLowPrecision<TestType>()));
+        CHECK(solution.z() == Catch::Approx(1));
+    }
+
+    SECTION("Unrolled")
+    {
+        check_cholesky<TestType, 3, StorageOrder::RowMajor>(100 * epsilon);
+        check_cholesky<TestType, 6, StorageOrder::RowMajor>(100 * epsilon);
+        check_cholesky<TestType, 6, StorageOrder::ColumnMajor>(100 * epsilon);
+        check_cholesky<TestType, 9, StorageOrder::RowMajor>(100 * epsilon);
+        check_cholesky<TestType, 16, StorageOrder::ColumnMajor>(1000 * epsilon);
+    }
+
+    SECTION("Blocked")
+    {
+        check_cholesky<TestType, 24, StorageOrder::ColumnMajor>(1000 * epsilon);
+        check_cholesky<TestType, 150, StorageOrder::RowMajor>(10000 * epsilon);
+    }
+
+    SECTION("Not positive definite")
+    {
+        // Symmetric with the eigenvalues 3 and -1
+        Matrix<TestType, 6, 6> mat(TestType{1});
+        mat(1, 4) = 2;
+        mat(4, 1) = 2;
+
+        CHECK_THROWS_AS(mat.choleskyFactor(), std::runtime_error);
+        CHECK_THROWS_AS(mat.inversedCholesky(), std::runtime_error);
+        CHECK_THROWS_AS(mat.solveCholesky(Vector<TestType, 6>()), std::runtime_error);
+
+        auto null = std::make_unique<Matrix<TestType, 20, 20>>();
+        CHECK_THROWS_AS(null->decomposeCholesky(), std::runtime_error);
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Cholesky decomposition of large matrices", "[algebra][matrix][cholesky]", FloatingTypes)
+{
+    using LCNS::Algebra::cholesky_factorize;
+    using LCNS::Algebra::cholesky_inverse;
+    using LCNS::Algebra::cholesky_solve;
+
+    // Several blocks, the last one being incomplete
+    constexpr size_t n        = 301;
+    constexpr size_t rhs_cols = 37;
+
+    const double tolerance = 1e4 * std::numeric_limits<TestType>::epsilon();
+
+    std::mt19937                             gen(n);
+    std::uniform_real_distribution<TestType> dis(-1, 1);
+
+    const std::vector<TestType> mat = random_spd<TestType>(n);
+
+    std::vector<TestType> rhs(n * rhs_cols);
+    std::generate(rhs.begin(), rhs.end(), [&]() { return dis(gen); });
+
+    // Largest coefficient of |mat * x - expected|, in double precision
+    const auto max_residual = [&](const std::vector<TestType>& x, const std::vector<TestType>& expected, size_t cols)
+    {
+        double result = 0.0;
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            for (size_t j = 0; j < cols; ++j)
+            {
+                double value = 0.0;
+
+                for (size_t k = 0; k < n; ++k)
+                {
+                    value += static_cast<double>(mat[i * n + k]) * static_cast<double>(x[k * cols + j]);
+                }
+
+                result = std::max(result, std::abs(value - static_cast<double>(expected[i * cols + j])));
+            }
+        }
+
+        return result;
+    };
+
+    SECTION("Decomposition and solve")
+    {
+        // Garbage above the diagonal, which must not be read
+        std::vector<TestType> factor = mat;
+        for (size_t i = 0; i < n; ++i)
+        {
+            std::fill(factor.begin() + static_cast<std::ptrdiff_t>(i * n + i + 1), factor.begin() + static_cast<std::ptrdiff_t>((i + 1) * n), TestType{-7});
+        }
+
+        REQUIRE(cholesky_factorize<TestType>(factor));
+
+        double error = 0.0;
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            for (size_t j = 0; j <= i; ++j)
+            {
+                CHECK(factor[j * n + i] == factor[i * n + j]);
+
+                double value = 0.0;
+
+                for (size_t k = 0; k <= j; ++k)
+                {
+                    value += static_cast<double>(factor[i * n + k]) * static_cast<double>(factor[j * n + k]);
+                }
+
+                error = std::max(error, std::abs(value - static_cast<double>(mat[i * n + j])));
+            }
+        }
+
+        CHECK(error < tolerance);
+
+        std::vector<TestType> x = rhs;
+        cholesky_solve<TestType>(factor, x, rhs_cols);
+        CHECK(max_residual(x, rhs, rhs_cols) < tolerance);
+
+        // Single right hand side: the first column
+        std::vector<TestType> x0(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            x0[i] = rhs[i * rhs_cols];
+        }
+
+        cholesky_solve<TestType>(factor, x0);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            CHECK(x0[i] == Catch::Approx(x[i * rhs_cols]).margin(tolerance));
+        }
+
+        CHECK_THROWS_AS(cholesky_solve<TestType>(factor, x0, 2), std::invalid_argument);
+    }
+
+    SECTION("Inverse")
+    {
+        std::vector<TestType> inverse = mat;
+        REQUIRE(cholesky_inverse<TestType>(inverse));
+
+        std::vector<TestType> identity(n * n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            identity[i * n + i] = 1;
+        }
+
+        CHECK(max_residual(inverse, identity, n) < tolerance);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            for (size_t j = 0; j < i; ++j)
+            {
+                CHECK(inverse[i * n + j] == inverse[j * n + i]);
+            }
+        }
+    }
+
+    SECTION("Not positive definite")
+    {
+        std::vector<TestType> indefinite = mat;
+        indefinite[200 * n + 200]        = -1;
+
+        CHECK_FALSE(cholesky_factorize<TestType>(indefinite));
+
+        indefinite                = mat;
+        indefinite[100 * n + 100] = 0;
+        CHECK_FALSE(cholesky_inverse<TestType>(indefinite));
+
+        CHECK_THROWS_AS(cholesky_factorize<TestType>(std::span(indefinite).first(n * n - 1)), std::invalid_argument);
+    }
+}
@@ -0,0 +1,651 @@
+#include "algebra/EigenDecomposition.hpp"
+
+#include "Helper.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+using LCNS::epsilonHighPrecision;
+using LCNS::Algebra::eigenSymmetric;
+using LCNS::Algebra::Matrix;
+using LCNS::Algebra::StorageOrder;
+using LCNS::Algebra::Vector;
+using LCNS::Algebra::VectorArray;
+
+using FloatingTypes = std::tuple<float, double>;
+
+namespace
+{
+    /*
+     * Check that the eigenvalues are sorted, that the eigenvectors are orthonormal and that
+     * eigenvectors * diag(eigenvalues) * eigenvectors^T gives back the matrix, relatively to max|coefficient|
+     */
+    template <typename T, unsigned int size, StorageOrder order>
+    void check_decomposition(const Matrix<T, size, size, order>& matrix, const Vector<T, size>& eigenvalues, const Matrix<T, size, size, order>& eigenvectors)
+    {
+        const double tolerance = 50 * std::numeric_limits<T>::epsilon();
+
+        double scale = std::numeric_limits<double>::min();
+        double error = 0.0;
+
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            for (unsigned int j = 0; j < size; ++j)
+            {
+                scale = std::max(scale, std::abs(static_cast<double>(matrix(i, j))));
+            }
+        }
+
+        for (unsigned int i = 0; i + 1 < size; ++i)
+        {
+            CHECK(eigenvalues[i] <= eigenvalues[i + 1]);
+        }
+
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            for (unsigned int j = 0; j < size; ++j)
+            {
+                double product     = 0.0;
+                double dot_product = 0.0;
+
+                for (unsigned int k = 0; k < size; ++k)
+                {
+                    product += static_cast<double>(eigenvectors(i, k)) * static_cast<double>(eigenvalues[k]) * static_cast<double>(eigenvectors(j, k));
+                    dot_product += static_cast<double>(eigenvectors(k, i)) * static_cast<double>(eigenvectors(k, j));
+                }
+
+                error = std::max(error, std::abs(product - static_cast<double>(matrix(i, j))) / scale);
+                error = std::max(error, std::abs(dot_product - (i == j ? 1.0 : 0.0)));
+            }
+        }
+
+        CHECK(error < tolerance);
+    }
+
+    /*
+     * Random symmetric matrix R * diag(eigenvalues) * R^T, R being a random orthonormal basis
+     */
+    template <typename T, unsigned int size, StorageOrder order = StorageOrder::RowMajor>
+    Matrix<T, size, size, order> random_symmetric(std::mt19937& gen, const std::vector<double>& eigenvalues)
+    {
+        std::uniform_real_distribution<double> dis(-1.0, 1.0);
+
+        double basis[size][size];
+
+        for (unsigned int j = 0; j < size; ++j)
+        {
+            for (unsigned int i = 0; i < size; ++i)
+            {
+                basis[i][j] = dis(gen);
+            }
+
+            // Gram-Schmidt
+            for (unsigned int k = 0; k < j; ++k)
+            {
+                double dot_product = 0.0;
+
+                for (unsigned int i = 0; i < size; ++i)
+                {
+                    dot_product += basis[i][j] * basis[i][k];
+                }
+
+                for (unsigned int i = 0; i < size; ++i)
+                {
+                    basis[i][j] -= dot_product * basis[i][k];
+                }
+            }
+
+            double norm = 0.0;
+
+            for (unsigned int i = 0; i < size; ++i)
+            {
+                norm += basis[i][j] * basis[i][j];
+            }
+
+            for (unsigned int i = 0; i < size; ++i)
+            {
+                basis[i][j] /= std::sqrt(norm);
+            }
+        }
+
+        Matrix<T, size, size, order> result;
+
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            for (unsigned int j = i; j < size; ++j)
+            {
+                double value = 0.0;
+
+                for (unsigned int k = 0; k < size; ++k)
+                {
+                    value += basis[i][k] * eigenvalues[k] * basis[j][k];
+                }
+
+                result(i, j) = static_cast<T>(value);
+                result(j, i) = static_cast<T>(value);
+            }
+        }
+
+        return result;
+    }
+
+    /*
+     * Spectra of the random matrices: distinct, close, repeated, and of very different magnitudes
+     */
+    template <unsigned int size>
+    std::vector<double> random_spectrum(std::mt19937& gen, unsigned int kind)
+    {
+        std::uniform_real_distribution<double> dis(-10.0, 10.0);
+
+        std::vector<double> result(size);
+        std::generate(result.begin(), result.end(), [&]() { return dis(gen); });
+
+        switch (kind % 4)
+        {
+            case 1:
+                result[1] = result[0] * (1.0 + 1e-7);
+                break;
+            case 2:
+                std::fill(result.begin() + 1, result.end(), result[0]);
+                break;
+            case 3:
+                result[0] *= 1e-6;
+                break;
+            default:
+                break;
+        }
+
+        return result;
+    }
+
+    template <typename T, unsigned int size>
+    void check_random_matrices()
+    {
+        std::mt19937 gen(size);
+
+        for (unsigned int i = 0; i < 400; ++i)
+        {
+            const auto matrix = random_symmetric<T, size>(gen, random_spectrum<size>(gen, i));
+            const auto result = eigenSymmetric(matrix);
+
+            check_decomposition(matrix, result.eigenvalues, result.eigenvectors);
+        }
+
+        const auto matrix = random_symmetric<T, size, StorageOrder::ColumnMajor>(gen, random_spectrum<size>(gen, 0));
+        const auto result = eigenSymmetric(matrix);
+
+        check_decomposition(matrix, result.eigenvalues, result.eigenvectors);
+    }
+
+    template <typename T, unsigned int size>
+    void check_batch()
+    {
+        std::mt19937 gen(10 * size);
+
+        // Not a multiple of the SIMD widths, so that the last matrices are decomposed one at a time
+        constexpr size_t count = 1003;
+
+        std::vector<Matrix<T, size, size>> matrices(count);
+        std::vector<Matrix<T, size, size>> eigenvectors(count);
+        VectorArray<T, size>               eigenvalues(count);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            matrices[i] = random_symmetric<T, size>(gen, random_spectrum<size>(gen, static_cast<unsigned int>(i)));
+        }
+
+        eigenSymmetric<T, size>(matrices, eigenvalues, eigenvectors);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            check_decomposition(matrices[i], eigenvalues[i], eigenvectors[i]);
+
+            const auto single = eigenSymmetric(matrices[i]);
+
+            for (unsigned int k = 0; k < size; ++k)
+            {
+                CHECK(eigenvalues[i][k] == Catch::Approx(single.eigenvalues[k]).margin(100 * std::numeric_limits<T>::epsilon()));
+            }
+        }
+
+        VectorArray<T, size> wrong_count(count - 1);
+        const auto decompose = [&matrices](VectorArray<T, size>& values, std::span<Matrix<T, size, size>> vectors)
+        { eigenSymmetric<T, size>(matrices, values, vectors); };
+
+        CHECK_THROWS_AS(decompose(wrong_count, eigenvectors), std::invalid_argument);
+        CHECK_THROWS_AS(decompose(eigenvalues, std::span(eigenvectors).first(count - 1)), std::invalid_argument);
+    }
+
+    /*
+     * n x n symmetric matrix H * diag(eigenvalues) * H^T stored row by row, H being the product of a few random reflectors
+     */
+    std::vector<double> random_large_symmetric(const std::vector<double>& eigenvalues, unsigned int seed)
+    {
+        const size_t n = eigenvalues.size();
+
+        std::mt19937                           gen(seed);
+        std::uniform_real_distribution<double> dis(-1.0, 1.0);
+
+        std::vector<double> result(n * n);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            result[i * n + i] = eigenvalues[i];
+        }
+
+        for (unsigned int reflector = 0; reflector < 3; ++reflector)
+        {
+            std::vector<double> u(n);
+            std::generate(u.begin(), u.end(), [&]() { return dis(gen); });
+
+            double norm = 0.0;
+
+            for (const double value : u)
+            {
+                norm += value * value;
+            }
+
+            // A = (I - 2 * u * u^T) * A * (I - 2 * u * u^T), A being symmetric
+            std::vector<double> product(n);
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                u[i] /= std::sqrt(norm);
+            }
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                for (size_t j = 0; j < n; ++j)
+                {
+                    product[i] += result[i * n + j] * u[j];
+                }
+            }
+
+            double quadratic = 0.0;
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                quadratic += u[i] * product[i];
+            }
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                for (size_t j = 0; j < n; ++j)
+                {
+                    result[i * n + j] += 4 * quadratic * u[i] * u[j] - 2 * (u[i] * product[j] + product[i] * u[j]);
+                }
+            }
+        }
+
+        return result;
+    }
+
+    /*
+     * Largest |A * v - lambda * v| relative to |A| and largest |V^T * V - I| coefficient, for the eigenpairs in the
+     * columns of eigenvectors (n rows of count coefficients)
+     */
+    template <typename T>
+    double eigenpairs_error(const std::vector<double>& matrix, const std::vector<T>& eigenvalues, const std::vector<T>& eigenvectors)
+    {
+        const size_t count = eigenvalues.size();
+        const size_t n     = eigenvectors.size() / count;
+
+        double norm  = 0.0;
+        double error = 0.0;
+
+        for (const T value : eigenvalues)
+        {
+            norm = std::max(norm, std::abs(static_cast<double>(value)));
+        }
+
+        for (size_t k = 0; k < count; ++k)
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                double residual = -static_cast<double>(eigenvalues[k]) * static_cast<double>(eigenvectors[i * count + k]);
+
+                for (size_t j = 0; j < n; ++j)
+                {
+                    residual += matrix[i * n + j] * static_cast<double>(eigenvectors[j * count + k]);
+                }
+
+                error = std::max(error, std::abs(residual) / norm);
+            }
+
+            for (size_t l = 0; l <= k; ++l)
+            {
+                double dot_product = 0.0;
+
+                for (size_t i = 0; i < n; ++i)
+                {
+                    dot_product += static_cast<double>(eigenvectors[i * count + k]) * static_cast<double>(eigenvectors[i * count + l]);
+                }
+
+                error = std::max(error, std::abs(dot_product - (k == l ? 1.0 : 0.0)));
+            }
+        }
+
+        return error;
+    }
+}  // namespace
+
+TEMPLATE_LIST_TEST_CASE("Symmetric eigen decomposition of small matrices", "[algebra][matrix][eigen]", FloatingTypes)
+{
+    SECTION("2x2")
+    {
+        Matrix<TestType, 2, 2> matrix;
+        matrix(0, 0) = 2;
+        matrix(0, 1) = 1;
+        matrix(1, 0) = 1;
+        matrix(1, 1) = 2;
+
+        const auto result = eigenSymmetric(matrix);
+
+        CHECK(result.eigenvalues[0] == Catch::Approx(1));
+        CHECK(result.eigenvalues[1] == Catch::Approx(3));
+        CHECK(std::abs(result.eigenvectors(0, 0)) == Catch::Approx(std::sqrt(TestType{0.5})));
+        CHECK(result.eigenvectors(1, 0) == Catch::Approx(-result.eigenvectors(0, 0)));
+        CHECK(result.eigenvectors(1, 1) == Catch::Approx(result.eigenvectors(0, 1)));
+
+        check_decomposition(matrix, result.eigenvalues, result.eigenvectors);
+    }
+
+    SECTION("Diagonal")
+    {
+        Matrix<TestType, 3, 3> matrix;
+        matrix(0, 0) = 3;
+        matrix(1, 1) = -1;
+        matrix(2, 2) = 2;
+
+        const auto result = eigenSymmetric(matrix);
+
+        CHECK(result.eigenvalues[0] == -1);
+        CHECK(result.eigenvalues[1] == 2);
+        CHECK(result.eigenvalues[2] == 3);
+        CHECK(std::abs(result.eigenvectors(1, 0)) == 1);
+        CHECK(std::abs(result.eigenvectors(2, 1)) == 1);
+        CHECK(std::abs(result.eigenvectors(0, 2)) == 1);
+    }
+
+    SECTION("Inertia tensor")
+    {
+        // Solid cuboid of mass 12 and sides 1, 2 and 3 along the axes rotated by 30 degrees around z
+        const TestType angle = std::acos(TestType{-1}) / 6;
+        const TestType c     = std::cos(angle);
+        const TestType s     = std::sin(angle);
+
+        const TestType principal[3] = { 2 * 2 + 3 * 3, 1 * 1 + 3 * 3, 1 * 1 + 2 * 2 };
+
+        Matrix<TestType, 3, 3> matrix;
+        matrix(0, 0) = c * c * principal[0] + s * s * principal[1];
+        matrix(0, 1) = c * s * (principal[0] - principal[1]);
+        matrix(1, 0) = matrix(0, 1);
+        matrix(1, 1) = s * s * principal[0] + c * c * principal[1];
+        matrix(2, 2) = principal[2];
+
+        const auto result = eigenSymmetric(matrix);
+
+        CHECK(result.eigenvalues[0] == Catch::Approx(5));
+        CHECK(result.eigenvalues[1] == Catch::Approx(10));
+        CHECK(result.eigenvalues[2] == Catch::Approx(13));
+        CHECK(std::abs(result.eigenvectors(0, 2)) == Catch::Approx(c));
+        CHECK(std::abs(result.eigenvectors(1, 2)) == Catch::Approx(s));
+        CHECK(std::abs(result.eigenvectors(2, 0)) == Catch::Approx(1));
+
+        check_decomposition(matrix, result.eigenvalues, result.eigenvectors);
+    }
+
+    SECTION("Repeated eigenvalues")
+    {
+        Matrix<TestType, 4, 4> null_matrix;
+
+        const auto null_result = eigenSymmetric(null_matrix);
+        for (unsigned int i = 0; i < 4; ++i)
+        {
+            CHECK(null_result.eigenvalues[i] == 0);
+        }
+        check_decomposition(null_matrix, null_result.eigenvalues, null_result.eigenvectors);
+
+        // All ones: eigenvalues 0, 0 and 3
+        Matrix<TestType, 3, 3> ones;
+        for (unsigned int i = 0; i < 9; ++i)
+        {
+            ones(i / 3, i % 3) = 1;
+        }
+
+        const auto result = eigenSymmetric(ones);
+        CHECK(result.eigenvalues[0] == Catch::Approx(0).margin(epsilonHighPrecision<TestType>()));
+        CHECK(result.eigenvalues[1] == Catch::Approx(0).margin(epsilonHighPrecision<TestType>()));
+        CHECK(result.eigenvalues[2] == Catch::Approx(3));
+        check_decomposition(ones, result.eigenvalues, result.eigenvectors);
+    }
+
+    SECTION("Large and small coefficients")
+    {
+        Matrix<TestType, 3, 3> matrix;
+        matrix(0, 0) = std::numeric_limits<TestType>::max() / 4;
+        matrix(0, 1) = std::numeric_limits<TestType>::max() / 8;
+        matrix(1, 0) = matrix(0, 1);
+        matrix(2, 2) = std::numeric_limits<TestType>::max() / 16;
+
+        const auto large = eigenSymmetric(matrix);
+        CHECK(std::isfinite(large.eigenvalues[0]));
+        CHECK(large.eigenvalues[2] / matrix(0, 0) == Catch::Approx((1 + std::sqrt(TestType{2})) / 2));
+
+        Matrix<TestType, 2, 2> tiny;
+        tiny(0, 0) = std::numeric_limits<TestType>::min();
+        tiny(0, 1) = std::numeric_limits<TestType>::min();
+        tiny(1, 0) = tiny(0, 1);
+        tiny(1, 1) = std::numeric_limits<TestType>::min();
+
+        const auto small = eigenSymmetric(tiny);
+        CHECK(small.eigenvalues[0] == Catch::Approx(0).margin(std::numeric_limits<TestType>::min() / 4));
+        CHECK(small.eigenvalues[1] / std::numeric_limits<TestType>::min() == Catch::Approx(2));
+    }
+
+    SECTION("Random matrices")
+    {
+        check_random_matrices<TestType, 2>();
+        check_random_matrices<TestType, 3>();
+        check_random_matrices<TestType, 4>();
+    }
+
+    SECTION("Batch")
+    {
+        check_batch<TestType, 2>();
+        check_batch<TestType, 3>();
+        check_batch<TestType, 4>();
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Symmetric eigen decomposition of large matrices", "[algebra][matrix][eigen]", FloatingTypes)
+{
+    using LCNS::Algebra::eigen_symmetric;
+    using LCNS::Algebra::eigen_symmetric_lanczos;
+    using LCNS::Algebra::eigenvalues_symmetric;
+    using LCNS::Algebra::Spectrum;
+
+    const double tolerance = 100 * std::numeric_limits<TestType>::epsilon();
+
+    SECTION("Known spectrum")
+    {
+        // Several panels of the tridiagonalization and levels of divide and conquer. A third of the eigenvalues are
+        // repeated, and two are close, to be deflated.
+        constexpr size_t n = 300;
+
+        std::mt19937                           gen(n);
+        std::uniform_real_distribution<double> dis(-10.0, 10.0);
+
+        std::vector<double> spectrum(n);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            spectrum[i] = i % 3 == 0 ? 1.0 : dis(gen);
+        }
+
+        spectrum[1] = spectrum[2] * (1.0 + 1e-9);
+
+        const auto a = random_large_symmetric(spectrum, 1);
+
+        std::vector<TestType> matrix(a.begin(), a.end());
+        std::vector<TestType> eigenvalues(n);
+
+        REQUIRE(eigen_symmetric<TestType>(matrix, eigenvalues));
+
+        std::sort(spectrum.begin(), spectrum.end());
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            CHECK(eigenvalues[i] == Catch::Approx(spectrum[i]).margin(tolerance * 10.0));
+        }
+
+        CHECK(eigenpairs_error(a, eigenvalues, matrix) < tolerance);
+
+        // The eigenvalues alone, from the same tridiagonal matrix
+        std::vector<TestType> values_only(n);
+        matrix.assign(a.begin(), a.end());
+
+        REQUIRE(eigenvalues_symmetric<TestType>(matrix, values_only));
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            CHECK(values_only[i] == Catch::Approx(eigenvalues[i]).margin(tolerance * 10.0));
+        }
+    }
+
+    SECTION("Tridiagonal matrix")
+    {
+        // Discrete Laplacian, already tridiagonal, whose eigenvalues are 2 - 2 * cos(k * pi / (n + 1))
+        constexpr size_t n = 200;
+
+        std::vector<double> a(n * n);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            a[i * n + i] = 2.0;
+
+            if (i > 0)
+            {
+                a[i * n + i - 1] = -1.0;
+                a[(i - 1) * n + i] = -1.0;
+            }
+        }
+
+        std::vector<TestType> matrix(a.begin(), a.end());
+        std::vector<TestType> eigenvalues(n);
+
+        REQUIRE(eigen_symmetric<TestType>(matrix, eigenvalues));
+
+        for (size_t k = 0; k < n; ++k)
+        {
+            const double expected = 2.0 - 2.0 * std::cos(static_cast<double>(k + 1) * std::acos(-1.0) / static_cast<double>(n + 1));
+
+            CHECK(eigenvalues[k] == Catch::Approx(expected).margin(tolerance));
+        }
+
+        CHECK(eigenpairs_error(a, eigenvalues, matrix) < tolerance);
+    }
+
+    SECTION("Lanczos")
+    {
+        // A few eigenvalues at both ends separated from the bulk of the spectrum, as for similarity matrices
+        constexpr size_t n     = 500;
+        constexpr size_t count = 4;
+
+        std::mt19937                           gen(n);
+        std::uniform_real_distribution<double> dis(-1.0, 1.0);
+
+        std::vector<double> spectrum(n);
+        std::generate(spectrum.begin(), spectrum.end(), [&]() { return dis(gen); });
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            spectrum[i]         = 2.0 + static_cast<double>(i);
+            spectrum[count + i] = -1.5 - 0.5 * static_cast<double>(i);
+        }
+
+        const auto                  a = random_large_symmetric(spectrum, 2);
+        const std::vector<TestType> matrix(a.begin(), a.end());
+
+        std::sort(spectrum.begin(), spectrum.end());
+
+        std::vector<TestType> eigenvalues(count);
+        std::vector<TestType> eigenvectors(n * count);
+
+        REQUIRE(eigen_symmetric_lanczos<TestType>(matrix, eigenvalues, eigenvectors));
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            CHECK(eigenvalues[i] == Catch::Approx(spectrum[n - count + i]).margin(tolerance * 10.0));
+        }
+
+        CHECK(eigenpairs_error(a, eigenvalues, eigenvectors) < tolerance);
+
+        REQUIRE(eigen_symmetric_lanczos<TestType>(matrix, eigenvalues, eigenvectors, Spectrum::Smallest));
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            CHECK(eigenvalues[i] == Catch::Approx(spectrum[i]).margin(tolerance * 10.0));
+        }
+
+        CHECK(eigenpairs_error(a, eigenvalues, eigenvectors) < tolerance);
+
+        // All the eigenpairs of a small matrix, the Lanczos basis spanning the whole space
+        constexpr size_t small = 6;
+
+        std::vector<double>   b(small * small);
+        std::vector<TestType> small_matrix(small * small);
+
+        for (size_t i = 0; i < small; ++i)
+        {
+            for (size_t j = 0; j <= i; ++j)
+            {
+                b[i * small + j] = b[j * small + i] = dis(gen);
+            }
+        }
+
+        std::copy(b.begin(), b.end(), small_matrix.begin());
+
+        std::vector<TestType> all_values(small);
+        std::vector<TestType> all_vectors(small * small);
+
+        REQUIRE(eigen_symmetric_lanczos<TestType>(small_matrix, all_values, all_vectors));
+        CHECK(eigenpairs_error(b, all_values, all_vectors) < tolerance);
+
+        const auto lanczos = [](std::span<const TestType> a, std::span<TestType> values, std::span<TestType> vectors)
+        {
+            return eigen_symmetric_lanczos<TestType>(a, values, vectors);
+        };
+
+        CHECK_THROWS_AS(lanczos(matrix, std::span(eigenvalues).first(0), std::span(eigenvectors).first(0)), std::invalid_argument);
+        CHECK_THROWS_AS(lanczos(small_matrix, eigenvalues, std::span(eigenvectors).first(3 * count)), std::invalid_argument);
+        CHECK_THROWS_AS(lanczos(matrix, eigenvalues, std::span(eigenvectors).first((n - 1) * count)), std::invalid_argument);
+
+        std::vector<TestType> too_many_values(small + 1);
+        std::vector<TestType> too_many_vectors(small * (small + 1));
+
+        CHECK_THROWS_AS(lanczos(small_matrix, too_many_values, too_many_vectors), std::invalid_argument);
+    }
+
+    SECTION("Invalid matrices")
+    {
+        std::vector<TestType> matrix(16, TestType{1});
+        std::vector<TestType> eigenvalues(4);
+
+        matrix[9] = std::numeric_limits<TestType>::quiet_NaN();
+        CHECK_FALSE(eigen_symmetric<TestType>(matrix, eigenvalues));
+
+        matrix[9] = std::numeric_limits<TestType>::infinity();
+        CHECK_FALSE(eigenvalues_symmetric<TestType>(matrix, eigenvalues));
+
+        CHECK_THROWS_AS(eigen_symmetric<TestType>(std::span(matrix).first(15), eigenvalues), std::invalid_argument);
+        CHECK_THROWS_AS(eigenvalues_symmetric<TestType>(matrix, std::span(eigenvalues).first(3)), std::invalid_argument);
+    }
+}
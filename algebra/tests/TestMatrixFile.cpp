@@ -0,0 +1,208 @@
+#include "algebra/MatrixFile.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+using LCNS::Algebra::MappedMatrix;
+using LCNS::Algebra::Matrix;
+using LCNS::Algebra::MatrixFileWriter;
+using LCNS::Algebra::MatrixView;
+using LCNS::Algebra::StorageOrder;
+using LCNS::Algebra::write_matrix_file;
+
+using FileTypes = std::tuple<float, double, int, uint16_t>;
+
+namespace
+{
+    /*
+     * Path of a file in the temporary directory, removed when destroyed
+     */
+    class TemporaryFile
+    {
+    public:
+        explicit TemporaryFile(const std::string& name)
+        : _path(std::filesystem::temp_directory_path() / name)
+        {
+        }
+
+        ~TemporaryFile()
+        {
+            std::error_code error;
+            std::filesystem::remove(_path, error);
+        }
+
+        TemporaryFile(const TemporaryFile&)            = delete;
+        TemporaryFile& operator=(const TemporaryFile&) = delete;
+
+        const std::filesystem::path& path() const { return _path; }
+
+    private:
+        std::filesystem::path _path;
+    };
+
+    void overwrite_byte(const std::filesystem::path& path, std::streamoff offset)
+    {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(offset);
+        file.put('\x7F');
+    }
+}  // namespace
+
+TEMPLATE_LIST_TEST_CASE("Matrix files", "[algebra][matrix][file]", FileTypes)
+{
+    const TemporaryFile file("lcns_algebra_matrix_" + std::to_string(sizeof(TestType)) + std::to_string(std::is_integral_v<TestType>) + ".bin");
+
+    auto matrix = std::make_unique<Matrix<TestType, 37, 53>>();
+
+    for (unsigned int i = 0; i < 37; ++i)
+    {
+        for (unsigned int j = 0; j < 53; ++j)
+        {
+            (*matrix)(i, j) = static_cast<TestType>(i * 53 + j);
+        }
+    }
+
+    SECTION("Round trip")
+    {
+        write_matrix_file<TestType>(file.path(), MatrixView(*matrix));
+
+        const MappedMatrix<TestType>     mapped(file.path(), true);
+        const MatrixView<const TestType> view = mapped.view();
+
+        REQUIRE(view.rows() == 37);
+        REQUIRE(view.cols() == 53);
+        CHECK(view.rowStride() == 53);
+        CHECK(view.colStride() == 1);
+        CHECK(reinterpret_cast<std::uintptr_t>(view.data()) % 64 == 0);
+        CHECK(mapped.verifyChecksum());
+
+        for (size_t i = 0; i < 37; ++i)
+        {
+            for (size_t j = 0; j < 53; ++j)
+            {
+                REQUIRE(view(i, j) == (*matrix)(i, j));
+            }
+        }
+
+        // Moved mappings keep their coefficients
+        MappedMatrix<TestType> first(file.path());
+        MappedMatrix<TestType> moved(std::move(first));
+        CHECK(moved.view()(36, 52) == (*matrix)(36, 52));
+
+        first = std::move(moved);
+        CHECK(first.view()(36, 52) == (*matrix)(36, 52));
+    }
+
+    SECTION("Streaming by columns, in uneven chunks")
+    {
+        std::vector<TestType> columns;
+
+        for (size_t j = 0; j < 53; ++j)
+        {
+            for (size_t i = 0; i < 37; ++i)
+            {
+                columns.push_back((*matrix)(i, j));
+            }
+        }
+
+        MatrixFileWriter<TestType> writer(file.path(), 37, 53, StorageOrder::ColumnMajor, 4096);
+
+        const std::span<const TestType> coefficients(columns);
+
+        for (size_t begin = 0, chunk = 1; begin < coefficients.size(); begin += chunk, chunk = chunk * 3 + 1)
+        {
+            writer.write(coefficients.subspan(begin, std::min(chunk, coefficients.size() - begin)));
+        }
+
+        // Not a valid file until closed
+        CHECK_THROWS_AS(MappedMatrix<TestType>(file.path()), std::runtime_error);
+
+        writer.close();
+
+        const MappedMatrix<TestType> mapped(file.path(), true);
+        const MatrixView             view = mapped.view();
+
+        CHECK(view.rowStride() == 1);
+        CHECK(view.colStride() == 37);
+        CHECK(reinterpret_cast<std::uintptr_t>(view.data()) % 4096 == 0);
+
+        for (size_t i = 0; i < 37; ++i)
+        {
+            for (size_t j = 0; j < 53; ++j)
+            {
+                REQUIRE(view(i, j) == (*matrix)(i, j));
+            }
+        }
+    }
+
+    SECTION("Blocks and empty matrices")
+    {
+        write_matrix_file<TestType>(file.path(), MatrixView(*matrix).block(3, 5, 10, 20).transposed());
+
+        const MappedMatrix<TestType> mapped(file.path(), true);
+        REQUIRE(mapped.view().rows() == 20);
+        REQUIRE(mapped.view().cols() == 10);
+        CHECK(mapped.view()(7, 2) == (*matrix)(5, 12));
+
+        write_matrix_file<TestType>(file.path(), MatrixView(*matrix).block(0, 0, 0, 53));
+        CHECK(MappedMatrix<TestType>(file.path(), true).view().rows() == 0);
+    }
+
+    SECTION("Invalid files")
+    {
+        write_matrix_file<TestType>(file.path(), MatrixView(*matrix));
+
+        // Coefficients of another type
+        if constexpr (std::is_same_v<TestType, float>)
+        {
+            CHECK_THROWS_AS(MappedMatrix<int>(file.path()), std::runtime_error);
+        }
+        else
+        {
+            CHECK_THROWS_AS(MappedMatrix<float>(file.path()), std::runtime_error);
+        }
+
+        // Corrupted coefficient, only detected when verified
+        overwrite_byte(file.path(), 64 + 100 * sizeof(TestType) + 1);
+        CHECK_NOTHROW(MappedMatrix<TestType>(file.path()));
+        CHECK_FALSE(MappedMatrix<TestType>(file.path()).verifyChecksum());
+        CHECK_THROWS_AS(MappedMatrix<TestType>(file.path(), true), std::runtime_error);
+
+        // Truncated file
+        std::filesystem::resize_file(file.path(), 64 + 37 * 53 * sizeof(TestType) - 1);
+        CHECK_THROWS_AS(MappedMatrix<TestType>(file.path()), std::runtime_error);
+
+        std::filesystem::resize_file(file.path(), 10);
+        CHECK_THROWS_AS(MappedMatrix<TestType>(file.path()), std::runtime_error);
+
+        // Corrupted header
+        write_matrix_file<TestType>(file.path(), MatrixView(*matrix));
+        overwrite_byte(file.path(), 12);
+        CHECK_THROWS_AS(MappedMatrix<TestType>(file.path()), std::runtime_error);
+
+        CHECK_THROWS_AS(MappedMatrix<TestType>(file.path().string() + ".missing"), std::runtime_error);
+    }
+
+    SECTION("Wrong number of coefficients")
+    {
+        const std::vector<TestType> coefficients(37 * 53);
+
+        MatrixFileWriter<TestType> writer(file.path(), 37, 53);
+        writer.write(std::span(coefficients).first(100));
+
+        CHECK_THROWS_AS(writer.write(coefficients), std::invalid_argument);
+        CHECK_THROWS_AS(writer.close(), std::runtime_error);
+
+        CHECK_THROWS_AS(MatrixFileWriter<TestType>(file.path(), 1, 1, StorageOrder::RowMajor, 48), std::invalid_argument);
+        CHECK_THROWS_AS(MatrixFileWriter<TestType>(file.path(), 1, 1, StorageOrder::RowMajor, 1), std::invalid_argument);
+    }
+}
@@ -0,0 +1,210 @@
+#include "algebra/MatrixFunctions.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <random>
+
+using LCNS::Algebra::expm;
+using LCNS::Algebra::Matrix;
+using LCNS::Algebra::pow;
+using LCNS::Algebra::StorageOrder;
+
+using FloatingTypes = std::tuple<float, double>;
+
+namespace
+{
+    template <typename T, unsigned int size, StorageOrder order = StorageOrder::RowMajor>
+    std::unique_ptr<Matrix<T, size, size, order>> random_matrix(double norm, unsigned int seed = 1)
+    {
+        std::mt19937                     generator(seed);
+        std::uniform_real_distribution<> distribution(-1, 1);
+
+        auto matrix = std::make_unique<Matrix<T, size, size, order>>();
+
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            for (unsigned int j = 0; j < size; ++j)
+            {
+                (*matrix)(i, j) = static_cast<T>(distribution(generator) * norm / size);
+            }
+        }
+
+        return matrix;
+    }
+
+    template <typename T, unsigned int size, StorageOrder order>
+    double largest_coefficient(const Matrix<T, size, size, order>& matrix)
+    {
+        double largest = 0;
+
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            for (unsigned int j = 0; j < size; ++j)
+            {
+                largest = std::max(largest, std::abs(static_cast<double>(matrix(i, j))));
+            }
+        }
+
+        return largest;
+    }
+
+    /*
+     * Largest coefficient of |lhs - rhs| relative to the largest coefficient of rhs
+     */
+    template <typename T, unsigned int size, StorageOrder order>
+    double relative_difference(const Matrix<T, size, size, order>& lhs, const Matrix<T, size, size, order>& rhs)
+    {
+        double difference = 0;
+
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            for (unsigned int j = 0; j < size; ++j)
+            {
+                difference = std::max(difference, std::abs(static_cast<double>(lhs(i, j)) - static_cast<double>(rhs(i, j))));
+            }
+        }
+
+        return difference / largest_coefficient(rhs);
+    }
+
+    /*
+     * exp(M) * exp(-M) = I, up to the rounding errors of the product, exp(2 * M) = exp(M)^2 and
+     * exp(M) = exp(M / 2^k)^(2^k), whatever the degree of the Pade approximant and the number of squarings chosen for
+     * each norm
+     */
+    template <typename T, unsigned int size, StorageOrder order>
+    void check_exponential(const Matrix<T, size, size, order>& matrix, double tolerance)
+    {
+        const auto exponential = std::make_unique<Matrix<T, size, size, order>>(expm(matrix));
+        const auto inverse     = std::make_unique<Matrix<T, size, size, order>>(expm(matrix * T{-1}));
+        const auto identity    = std::make_unique<Matrix<T, size, size, order>>(T{1});
+
+        const double magnitude = largest_coefficient(*exponential) * largest_coefficient(*inverse);
+
+        CHECK(relative_difference(*exponential * *inverse, *identity) < magnitude * tolerance);
+        CHECK(relative_difference(expm(matrix * T{2}), *exponential * *exponential) < tolerance);
+        CHECK(relative_difference(pow<8>(expm(matrix * T{0.125})), *exponential) < tolerance);
+    }
+}  // namespace
+
+TEST_CASE("Matrix power", "[algebra][matrix][functions]")
+{
+    SECTION("Fibonacci numbers")
+    {
+        const Matrix<int, 2, 2> fibonacci = { 1, 1, 1, 0 };
+
+        int previous = 0;
+        int current  = 1;
+
+        CHECK(pow(fibonacci, 0) == Matrix<int, 2, 2>(1));
+
+        for (unsigned int k = 1; k < 40; ++k)
+        {
+            const Matrix<int, 2, 2> power = pow(fibonacci, k);
+            CHECK(power == Matrix<int, 2, 2>{ current + previous, current, current, previous });
+
+            const int next = current + previous;
+            previous       = current;
+            current        = next;
+        }
+
+        CHECK(pow<0>(fibonacci) == Matrix<int, 2, 2>(1));
+        CHECK(pow<1>(fibonacci) == fibonacci);
+        CHECK(pow<30>(fibonacci) == pow(fibonacci, 30));
+        CHECK(pow<30>(fibonacci)(0, 1) == 832040);
+    }
+
+    SECTION("Repeated products")
+    {
+        const auto row_major    = random_matrix<double, 6>(2);
+        const auto column_major = Matrix<double, 6, 6, StorageOrder::ColumnMajor>(*row_major);
+
+        Matrix<double, 6, 6> product(1.0);
+
+        for (unsigned int k = 0; k < 25; ++k)
+        {
+            CHECK(relative_difference(pow(*row_major, k), product) < 1e-13);
+            CHECK(relative_difference(Matrix<double, 6, 6>(pow(column_major, k)), product) < 1e-13);
+
+            product = product * *row_major;
+        }
+
+        CHECK(relative_difference(pow<13>(*row_major), pow(*row_major, 13)) < 1e-14);
+        CHECK(relative_difference(Matrix<double, 6, 6>(pow<24>(column_major)), pow(*row_major, 24)) < 1e-14);
+    }
+
+    SECTION("Blocked products")
+    {
+        const auto matrix = random_matrix<double, 64>(1.5);
+
+        auto product = std::make_unique<Matrix<double, 64, 64>>(*matrix);
+
+        for (unsigned int k = 1; k < 11; ++k)
+        {
+            *product = *product * *matrix;
+        }
+
+        CHECK(relative_difference(pow(*matrix, 11), *product) < 1e-13);
+        CHECK(relative_difference(pow<11>(*matrix), *product) < 1e-13);
+
+        const auto column_major = std::make_unique<Matrix<double, 64, 64, StorageOrder::ColumnMajor>>(*matrix);
+        CHECK(relative_difference(Matrix<double, 64, 64>(pow(*column_major, 11)), *product) < 1e-13);
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Matrix exponential", "[algebra][matrix][functions]", FloatingTypes)
+{
+    const double tolerance = 100 * std::numeric_limits<TestType>::epsilon();
+
+    SECTION("Known values")
+    {
+        // Diagonal
+        const Matrix<TestType, 3, 3> diagonal = { 1, 0, 0, 0, -2, 0, 0, 0, TestType{0.5} };
+        const Matrix<TestType, 3, 3> expected = { std::exp(TestType{1}), 0, 0, 0, std::exp(TestType{-2}), 0, 0, 0, std::exp(TestType{0.5}) };
+        CHECK(relative_difference(expm(diagonal), expected) < tolerance);
+
+        // Nilpotent, the series stops at M^2 / 2
+        const Matrix<TestType, 3, 3> nilpotent  = { 0, 1, 2, 0, 0, 3, 0, 0, 0 };
+        const Matrix<TestType, 3, 3> polynomial = { 1, 1, TestType{3.5}, 0, 1, 3, 0, 0, 1 };
+        CHECK(relative_difference(expm(nilpotent), polynomial) < tolerance);
+
+        // Generators of the rotations, over several turns so that the matrix is scaled
+        for (const TestType angle : { TestType{0.001}, TestType{0.3}, TestType{1}, TestType{2.5}, TestType{40} })
+        {
+            const Matrix<TestType, 2, 2> generator = { 0, -angle, angle, 0 };
+            const Matrix<TestType, 2, 2> rotation  = { std::cos(angle), -std::sin(angle), std::sin(angle), std::cos(angle) };
+
+            CHECK(relative_difference(expm(generator), rotation) < std::max(TestType{1}, angle) * tolerance);
+        }
+
+        CHECK(expm(Matrix<TestType, 4, 4>()) == Matrix<TestType, 4, 4>(TestType{1}));
+    }
+
+    SECTION("Pade degrees and scaling")
+    {
+        // The norms select each degree, then an increasing number of squarings
+        for (const double norm : { 0.01, 0.2, 0.9, 2.0, 5.0, 20.0 })
+        {
+            check_exponential(*random_matrix<TestType, 5>(norm), std::max(1.0, norm) * tolerance);
+            check_exponential(*random_matrix<TestType, 7, StorageOrder::ColumnMajor>(norm, 2), std::max(1.0, norm) * tolerance);
+        }
+
+        check_exponential(*random_matrix<TestType, 40>(3.0), 10 * tolerance);
+    }
+
+    SECTION("Non finite coefficients")
+    {
+        Matrix<TestType, 3, 3> matrix;
+        matrix(1, 2) = std::numeric_limits<TestType>::quiet_NaN();
+        CHECK_THROWS_AS(expm(matrix), std::runtime_error);
+
+        matrix(1, 2) = std::numeric_limits<TestType>::infinity();
+        CHECK_THROWS_AS(expm(matrix), std::runtime_error);
+    }
+}
@@ -0,0 +1,343 @@
+#include "algebra/Matrix.hpp"
+
+#include "Helper.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <random>
+
+using LCNS::epsilonLowPrecision;
+using LCNS::Algebra::Matrix;
+using LCNS::Algebra::StorageOrder;
+using LCNS::Algebra::Vector;
+
+using IntegerTypes  = std::tuple<short, int, long>;
+using FloatingTypes = std::tuple<float, double>;
+
+namespace
+{
+    template <typename T, unsigned int n, StorageOrder order>
+    void fill_random(Matrix<T, n, n, order>& mat)
+    {
+        std::mt19937                      gen(n);
+        std::uniform_real_distribution<T> dis(-1, 1);
+
+        for (unsigned int i = 0; i < n; ++i)
+        {
+            for (unsigned int j = 0; j < n; ++j)
+            {
+                mat(i, j) = dis(gen);
+            }
+        }
+    }
+
+    /*
+     * Largest coefficient of |lhs * rhs - expected|, the product being computed in double precision
+     */
+    template <typename T, unsigned int n, unsigned int m, StorageOrder order>
+    double max_residual(const Matrix<T, n, n, order>& lhs, const Matrix<T, n, m, order>& rhs, const Matrix<T, n, m, order>& expected)
+    {
+        double result = 0.0;
+
+        for (unsigned int i = 0; i < n; ++i)
+        {
+            for (unsigned int j = 0; j < m; ++j)
+            {
+                double value = 0.0;
+
+                for (unsigned int k = 0; k < n; ++k)
+                {
+                    value += static_cast<double>(lhs(i, k)) * static_cast<double>(rhs(k, j));
+                }
+
+                result = std::max(result, std::abs(value - static_cast<double>(expected(i, j))));
+            }
+        }
+
+        return result;
+    }
+
+    /*
+     * Inverse, solve with a vector and solve with several right hand sides of a random n x n matrix
+     */
+    template <typename T, unsigned int n, StorageOrder order>
+    void check_inverse_and_solve(double tolerance)
+    {
+        constexpr unsigned int rhs_cols = 3;
+
+        const auto mat      = std::make_unique<Matrix<T, n, n, order>>();
+        const auto identity = std::make_unique<Matrix<T, n, n, order>>(T{1});
+        const auto rhs      = std::make_unique<Matrix<T, n, rhs_cols, order>>();
+
+        fill_random(*mat);
+
+        for (unsigned int i = 0; i < n; ++i)
+        {
+            for (unsigned int j = 0; j < rhs_cols; ++j)
+            {
+                (*rhs)(i, j) = static_cast<T>(i + 1) / static_cast<T>(j + 1);
+            }
+        }
+
+        const auto inverse = std::make_unique<Matrix<T, n, n, order>>(mat->inversed());
+        CHECK(max_residual(*mat, *inverse, *identity) < tolerance);
+
+        auto in_place = std::make_unique<Matrix<T, n, n, order>>(*mat);
+        in_place->inverse();
+        CHECK(*in_place == *inverse);
+
+        const auto solution = std::make_unique<Matrix<T, n, rhs_cols, order>>(mat->solve(*rhs));
+        CHECK(max_residual(*mat, *solution, *rhs) < tolerance * n);
+
+        Vector<T, n> vec;
+        for (unsigned int i = 0; i < n; ++i)
+        {
+            vec[i] = (*rhs)(i, 1);
+        }
+
+        const auto vec_solution = mat->solve(vec);
+        for (unsigned int i = 0; i < n; ++i)
+        {
+            CHECK(vec_solution[i] == Catch::Approx((*solution)(i, 1)).margin(tolerance));
+        }
+    }
+}  // namespace
+
+TEMPLATE_LIST_TEST_CASE("LU determinant", "[algebra][matrix][lu]", IntegerTypes)
+{
+    // clang-format off
+    constexpr Matrix<TestType, 5, 5> mat = {  2, -1,  0,  3,  1,
+                                              4,  1, -2,  0,  5,
+                                             -3,  2,  6,  1,  0,
+                                              1,  0, -1,  7, -2,
+                                              0,  3,  2, -4,  1 };
+
+    constexpr Matrix<TestType, 6, 6> mat6 = {  3,  1,  0, -2,  4,  1,
+                                               1,  5,  2,  0, -1,  3,
+                                               0, -2,  4,  1,  2,  0,
+                                               2,  0,  1,  6, -3,  1,
+                                              -1,  3,  0,  2,  5, -2,
+                                               4,  1, -3,  0,  1,  7 };
+    // clang-format on
+
+    static_assert(mat.determinant() == -950);
+    static_assert(Matrix<TestType, 5, 5, StorageOrder::ColumnMajor>(mat).determinant() == -950);
+    static_assert(mat.transposed().determinant() == -950);
+
+    CHECK(mat.determinant() == -950);
+    CHECK(mat6.determinant() == 27281);
+    CHECK(Matrix<float, 6, 6>({ 3, 1, 0, -2, 4, 1, 1, 5, 2, 0, -1, 3, 0, -2, 4, 1, 2, 0, 2, 0, 1, 6, -3, 1, -1, 3, 0, 2, 5, -2, 4, 1, -3, 0, 1, 7 }).determinant()
+          == Catch::Approx(27281.0f));
+
+    // Two equal rows
+    Matrix<TestType, 6, 6> singular = mat6;
+    for (unsigned int j = 0; j < 6; ++j)
+    {
+        singular(4, j) = singular(1, j);
+    }
+
+    CHECK(singular.determinant() == 0);
+
+    const Matrix<TestType, 40, 40> identity(TestType{1});
+    CHECK(identity.determinant() == 1);
+}
+
+TEMPLATE_LIST_TEST_CASE("LU inverse and solve", "[algebra][matrix][lu]", FloatingTypes)
+{
+    constexpr double epsilon = std::numeric_limits<TestType>::epsilon();
+
+    SECTION("Compile time")
+    {
+        // clang-format off
+        constexpr Matrix<TestType, 5, 5> mat = {  2, -1,  0,  3,  1,
+                                                  4,  1, -2,  0,  5,
+                                                 -3,  2,  6,  1,  0,
+                                                  1,  0, -1,  7, -2,
+                                                  0,  3,  2, -4,  1 };
+        // clang-format on
+
+        constexpr auto inverse  = mat.inversed();
+        constexpr auto solution = mat.solve(
+        []()
+        {
+            Vector<TestType, 5> rhs;
+            for (unsigned int i = 0; i < 5; ++i)
+            {
+                rhs[i] = static_cast<TestType>(i + 1);
+            }
+            return rhs;
+        }());
+
+        static_assert(std::abs(inverse(0, 0) * mat(0, 0) + inverse(0, 1) * mat(1, 0) + inverse(0, 2) * mat(2, 0) + inverse(0, 3) * mat(3, 0) + inverse(0, 4) * mat(4, 0) - 1) < epsilonLowPrecision<TestType>());
+        static_assert(std::abs(mat(4, 0) * solution[0] + mat(4, 1) * solution[1] + mat(4, 2) * solution[2] + mat(4, 3) * solution[3] + mat(4, 4) * solution[4] - 5) < epsilonLowPrecision<TestType>());
+
+        CHECK(max_residual(mat, inverse, Matrix<TestType, 5, 5>(TestType{1})) < 100 * epsilon);
+    }
+
+    SECTION("Unrolled")
+    {
+        check_inverse_and_solve<TestType, 6, StorageOrder::RowMajor>(1000 * epsilon);
+        check_inverse_and_solve<TestType, 6, StorageOrder::ColumnMajor>(1000 * epsilon);
+        check_inverse_and_solve<TestType, 16, StorageOrder::RowMajor>(1000 * epsilon);
+    }
+
+    SECTION("Blocked")
+    {
+        check_inverse_and_solve<TestType, 24, StorageOrder::ColumnMajor>(10000 * epsilon);
+        check_inverse_and_solve<TestType, 150, StorageOrder::RowMajor>(100000 * epsilon);
+    }
+
+    SECTION("Singular")
+    {
+        Matrix<TestType, 6, 6> mat;
+        fill_random(mat);
+
+        for (unsigned int j = 0; j < 6; ++j)
+        {
+            mat(4, j) = 2 * mat(1, j);
+        }
+
+        const auto copy = mat;
+
+        CHECK(mat.inversed().isNull());
+        CHECK(mat.inverse() == copy);
+        CHECK_THROWS_AS(mat.solve(Vector<TestType, 6>()), std::runtime_error);
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("LU decomposition of large matrices", "[algebra][matrix][lu]", FloatingTypes)
+{
+    using LCNS::Algebra::lu_factorize;
+    using LCNS::Algebra::lu_solve;
+    using LCNS::Algebra::solve_triangular;
+    using LCNS::Algebra::Triangle;
+
+    // Several panels, the last one being incomplete
+    constexpr size_t n        = 301;
+    constexpr size_t rhs_cols = 37;
+
+    const double tolerance = 1e5 * std::numeric_limits<TestType>::epsilon();
+
+    std::mt19937                             gen(n);
+    std::uniform_real_distribution<TestType> dis(-1, 1);
+
+    std::vector<TestType> mat(n * n);
+    std::vector<TestType> rhs(n * rhs_cols);
+    std::generate(mat.begin(), mat.end(), [&]() { return dis(gen); });
+    std::generate(rhs.begin(), rhs.end(), [&]() { return dis(gen); });
+
+    // Largest coefficient of |mat * x - rhs|, in double precision
+    const auto max_residual = [&](const std::vector<TestType>& x, size_t cols)
+    {
+        double result = 0.0;
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            for (size_t j = 0; j < cols; ++j)
+            {
+                double value = 0.0;
+
+                for (size_t k = 0; k < n; ++k)
+                {
+                    value += static_cast<double>(mat[i * n + k]) * static_cast<double>(x[k * cols + j]);
+                }
+
+                result = std::max(result, std::abs(value - static_cast<double>(rhs[i * cols + j])));
+            }
+        }
+
+        return result;
+    };
+
+    SECTION("Solve")
+    {
+        std::vector<TestType>     lu = mat;
+        std::vector<unsigned int> pivots(n);
+
+        REQUIRE(lu_factorize<TestType>(lu, pivots));
+
+        std::vector<TestType> x = rhs;
+        lu_solve<TestType>(lu, pivots, x, rhs_cols);
+        CHECK(max_residual(x, rhs_cols) < tolerance);
+
+        // Single right hand side: the first column
+        std::vector<TestType> x0(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            x0[i] = rhs[i * rhs_cols];
+        }
+
+        lu_solve<TestType>(lu, pivots, x0);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            CHECK(x0[i] == Catch::Approx(x[i * rhs_cols]).margin(tolerance));
+        }
+
+        CHECK_THROWS_AS(lu_solve<TestType>(lu, pivots, x0, 2), std::invalid_argument);
+    }
+
+    SECTION("Triangular solves")
+    {
+        for (const auto triangle : { Triangle::Lower, Triangle::UnitLower, Triangle::Upper, Triangle::UnitUpper })
+        {
+            // Diagonally dominant triangle, the coefficients of the other triangle being garbage that must not be read
+            std::vector<TestType> t = mat;
+            std::vector<TestType> expected(n * rhs_cols);
+            std::generate(expected.begin(), expected.end(), [&]() { return dis(gen); });
+
+            const bool lower = triangle == Triangle::Lower || triangle == Triangle::UnitLower;
+            const bool unit  = triangle == Triangle::UnitLower || triangle == Triangle::UnitUpper;
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                t[i * n + i] = 4;
+            }
+
+            // b = T * expected
+            std::vector<TestType> x(n * rhs_cols);
+            for (size_t i = 0; i < n; ++i)
+            {
+                for (size_t j = 0; j < rhs_cols; ++j)
+                {
+                    double value = unit ? expected[i * rhs_cols + j] : 4.0 * expected[i * rhs_cols + j];
+
+                    for (size_t k = lower ? 0 : i + 1; k < (lower ? i : n); ++k)
+                    {
+                        value += static_cast<double>(t[i * n + k] / n) * expected[k * rhs_cols + j];
+                    }
+
+                    x[i * rhs_cols + j] = static_cast<TestType>(value);
+                }
+            }
+
+            std::transform(t.begin(), t.end(), t.begin(), [](TestType value) { return value == 4 ? value : value / n; });
+
+            solve_triangular<TestType>(t, triangle, x, rhs_cols);
+
+            for (size_t i = 0; i < n * rhs_cols; ++i)
+            {
+                CHECK(x[i] == Catch::Approx(expected[i]).margin(epsilonLowPrecision<TestType>()));
+            }
+        }
+    }
+
+    SECTION("Singular")
+    {
+        std::vector<TestType> singular = mat;
+        for (size_t j = 0; j < n; ++j)
+        {
+            singular[200 * n + j] = singular[3 * n + j] - singular[150 * n + j];
+        }
+
+        std::vector<unsigned int> pivots(n);
+        CHECK_FALSE(lu_factorize<TestType>(singular, pivots));
+        CHECK_THROWS_AS(lu_factorize<TestType>(singular, std::span(pivots).first(n - 1)), std::invalid_argument);
+    }
+}
@@ -1870,6 +1870,78 @@ TEMPLATE_LIST_TEST_CASE("Matrix vector multiplication", "[algebra][matrix][dimMx
     CHECK(mul2[4] == Catch::Approx(-99.9595).epsilon(ehp));
 }
 
+TEMPLATE_LIST_TEST_CASE("Large matrix vector multiplication", "[algebra][matrix][dimMxN][method]", IntegerTypes)
+{
+    // Large enough for the matrix vector product kernel
+    Matrix<TestType, 40, 24>                                           row_major;
+    Matrix<TestType, 40, 24, LCNS::Algebra::StorageOrder::ColumnMajor> column_major;
+    Vector<TestType, 24>                                               vec;
+
+    for (unsigned int j = 0; j < 24; ++j)
+    {
+        vec[j] = static_cast<TestType>(j % 5) - 2;
+
+        for (unsigned int i = 0; i < 40; ++i)
+        {
+            row_major(i, j)    = static_cast<TestType>((i * 7 + j * 3) % 11) - 5;
+            column_major(i, j) = row_major(i, j);
+        }
+    }
+
+    const Vector<TestType, 40> row_major_product    = row_major * vec;
+    const Vector<TestType, 40> column_major_product = column_major * vec;
+
+    for (unsigned int i = 0; i < 40; ++i)
+    {
+        TestType expected = 0;
+
+        for (unsigned int j = 0; j < 24; ++j)
+        {
+            expected += row_major(i, j) * vec[j];
+        }
+
+        CHECK(row_major_product[i] == expected);
+        CHECK(column_major_product[i] == expected);
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Large matrix vector multiplication", "[algebra][matrix][dimMxN][method]", FloatingTypes)
+{
+    // Large enough for the matrix vector product kernel
+    Matrix<TestType, 40, 37>                                           row_major;
+    Matrix<TestType, 40, 37, LCNS::Algebra::StorageOrder::ColumnMajor> column_major;
+    Vector<TestType, 37>                                               vec;
+
+    for (unsigned int j = 0; j < 37; ++j)
+    {
+        vec[j] = static_cast<TestType>(std::sin(j + 1.0));
+
+        for (unsigned int i = 0; i < 40; ++i)
+        {
+            row_major(i, j)    = static_cast<TestType>(std::cos(i * 37.0 + j));
+            column_major(i, j) = row_major(i, j);
+        }
+    }
+
+    const Vector<TestType, 40> row_major_product    = row_major * vec;
+    const Vector<TestType, 40> column_major_product = column_major * vec;
+
+    constexpr auto elp = epsilonLowPrecision<TestType>();
+
+    for (unsigned int i = 0; i < 40; ++i)
+    {
+        double expected = 0;
+
+        for (unsigned int j = 0; j < 37; ++j)
+        {
+            expected += static_cast<double>(row_major(i, j)) * vec[j];
+        }
+
+        CHECK(row_major_product[i] == Catch::Approx(expected).margin(elp));
+        CHECK(column_major_product[i] == Catch::Approx(expected).margin(elp));
+    }
+}
+
 TEMPLATE_LIST_TEST_CASE("Scalar division operator", "[algebra][matrix][dimMxN][operator]", IntegerTypes)
 {
     // clang-format off
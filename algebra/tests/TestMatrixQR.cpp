@@ -0,0 +1,331 @@
+#include "algebra/Matrix.hpp"
+
+#include "Helper.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+using LCNS::epsilonLowPrecision;
+using LCNS::Algebra::Matrix;
+using LCNS::Algebra::StorageOrder;
+using LCNS::Algebra::Vector;
+
+using FloatingTypes = std::tuple<float, double>;
+
+namespace
+{
+    /*
+     * Largest coefficient of |A^T * (A * x - b)| relative to the norms of A and b, null at the least squares solution
+     * x, A being a rows x cols matrix and x and b having rhs_cols columns, all stored row by row
+     */
+    template <typename T>
+    double normal_equations_error(const std::vector<T>& a, const std::vector<T>& x, const std::vector<T>& b, size_t rows, size_t cols, size_t rhs_cols)
+    {
+        std::vector<double> residual(rows * rhs_cols);
+
+        for (size_t i = 0; i < rows; ++i)
+        {
+            for (size_t j = 0; j < rhs_cols; ++j)
+            {
+                double value = -static_cast<double>(b[i * rhs_cols + j]);
+
+                for (size_t k = 0; k < cols; ++k)
+                {
+                    value += static_cast<double>(a[i * cols + k]) * static_cast<double>(x[k * rhs_cols + j]);
+                }
+
+                residual[i * rhs_cols + j] = value;
+            }
+        }
+
+        double a_norm = 0.0;
+        double b_norm = 0.0;
+        double result = 0.0;
+
+        for (size_t i = 0; i < rows * cols; ++i)
+        {
+            a_norm += static_cast<double>(a[i]) * static_cast<double>(a[i]);
+        }
+
+        for (size_t i = 0; i < rows * rhs_cols; ++i)
+        {
+            b_norm += static_cast<double>(b[i]) * static_cast<double>(b[i]);
+        }
+
+        for (size_t k = 0; k < cols; ++k)
+        {
+            for (size_t j = 0; j < rhs_cols; ++j)
+            {
+                double value = 0.0;
+
+                for (size_t i = 0; i < rows; ++i)
+                {
+                    value += static_cast<double>(a[i * cols + k]) * residual[i * rhs_cols + j];
+                }
+
+                result = std::max(result, std::abs(value));
+            }
+        }
+
+        return result / std::sqrt(a_norm * b_norm);
+    }
+
+    template <typename T>
+    std::vector<T> random_coefficients(size_t count, unsigned int seed)
+    {
+        std::mt19937                      gen(seed);
+        std::uniform_real_distribution<T> dis(-1, 1);
+
+        std::vector<T> result(count);
+        std::generate(result.begin(), result.end(), [&]() { return dis(gen); });
+
+        return result;
+    }
+
+    /*
+     * Least squares solutions of a random rows x cols system by Matrix::solveLeastSquares
+     */
+    template <typename T, unsigned int rows, unsigned int cols, StorageOrder order>
+    void check_solve_least_squares(double tolerance)
+    {
+        constexpr unsigned int rhs_cols = 3;
+
+        const auto a = random_coefficients<T>(rows * cols, rows);
+        const auto b = random_coefficients<T>(rows * rhs_cols, cols);
+
+        const auto mat = std::make_unique<Matrix<T, rows, cols, order>>();
+        const auto rhs = std::make_unique<Matrix<T, rows, rhs_cols, order>>();
+
+        for (unsigned int i = 0; i < rows; ++i)
+        {
+            for (unsigned int j = 0; j < cols; ++j)
+            {
+                (*mat)(i, j) = a[(i * cols) + j];
+            }
+
+            for (unsigned int j = 0; j < rhs_cols; ++j)
+            {
+                (*rhs)(i, j) = b[(i * rhs_cols) + j];
+            }
+        }
+
+        const auto solution = mat->solveLeastSquares(*rhs);
+
+        std::vector<T> x(cols * rhs_cols);
+        for (unsigned int i = 0; i < cols; ++i)
+        {
+            for (unsigned int j = 0; j < rhs_cols; ++j)
+            {
+                x[(i * rhs_cols) + j] = solution(i, j);
+            }
+        }
+
+        CHECK(normal_equations_error(a, x, b, rows, cols, rhs_cols) < tolerance);
+
+        Vector<T, rows> vec;
+        for (unsigned int i = 0; i < rows; ++i)
+        {
+            vec[i] = (*rhs)(i, 2);
+        }
+
+        const auto vec_solution = mat->solveLeastSquares(vec);
+        for (unsigned int i = 0; i < cols; ++i)
+        {
+            CHECK(vec_solution[i] == Catch::Approx(solution(i, 2)).margin(tolerance));
+        }
+    }
+}  // namespace
+
+TEMPLATE_LIST_TEST_CASE("QR least squares", "[algebra][matrix][qr]", FloatingTypes)
+{
+    constexpr double epsilon = std::numeric_limits<TestType>::epsilon();
+
+    SECTION("Line fit")
+    {
+        // Exact points of y = 2 + 3 * t, then the same points with errors orthogonal to the columns
+        Matrix<TestType, 5, 2> mat;
+        Vector<TestType, 5>    exact;
+
+        for (unsigned int i = 0; i < 5; ++i)
+        {
+            mat(i, 0) = 1;
+            mat(i, 1) = static_cast<TestType>(i);
+            exact[i]  = static_cast<TestType>(2 + 3 * i);
+        }
+
+        const Matrix<TestType, 5, 2, StorageOrder::ColumnMajor> transposed_storage(mat);
+
+        const auto line = mat.solveLeastSquares(exact);
+        CHECK(line.x() == Catch::Approx(2));
+        CHECK(line.y() == Catch::Approx(3));
+
+        Vector<TestType, 5> noisy = exact;
+        noisy[0] += 1;
+        noisy[1] -= 1;
+        noisy[3] -= 1;
+        noisy[4] += 1;
+
+        // The errors sum to zero and so do the errors weighted by t, the fit does not change
+        const auto fit = transposed_storage.solveLeastSquares(noisy);
+        CHECK(fit.x() == Catch::Approx(2));
+        CHECK(fit.y() == Catch::Approx(3));
+    }
+
+    SECTION("Random systems")
+    {
+        check_solve_least_squares<TestType, 9, 9, StorageOrder::RowMajor>(100 * epsilon);
+        check_solve_least_squares<TestType, 40, 7, StorageOrder::RowMajor>(100 * epsilon);
+        check_solve_least_squares<TestType, 40, 7, StorageOrder::ColumnMajor>(100 * epsilon);
+        check_solve_least_squares<TestType, 150, 70, StorageOrder::RowMajor>(1000 * epsilon);
+    }
+
+    SECTION("Rank deficient")
+    {
+        Matrix<TestType, 6, 3> mat;
+
+        for (unsigned int i = 0; i < 6; ++i)
+        {
+            mat(i, 0) = static_cast<TestType>(i);
+            mat(i, 1) = 1;
+            mat(i, 2) = 2 * mat(i, 0) - 3;
+        }
+
+        CHECK_THROWS_AS(mat.solveLeastSquares(Vector<TestType, 6>()), std::runtime_error);
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("QR decomposition of large matrices", "[algebra][matrix][qr]", FloatingTypes)
+{
+    using LCNS::Algebra::least_squares;
+    using LCNS::Algebra::qr_factorize;
+    using LCNS::Algebra::qr_solve;
+
+    const double tolerance = 1000 * std::numeric_limits<TestType>::epsilon();
+
+    SECTION("Decomposition and solve")
+    {
+        // Several panels, the last one being incomplete
+        constexpr size_t rows     = 301;
+        constexpr size_t cols     = 77;
+        constexpr size_t rhs_cols = 5;
+
+        const auto a = random_coefficients<TestType>(rows * cols, 1);
+        const auto b = random_coefficients<TestType>(rows * rhs_cols, 2);
+
+        std::vector<TestType> qr = a;
+        std::vector<TestType> tau(cols);
+        qr_factorize<TestType>(qr, cols, tau);
+
+        // A^T * A = R^T * Q^T * Q * R = R^T * R
+        double error = 0.0;
+
+        for (size_t i = 0; i < cols; ++i)
+        {
+            for (size_t j = 0; j < cols; ++j)
+            {
+                double expected = 0.0;
+                double value    = 0.0;
+
+                for (size_t k = 0; k < rows; ++k)
+                {
+                    expected += static_cast<double>(a[k * cols + i]) * static_cast<double>(a[k * cols + j]);
+                }
+
+                for (size_t k = 0; k <= std::min(i, j); ++k)
+                {
+                    value += static_cast<double>(qr[k * cols + i]) * static_cast<double>(qr[k * cols + j]);
+                }
+
+                error = std::max(error, std::abs(value - expected) / static_cast<double>(rows));
+            }
+        }
+
+        CHECK(error < tolerance);
+
+        // The rows below the solution hold the residual
+        std::vector<TestType> x = b;
+        REQUIRE(qr_solve<TestType>(qr, tau, x, rhs_cols));
+
+        const std::vector<TestType> solution(x.begin(), x.begin() + cols * rhs_cols);
+        CHECK(normal_equations_error(a, solution, b, rows, cols, rhs_cols) < tolerance);
+
+        double residual = 0.0;
+        double expected = 0.0;
+
+        for (size_t i = cols * rhs_cols; i < rows * rhs_cols; ++i)
+        {
+            residual += static_cast<double>(x[i]) * static_cast<double>(x[i]);
+        }
+
+        for (size_t i = 0; i < rows; ++i)
+        {
+            for (size_t j = 0; j < rhs_cols; ++j)
+            {
+                double value = -static_cast<double>(b[i * rhs_cols + j]);
+
+                for (size_t k = 0; k < cols; ++k)
+                {
+                    value += static_cast<double>(a[i * cols + k]) * static_cast<double>(solution[k * rhs_cols + j]);
+                }
+
+                expected += value * value;
+            }
+        }
+
+        CHECK(residual == Catch::Approx(expected).epsilon(epsilonLowPrecision<TestType>()));
+
+        CHECK_THROWS_AS(qr_solve<TestType>(qr, tau, std::span(x).first(rows), rhs_cols), std::invalid_argument);
+        CHECK_THROWS_AS(qr_factorize<TestType>(std::span(qr).first(cols * (cols - 1)), cols, tau), std::invalid_argument);
+    }
+
+    SECTION("Tall skinny")
+    {
+        // Several blocks of rows decomposed separately, then the decomposition of their stacked R factors
+        constexpr size_t rows     = 20011;
+        constexpr size_t cols     = 12;
+        constexpr size_t rhs_cols = 2;
+
+        const auto a = random_coefficients<TestType>(rows * cols, 3);
+        const auto b = random_coefficients<TestType>(rows * rhs_cols, 4);
+
+        std::vector<TestType> mat = a;
+        std::vector<TestType> x   = b;
+        REQUIRE(least_squares<TestType>(mat, cols, x, rhs_cols));
+
+        const std::vector<TestType> solution(x.begin(), x.begin() + cols * rhs_cols);
+        CHECK(normal_equations_error(a, solution, b, rows, cols, rhs_cols) < 10 * tolerance);
+
+        // Same solution as the decomposition of the whole matrix
+        std::vector<TestType> qr = a;
+        std::vector<TestType> tau(cols);
+        std::vector<TestType> y = b;
+
+        qr_factorize<TestType>(qr, cols, tau);
+        REQUIRE(qr_solve<TestType>(qr, tau, y, rhs_cols));
+
+        for (size_t i = 0; i < cols * rhs_cols; ++i)
+        {
+            CHECK(x[i] == Catch::Approx(y[i]).margin(10 * tolerance));
+        }
+
+        // A column repeated
+        mat = a;
+        x   = b;
+
+        for (size_t i = 0; i < rows; ++i)
+        {
+            mat[i * cols + 7] = mat[i * cols + 2];
+        }
+
+        CHECK_FALSE(least_squares<TestType>(mat, cols, x, rhs_cols));
+        CHECK_THROWS_AS(least_squares<TestType>(mat, cols, std::span(x).first(rows), rhs_cols), std::invalid_argument);
+    }
+}
@@ -0,0 +1,605 @@
+#include "algebra/SingularValueDecomposition.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+using LCNS::Algebra::Matrix;
+using LCNS::Algebra::polarDecomposition;
+using LCNS::Algebra::randomized_svd;
+using LCNS::Algebra::singularValueDecomposition;
+using LCNS::Algebra::StorageOrder;
+using LCNS::Algebra::Vector;
+using LCNS::Algebra::VectorArray;
+
+using FloatingTypes = std::tuple<float, double>;
+
+namespace
+{
+    template <typename T, StorageOrder order>
+    double max_coefficient(const Matrix<T, 3, 3, order>& matrix)
+    {
+        double result = std::numeric_limits<double>::min();
+
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            for (unsigned int j = 0; j < 3; ++j)
+            {
+                result = std::max(result, std::abs(static_cast<double>(matrix(i, j))));
+            }
+        }
+
+        return result;
+    }
+
+    /*
+     * Check that the matrix is a rotation: orthonormal columns and a determinant of 1
+     */
+    template <typename T, StorageOrder order>
+    void check_rotation(const Matrix<T, 3, 3, order>& rotation)
+    {
+        const double tolerance = 20 * std::numeric_limits<T>::epsilon();
+
+        double error = 0.0;
+
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            for (unsigned int j = 0; j < 3; ++j)
+            {
+                double dot_product = 0.0;
+
+                for (unsigned int k = 0; k < 3; ++k)
+                {
+                    dot_product += static_cast<double>(rotation(k, i)) * static_cast<double>(rotation(k, j));
+                }
+
+                error = std::max(error, std::abs(dot_product - (i == j ? 1.0 : 0.0)));
+            }
+        }
+
+        CHECK(error < tolerance);
+        CHECK(rotation.determinant() > T{0});
+    }
+
+    /*
+     * Check that u and v are rotations, that sigma[0] >= sigma[1] >= |sigma[2]| with the sign of det(matrix) and that
+     * u * diag(sigma) * v^T gives back the matrix, relatively to max|coefficient|
+     */
+    template <typename T, StorageOrder order>
+    void check_decomposition(const Matrix<T, 3, 3, order>& matrix,
+                             const Matrix<T, 3, 3, order>& u,
+                             const Vector<T, 3>&           sigma,
+                             const Matrix<T, 3, 3, order>& v)
+    {
+        const double tolerance = 20 * std::numeric_limits<T>::epsilon();
+        const double scale     = max_coefficient(matrix);
+
+        check_rotation(u);
+        check_rotation(v);
+
+        CHECK(sigma[0] >= sigma[1] - tolerance * scale);
+        CHECK(sigma[1] >= std::abs(sigma[2]) - tolerance * scale);
+
+        double error = 0.0;
+
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            for (unsigned int j = 0; j < 3; ++j)
+            {
+                double product = 0.0;
+
+                for (unsigned int k = 0; k < 3; ++k)
+                {
+                    product += static_cast<double>(u(i, k)) * static_cast<double>(sigma[k]) * static_cast<double>(v(j, k));
+                }
+
+                error = std::max(error, std::abs(product - static_cast<double>(matrix(i, j))) / scale);
+            }
+        }
+
+        CHECK(error < tolerance);
+    }
+
+    /*
+     * Check that the rotation is one, that the stretch is symmetric and that rotation * stretch gives back the matrix
+     */
+    template <typename T, StorageOrder order>
+    void check_polar(const Matrix<T, 3, 3, order>& matrix, const Matrix<T, 3, 3, order>& rotation, const Matrix<T, 3, 3, order>& stretch)
+    {
+        const double tolerance = 20 * std::numeric_limits<T>::epsilon();
+        const double scale     = max_coefficient(matrix);
+
+        check_rotation(rotation);
+
+        double error = 0.0;
+
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            for (unsigned int j = 0; j < 3; ++j)
+            {
+                double product = 0.0;
+
+                for (unsigned int k = 0; k < 3; ++k)
+                {
+                    product += static_cast<double>(rotation(i, k)) * static_cast<double>(stretch(k, j));
+                }
+
+                error = std::max(error, std::abs(product - static_cast<double>(matrix(i, j))) / scale);
+                error = std::max(error, std::abs(static_cast<double>(stretch(i, j)) - static_cast<double>(stretch(j, i))) / scale);
+            }
+        }
+
+        CHECK(error < tolerance);
+    }
+
+    /*
+     * Random matrices: full rank, of rank 2, 1 and 0, reflections, close singular values and very different magnitudes
+     */
+    template <typename T, StorageOrder order = StorageOrder::RowMajor>
+    Matrix<T, 3, 3, order> random_matrix(std::mt19937& gen, unsigned int kind)
+    {
+        std::uniform_real_distribution<double> dis(-1.0, 1.0);
+
+        Matrix<T, 3, 3, order> result;
+
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            for (unsigned int j = 0; j < 3; ++j)
+            {
+                result(i, j) = static_cast<T>(dis(gen));
+            }
+        }
+
+        switch (kind % 6)
+        {
+            case 1:
+                for (unsigned int j = 0; j < 3; ++j)
+                {
+                    result(2, j) = result(0, j) - result(1, j);
+                }
+                break;
+            case 2:
+                for (unsigned int i = 1; i < 3; ++i)
+                {
+                    for (unsigned int j = 0; j < 3; ++j)
+                    {
+                        result(i, j) = result(0, j) * static_cast<T>(i + 1);
+                    }
+                }
+                break;
+            case 3:
+                for (unsigned int i = 0; i < 3; ++i)
+                {
+                    for (unsigned int j = 0; j < 3; ++j)
+                    {
+                        result(i, j) = static_cast<T>(i == j ? 1.0 : 0.0) + result(i, j) * static_cast<T>(1e-4);
+                    }
+                }
+                break;
+            case 4:
+                for (unsigned int j = 0; j < 3; ++j)
+                {
+                    result(0, j) *= static_cast<T>(1e6);
+                    result(1, j) *= static_cast<T>(-1e-3);
+                }
+                break;
+            case 5:
+                result = Matrix<T, 3, 3, order>();
+                break;
+            default:
+                break;
+        }
+
+        return result;
+    }
+
+    /*
+     * rows x cols matrix with orthonormal random columns, by Gram-Schmidt applied twice
+     */
+    std::vector<double> random_orthonormal(std::mt19937& gen, size_t rows, size_t cols)
+    {
+        std::normal_distribution<double> dis;
+
+        std::vector<double> result(rows * cols);
+        std::generate(result.begin(), result.end(), [&]() { return dis(gen); });
+
+        for (size_t j = 0; j < cols; ++j)
+        {
+            for (unsigned int pass = 0; pass < 2; ++pass)
+            {
+                for (size_t k = 0; k < j; ++k)
+                {
+                    double dot_product = 0.0;
+
+                    for (size_t i = 0; i < rows; ++i)
+                    {
+                        dot_product += result[i * cols + j] * result[i * cols + k];
+                    }
+
+                    for (size_t i = 0; i < rows; ++i)
+                    {
+                        result[i * cols + j] -= dot_product * result[i * cols + k];
+                    }
+                }
+            }
+
+            double norm = 0.0;
+
+            for (size_t i = 0; i < rows; ++i)
+            {
+                norm += result[i * cols + j] * result[i * cols + j];
+            }
+
+            for (size_t i = 0; i < rows; ++i)
+            {
+                result[i * cols + j] /= std::sqrt(norm);
+            }
+        }
+
+        return result;
+    }
+
+    /*
+     * rows x cols matrix U * diag(singular_values) * V^T, U and V being random with orthonormal columns
+     */
+    std::vector<double> random_low_rank(std::mt19937& gen, size_t rows, size_t cols, const std::vector<double>& singular_values)
+    {
+        const size_t rank = singular_values.size();
+        const auto   u    = random_orthonormal(gen, rows, rank);
+        const auto   v    = random_orthonormal(gen, cols, rank);
+
+        std::vector<double> result(rows * cols);
+
+        for (size_t i = 0; i < rows; ++i)
+        {
+            for (size_t k = 0; k < rank; ++k)
+            {
+                const double factor = u[i * rank + k] * singular_values[k];
+
+                for (size_t j = 0; j < cols; ++j)
+                {
+                    result[i * cols + j] += factor * v[j * rank + k];
+                }
+            }
+        }
+
+        return result;
+    }
+
+    /*
+     * Largest |A * v_i - sigma_i * u_i| relative to sigma_0, and largest |U^T * U - I| and |V^T * V - I| coefficients,
+     * the columns of null singular values of V being skipped
+     */
+    template <typename T>
+    double singular_triplets_error(const std::vector<double>& matrix, const std::vector<T>& u, const std::vector<T>& sigma, const std::vector<T>& v)
+    {
+        const size_t k    = sigma.size();
+        const size_t rows = u.size() / k;
+        const size_t cols = v.size() / k;
+
+        double error = 0.0;
+
+        for (size_t c = 0; c < k; ++c)
+        {
+            for (size_t i = 0; i < rows; ++i)
+            {
+                double residual = -static_cast<double>(sigma[c]) * static_cast<double>(u[i * k + c]);
+
+                for (size_t j = 0; j < cols; ++j)
+                {
+                    residual += matrix[i * cols + j] * static_cast<double>(v[j * k + c]);
+                }
+
+                error = std::max(error, std::abs(residual) / static_cast<double>(sigma[0]));
+            }
+
+            for (size_t d = 0; d <= c; ++d)
+            {
+                double dot_u = 0.0;
+                double dot_v = 0.0;
+
+                for (size_t i = 0; i < rows; ++i)
+                {
+                    dot_u += static_cast<double>(u[i * k + c]) * static_cast<double>(u[i * k + d]);
+                }
+
+                for (size_t j = 0; j < cols; ++j)
+                {
+                    dot_v += static_cast<double>(v[j * k + c]) * static_cast<double>(v[j * k + d]);
+                }
+
+                const double identity = c == d ? 1.0 : 0.0;
+
+                error = std::max(error, std::abs(dot_u - identity));
+                error = std::max(error, sigma[c] > T{0} ? std::abs(dot_v - identity) : std::abs(dot_v));
+            }
+        }
+
+        return error;
+    }
+}  // namespace
+
+TEMPLATE_LIST_TEST_CASE("Singular value decomposition of 3x3 matrices", "[algebra][matrix][svd]", FloatingTypes)
+{
+    SECTION("Diagonal matrix")
+    {
+        Matrix<TestType, 3, 3> matrix;
+        matrix(0, 0) = TestType{2};
+        matrix(1, 1) = TestType{-5};
+        matrix(2, 2) = TestType{3};
+
+        const auto result = singularValueDecomposition(matrix);
+
+        CHECK(result.singularValues[0] == Catch::Approx(5.0));
+        CHECK(result.singularValues[1] == Catch::Approx(3.0));
+        CHECK(result.singularValues[2] == Catch::Approx(-2.0));
+
+        check_decomposition(matrix, result.u, result.singularValues, result.v);
+    }
+
+    SECTION("Random matrices")
+    {
+        std::mt19937 gen(3);
+
+        for (unsigned int i = 0; i < 600; ++i)
+        {
+            const auto matrix = random_matrix<TestType>(gen, i);
+            const auto result = singularValueDecomposition(matrix);
+
+            check_decomposition(matrix, result.u, result.singularValues, result.v);
+
+            // The last singular value carries the sign of the determinant, when it is not null up to rounding errors
+            const double determinant = static_cast<double>(matrix.determinant());
+
+            if (std::abs(determinant) > 1e-3 * std::pow(max_coefficient(matrix), 3.0))
+            {
+                CHECK(result.singularValues[2] * determinant > 0.0);
+            }
+        }
+
+        const auto matrix = random_matrix<TestType, StorageOrder::ColumnMajor>(gen, 0);
+        const auto result = singularValueDecomposition(matrix);
+
+        check_decomposition(matrix, result.u, result.singularValues, result.v);
+    }
+
+    SECTION("Batch")
+    {
+        std::mt19937 gen(4);
+
+        // Not a multiple of the SIMD widths, so that the last matrices are decomposed one at a time
+        constexpr size_t count = 1003;
+
+        std::vector<Matrix<TestType, 3, 3>> matrices(count);
+        std::vector<Matrix<TestType, 3, 3>> u(count);
+        std::vector<Matrix<TestType, 3, 3>> v(count);
+        VectorArray<TestType, 3>            singularValues(count);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            matrices[i] = random_matrix<TestType>(gen, static_cast<unsigned int>(i));
+        }
+
+        singularValueDecomposition<TestType>(matrices, u, singularValues, v);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const auto   sigma  = singularValues[i];
+            const auto   single = singularValueDecomposition(matrices[i]);
+            const double margin = 20 * std::numeric_limits<TestType>::epsilon() * max_coefficient(matrices[i]);
+
+            check_decomposition(matrices[i], u[i], sigma, v[i]);
+
+            for (unsigned int k = 0; k < 3; ++k)
+            {
+                CHECK(sigma[k] == Catch::Approx(single.singularValues[k]).margin(margin));
+            }
+        }
+
+        VectorArray<TestType, 3> wrong_count(count - 1);
+
+        const auto decompose = [&matrices](auto left, VectorArray<TestType, 3>& sigma, auto right)
+        {
+            singularValueDecomposition<TestType>(matrices, left, sigma, right);
+        };
+
+        CHECK_THROWS_AS(decompose(u, wrong_count, v), std::invalid_argument);
+        CHECK_THROWS_AS(decompose(std::span(u).first(count - 1), singularValues, v), std::invalid_argument);
+        CHECK_THROWS_AS(decompose(u, singularValues, std::span(v).first(count - 1)), std::invalid_argument);
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Polar decomposition of 3x3 matrices", "[algebra][matrix][svd]", FloatingTypes)
+{
+    SECTION("Rotation and stretch")
+    {
+        // A = R * S with a rotation of pi / 3 around z and a symmetric positive definite S
+        const TestType c = std::cos(TestType{1.0471975511965976});
+        const TestType s = std::sin(TestType{1.0471975511965976});
+
+        Matrix<TestType, 3, 3> rotation;
+        rotation(0, 0) = c;
+        rotation(0, 1) = -s;
+        rotation(1, 0) = s;
+        rotation(1, 1) = c;
+        rotation(2, 2) = TestType{1};
+
+        Matrix<TestType, 3, 3> stretch;
+        stretch(0, 0) = TestType{2};
+        stretch(1, 1) = TestType{1.5};
+        stretch(2, 2) = TestType{0.5};
+        stretch(0, 1) = stretch(1, 0) = TestType{0.25};
+        stretch(1, 2) = stretch(2, 1) = TestType{-0.125};
+
+        const auto matrix = rotation * stretch;
+        const auto result = polarDecomposition(matrix);
+
+        check_polar(matrix, result.rotation, result.stretch);
+
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            for (unsigned int j = 0; j < 3; ++j)
+            {
+                CHECK(result.rotation(i, j) == Catch::Approx(rotation(i, j)).margin(20 * std::numeric_limits<TestType>::epsilon()));
+                CHECK(result.stretch(i, j) == Catch::Approx(stretch(i, j)).margin(20 * std::numeric_limits<TestType>::epsilon()));
+            }
+        }
+    }
+
+    SECTION("Random matrices")
+    {
+        std::mt19937 gen(5);
+
+        for (unsigned int i = 0; i < 600; ++i)
+        {
+            const auto matrix = random_matrix<TestType>(gen, i);
+            const auto result = polarDecomposition(matrix);
+
+            check_polar(matrix, result.rotation, result.stretch);
+        }
+    }
+
+    SECTION("Batch")
+    {
+        std::mt19937 gen(6);
+
+        constexpr size_t count = 1003;
+
+        std::vector<Matrix<TestType, 3, 3>> matrices(count);
+        std::vector<Matrix<TestType, 3, 3>> rotations(count);
+        std::vector<Matrix<TestType, 3, 3>> stretches(count);
+        std::vector<Matrix<TestType, 3, 3>> rotations_only(count);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            matrices[i] = random_matrix<TestType>(gen, static_cast<unsigned int>(i));
+        }
+
+        polarDecomposition<TestType>(matrices, rotations, stretches);
+        polarDecomposition<TestType>(matrices, rotations_only);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            check_polar(matrices[i], rotations[i], stretches[i]);
+
+            for (unsigned int j = 0; j < 3; ++j)
+            {
+                for (unsigned int k = 0; k < 3; ++k)
+                {
+                    CHECK(rotations_only[i](j, k) == rotations[i](j, k));
+                }
+            }
+        }
+
+        const auto decompose = [&matrices](std::span<Matrix<TestType, 3, 3>> destination) { polarDecomposition<TestType>(matrices, destination); };
+
+        CHECK_THROWS_AS(decompose(std::span(rotations).first(count - 1)), std::invalid_argument);
+        CHECK_THROWS_AS(polarDecomposition<TestType>(matrices, rotations, std::span(stretches).first(count - 1)), std::invalid_argument);
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Randomized singular value decomposition of large matrices", "[algebra][matrix][svd]", FloatingTypes)
+{
+    const double tolerance = 100 * std::numeric_limits<TestType>::epsilon();
+
+    SECTION("Decaying spectrum")
+    {
+        // Rank 40 above the 20 random vectors, the power iterations making the neglected singular values negligible.
+        // More rows than a panel of the products by A^T, and more columns than a panel of the QR decompositions.
+        constexpr size_t rows = 1500;
+        constexpr size_t cols = 300;
+        constexpr size_t k    = 10;
+
+        std::mt19937 gen(rows);
+
+        std::vector<double> spectrum(40);
+
+        for (size_t i = 0; i < spectrum.size(); ++i)
+        {
+            spectrum[i] = 10.0 * std::pow(0.5, static_cast<double>(i));
+        }
+
+        const auto                  a = random_low_rank(gen, rows, cols, spectrum);
+        const std::vector<TestType> matrix(a.begin(), a.end());
+
+        std::vector<TestType> u(rows * k);
+        std::vector<TestType> singular_values(k);
+        std::vector<TestType> v(cols * k);
+
+        REQUIRE(randomized_svd<TestType>(matrix, cols, u, singular_values, v));
+
+        for (size_t i = 0; i < k; ++i)
+        {
+            CHECK(singular_values[i] == Catch::Approx(spectrum[i]).margin(tolerance * spectrum[0]));
+        }
+
+        CHECK(singular_triplets_error(a, u, singular_values, v) < tolerance);
+
+        // Without power iterations, the approximation is only as good as (sigma[20] / sigma[10])
+        REQUIRE(randomized_svd<TestType>(matrix, cols, u, singular_values, v, 10, 0));
+        CHECK(singular_values[0] == Catch::Approx(spectrum[0]).epsilon(1e-2));
+    }
+
+    SECTION("Matrix of lower rank")
+    {
+        // Wide matrix of rank 5 < k: the last singular values are null, as are their right singular vectors
+        constexpr size_t rows = 80;
+        constexpr size_t cols = 200;
+        constexpr size_t k    = 8;
+
+        std::mt19937 gen(rows);
+
+        const std::vector<double>   spectrum = { 5.0, 4.0, 4.0, 1.0, 0.5 };
+        const auto                  a        = random_low_rank(gen, rows, cols, spectrum);
+        const std::vector<TestType> matrix(a.begin(), a.end());
+
+        std::vector<TestType> u(rows * k);
+        std::vector<TestType> singular_values(k);
+        std::vector<TestType> v(cols * k);
+
+        REQUIRE(randomized_svd<TestType>(matrix, cols, u, singular_values, v));
+
+        for (size_t i = 0; i < k; ++i)
+        {
+            CHECK(singular_values[i] == Catch::Approx(i < spectrum.size() ? spectrum[i] : 0.0).margin(tolerance * spectrum[0]));
+        }
+
+        CHECK(singular_triplets_error(a, u, singular_values, v) < tolerance);
+    }
+
+    SECTION("Invalid matrices")
+    {
+        constexpr size_t rows = 20;
+        constexpr size_t cols = 10;
+
+        std::vector<TestType> matrix(rows * cols, TestType{1});
+        std::vector<TestType> u(rows * 2);
+        std::vector<TestType> singular_values(2);
+        std::vector<TestType> v(cols * 2);
+
+        matrix[7] = std::numeric_limits<TestType>::quiet_NaN();
+        CHECK_FALSE(randomized_svd<TestType>(matrix, cols, u, singular_values, v));
+
+        const auto decompose = [&matrix](size_t matrix_cols, std::span<TestType> left, std::span<TestType> sigma, std::span<TestType> right)
+        {
+            return randomized_svd<TestType>(matrix, matrix_cols, left, sigma, right);
+        };
+
+        std::vector<TestType> too_many_values(cols + 1);
+        std::vector<TestType> too_many_u(rows * (cols + 1));
+        std::vector<TestType> too_many_v(cols * (cols + 1));
+
+        CHECK_THROWS_AS(decompose(0, u, singular_values, v), std::invalid_argument);
+        CHECK_THROWS_AS(decompose(cols + 1, u, singular_values, v), std::invalid_argument);
+        CHECK_THROWS_AS(decompose(cols, u, std::span(singular_values).first(0), v), std::invalid_argument);
+        CHECK_THROWS_AS(decompose(cols, too_many_u, too_many_values, too_many_v), std::invalid_argument);
+        CHECK_THROWS_AS(decompose(cols, std::span(u).first(rows), singular_values, v), std::invalid_argument);
+        CHECK_THROWS_AS(decompose(cols, u, singular_values, std::span(v).first(cols)), std::invalid_argument);
+    }
+}
@@ -0,0 +1,521 @@
+#include "algebra/MatrixView.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <random>
+#include <span>
+#include <vector>
+
+using LCNS::Algebra::gemm;
+using LCNS::Algebra::gemv;
+using LCNS::Algebra::Matrix;
+using LCNS::Algebra::MatrixView;
+using LCNS::Algebra::StorageOrder;
+using LCNS::Algebra::Triangle;
+
+using FloatingTypes = std::tuple<float, double>;
+
+namespace
+{
+    enum class Layout
+    {
+        Rows,
+        Columns,
+        Strided
+    };
+
+    constexpr Layout layouts[] = { Layout::Rows, Layout::Columns, Layout::Strided };
+
+    /*
+     * View on random coefficients in buffer, as a block of a larger matrix stored by rows or by columns, or with
+     * strides which are 1 neither between rows nor between columns
+     */
+    template <typename T>
+    MatrixView<T> random_view(std::vector<T>& buffer, size_t rows, size_t cols, Layout layout, unsigned int seed)
+    {
+        MatrixView<T> view;
+
+        switch (layout)
+        {
+            case Layout::Rows:
+                buffer.assign(rows * (cols + 3), std::numeric_limits<T>::quiet_NaN());
+                view = MatrixView<T>(buffer.data(), rows, cols, cols + 3);
+                break;
+            case Layout::Columns:
+                buffer.assign((rows + 2) * cols, std::numeric_limits<T>::quiet_NaN());
+                view = MatrixView<T>(buffer.data(), rows, cols, 1, rows + 2);
+                break;
+            case Layout::Strided:
+                buffer.assign(rows * (2 * cols + 1), std::numeric_limits<T>::quiet_NaN());
+                view = MatrixView<T>(buffer.data(), rows, cols, 2 * cols + 1, 2);
+                break;
+        }
+
+        std::mt19937                      generator(seed);
+        std::uniform_real_distribution<T> distribution(-1, 1);
+
+        for (size_t i = 0; i < rows; ++i)
+        {
+            for (size_t j = 0; j < cols; ++j)
+            {
+                view(i, j) = distribution(generator);
+            }
+        }
+
+        return view;
+    }
+
+    /*
+     * Coefficients of a view stored row by row
+     */
+    template <typename T>
+    std::vector<T> packed(MatrixView<const T> view)
+    {
+        std::vector<T> result(view.rows() * view.cols());
+
+        for (size_t i = 0; i < view.rows(); ++i)
+        {
+            for (size_t j = 0; j < view.cols(); ++j)
+            {
+                result[i * view.cols() + j] = view(i, j);
+            }
+        }
+
+        return result;
+    }
+
+    /*
+     * Symmetric matrix with a dominant diagonal, positive definite
+     */
+    template <typename T>
+    void make_positive_definite(MatrixView<T> view)
+    {
+        for (size_t i = 0; i < view.rows(); ++i)
+        {
+            for (size_t j = 0; j < i; ++j)
+            {
+                view(j, i) = view(i, j);
+            }
+
+            view(i, i) += static_cast<T>(view.rows());
+        }
+    }
+
+    /*
+     * Check that the coefficients of a view are those of a matrix stored row by row, or their opposites if signs is
+     * true, as for the eigenvectors
+     */
+    template <typename T>
+    void check_same(MatrixView<const T> view, const std::vector<T>& expected, bool signs = false)
+    {
+        const T tolerance = 10000 * std::numeric_limits<T>::epsilon();
+
+        for (size_t i = 0; i < view.rows(); ++i)
+        {
+            for (size_t j = 0; j < view.cols(); ++j)
+            {
+                const T value = expected[i * view.cols() + j];
+
+                REQUIRE((signs ? std::abs(view(i, j)) : view(i, j)) == Catch::Approx(signs ? std::abs(value) : value).margin(tolerance));
+            }
+        }
+    }
+}  // namespace
+
+TEMPLATE_LIST_TEST_CASE("Matrix views", "[algebra][matrix][view]", FloatingTypes)
+{
+    SECTION("Views on matrices")
+    {
+        Matrix<TestType, 5, 7>                            row_major;
+        Matrix<TestType, 5, 7, StorageOrder::ColumnMajor> column_major;
+
+        for (unsigned int i = 0; i < 5; ++i)
+        {
+            for (unsigned int j = 0; j < 7; ++j)
+            {
+                row_major(i, j)    = static_cast<TestType>(10 * i + j);
+                column_major(i, j) = static_cast<TestType>(10 * i + j);
+            }
+        }
+
+        const MatrixView rows_view    = MatrixView(row_major);
+        const MatrixView columns_view = MatrixView(column_major);
+
+        CHECK(rows_view.rowStride() == 7);
+        CHECK(rows_view.colStride() == 1);
+        CHECK(columns_view.rowStride() == 1);
+        CHECK(columns_view.colStride() == 5);
+
+        for (size_t i = 0; i < 5; ++i)
+        {
+            for (size_t j = 0; j < 7; ++j)
+            {
+                CHECK(rows_view(i, j) == row_major(i, j));
+                CHECK(columns_view(i, j) == row_major(i, j));
+                CHECK(rows_view.transposed()(j, i) == row_major(i, j));
+            }
+        }
+
+        // Blocks of blocks, writing through the views
+        const MatrixView<TestType> block = rows_view.block(1, 2, 4, 5).block(1, 1, 2, 3);
+        CHECK(block.rows() == 2);
+        CHECK(block.cols() == 3);
+        CHECK(block(0, 0) == 23);
+        CHECK(block(1, 2) == 35);
+
+        block(1, 2) = -1;
+        CHECK(row_major(3, 5) == -1);
+
+        columns_view.block(4, 6, 1, 1)(0, 0) = -2;
+        CHECK(column_major(4, 6) == -2);
+
+        // Read only views
+        const Matrix<TestType, 5, 7>&    constant  = row_major;
+        const MatrixView                 read_only = MatrixView(constant);
+        const MatrixView<const TestType> converted = block;
+        CHECK(read_only(3, 5) == -1);
+        CHECK(converted(1, 2) == -1);
+        CHECK(converted.data() == block.data());
+
+        CHECK_THROWS_AS(rows_view(5, 0), std::out_of_range);
+        CHECK_THROWS_AS(rows_view(0, 7), std::out_of_range);
+        CHECK_THROWS_AS(rows_view.block(3, 0, 3, 1), std::out_of_range);
+        CHECK_THROWS_AS(rows_view.block(0, 8, 0, 0), std::out_of_range);
+        CHECK(rows_view.block(5, 7, 0, 0).rows() == 0);
+    }
+
+    SECTION("Matrix vector products")
+    {
+        const TestType tolerance = 100 * std::numeric_limits<TestType>::epsilon();
+
+        for (const Layout layout : layouts)
+        {
+            std::vector<TestType> buffer;
+            const MatrixView      a = random_view(buffer, 53, 41, layout, 1);
+
+            std::vector<TestType> x(41);
+            std::vector<TestType> y(53, TestType{1});
+
+            for (size_t j = 0; j < 41; ++j)
+            {
+                x[j] = static_cast<TestType>(std::sin(j + 1.0));
+            }
+
+            gemv<TestType>(2, a, x, -1, y);
+
+            for (size_t i = 0; i < 53; ++i)
+            {
+                double expected = -1;
+
+                for (size_t j = 0; j < 41; ++j)
+                {
+                    expected += 2 * static_cast<double>(a(i, j)) * x[j];
+                }
+
+                CHECK(y[i] == Catch::Approx(expected).margin(tolerance * 41));
+            }
+
+            CHECK_THROWS_AS(gemv<TestType>(1, a, std::span(x).first(40), 0, y), std::invalid_argument);
+        }
+    }
+
+    SECTION("Matrix products")
+    {
+        const TestType tolerance = 100 * std::numeric_limits<TestType>::epsilon();
+
+        // Every layout of each operand and of the result
+        for (const Layout a_layout : layouts)
+        {
+            for (const Layout b_layout : layouts)
+            {
+                for (const Layout c_layout : layouts)
+                {
+                    std::vector<TestType> a_buffer;
+                    std::vector<TestType> b_buffer;
+                    std::vector<TestType> c_buffer;
+
+                    const MatrixView a = random_view(a_buffer, 37, 29, a_layout, 2);
+                    const MatrixView b = random_view(b_buffer, 29, 45, b_layout, 3);
+                    const MatrixView c = random_view(c_buffer, 37, 45, c_layout, 4);
+
+                    const std::vector<TestType> initial = c_buffer;
+
+                    gemm<TestType>(TestType{0.5}, a, b, 2, c);
+
+                    for (size_t i = 0; i < 37; ++i)
+                    {
+                        for (size_t j = 0; j < 45; ++j)
+                        {
+                            double expected = 0;
+
+                            for (size_t k = 0; k < 29; ++k)
+                            {
+                                expected += static_cast<double>(a(i, k)) * b(k, j);
+                            }
+
+                            const TestType previous = initial[&c(i, j) - c_buffer.data()];
+
+                            REQUIRE(c(i, j) == Catch::Approx(expected / 2 + 2 * previous).margin(tolerance * 29));
+                        }
+                    }
+
+                    // Not read when beta is zero, and the padding is left alone
+                    c(0, 0) = std::numeric_limits<TestType>::quiet_NaN();
+                    gemm<TestType>(1, a, b, 0, c);
+                    CHECK_FALSE(std::isnan(c(0, 0)));
+                    CHECK(std::isnan(c_buffer.back()));
+                }
+            }
+        }
+    }
+
+    SECTION("Products of blocks of matrices")
+    {
+        auto matrix  = std::make_unique<Matrix<TestType, 60, 60>>();
+        auto product = std::make_unique<Matrix<TestType, 60, 60, StorageOrder::ColumnMajor>>();
+
+        for (unsigned int i = 0; i < 60; ++i)
+        {
+            for (unsigned int j = 0; j < 60; ++j)
+            {
+                (*matrix)(i, j) = static_cast<TestType>(std::cos(i * 60.0 + j));
+            }
+        }
+
+        // Upper left block times the transpose of the lower right block, in the middle of the product
+        const MatrixView<const TestType> view = MatrixView(*matrix);
+        gemm<TestType>(1, view.block(0, 0, 20, 30), view.block(30, 30, 20, 30).transposed(), 0, MatrixView(*product).block(10, 20, 20, 20));
+
+        for (unsigned int i = 0; i < 60; ++i)
+        {
+            for (unsigned int j = 0; j < 60; ++j)
+            {
+                double expected = 0;
+
+                if (10 <= i && i < 30 && 20 <= j && j < 40)
+                {
+                    for (unsigned int k = 0; k < 30; ++k)
+                    {
+                        expected += static_cast<double>((*matrix)(i - 10, k)) * (*matrix)(30 + j - 20, 30 + k);
+                    }
+                }
+
+                CHECK((*product)(i, j) == Catch::Approx(expected).margin(1e-4));
+            }
+        }
+
+        CHECK_THROWS_AS(gemm<TestType>(1, view.block(0, 0, 20, 30), view.block(0, 0, 20, 30), 0, MatrixView(*product).block(0, 0, 20, 30)),
+                        std::invalid_argument);
+    }
+
+    SECTION("Decompositions")
+    {
+        // In place for the blocks of matrices stored by rows, on copies for the other layouts: same results as on spans
+        for (const Layout layout : layouts)
+        {
+            std::vector<TestType> buffer;
+            std::vector<TestType> rhs_buffer;
+
+            // LU
+            const MatrixView lu  = random_view(buffer, 150, 150, layout, 5);
+            const MatrixView rhs = random_view(rhs_buffer, 150, 3, layout, 6);
+
+            std::vector<TestType>     lu_span  = packed<TestType>(lu);
+            std::vector<TestType>     rhs_span = packed<TestType>(rhs);
+            std::vector<unsigned int> pivots(150);
+            std::vector<unsigned int> span_pivots(150);
+
+            REQUIRE(LCNS::Algebra::lu_factorize(lu, std::span(pivots)));
+            REQUIRE(LCNS::Algebra::lu_factorize(std::span(lu_span), std::span(span_pivots)));
+            CHECK(pivots == span_pivots);
+            check_same<TestType>(lu, lu_span);
+
+            LCNS::Algebra::lu_solve<TestType>(lu, pivots, rhs);
+            LCNS::Algebra::lu_solve<TestType>(lu_span, span_pivots, rhs_span, 3);
+            check_same<TestType>(rhs, rhs_span);
+
+            LCNS::Algebra::solve_triangular<TestType>(lu, Triangle::UnitLower, rhs);
+            LCNS::Algebra::solve_triangular<TestType>(lu_span, Triangle::UnitLower, rhs_span, 3);
+            check_same<TestType>(rhs, rhs_span);
+
+            CHECK_THROWS_AS(LCNS::Algebra::lu_factorize(lu, std::span(pivots).first(149)), std::invalid_argument);
+            CHECK_THROWS_AS(LCNS::Algebra::lu_solve<TestType>(lu, pivots, rhs.block(0, 0, 149, 3)), std::invalid_argument);
+
+            // Cholesky
+            const MatrixView cholesky = random_view(buffer, 150, 150, layout, 7);
+            make_positive_definite(cholesky);
+
+            std::vector<TestType> cholesky_span = packed<TestType>(cholesky);
+            rhs_span                            = packed<TestType>(rhs);
+
+            REQUIRE(LCNS::Algebra::cholesky_factorize(cholesky));
+            REQUIRE(LCNS::Algebra::cholesky_factorize(std::span(cholesky_span)));
+            check_same<TestType>(cholesky, cholesky_span);
+
+            LCNS::Algebra::cholesky_solve<TestType>(cholesky, rhs);
+            LCNS::Algebra::cholesky_solve<TestType>(cholesky_span, rhs_span, 3);
+            check_same<TestType>(rhs, rhs_span);
+
+            const MatrixView inverse = random_view(buffer, 150, 150, layout, 8);
+            make_positive_definite(inverse);
+
+            std::vector<TestType> inverse_span = packed<TestType>(inverse);
+
+            REQUIRE(LCNS::Algebra::cholesky_inverse(inverse));
+            REQUIRE(LCNS::Algebra::cholesky_inverse(std::span(inverse_span)));
+            check_same<TestType>(inverse, inverse_span);
+
+            CHECK_THROWS_AS(LCNS::Algebra::cholesky_factorize(cholesky.block(0, 0, 150, 149)), std::invalid_argument);
+
+            // QR
+            const MatrixView qr = random_view(buffer, 90, 70, layout, 9);
+            const MatrixView b  = random_view(rhs_buffer, 90, 2, layout, 10);
+
+            std::vector<TestType> qr_span = packed<TestType>(qr);
+            std::vector<TestType> b_span  = packed<TestType>(b);
+            std::vector<TestType> tau(70);
+            std::vector<TestType> span_tau(70);
+
+            LCNS::Algebra::qr_factorize(qr, tau);
+            LCNS::Algebra::qr_factorize(std::span(qr_span), 70, std::span(span_tau));
+            check_same<TestType>(qr, qr_span);
+
+            REQUIRE(LCNS::Algebra::qr_solve<TestType>(qr, tau, b));
+            REQUIRE(LCNS::Algebra::qr_solve<TestType>(qr_span, span_tau, b_span, 2));
+            check_same<TestType>(b, b_span);
+
+            CHECK_THROWS_AS(LCNS::Algebra::qr_factorize(qr.transposed(), tau), std::invalid_argument);
+
+            // Tall skinny least squares, on blocks decomposed in parallel
+            const MatrixView tall   = random_view(buffer, 20000, 8, layout, 11);
+            const MatrixView values = random_view(rhs_buffer, 20000, 2, layout, 12);
+
+            std::vector<TestType> tall_span   = packed<TestType>(tall);
+            std::vector<TestType> values_span = packed<TestType>(values);
+
+            REQUIRE(LCNS::Algebra::least_squares(tall, values));
+            REQUIRE(LCNS::Algebra::least_squares(std::span(tall_span), 8, std::span(values_span), 2));
+            check_same<TestType>(values.block(0, 0, 8, 2), std::vector<TestType>(values_span.begin(), values_span.begin() + 16));
+
+            // Symmetric eigen decompositions
+            const MatrixView symmetric = random_view(buffer, 150, 150, layout, 13);
+            make_positive_definite(symmetric);
+
+            const std::vector<TestType> symmetric_span = packed<TestType>(symmetric);
+            std::vector<TestType>       eigen_span     = symmetric_span;
+            std::vector<TestType>       eigenvalues(150);
+            std::vector<TestType>       span_eigenvalues(150);
+
+            std::vector<TestType> lanczos_buffer;
+            const MatrixView      eigenvectors = random_view(lanczos_buffer, 150, 3, layout, 14);
+            std::vector<TestType> lanczos_values(3);
+            std::vector<TestType> span_lanczos_values(3);
+            std::vector<TestType> span_eigenvectors(150 * 3);
+
+            REQUIRE(LCNS::Algebra::eigen_symmetric_lanczos<TestType>(symmetric, lanczos_values, eigenvectors));
+            REQUIRE(LCNS::Algebra::eigen_symmetric_lanczos<TestType>(symmetric_span, span_lanczos_values, span_eigenvectors));
+            check_same<TestType>(MatrixView<const TestType>(lanczos_values.data(), 1, 3, 3), span_lanczos_values);
+            check_same<TestType>(eigenvectors, span_eigenvectors, true);
+
+            REQUIRE(LCNS::Algebra::eigen_symmetric(symmetric, eigenvalues));
+            REQUIRE(LCNS::Algebra::eigen_symmetric(std::span(eigen_span), std::span(span_eigenvalues)));
+            check_same<TestType>(MatrixView<const TestType>(eigenvalues.data(), 1, 150, 150), span_eigenvalues);
+            check_same<TestType>(symmetric, eigen_span, true);
+
+            CHECK_THROWS_AS(LCNS::Algebra::eigen_symmetric(symmetric, std::span(eigenvalues).first(149)), std::invalid_argument);
+            CHECK_THROWS_AS(LCNS::Algebra::eigen_symmetric_lanczos<TestType>(symmetric, lanczos_values, eigenvectors.block(0, 0, 150, 2)),
+                            std::invalid_argument);
+        }
+    }
+
+    SECTION("Randomized singular value decomposition")
+    {
+        // A matrix of rank 4, whose 3 largest singular values the randomized range finder gets exactly
+        for (const Layout layout : layouts)
+        {
+            std::vector<TestType> buffer;
+            std::vector<TestType> u_buffer;
+            std::vector<TestType> v_buffer;
+
+            const MatrixView a = random_view(buffer, 60, 40, layout, 15);
+            const MatrixView u = random_view(u_buffer, 60, 3, layout, 16);
+            const MatrixView v = random_view(v_buffer, 40, 3, layout, 17);
+
+            for (size_t i = 0; i < 60; ++i)
+            {
+                for (size_t j = 0; j < 40; ++j)
+                {
+                    double value = 0;
+
+                    for (size_t k = 1; k <= 4; ++k)
+                    {
+                        value += std::sin(static_cast<double>(k * (i + 1))) * std::cos(static_cast<double>(k * k * (j + 2))) / static_cast<double>(k);
+                    }
+
+                    a(i, j) = static_cast<TestType>(value);
+                }
+            }
+
+            const std::vector<TestType> a_span = packed<TestType>(a);
+            std::vector<TestType>       sigma(3);
+            std::vector<TestType>       span_sigma(3);
+            std::vector<TestType>       span_u(60 * 3);
+            std::vector<TestType>       span_v(40 * 3);
+
+            REQUIRE(LCNS::Algebra::randomized_svd<TestType>(a, u, sigma, v));
+            REQUIRE(LCNS::Algebra::randomized_svd<TestType>(a_span, 40, span_u, span_sigma, span_v));
+
+            const TestType tolerance = 1000 * std::numeric_limits<TestType>::epsilon();
+
+            for (size_t l = 0; l < 3; ++l)
+            {
+                CHECK(sigma[l] == Catch::Approx(span_sigma[l]).epsilon(tolerance));
+
+                // A * v_l = sigma_l * u_l
+                for (size_t i = 0; i < 60; ++i)
+                {
+                    double product = 0;
+
+                    for (size_t j = 0; j < 40; ++j)
+                    {
+                        product += static_cast<double>(a(i, j)) * v(j, l);
+                    }
+
+                    REQUIRE(product == Catch::Approx(sigma[l] * u(i, l)).margin(tolerance * sigma[0]));
+                }
+            }
+
+            CHECK_THROWS_AS(LCNS::Algebra::randomized_svd<TestType>(a, u, sigma, v.block(0, 0, 39, 3)), std::invalid_argument);
+            CHECK_THROWS_AS(LCNS::Algebra::randomized_svd<TestType>(a, u.block(0, 0, 60, 2), sigma, v.block(0, 0, 40, 2)),
+                            std::invalid_argument);
+        }
+    }
+
+#ifdef __cpp_lib_mdspan
+    SECTION("Mdspans")
+    {
+        std::vector<TestType> buffer(12);
+
+        for (size_t k = 0; k < 12; ++k)
+        {
+            buffer[k] = static_cast<TestType>(k);
+        }
+
+        const std::mdspan<TestType, std::dextents<size_t, 2>, std::layout_left> column_major(buffer.data(), 3, 4);
+
+        const MatrixView<TestType> view(column_major);
+        CHECK(view.rowStride() == 1);
+        CHECK(view.colStride() == 3);
+        CHECK(view(2, 1) == 5);
+
+        const auto transposed = view.transposed().toMdspan();
+        CHECK(transposed.extent(0) == 4);
+        CHECK(transposed.data_handle()[transposed.mapping()(1, 2)] == 5);
+    }
+#endif
+}
@@ -8,10 +8,14 @@
 
 #include <random>
 #include <algorithm>
+#include <span>
 #include <type_traits>
+#include <vector>
 
 using LCNS::Algebra::Matrix;
+using LCNS::Algebra::MatrixView;
 using LCNS::Algebra::multiply_concurrently;
+using LCNS::Algebra::StorageOrder;
 
 using Catch::Matchers::WithinAbs;
 
@@ -24,10 +28,10 @@ using namespace std;
 
 namespace
 {
-    template <Coordinate coordinate, unsigned int rows, unsigned int cols>
-    Matrix<coordinate, rows, cols> generate_random_matrix(coordinate min, coordinate max)
+    template <Coordinate coordinate, unsigned int rows, unsigned int cols, StorageOrder order = StorageOrder::RowMajor>
+    Matrix<coordinate, rows, cols, order> generate_random_matrix(coordinate min, coordinate max)
     {
-        Matrix<coordinate, rows, cols> result;
+        Matrix<coordinate, rows, cols, order> result;
 
         std::random_device rd;
         std::mt19937       gen(rd());
@@ -127,6 +131,82 @@ TEMPLATE_LIST_TEST_CASE("Test multiplication with multithreading", "[test][algeb
     }
 }
 
+TEMPLATE_LIST_TEST_CASE("Test column major multiplication with multithreading", "[test][algebra][multiplication][multithreading]", TestTypeAll)
+{
+    const TestType min = 0;
+    const TestType max = is_floating_point_v<TestType> ? 1.0 : 10.0;
+
+    const auto lhs = generate_random_matrix<TestType, 67, 41, StorageOrder::ColumnMajor>(min, max);
+    const auto rhs = generate_random_matrix<TestType, 41, 23, StorageOrder::ColumnMajor>(min, max);
+
+    const auto res1 = Matrix<TestType, 67, 41>(lhs) * Matrix<TestType, 41, 23>(rhs);
+    const auto res2 = multiply_concurrently(lhs, rhs);
+
+    static_assert(is_same_v<decltype(res2), const Matrix<TestType, 67, 23, StorageOrder::ColumnMajor>>);
+
+    for (size_t i = 0u; i < 67; ++i)
+    {
+        for (size_t j = 0u; j < 23; ++j)
+        {
+            if constexpr (is_integral_v<TestType>)
+            {
+                CHECK(res1(i, j) == res2(i, j));
+            }
+            else
+            {
+                CHECK_THAT(res1(i, j), WithinAbs(res2(i, j), 1e-4));
+            }
+        }
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Test multiplication of views with multithreading", "[test][algebra][multiplication][multithreading]", TestTypeAll)
+{
+    const TestType min = 0;
+    const TestType max = is_floating_point_v<TestType> ? 1.0 : 10.0;
+
+    const auto lhs = generate_random_matrix<TestType, 67, 41>(min, max);
+    const auto rhs = generate_random_matrix<TestType, 50, 30, StorageOrder::ColumnMajor>(min, max);
+
+    Matrix<TestType, 41, 23> rhs_block;
+    for (size_t i = 0u; i < 41; ++i)
+    {
+        for (size_t j = 0u; j < 23; ++j)
+        {
+            rhs_block(i, j) = rhs(i + 3, j + 5);
+        }
+    }
+
+    const auto res1 = lhs * rhs_block;
+
+    // The rows of the transpose of a transpose are not contiguous and are copied, the columns of the block are read in place
+    const auto                       lhs_transposed = lhs.transposed();
+    const MatrixView<const TestType> lhs_view       = MatrixView(lhs_transposed).transposed();
+    const MatrixView<const TestType> rhs_view       = MatrixView(rhs).block(3, 5, 41, 23);
+
+    // The product is stored by columns
+    std::vector<TestType>      res2(67 * 23);
+    const MatrixView<TestType> res2_view(res2.data(), 67, 23, 1, 67);
+    multiply_concurrently<TestType>(lhs_view, rhs_view, res2_view);
+
+    for (size_t i = 0u; i < 67; ++i)
+    {
+        for (size_t j = 0u; j < 23; ++j)
+        {
+            if constexpr (is_integral_v<TestType>)
+            {
+                CHECK(res1(i, j) == res2[j * 67 + i]);
+            }
+            else
+            {
+                CHECK_THAT(res1(i, j), WithinAbs(res2[j * 67 + i], 1e-4));
+            }
+        }
+    }
+
+    CHECK_THROWS_AS(multiply_concurrently<TestType>(lhs_view, lhs_view, res2_view), std::invalid_argument);
+}
+
 #ifdef AVX_ENABLED_ON_CPU
 
 TEMPLATE_LIST_TEST_CASE("Test floating multiplication with simd", "[test][algebra][multiplication][simd]", TestTypeFloating)
@@ -192,6 +272,76 @@ TEMPLATE_LIST_TEST_CASE("Test integer multiplication with simd", "[test][algebra
     }
 }
 
+TEMPLATE_LIST_TEST_CASE("Test column major multiplication with simd", "[test][algebra][multiplication][simd]", TestTypeFloating)
+{
+    const TestType min = 0.0;
+    const TestType max = 1.0;
+
+    const auto lhs = generate_random_matrix<TestType, 17, 22, StorageOrder::ColumnMajor>(min, max);
+    const auto rhs = generate_random_matrix<TestType, 22, 15, StorageOrder::ColumnMajor>(min, max);
+
+    const auto res1 = lhs * rhs;
+    const auto res2 = multiply_simd(lhs, rhs);
+    const auto res3 = multiply_concurrently_simd(lhs, rhs);
+
+    for (size_t i = 0u; i < 17; ++i)
+    {
+        for (size_t j = 0u; j < 15; ++j)
+        {
+            CHECK_THAT(res1(i, j), WithinAbs(res2(i, j), precision<TestType>()));
+            CHECK_THAT(res1(i, j), WithinAbs(res3(i, j), precision<TestType>()));
+        }
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Test multiplication of views with simd", "[test][algebra][multiplication][simd]", TestTypeFloating)
+{
+    using LCNS::Algebra::multiply_concurrently_simd;
+    using LCNS::Algebra::multiply_simd;
+
+    const TestType min = 0.0;
+    const TestType max = 1.0;
+
+    const auto lhs = generate_random_matrix<TestType, 67, 41>(min, max);
+    const auto rhs = generate_random_matrix<TestType, 50, 30, StorageOrder::ColumnMajor>(min, max);
+
+    Matrix<TestType, 41, 23> rhs_block;
+    for (size_t i = 0u; i < 41; ++i)
+    {
+        for (size_t j = 0u; j < 23; ++j)
+        {
+            rhs_block(i, j) = rhs(i + 3, j + 5);
+        }
+    }
+
+    const auto res1 = lhs * rhs_block;
+
+    // The rows of the transpose of a transpose are not contiguous and are copied, the columns of the block are read in place
+    const auto                       lhs_transposed = lhs.transposed();
+    const MatrixView<const TestType> lhs_view       = MatrixView(lhs_transposed).transposed();
+    const MatrixView<const TestType> rhs_view       = MatrixView(rhs).block(3, 5, 41, 23);
+
+    // The products are stored by columns
+    std::vector<TestType>      res2(67 * 23);
+    std::vector<TestType>      res3(67 * 23);
+    const MatrixView<TestType> res2_view(res2.data(), 67, 23, 1, 67);
+    const MatrixView<TestType> res3_view(res3.data(), 67, 23, 1, 67);
+    multiply_simd<TestType>(lhs_view, rhs_view, res2_view);
+    multiply_concurrently_simd<TestType>(lhs_view, rhs_view, res3_view);
+
+    for (size_t i = 0u; i < 67; ++i)
+    {
+        for (size_t j = 0u; j < 23; ++j)
+        {
+            CHECK_THAT(res1(i, j), WithinAbs(res2[j * 67 + i], precision<TestType>()));
+            CHECK_THAT(res1(i, j), WithinAbs(res3[j * 67 + i], precision<TestType>()));
+        }
+    }
+
+    CHECK_THROWS_AS(multiply_simd<TestType>(lhs_view, lhs_view, res2_view), std::invalid_argument);
+    CHECK_THROWS_AS(multiply_concurrently_simd<TestType>(lhs_view, lhs_view, res3_view), std::invalid_argument);
+}
+
 TEMPLATE_LIST_TEST_CASE("Test floating multiplication with multithreading and simd",
                         "[test][algebra][multiplication][multithreading][simd]",
                         TestTypeFloating)
@@ -227,3 +377,42 @@ TEMPLATE_LIST_TEST_CASE("Test floating multiplication with multithreading and si
 }
 
 #endif
+
+TEMPLATE_LIST_TEST_CASE("Test blocked multiplication", "[test][algebra][multiplication][blocked]", TestTypeFloating)
+{
+    using LCNS::Algebra::multiply_blocked;
+
+    const TestType min = 0.0;
+    const TestType max = 1.0;
+
+    // Sizes that are not multiples of the tiles or of the SIMD widths
+    const auto lhs = generate_random_matrix<TestType, 171, 229>(min, max);
+    const auto rhs = generate_random_matrix<TestType, 229, 539>(min, max);
+
+    const auto res1 = lhs * rhs;
+    const auto res2 = multiply_blocked(lhs, rhs);
+    const auto res3 = multiply_blocked(Matrix<TestType, 171, 229, StorageOrder::ColumnMajor>(lhs), Matrix<TestType, 229, 539, StorageOrder::ColumnMajor>(rhs));
+
+    std::vector<TestType> res4(171 * 539);
+    multiply_blocked<TestType>(171, 229, 539, std::span(lhs.data(), 171 * 229), std::span(rhs.data(), 229 * 539), res4);
+
+    // Views on the transposes of the operands, the product being stored by columns
+    const auto            lhs_transposed = lhs.transposed();
+    const auto            rhs_transposed = rhs.transposed();
+    std::vector<TestType> res5(171 * 539);
+    const MatrixView<TestType> res5_view(res5.data(), 171, 539, 1, 171);
+    multiply_blocked<TestType>(MatrixView(lhs_transposed).transposed(), MatrixView(rhs_transposed).transposed(), res5_view);
+
+    for (size_t i = 0u; i < 171; ++i)
+    {
+        for (size_t j = 0u; j < 539; ++j)
+        {
+            CHECK_THAT(res2(i, j), WithinAbs(res1(i, j), precision<TestType>() * 100));
+            CHECK_THAT(res3(i, j), WithinAbs(res1(i, j), precision<TestType>() * 100));
+            CHECK(res4[i * 539 + j] == res2(i, j));
+            CHECK_THAT(res5[j * 171 + i], WithinAbs(res1(i, j), precision<TestType>() * 100));
+        }
+    }
+
+    CHECK_THROWS_AS(multiply_blocked<TestType>(171, 229, 538, std::span(lhs.data(), 171 * 229), std::span(rhs.data(), 229 * 539), res4), std::invalid_argument);
+}
@@ -8,6 +8,7 @@
 #include <numbers>
 
 using Catch::Generators::random;
+using LCNS::Algebra::Precision;
 using LCNS::Algebra::Quaternion;
 
 using IntegerTypes  = std::tuple<short, int, long>;
@@ -561,6 +562,23 @@ TEMPLATE_LIST_TEST_CASE("Hamilton product", "[algebra][quat][operator]", Floatin
     CHECK(std::abs(hamiltonProduct.y() - resY) < epsilon);
     CHECK(std::abs(hamiltonProduct.z() - resZ) < epsilon);
     CHECK(std::abs(hamiltonProduct.w() - resW) < epsilon);
+
+    // Not constant evaluated, uses the SIMD implementation if available
+    const Quaternion<TestType> lhs(x1, y1, z1, w1);
+    const Quaternion<TestType> rhs(x2, y2, z2, w2);
+    const auto                 product = lhs * rhs;
+
+    CHECK(std::abs(product.x() - resX) < epsilon);
+    CHECK(std::abs(product.y() - resY) < epsilon);
+    CHECK(std::abs(product.z() - resZ) < epsilon);
+    CHECK(std::abs(product.w() - resW) < epsilon);
+
+    const auto conjugated_product = rhs.conjugated() * lhs.conjugated();
+
+    CHECK(std::abs(conjugated_product.x() + resX) < epsilon);
+    CHECK(std::abs(conjugated_product.y() + resY) < epsilon);
+    CHECK(std::abs(conjugated_product.z() + resZ) < epsilon);
+    CHECK(std::abs(conjugated_product.w() - resW) < epsilon);
 }
 
 TEMPLATE_LIST_TEST_CASE("Scalar multiplication operator", "[algebra][quat][operator]", IntegerTypes)
@@ -888,7 +906,7 @@ TEMPLATE_LIST_TEST_CASE("Square length", "[algebra][quat][accessor]", FloatingTy
 
     constexpr auto epsilon = std::numeric_limits<TestType>::epsilon() * 100;
 
-    static_assert(std::abs(quat.sqrLength() - 72366.41) < epsilon);
+    static_assert(std::abs(quat.sqrLength() - 72366.41) < epsilon * 72366.41);
 
     const auto approxSqrLength = Catch::Approx(72366.41).epsilon(epsilon);
 
@@ -918,7 +936,7 @@ TEMPLATE_LIST_TEST_CASE("Length", "[algebra][quat][accessor]", FloatingTypes)
 
     const Quaternion<TestType> quat(x, y, z, w);
 
-    const auto approxLength = Catch::Approx(269.0105553691).epsilon(1e-9);
+    const auto approxLength = Catch::Approx(269.0105553691).epsilon(1e-6);
 
     CHECK(quat.length() == approxLength);
 }
@@ -953,6 +971,30 @@ TEMPLATE_LIST_TEST_CASE("Normalized", "[algebra][quat][accessor]", FloatingTypes
     CHECK(normalized.length() == one);
 }
 
+TEMPLATE_LIST_TEST_CASE("Fast normalize", "[algebra][quat][accessor]", FloatingTypes)
+{
+    const TestType x = -69.0;
+    const TestType y = 260.0;
+    const TestType z = 1e-3;
+    const TestType w = 17.3;
+
+    const Quaternion<TestType> quat(x, y, z, w);
+    const Quaternion<TestType> exact = quat.normalized();
+    const Quaternion<TestType> fast  = quat.normalized(Precision::Fast);
+
+    static_assert(std::is_same_v<decltype(quat.sqrLength()), TestType>);
+
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        CHECK(fast[i] == Catch::Approx(exact[i]).epsilon(1e-6));
+    }
+
+    Quaternion<TestType> null;
+    null.normalize(Precision::Fast);
+
+    CHECK(null.isNull());
+}
+
 TEMPLATE_LIST_TEST_CASE("Is null?", "[algebra][quat][method]", IntegerTypes)
 {
     constexpr TestType x    = 3;
@@ -1096,3 +1138,80 @@ TEMPLATE_LIST_TEST_CASE("Conjugate", "[algebra][quat][method]", FloatingTypes)
     CHECK(quat.z() == z2);
     CHECK(quat.w() == w2);
 }
+
+TEMPLATE_LIST_TEST_CASE("Rotate a vector", "[algebra][quat][method]", FloatingTypes)
+{
+    using LCNS::Algebra::Vector;
+
+    // Rotation of pi/2 around z
+    constexpr TestType half_sqrt2 = static_cast<TestType>(0.70710678118654752440);
+    constexpr TestType zero       = 0.0;
+    constexpr TestType one        = 1.0;
+
+    constexpr Quaternion<TestType> around_z(zero, zero, half_sqrt2, half_sqrt2);
+    constexpr Vector<TestType, 3>  x_axis(one, zero, zero);
+
+    constexpr auto rotated = around_z.rotate(x_axis);
+
+    CHECK(rotated.x() == Catch::Approx(0.0).margin(1e-6));
+    CHECK(rotated.y() == Catch::Approx(1.0));
+    CHECK(rotated.z() == Catch::Approx(0.0).margin(1e-6));
+
+    const TestType min = -10.0;
+    const TestType max = 10.0;
+
+    const auto quat = Quaternion<TestType>(random(min, max).get(), random(min, max).get(), random(min, max).get(), random(min, max).get()).normalized();
+    const auto vec  = Vector<TestType, 3>(random(min, max).get(), random(min, max).get(), random(min, max).get());
+
+    // Reference computed with two Hamilton products
+    const auto expected = quat * Quaternion<TestType>(vec.x(), vec.y(), vec.z(), zero) * quat.conjugated();
+    const auto result   = quat.rotate(vec);
+
+    CHECK(result.x() == Catch::Approx(expected.x()).epsilon(1e-4).margin(1e-4));
+    CHECK(result.y() == Catch::Approx(expected.y()).epsilon(1e-4).margin(1e-4));
+    CHECK(result.z() == Catch::Approx(expected.z()).epsilon(1e-4).margin(1e-4));
+    CHECK(result.length() == Catch::Approx(vec.length()).epsilon(1e-4));
+}
+
+TEMPLATE_LIST_TEST_CASE("Slerp and nlerp", "[algebra][quat][method]", FloatingTypes)
+{
+    using LCNS::Algebra::nlerp;
+    using LCNS::Algebra::slerp;
+
+    constexpr TestType zero = 0.0;
+    constexpr TestType half = 0.5;
+    constexpr TestType one  = 1.0;
+
+    // Rotations of 0 and pi/2 around z
+    const Quaternion<TestType> identity(zero, zero, zero, one);
+    const Quaternion<TestType> quarter_turn(zero, zero, static_cast<TestType>(std::sin(pi / 4.0)), static_cast<TestType>(std::cos(pi / 4.0)));
+
+    CHECK(slerp(identity, quarter_turn, zero).w() == Catch::Approx(1.0));
+    CHECK(slerp(identity, quarter_turn, one).z() == Catch::Approx(quarter_turn.z()));
+
+    // Halfway is the rotation of pi/4 around z, for both interpolations since the path is the same
+    const auto slerp_half = slerp(identity, quarter_turn, half);
+    const auto nlerp_half = nlerp(identity, quarter_turn, half);
+
+    CHECK(slerp_half.z() == Catch::Approx(std::sin(pi / 8.0)));
+    CHECK(slerp_half.w() == Catch::Approx(std::cos(pi / 8.0)));
+    CHECK(nlerp_half.z() == Catch::Approx(std::sin(pi / 8.0)));
+    CHECK(nlerp_half.w() == Catch::Approx(std::cos(pi / 8.0)));
+
+    // Constant angular velocity: a quarter of the way is the rotation of pi/8 around z
+    const auto slerp_quarter = slerp(identity, quarter_turn, static_cast<TestType>(0.25));
+
+    CHECK(slerp_quarter.z() == Catch::Approx(std::sin(pi / 16.0)));
+    CHECK(slerp_quarter.w() == Catch::Approx(std::cos(pi / 16.0)));
+
+    // -quarter_turn is the same rotation, the shortest path gives the same result
+    const auto opposite = slerp(identity, quarter_turn * TestType{-1}, half);
+
+    CHECK(opposite.z() == Catch::Approx(slerp_half.z()));
+    CHECK(opposite.w() == Catch::Approx(slerp_half.w()));
+
+    // Almost equal quaternions fall back to nlerp
+    const auto close = slerp(identity, identity, half);
+
+    CHECK(close.w() == Catch::Approx(1.0));
+}
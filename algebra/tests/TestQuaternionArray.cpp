@@ -0,0 +1,377 @@
+#include "algebra/Algebra.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using LCNS::Algebra::Quaternion;
+using LCNS::Algebra::QuaternionArray;
+using LCNS::Algebra::Vector;
+using LCNS::Algebra::VectorArray;
+
+using FloatingTypes = std::tuple<float, double>;
+
+namespace
+{
+    template <Coordinate coordinate>
+    std::vector<Vector<coordinate, 3>> generate_random_vectors(size_t count)
+    {
+        std::mt19937                               gen(3);
+        std::uniform_real_distribution<coordinate> dis(-10.0, 10.0);
+
+        std::vector<Vector<coordinate, 3>> result(count);
+
+        for (auto& vec : result)
+        {
+            vec = Vector<coordinate, 3>(dis(gen), dis(gen), dis(gen));
+        }
+
+        return result;
+    }
+
+    template <Coordinate coordinate>
+    std::vector<Quaternion<coordinate>> generate_random_rotations(size_t count)
+    {
+        std::mt19937                               gen(5);
+        std::uniform_real_distribution<coordinate> dis(-1.0, 1.0);
+
+        std::vector<Quaternion<coordinate>> result(count);
+
+        for (auto& quat : result)
+        {
+            quat = Quaternion<coordinate>(dis(gen), dis(gen), dis(gen), dis(gen)).normalized();
+        }
+
+        return result;
+    }
+
+    template <Coordinate coordinate>
+    void check_vectors(const std::vector<Vector<coordinate, 3>>& actual, const std::vector<Vector<coordinate, 3>>& expected)
+    {
+        REQUIRE(actual.size() == expected.size());
+
+        for (size_t i = 0; i < actual.size(); ++i)
+        {
+            for (unsigned int k = 0; k < 3; ++k)
+            {
+                CHECK(actual[i][k] == Catch::Approx(expected[i][k]).epsilon(1e-4).margin(1e-4));
+            }
+        }
+    }
+
+    // Odd counts exercise the scalar tail after the SIMD loop, the large one the multithreaded path
+    constexpr std::array<size_t, 3> counts = {0, 23, (1 << 17) + 1};
+}  // namespace
+
+TEMPLATE_LIST_TEST_CASE("Quaternion array conversion", "[algebra][quat][batch]", FloatingTypes)
+{
+    const auto rotations = generate_random_rotations<TestType>(19);
+
+    const QuaternionArray<TestType> array(rotations);
+
+    REQUIRE(array.count() == rotations.size());
+    CHECK(array[7] == rotations[7]);
+    CHECK(array.lane(3)[7] == rotations[7].w());
+    CHECK(array.toQuaternions() == rotations);
+    CHECK_THROWS_AS(array[19], std::out_of_range);
+}
+
+TEMPLATE_LIST_TEST_CASE("Batched rotation by one quaternion", "[algebra][quat][batch]", FloatingTypes)
+{
+    const auto rotation = generate_random_rotations<TestType>(1).front();
+
+    for (const auto count : counts)
+    {
+        const auto vectors = generate_random_vectors<TestType>(count);
+
+        std::vector<Vector<TestType, 3>> expected(count);
+        std::transform(vectors.begin(), vectors.end(), expected.begin(), [&](const auto& vec) { return rotation.rotate(vec); });
+
+        std::vector<Vector<TestType, 3>> result(count);
+        LCNS::Algebra::rotate(rotation, vectors, result);
+        check_vectors(result, expected);
+
+        VectorArray<TestType, 3> array(vectors);
+        LCNS::Algebra::rotate(rotation, array, array);
+        check_vectors(array.toVectors(), expected);
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Batched rotation by an array of quaternions", "[algebra][quat][batch]", FloatingTypes)
+{
+    for (const auto count : counts)
+    {
+        const auto vectors   = generate_random_vectors<TestType>(count);
+        const auto rotations = generate_random_rotations<TestType>(count);
+
+        std::vector<Vector<TestType, 3>> expected(count);
+        std::transform(vectors.begin(), vectors.end(), rotations.begin(), expected.begin(), [](const auto& vec, const auto& quat) { return quat.rotate(vec); });
+
+        const QuaternionArray<TestType> rotation_array(rotations);
+        VectorArray<TestType, 3>        array(vectors);
+        LCNS::Algebra::rotate(rotation_array, array, array);
+        check_vectors(array.toVectors(), expected);
+    }
+
+    const QuaternionArray<TestType> rotation_array(3);
+    VectorArray<TestType, 3>        array(4);
+
+    CHECK_THROWS_AS(LCNS::Algebra::rotate(rotation_array, array, array), std::invalid_argument);
+}
+
+TEMPLATE_LIST_TEST_CASE("Batched Hamilton product", "[algebra][quat][batch]", FloatingTypes)
+{
+    for (const auto count : counts)
+    {
+        const auto lhs = generate_random_rotations<TestType>(count);
+        auto       rhs = generate_random_rotations<TestType>(count + 1);
+        rhs.erase(rhs.begin());
+
+        const QuaternionArray<TestType> lhs_array(lhs);
+        QuaternionArray<TestType>       rhs_array(rhs);
+
+        // In place, the result replaces rhs
+        LCNS::Algebra::multiply(lhs_array, rhs_array, rhs_array);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const auto expected = lhs[i] * rhs[i];
+            const auto result   = rhs_array[i];
+
+            for (unsigned int k = 0; k < 4; ++k)
+            {
+                CHECK(result[k] == Catch::Approx(expected[k]).epsilon(1e-4).margin(1e-5));
+            }
+        }
+    }
+
+    const QuaternionArray<TestType> lhs_array(3);
+    QuaternionArray<TestType>       rhs_array(4);
+
+    CHECK_THROWS_AS(LCNS::Algebra::multiply(lhs_array, rhs_array, rhs_array), std::invalid_argument);
+}
+
+TEMPLATE_LIST_TEST_CASE("Batched length and normalization", "[algebra][quat][batch]", FloatingTypes)
+{
+    using LCNS::Algebra::Precision;
+
+    for (const auto count : counts)
+    {
+        // Scaled rotations, with a null quaternion at the end for the tail
+        auto quaternions = generate_random_rotations<TestType>(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            quaternions[i] = quaternions[i] * static_cast<TestType>(1 + i % 50);
+        }
+        if (count != 0)
+        {
+            quaternions.back() = Quaternion<TestType>();
+        }
+
+        const QuaternionArray<TestType> array(quaternions);
+        QuaternionArray<TestType>       exact(quaternions);
+        QuaternionArray<TestType>       fast(quaternions);
+
+        std::vector<TestType> sqr_lengths(count);
+        std::vector<TestType> lengths(count);
+        LCNS::Algebra::sqrLength(array, std::span(sqr_lengths));
+        LCNS::Algebra::length(array, std::span(lengths));
+        LCNS::Algebra::normalize(exact);
+        LCNS::Algebra::normalize(fast, Precision::Fast);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            CHECK(sqr_lengths[i] == Catch::Approx(quaternions[i].sqrLength()).epsilon(1e-6));
+            CHECK(lengths[i] == Catch::Approx(quaternions[i].length()).epsilon(1e-6));
+
+            const auto expected = quaternions[i].normalized();
+
+            for (unsigned int k = 0; k < 4; ++k)
+            {
+                CHECK(exact[i][k] == Catch::Approx(expected[k]).epsilon(1e-6));
+                CHECK(fast[i][k] == Catch::Approx(expected[k]).epsilon(1e-6).margin(1e-7));
+            }
+        }
+    }
+
+    const QuaternionArray<TestType> array(3);
+    std::vector<TestType>           lengths(4);
+
+    CHECK_THROWS_AS(LCNS::Algebra::length(array, std::span(lengths)), std::invalid_argument);
+}
+
+TEMPLATE_LIST_TEST_CASE("Batched slerp and nlerp", "[algebra][quat][batch]", FloatingTypes)
+{
+    using LCNS::Algebra::Precision;
+
+    for (const auto count : counts)
+    {
+        const auto from = generate_random_rotations<TestType>(count);
+        auto       to   = generate_random_rotations<TestType>(count + 1);
+        to.erase(to.begin());
+
+        // Add some pairs of almost equal quaternions, for the nlerp fallback of slerp
+        for (size_t i = 0; i < count; i += 7)
+        {
+            to[i] = (from[i] + Quaternion<TestType>(TestType{1e-3}, TestType{0}, TestType{0}, TestType{0})).normalized();
+        }
+
+        std::mt19937                             gen(11);
+        std::uniform_real_distribution<TestType> dis(0.0, 1.0);
+        std::vector<TestType>                    weights(count);
+        std::generate(weights.begin(), weights.end(), [&]() { return dis(gen); });
+
+        const QuaternionArray<TestType> from_array(from);
+        const QuaternionArray<TestType> to_array(to);
+        QuaternionArray<TestType>       fast(count);
+        QuaternionArray<TestType>       exact(count);
+        QuaternionArray<TestType>       normalized(count);
+
+        LCNS::Algebra::slerp(from_array, to_array, weights, fast);
+        LCNS::Algebra::slerp(from_array, to_array, weights, exact, Precision::Exact);
+        LCNS::Algebra::nlerp(from_array, to_array, weights, normalized);
+
+        const double fast_margin = std::is_same_v<TestType, float> ? 2e-6 : 2e-7;
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const auto expected_slerp = LCNS::Algebra::slerp(from[i], to[i], weights[i]);
+            const auto expected_nlerp = LCNS::Algebra::nlerp(from[i], to[i], weights[i]);
+
+            for (unsigned int k = 0; k < 4; ++k)
+            {
+                CHECK(exact[i][k] == expected_slerp[k]);
+                CHECK(fast[i][k] == Catch::Approx(expected_slerp[k]).margin(fast_margin));
+                CHECK(normalized[i][k] == Catch::Approx(expected_nlerp[k]).margin(1e-6));
+            }
+        }
+    }
+
+    const QuaternionArray<TestType> array(3);
+    QuaternionArray<TestType>       result(3);
+    const std::vector<TestType>     weights(2);
+
+    CHECK_THROWS_AS(LCNS::Algebra::slerp(array, array, weights, result), std::invalid_argument);
+    CHECK_THROWS_AS(LCNS::Algebra::slerp(array, array, weights, result, LCNS::Algebra::Precision::Exact), std::invalid_argument);
+    CHECK_THROWS_AS(LCNS::Algebra::nlerp(array, array, weights, result), std::invalid_argument);
+}
+
+TEMPLATE_LIST_TEST_CASE("Batched conversions between rotation matrices, quaternions and Euler angles", "[algebra][quat][batch]", FloatingTypes)
+{
+    using LCNS::Algebra::Matrix;
+
+    const double margin = std::is_same_v<TestType, float> ? 1e-5 : 1e-12;
+
+    for (const auto count : counts)
+    {
+        const auto rotations = generate_random_rotations<TestType>(count);
+
+        std::vector<Matrix<TestType, 3, 3>> matrices(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            matrices[i] = QuaternionAsRotationMatrix(rotations[i]);
+        }
+
+        SECTION("Quaternions to matrices")
+        {
+            // Not normalized: the conversion divides by the squared length
+            QuaternionArray<TestType> scaled(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                scaled.set(i, rotations[i] * TestType{3});
+            }
+
+            std::vector<Matrix<TestType, 3, 3>> result(count);
+            QuaternionsAsRotationMatrices(scaled, std::span(result));
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                for (unsigned int k = 0; k < 9; ++k)
+                {
+                    CHECK(result[i](k / 3, k % 3) == Catch::Approx(matrices[i](k / 3, k % 3)).margin(margin));
+                }
+            }
+        }
+
+        SECTION("Matrices to quaternions")
+        {
+            QuaternionArray<TestType> result(count);
+            RotationMatricesAsQuaternions(std::span<const Matrix<TestType, 3, 3>>(matrices), result);
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                const auto expected = RotationMatrixAsQuaternion(matrices[i]);
+
+                for (unsigned int k = 0; k < 4; ++k)
+                {
+                    CHECK(result[i][k] == Catch::Approx(expected[k]).margin(margin));
+                }
+            }
+        }
+
+        SECTION("Matrices to Euler angles to quaternions")
+        {
+            VectorArray<TestType, 3> angles(count);
+            EulerAnglesFromRotationMatrices(std::span<const Matrix<TestType, 3, 3>>(matrices), angles);
+
+            QuaternionArray<TestType> result(count);
+            EulerAnglesAsQuaternions(angles, result);
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                const auto [psi, theta, phi] = EulerAnglesFromRotationMatrix(matrices[i]);
+
+                CHECK(angles.x()[i] == Catch::Approx(psi).margin(margin));
+                CHECK(angles.y()[i] == Catch::Approx(theta).margin(margin));
+                CHECK(angles.z()[i] == Catch::Approx(phi).margin(margin));
+
+                // Same rotation as the original quaternion, up to the sign
+                const auto     expected = rotations[i];
+                const TestType sign     = (result[i][0] * expected[0] + result[i][1] * expected[1] + result[i][2] * expected[2] + result[i][3] * expected[3]) < 0 ? -1 : 1;
+
+                for (unsigned int k = 0; k < 4; ++k)
+                {
+                    CHECK(result[i][k] == Catch::Approx(sign * expected[k]).margin(margin * 10));
+                }
+            }
+        }
+    }
+
+    SECTION("Gimbal lock")
+    {
+        constexpr TestType zero = 0;
+        constexpr TestType one  = 1;
+        const TestType     cos  = std::cos(TestType{0.3});
+        const TestType     sin  = std::sin(TestType{0.3});
+
+        // Rotations of -pi/2 and pi/2 around y followed by a rotation around x
+        const std::vector<Matrix<TestType, 3, 3>> locked = { Matrix<TestType, 3, 3>({ zero, sin, cos, zero, cos, -sin, -one, zero, zero }),
+                                                             Matrix<TestType, 3, 3>({ zero, -sin, -cos, zero, cos, -sin, one, zero, zero }) };
+
+        VectorArray<TestType, 3> angles(locked.size());
+        EulerAnglesFromRotationMatrices(std::span<const Matrix<TestType, 3, 3>>(locked), angles);
+
+        for (size_t i = 0; i < locked.size(); ++i)
+        {
+            const auto [psi, theta, phi] = EulerAnglesFromRotationMatrix(locked[i]);
+
+            CHECK(angles.x()[i] == Catch::Approx(psi).margin(margin));
+            CHECK(angles.y()[i] == Catch::Approx(theta).margin(margin));
+            CHECK(angles.z()[i] == Catch::Approx(phi).margin(margin));
+        }
+    }
+
+    QuaternionArray<TestType>                 quaternions(3);
+    std::vector<Matrix<TestType, 3, 3>>       matrices(2);
+    std::vector<Matrix<TestType, 3, 3>>       result(2);
+    VectorArray<TestType, 3>                  angles(3);
+
+    CHECK_THROWS_AS(RotationMatricesAsQuaternions(std::span<const Matrix<TestType, 3, 3>>(matrices), quaternions), std::invalid_argument);
+    CHECK_THROWS_AS(QuaternionsAsRotationMatrices(quaternions, std::span(result)), std::invalid_argument);
+    CHECK_THROWS_AS(EulerAnglesFromRotationMatrices(std::span<const Matrix<TestType, 3, 3>>(matrices), angles), std::invalid_argument);
+    CHECK_THROWS_AS(EulerAnglesAsQuaternions(VectorArray<TestType, 3>(2), quaternions), std::invalid_argument);
+}
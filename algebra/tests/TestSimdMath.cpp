@@ -0,0 +1,180 @@
+#include "algebra/SimdMath.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <random>
+#include <vector>
+
+using LCNS::Algebra::ImplementationDetails::ScalarPack;
+using LCNS::Algebra::ImplementationDetails::for_each_pack;
+
+using FloatingTypes = std::tuple<float, double>;
+
+namespace
+{
+    // Wider type used to compute the reference values
+    template <typename T>
+    using Reference = std::conditional_t<std::is_same_v<T, float>, double, long double>;
+
+    /*
+     * Error of value in units in the last place of T, relative to the exact result
+     */
+    template <typename T>
+    double ulp_error(T value, Reference<T> exact)
+    {
+        const T    rounded = static_cast<T>(exact);
+        const auto ulp     = static_cast<Reference<T>>(std::nextafter(std::abs(rounded), std::numeric_limits<T>::infinity())) - std::abs(rounded);
+
+        return static_cast<double>(std::abs(static_cast<Reference<T>>(value) - exact) / ulp);
+    }
+
+    template <typename T>
+    std::vector<T> generate_uniform(size_t count, T min, T max)
+    {
+        std::mt19937                      gen(7);
+        std::uniform_real_distribution<T> dis(min, max);
+
+        std::vector<T> result(count);
+        std::generate(result.begin(), result.end(), [&]() { return dis(gen); });
+
+        return result;
+    }
+
+    /*
+     * Maximum error of function(pack, x), over the inputs, evaluated with SimdPack when available and with ScalarPack
+     */
+    template <typename T, typename Function, typename Exact>
+    double max_ulp_error(const std::vector<T>& inputs, const Function& function, const Exact& exact)
+    {
+        std::vector<T> packed(inputs.size());
+        std::vector<T> scalar(inputs.size());
+
+        for_each_pack<T>(0,
+                         inputs.size(),
+                         [&](auto pack, size_t i)
+                         {
+                             using simd = decltype(pack);
+                             simd::store(packed.data() + i, function(pack, simd::load(inputs.data() + i)));
+                         });
+
+        for (size_t i = 0; i < inputs.size(); ++i)
+        {
+            scalar[i] = function(ScalarPack<T>{}, inputs[i]);
+        }
+
+        double result = 0.0;
+
+        for (size_t i = 0; i < inputs.size(); ++i)
+        {
+            const auto expected = exact(static_cast<Reference<T>>(inputs[i]));
+
+            result = std::max({ result, ulp_error(packed[i], expected), ulp_error(scalar[i], expected) });
+        }
+
+        return result;
+    }
+
+    constexpr size_t sample_count = 100'003;
+
+    // Error bounds of SimdMath.hpp, which depend on the availability of fused multiply-add instructions
+    constexpr double max_error([[maybe_unused]] double with_fma, [[maybe_unused]] double without_fma)
+    {
+#if defined(AVX512_ENABLED) || defined(__FMA__)
+        return with_fma;
+#else
+        return without_fma;
+#endif
+    }
+}  // namespace
+
+TEMPLATE_LIST_TEST_CASE("Sine and cosine", "[algebra][simdmath]", FloatingTypes)
+{
+    using namespace LCNS::Algebra::ImplementationDetails;
+
+    const auto sin = [](auto pack, auto x) { return sin_simd<TestType, decltype(pack)>(x); };
+    const auto cos = [](auto pack, auto x) { return cos_simd<TestType, decltype(pack)>(x); };
+
+    for (const TestType range : { TestType{4}, TestType{100}, TestType{1e4} })
+    {
+        const auto inputs = generate_uniform<TestType>(sample_count, -range, range);
+
+        const auto sin_error = max_ulp_error(inputs, sin, [](auto x) { return std::sin(x); });
+        const auto cos_error = max_ulp_error(inputs, cos, [](auto x) { return std::cos(x); });
+
+        CHECK(sin_error <= max_error(2, 4));
+        CHECK(cos_error <= max_error(2, 4));
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Inverse trigonometric functions", "[algebra][simdmath]", FloatingTypes)
+{
+    using namespace LCNS::Algebra::ImplementationDetails;
+
+    const auto asin = [](auto pack, auto x) { return asin_simd<TestType, decltype(pack)>(x); };
+    const auto acos = [](auto pack, auto x) { return acos_simd<TestType, decltype(pack)>(x); };
+
+    auto inputs = generate_uniform<TestType>(sample_count, -1, 1);
+    inputs.insert(inputs.end(), { TestType{-1}, TestType{1}, TestType{0}, TestType{0.5}, std::nextafter(TestType{1}, TestType{0}) });
+
+    const auto asin_error = max_ulp_error(inputs, asin, [](auto x) { return std::asin(x); });
+    const auto acos_error = max_ulp_error(inputs, acos, [](auto x) { return std::acos(x); });
+
+    // atan2 in all the quadrants: y / x covers the full range of the reduction
+    const auto y_values = generate_uniform<TestType>(sample_count, -10, 10);
+    const auto x_values = generate_uniform<TestType>(sample_count + 1, -10, 10);
+
+    std::vector<TestType> result(sample_count);
+
+    for_each_pack<TestType>(0,
+                            sample_count,
+                            [&](auto pack, size_t i)
+                            {
+                                using simd = decltype(pack);
+                                simd::store(result.data() + i,
+                                            atan2_simd<TestType, simd>(simd::load(y_values.data() + i), simd::load(x_values.data() + i + 1)));
+                            });
+
+    double atan2_error = 0.0;
+    for (size_t i = 0; i < sample_count; ++i)
+    {
+        const auto y = static_cast<Reference<TestType>>(y_values[i]);
+        const auto x = static_cast<Reference<TestType>>(x_values[i + 1]);
+
+        atan2_error = std::max(atan2_error, ulp_error(result[i], std::atan2(y, x)));
+    }
+
+    CHECK(asin_error <= 4);
+    CHECK(acos_error <= 4);
+    CHECK(atan2_error <= 4);
+}
+
+TEMPLATE_LIST_TEST_CASE("Exponential and reciprocal square root", "[algebra][simdmath]", FloatingTypes)
+{
+    using namespace LCNS::Algebra::ImplementationDetails;
+
+    const auto exp   = [](auto pack, auto x) { return exp_simd<TestType, decltype(pack)>(x); };
+    const auto rsqrt = [](auto pack, auto x) { return rsqrt_simd<TestType, decltype(pack)>(x); };
+
+    const TestType max_log = std::is_same_v<TestType, float> ? 88 : 709;
+    const TestType min_log = std::is_same_v<TestType, float> ? -87 : -708;
+
+    const auto exp_error = max_ulp_error(generate_uniform<TestType>(sample_count, min_log, max_log), exp, [](auto x) { return std::exp(x); });
+
+    auto rsqrt_inputs = generate_uniform<TestType>(sample_count, 0, 4);
+    std::ranges::transform(rsqrt_inputs, rsqrt_inputs.begin(), [](TestType x) { return std::ldexp(TestType{1} + x, static_cast<int>(x * 20) - 40); });
+
+    const auto rsqrt_error = max_ulp_error(rsqrt_inputs, rsqrt, [](auto x) { return 1 / std::sqrt(x); });
+
+    CHECK(exp_error <= max_error(1, 2));
+
+#if defined(AVX_ENABLED_ON_CPU) && !defined(AVX512_ENABLED)
+    CHECK(rsqrt_error <= (std::is_same_v<TestType, float> ? 4 : 2));
+#else
+    CHECK(rsqrt_error <= 2);
+#endif
+}
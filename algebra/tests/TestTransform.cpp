@@ -0,0 +1,194 @@
+#include "algebra/Algebra.hpp"
+#include "Helper.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using LCNS::Algebra::Matrix;
+using LCNS::Algebra::StorageOrder;
+using LCNS::Algebra::Vector;
+using LCNS::Algebra::VectorArray;
+using LCNS::Algebra::transform_directions;
+using LCNS::Algebra::transform_points;
+
+using FloatingTypes = std::tuple<float, double>;
+
+namespace
+{
+    template <Coordinate coordinate>
+    std::vector<Vector<coordinate, 3>> generate_random_vectors(size_t count)
+    {
+        std::mt19937                               gen(7);
+        std::uniform_real_distribution<coordinate> dis(-10.0, 10.0);
+
+        std::vector<Vector<coordinate, 3>> result(count);
+
+        for (auto& vec : result)
+        {
+            vec = Vector<coordinate, 3>(dis(gen), dis(gen), dis(gen));
+        }
+
+        return result;
+    }
+
+    template <Coordinate coordinate, StorageOrder order = StorageOrder::RowMajor>
+    Matrix<coordinate, 4, 4, order> affine_matrix()
+    {
+        // clang-format off
+        return Matrix<coordinate, 4, 4, order>({ 0.5, -1.0,  2.0,  3.0,
+                                                 1.5,  0.2, -0.7, -4.0,
+                                                -0.3,  0.8,  1.1, 10.0,
+                                                 0.0,  0.0,  0.0,  1.0});
+        // clang-format on
+    }
+
+    template <Coordinate coordinate>
+    Matrix<coordinate, 4, 4> projective_matrix()
+    {
+        // clang-format off
+        return Matrix<coordinate, 4, 4>({ 0.5, -1.0,  2.0,  3.0,
+                                          1.5,  0.2, -0.7, -4.0,
+                                         -0.3,  0.8,  1.1, 10.0,
+                                          0.0,  0.0, 0.01, 50.0});
+        // clang-format on
+    }
+
+    template <Coordinate coordinate, StorageOrder order>
+    Vector<coordinate, 3> expected_transform(const Matrix<coordinate, 4, 4, order>& matrix, const Vector<coordinate, 3>& vec, coordinate w)
+    {
+        const auto result = matrix * Vector<coordinate, 4>(vec.x(), vec.y(), vec.z(), w);
+        const auto scale  = w == coordinate{0} ? coordinate{1} : result.w();
+
+        return Vector<coordinate, 3>(result.x() / scale, result.y() / scale, result.z() / scale);
+    }
+
+    template <Coordinate coordinate>
+    void check_vectors(const std::vector<Vector<coordinate, 3>>& actual, const std::vector<Vector<coordinate, 3>>& expected)
+    {
+        REQUIRE(actual.size() == expected.size());
+
+        for (size_t i = 0; i < actual.size(); ++i)
+        {
+            for (unsigned int k = 0; k < 3; ++k)
+            {
+                CHECK(actual[i][k] == Catch::Approx(expected[i][k]).epsilon(LCNS::epsilonLowPrecision<coordinate>()).margin(1e-4));
+            }
+        }
+    }
+
+    // Odd counts exercise the scalar tail after the SIMD loop, the large one the multithreaded path
+    constexpr std::array<size_t, 4> counts = {0, 5, 301, (1 << 17) + 3};
+}  // namespace
+
+TEMPLATE_LIST_TEST_CASE("Transform points by an affine matrix", "[algebra][transform][points]", FloatingTypes)
+{
+    const auto matrix = affine_matrix<TestType>();
+
+    for (const auto count : counts)
+    {
+        const auto points = generate_random_vectors<TestType>(count);
+
+        std::vector<Vector<TestType, 3>> expected(count);
+        std::transform(points.begin(), points.end(), expected.begin(), [&](const auto& point) { return expected_transform(matrix, point, TestType{1}); });
+
+        std::vector<Vector<TestType, 3>> result(count);
+        transform_points(matrix, points, result);
+        check_vectors(result, expected);
+
+        auto in_place = points;
+        transform_points(matrix, in_place);
+        check_vectors(in_place, expected);
+
+        VectorArray<TestType, 3> array(points);
+        transform_points(matrix, array);
+        check_vectors(array.toVectors(), expected);
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Transform points by a projective matrix", "[algebra][transform][points]", FloatingTypes)
+{
+    const auto matrix = projective_matrix<TestType>();
+
+    for (const auto count : counts)
+    {
+        const auto points = generate_random_vectors<TestType>(count);
+
+        std::vector<Vector<TestType, 3>> expected(count);
+        std::transform(points.begin(), points.end(), expected.begin(), [&](const auto& point) { return expected_transform(matrix, point, TestType{1}); });
+
+        std::vector<Vector<TestType, 3>> result(count);
+        transform_points(matrix, points, result);
+        check_vectors(result, expected);
+
+        const VectorArray<TestType, 3> array(points);
+        VectorArray<TestType, 3>       array_result(count);
+        transform_points(matrix, array, array_result);
+        check_vectors(array_result.toVectors(), expected);
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Transform directions", "[algebra][transform][directions]", FloatingTypes)
+{
+    const auto matrix = affine_matrix<TestType, StorageOrder::ColumnMajor>();
+
+    for (const auto count : counts)
+    {
+        const auto directions = generate_random_vectors<TestType>(count);
+
+        std::vector<Vector<TestType, 3>> expected(count);
+        std::transform(directions.begin(), directions.end(), expected.begin(), [&](const auto& dir) { return expected_transform(matrix, dir, TestType{0}); });
+
+        std::vector<Vector<TestType, 3>> result(count);
+        transform_directions(matrix, directions, result);
+        check_vectors(result, expected);
+
+        VectorArray<TestType, 3> array(directions);
+        transform_directions(matrix, array);
+        check_vectors(array.toVectors(), expected);
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Transform by a 3x3 matrix", "[algebra][transform][points]", FloatingTypes)
+{
+    // clang-format off
+    const Matrix<TestType, 3, 3> matrix({ 0.0, -1.0, 0.0,
+                                          1.0,  0.0, 0.0,
+                                          0.0,  0.0, 2.0});
+    // clang-format on
+
+    for (const auto count : counts)
+    {
+        const auto points = generate_random_vectors<TestType>(count);
+
+        std::vector<Vector<TestType, 3>> expected(count);
+        std::transform(points.begin(), points.end(), expected.begin(), [&](const auto& point) { return matrix * point; });
+
+        std::vector<Vector<TestType, 3>> result(count);
+        transform_points(matrix, points, result);
+        check_vectors(result, expected);
+
+        VectorArray<TestType, 3> array(points);
+        transform_directions(matrix, array);
+        check_vectors(array.toVectors(), expected);
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Transform with a destination of a different size", "[algebra][transform][exception]", FloatingTypes)
+{
+    const auto matrix = affine_matrix<TestType>();
+
+    const std::vector<Vector<TestType, 3>> points(3);
+    std::vector<Vector<TestType, 3>>       result(2);
+
+    CHECK_THROWS_AS(transform_points(matrix, points, result), std::invalid_argument);
+
+    const VectorArray<TestType, 3> array(3);
+    VectorArray<TestType, 3>       array_result(4);
+
+    CHECK_THROWS_AS(transform_directions(matrix, array, array_result), std::invalid_argument);
+}
@@ -4,6 +4,7 @@
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
 
+using LCNS::Algebra::Precision;
 using LCNS::Algebra::Vector;
 
 using IntegerTypes  = std::tuple<short, int, long>;
@@ -766,7 +767,10 @@ TEMPLATE_LIST_TEST_CASE("Square length", "[algebra][vector][dim3][accessor]", Fl
 
     constexpr auto epsilon = std::numeric_limits<TestType>::epsilon() * 100;
 
-    static_assert(std::abs(vec.sqrLength() - 72365.41) < epsilon);
+    // Float lengths are rounded to float, hence a relative bound, while double keeps the absolute one
+    constexpr auto tolerance = std::is_same_v<TestType, float> ? epsilon * 72365.41 : epsilon;
+
+    static_assert(std::abs(vec.sqrLength() - 72365.41) < tolerance);
 
     const auto approxSqrLength = Catch::Approx(72365.41).epsilon(epsilon);
 
@@ -794,7 +798,7 @@ TEMPLATE_LIST_TEST_CASE("Length", "[algebra][vector][dim3][accessor]", FloatingT
 
     const Vector<TestType, 3> vec(x, y, z);
 
-    const auto approxLength = Catch::Approx(269.0004646836).epsilon(0.000000001);
+    const auto approxLength = Catch::Approx(269.0004646836).epsilon(std::is_same_v<TestType, float> ? 0.000001 : 0.000000001);
 
     CHECK(vec.length() == approxLength);
 }
@@ -827,6 +831,29 @@ TEMPLATE_LIST_TEST_CASE("Normalized", "[algebra][vector][dim3][accessor]", Float
     CHECK(normalized.length() == one);
 }
 
+TEMPLATE_LIST_TEST_CASE("Fast normalize", "[algebra][vector][dim3][accessor]", FloatingTypes)
+{
+    const TestType x = 69.0;
+    const TestType y = -260.0;
+    const TestType z = 1e-3;
+
+    const Vector<TestType, 3> vec(x, y, z);
+    const Vector<TestType, 3> exact = vec.normalized();
+    const Vector<TestType, 3> fast  = vec.normalized(Precision::Fast);
+
+    static_assert(std::is_same_v<decltype(vec.length()), TestType>);
+
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        CHECK(fast[i] == Catch::Approx(exact[i]).epsilon(1e-6));
+    }
+
+    Vector<TestType, 3> null;
+    null.normalize(Precision::Fast);
+
+    CHECK(null.isNull());
+}
+
 TEMPLATE_LIST_TEST_CASE("Is null?", "[algebra][vector][dim3][method]", IntegerTypes)
 {
     constexpr TestType x    = 3;
@@ -805,7 +805,10 @@ TEMPLATE_LIST_TEST_CASE("Square length", "[algebra][vector][dim4][accessor]", Fl
 
     constexpr auto epsilon = std::numeric_limits<TestType>::epsilon() * 100;
 
-    static_assert(std::abs(vec.sqrLength() - 72366.41) < epsilon);
+    // Float lengths are rounded to float, hence a relative bound, while double keeps the absolute one
+    constexpr auto tolerance = std::is_same_v<TestType, float> ? epsilon * 72366.41 : epsilon;
+
+    static_assert(std::abs(vec.sqrLength() - 72366.41) < tolerance);
 
     const auto approxSqrLength = Catch::Approx(72366.41).epsilon(epsilon);
 
@@ -835,7 +838,7 @@ TEMPLATE_LIST_TEST_CASE("Length", "[algebra][vector][dim4][accessor]", FloatingT
 
     const Vector<TestType, 4> vec(x, y, z, w);
 
-    const auto approxLength = Catch::Approx(269.0105553691).epsilon(0.000000001);
+    const auto approxLength = Catch::Approx(269.0105553691).epsilon(std::is_same_v<TestType, float> ? 0.000001 : 0.000000001);
 
     CHECK(vec.length() == approxLength);
 }
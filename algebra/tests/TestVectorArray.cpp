@@ -0,0 +1,197 @@
+#include "algebra/Algebra.hpp"
+#include "Helper.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <random>
+#include <vector>
+
+using LCNS::Algebra::Vector;
+using LCNS::Algebra::VectorArray;
+
+using FloatingTypes = std::tuple<float, double>;
+
+namespace
+{
+    template <Coordinate coordinate, unsigned int size>
+    std::vector<Vector<coordinate, size>> generate_random_vectors(size_t count)
+    {
+        std::mt19937                               gen(42);
+        std::uniform_real_distribution<coordinate> dis(-10.0, 10.0);
+
+        std::vector<Vector<coordinate, size>> result(count);
+
+        for (auto& vec : result)
+        {
+            for (unsigned int k = 0; k < size; ++k)
+            {
+                vec[k] = dis(gen);
+            }
+        }
+
+        return result;
+    }
+
+    // Odd counts exercise the scalar tail after the SIMD loop, the large one the multithreaded path
+    constexpr std::array<size_t, 3> counts = {0, 37, (1 << 17) + 5};
+}  // namespace
+
+TEMPLATE_LIST_TEST_CASE("Conversion from and to an array of structures", "[algebra][vectorarray][conversion]", FloatingTypes)
+{
+    for (const auto count : counts)
+    {
+        const auto vectors = generate_random_vectors<TestType, 4>(count);
+
+        const VectorArray<TestType, 4> array(vectors);
+
+        REQUIRE(array.count() == count);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            CHECK(array[i] == vectors[i]);
+            CHECK(array.x()[i] == vectors[i].x());
+            CHECK(array.w()[i] == vectors[i].w());
+        }
+
+        CHECK(array.toVectors() == vectors);
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Accessors", "[algebra][vectorarray][operator]", FloatingTypes)
+{
+    constexpr TestType x = 1.0;
+    constexpr TestType y = -2.0;
+    constexpr TestType z = 3.5;
+
+    VectorArray<TestType, 3> array(2);
+
+    CHECK(array[0] == Vector<TestType, 3>());
+
+    array.set(1, Vector<TestType, 3>(x, y, z));
+
+    CHECK(array[1] == Vector<TestType, 3>(x, y, z));
+    CHECK(array.lane(1)[1] == y);
+    CHECK_THROWS_AS(array[2], std::out_of_range);
+    CHECK_THROWS_AS(array.set(2, Vector<TestType, 3>()), std::out_of_range);
+    CHECK_THROWS_AS(array.lane(3), std::out_of_range);
+}
+
+TEMPLATE_LIST_TEST_CASE("Batched dot product", "[algebra][vectorarray][method]", FloatingTypes)
+{
+    for (const auto count : counts)
+    {
+        const auto lhs = generate_random_vectors<TestType, 3>(count);
+        const auto rhs = generate_random_vectors<TestType, 3>(count + 1);
+
+        const VectorArray<TestType, 3> lhs_array(lhs);
+        const VectorArray<TestType, 3> rhs_array{std::span(rhs).first(count)};
+
+        std::vector<TestType> result(count);
+        LCNS::Algebra::dot(lhs_array, rhs_array, std::span(result));
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            CHECK(result[i] == Catch::Approx(lhs[i] * rhs[i]).epsilon(LCNS::epsilonLowPrecision<TestType>()));
+        }
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Batched cross product", "[algebra][vectorarray][method]", FloatingTypes)
+{
+    for (const auto count : counts)
+    {
+        const auto lhs = generate_random_vectors<TestType, 3>(count);
+        const auto rhs = generate_random_vectors<TestType, 3>(count + 1);
+
+        VectorArray<TestType, 3>       lhs_array(lhs);
+        const VectorArray<TestType, 3> rhs_array{std::span(rhs).first(count)};
+
+        // In place, the result replaces lhs
+        LCNS::Algebra::cross(lhs_array, rhs_array, lhs_array);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const auto expected = lhs[i] ^ rhs[i];
+
+            for (unsigned int k = 0; k < 3; ++k)
+            {
+                CHECK(lhs_array[i][k] == Catch::Approx(expected[k]).epsilon(LCNS::epsilonLowPrecision<TestType>()).margin(1e-4));
+            }
+        }
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Batched addition and scaling", "[algebra][vectorarray][method]", FloatingTypes)
+{
+    constexpr TestType scalar = -2.5;
+
+    for (const auto count : counts)
+    {
+        const auto lhs = generate_random_vectors<TestType, 2>(count);
+        const auto rhs = generate_random_vectors<TestType, 2>(count + 1);
+
+        const VectorArray<TestType, 2> lhs_array(lhs);
+        const VectorArray<TestType, 2> rhs_array{std::span(rhs).first(count)};
+        VectorArray<TestType, 2>       result(count);
+
+        LCNS::Algebra::add(lhs_array, rhs_array, result);
+        LCNS::Algebra::scale(result, scalar, result);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            CHECK(result[i] == (lhs[i] + rhs[i]) * scalar);
+        }
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Batched length and normalization", "[algebra][vectorarray][method]", FloatingTypes)
+{
+    for (const auto count : counts)
+    {
+        auto vectors = generate_random_vectors<TestType, 4>(count);
+
+        if (count != 0)
+        {
+            vectors.back() = Vector<TestType, 4>();
+        }
+
+        VectorArray<TestType, 4> array(vectors);
+        VectorArray<TestType, 4> fast(vectors);
+
+        std::vector<TestType> sqr_lengths(count);
+        std::vector<TestType> lengths(count);
+        LCNS::Algebra::sqrLength(array, std::span(sqr_lengths));
+        LCNS::Algebra::length(array, std::span(lengths));
+        LCNS::Algebra::normalize(array);
+        LCNS::Algebra::normalize(fast, LCNS::Algebra::Precision::Fast);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            CHECK(sqr_lengths[i] == Catch::Approx(vectors[i].sqrLength()).epsilon(LCNS::epsilonLowPrecision<TestType>()));
+            CHECK(lengths[i] == Catch::Approx(vectors[i].length()).epsilon(LCNS::epsilonLowPrecision<TestType>()));
+
+            const auto expected = vectors[i].normalized();
+
+            for (unsigned int k = 0; k < 4; ++k)
+            {
+                CHECK(array[i][k] == Catch::Approx(expected[k]).epsilon(LCNS::epsilonLowPrecision<TestType>()));
+                CHECK(fast[i][k] == Catch::Approx(expected[k]).epsilon(LCNS::epsilonLowPrecision<TestType>()));
+            }
+        }
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Batched kernels with different counts", "[algebra][vectorarray][exception]", FloatingTypes)
+{
+    const VectorArray<TestType, 3> lhs(3);
+    VectorArray<TestType, 3>       rhs(4);
+    std::vector<TestType>          result(3);
+
+    CHECK_THROWS_AS(LCNS::Algebra::dot(lhs, rhs, std::span(result)), std::invalid_argument);
+    CHECK_THROWS_AS(LCNS::Algebra::cross(lhs, lhs, rhs), std::invalid_argument);
+    CHECK_THROWS_AS(LCNS::Algebra::add(lhs, rhs, rhs), std::invalid_argument);
+    CHECK_THROWS_AS(LCNS::Algebra::scale(lhs, TestType{2}, rhs), std::invalid_argument);
+    CHECK_THROWS_AS(LCNS::Algebra::length(rhs, std::span(result)), std::invalid_argument);
+}
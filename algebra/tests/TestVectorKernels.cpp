@@ -0,0 +1,237 @@
+#include "algebra/VectorKernels.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <span>
+#include <vector>
+
+using FloatingTypes = std::tuple<float, double>;
+
+namespace
+{
+    template <typename T>
+    std::vector<T> random_vector(size_t size, unsigned int seed)
+    {
+        std::mt19937                      generator(seed);
+        std::uniform_real_distribution<T> distribution(-1, 1);
+
+        std::vector<T> result(size);
+
+        for (T& value : result)
+        {
+            value = distribution(generator);
+        }
+
+        return result;
+    }
+
+    // Lengths covering the SIMD tails and the split between threads
+    constexpr size_t lengths[] = { 0, 1, 7, 33, 1000, (size_t{1} << 18) + 37 };
+}  // namespace
+
+TEMPLATE_LIST_TEST_CASE("Level 1 vector kernels", "[algebra][vector][kernels]", FloatingTypes)
+{
+    using LCNS::Algebra::asum;
+    using LCNS::Algebra::axpy;
+    using LCNS::Algebra::copy;
+    using LCNS::Algebra::dot;
+    using LCNS::Algebra::gemv;
+    using LCNS::Algebra::iamax;
+    using LCNS::Algebra::nrm2;
+    using LCNS::Algebra::scal;
+
+    using const_span = std::span<const TestType>;
+
+    const double tolerance = 100 * std::numeric_limits<TestType>::epsilon();
+
+    SECTION("Against scalar loops")
+    {
+        for (const size_t length : lengths)
+        {
+            const std::vector<TestType> x = random_vector<TestType>(length, 1);
+            const std::vector<TestType> y = random_vector<TestType>(length, 2);
+
+            double expected_dot  = 0;
+            double expected_asum = 0;
+            size_t expected_max  = length;
+            double largest       = -1;
+
+            for (size_t i = 0; i < length; ++i)
+            {
+                expected_dot += static_cast<double>(x[i]) * y[i];
+                expected_asum += std::abs(static_cast<double>(x[i]));
+
+                if (std::abs(x[i]) > largest)
+                {
+                    largest      = std::abs(x[i]);
+                    expected_max = i;
+                }
+            }
+
+            // The errors of the sums grow with the square root of the length for random signs
+            const double margin = tolerance * std::sqrt(static_cast<double>(length) + 1);
+
+            CHECK(dot(const_span(x), const_span(y)) == Catch::Approx(expected_dot).margin(margin));
+            CHECK(asum(const_span(x)) == Catch::Approx(expected_asum).epsilon(tolerance));
+            CHECK(nrm2(const_span(x)) == Catch::Approx(std::sqrt(static_cast<double>(dot(const_span(x), const_span(x))))).epsilon(tolerance));
+            CHECK(iamax(const_span(x)) == expected_max);
+
+            // Same result whatever the threads, the parts of the reductions being fixed
+            CHECK(dot(const_span(x), const_span(y)) == dot(const_span(x), const_span(y)));
+
+            std::vector<TestType> result = y;
+            axpy(TestType{-3}, const_span(x), std::span<TestType>(result));
+
+            for (size_t i = 0; i < length; ++i)
+            {
+                REQUIRE(result[i] == Catch::Approx(TestType{-3} * x[i] + y[i]).margin(tolerance));
+            }
+
+            scal(TestType{0.5}, std::span<TestType>(result));
+
+            for (size_t i = 0; i < length; ++i)
+            {
+                REQUIRE(result[i] == Catch::Approx((TestType{-3} * x[i] + y[i]) / 2).margin(tolerance));
+            }
+
+            copy(const_span(x), std::span<TestType>(result));
+            CHECK(result == x);
+
+            std::vector<TestType> other = y;
+            LCNS::Algebra::swap(std::span<TestType>(result), std::span<TestType>(other));
+            CHECK(result == y);
+            CHECK(other == x);
+        }
+    }
+
+    SECTION("Norm without overflow nor underflow")
+    {
+        constexpr TestType large = std::sqrt(std::numeric_limits<TestType>::max()) * 4;
+        constexpr TestType small = std::sqrt(std::numeric_limits<TestType>::min()) / 4;
+
+        for (const size_t length : { size_t{3}, size_t{100}, (size_t{1} << 18) + 5 })
+        {
+            const double root = std::sqrt(static_cast<double>(length));
+
+            std::vector<TestType> x(length, large);
+            CHECK(nrm2(const_span(x)) == Catch::Approx(large * root).epsilon(tolerance));
+
+            x.assign(length, small);
+            CHECK(nrm2(const_span(x)) == Catch::Approx(small * root).epsilon(tolerance));
+
+            x.back() = std::numeric_limits<TestType>::infinity();
+            CHECK(nrm2(const_span(x)) == std::numeric_limits<TestType>::infinity());
+
+            x.back() = std::numeric_limits<TestType>::quiet_NaN();
+            CHECK(std::isnan(nrm2(const_span(x))));
+        }
+
+        CHECK(nrm2(const_span()) == 0);
+        CHECK(nrm2(const_span(std::vector<TestType>(10))) == 0);
+    }
+
+    SECTION("Index of the largest magnitude")
+    {
+        std::vector<TestType> x = random_vector<TestType>((size_t{1} << 18) + 100, 3);
+
+        // First of equal magnitudes, whatever their signs and the part of the vector holding them
+        x[5000]   = -2;
+        x[200000] = 2;
+        x[250000] = -2;
+        CHECK(iamax(const_span(x)) == 5000);
+        CHECK(iamax(const_span(x).subspan(5001)) == 200000 - 5001);
+
+        x[100] = std::numeric_limits<TestType>::quiet_NaN();
+        CHECK(iamax(const_span(x)) == 5000);
+
+        CHECK(iamax(const_span()) == 0);
+        CHECK(iamax(const_span(std::vector<TestType>(3, std::numeric_limits<TestType>::quiet_NaN()))) == 3);
+    }
+
+    SECTION("Matrix vector product")
+    {
+        // Shapes covering the blocks of rows and columns, a leading dimension larger than the number of columns, and
+        // the split between threads
+        struct Shape
+        {
+            size_t rows;
+            size_t cols;
+            size_t lda;
+        };
+
+        for (const Shape shape : { Shape{ 0, 5, 5 }, Shape{ 5, 0, 0 }, Shape{ 1, 1, 1 }, Shape{ 7, 3, 5 }, Shape{ 37, 70, 75 },
+                                   Shape{ 3, 2100, 2100 }, Shape{ 700, 600, 601 } })
+        {
+            const std::vector<TestType> a = random_vector<TestType>(shape.rows * shape.lda, 4);
+
+            for (const bool transpose : { false, true })
+            {
+                const size_t x_size = transpose ? shape.rows : shape.cols;
+                const size_t y_size = transpose ? shape.cols : shape.rows;
+
+                const std::vector<TestType> x = random_vector<TestType>(x_size, 5);
+                const std::vector<TestType> y = random_vector<TestType>(y_size, 6);
+
+                for (const TestType beta : { TestType{0}, TestType{1}, TestType{-0.5} })
+                {
+                    std::vector<TestType> result = y;
+
+                    // Not read when beta is zero
+                    if (beta == 0 && y_size > 0)
+                    {
+                        result[0] = std::numeric_limits<TestType>::quiet_NaN();
+                    }
+
+                    gemv(transpose, shape.rows, shape.cols, TestType{2}, const_span(a), shape.lda, const_span(x), beta, std::span<TestType>(result));
+
+                    for (size_t k = 0; k < y_size; ++k)
+                    {
+                        double expected = 0;
+                        double bound    = 0;
+
+                        for (size_t l = 0; l < x_size; ++l)
+                        {
+                            const double coefficient = transpose ? a[l * shape.lda + k] : a[k * shape.lda + l];
+
+                            expected += coefficient * x[l];
+                            bound += std::abs(coefficient * x[l]);
+                        }
+
+                        expected = 2 * expected + beta * static_cast<double>(y[k]);
+
+                        REQUIRE(result[k] == Catch::Approx(expected).margin(tolerance * (2 * bound + 1)));
+                    }
+                }
+            }
+        }
+    }
+
+    SECTION("Different sizes")
+    {
+        std::vector<TestType> x(10);
+        std::vector<TestType> y(11);
+
+        CHECK_THROWS_AS(axpy(TestType{1}, const_span(x), std::span<TestType>(y)), std::invalid_argument);
+        CHECK_THROWS_AS(dot(const_span(x), const_span(y)), std::invalid_argument);
+        CHECK_THROWS_AS(copy(const_span(x), std::span<TestType>(y)), std::invalid_argument);
+        CHECK_THROWS_AS(LCNS::Algebra::swap(std::span<TestType>(x), std::span<TestType>(y)), std::invalid_argument);
+
+        // 2 x 5 matrix
+        CHECK_NOTHROW(gemv(false, 2, 5, TestType{1}, const_span(x), 5, const_span(x).first(5), TestType{0}, std::span<TestType>(y).first(2)));
+        CHECK_NOTHROW(gemv(true, 2, 5, TestType{1}, const_span(x), 5, const_span(x).first(2), TestType{0}, std::span<TestType>(y).first(5)));
+        CHECK_THROWS_AS(gemv(false, 2, 5, TestType{1}, const_span(x), 5, const_span(x).first(4), TestType{0}, std::span<TestType>(y).first(2)),
+                        std::invalid_argument);
+        CHECK_THROWS_AS(gemv(true, 2, 5, TestType{1}, const_span(x), 5, const_span(x).first(2), TestType{0}, std::span<TestType>(y).first(2)),
+                        std::invalid_argument);
+        CHECK_THROWS_AS(gemv(false, 2, 5, TestType{1}, const_span(x), 4, const_span(x).first(5), TestType{0}, std::span<TestType>(y).first(2)),
+                        std::invalid_argument);
+        CHECK_THROWS_AS(
+        gemv(false, 2, 5, TestType{1}, const_span(x).first(9), 5, const_span(x).first(5), TestType{0}, std::span<TestType>(y).first(2)),
+        std::invalid_argument);
+    }
+}